@@ -39,6 +39,8 @@ class FlapFile {
     // public functions
     bool available();                                                           // check ich filesystem is available
     bool saveFile(const char* filename, JsonDocument& doc);                     // store a file
+    void composeFile(const char* filename, JsonDocument& dataDoc, JsonDocument& finalDoc); // prepend _meta
+    bool writeFile(const char* filename, JsonDocument& finalDoc);               // store composed document
     bool readFile(const char* filename, JsonDocument& doc);                     // read a file
 
     // ----------------------------
@@ -27,6 +27,7 @@
 */
 #include <Arduino.h>
 #include <map>
+#include <vector>
 #include <FlapGlobal.h>
 #include "TracePrint.h"
 #include <cstdint>
@@ -44,6 +45,14 @@ struct I2CSlaveDevice {
     bool           bootFlag;                                                    // bootFlag of device
 };
 
+// One flap of a display frame
+struct FlapFrameEntry {
+    I2Caddress address;                                                         // device to move
+    int        targetFlap;                                                      // flap to be shown
+};
+
+#define FRAME_LOCK_WAIT_MS (20)                                                 // wait for a running twin command, else twin queue is used
+
 // ----------------------------
 extern std::map<I2Caddress, I2CSlaveDevice*> g_slaveRegistry;
 
@@ -102,6 +111,9 @@ class FlapRegistry {
     // API to twins
     bool sendToIndex(int idx, const TwinCommand& cmd) const;                    // sent to TwinQueue n
     void sendToAll(const TwinCommand& cmd) const;                               // send to all TwinQueues
+    int  showFrame(const std::vector<FlapFrameEntry>& frame) const;             // move all flaps in one bus round, returns confirmed moves
+    bool postFrame(const std::vector<FlapFrameEntry>& frame);                   // hand frame to the Frame task, returns at once
+    bool takeFrame(std::vector<FlapFrameEntry>& frame);                         // newest posted frame (Frame task)
 
     template <typename Fn>
     inline void forEachRegisteredIdx(Fn&& fn) const {                           // loop all registered devices
@@ -131,5 +143,9 @@ class FlapRegistry {
     I2Caddress findFreeAddress(I2Caddress minAddr, I2Caddress maxAddr);         // free address from register
 
     void printStepsByFlapLines(I2Caddress address, int* steps, int flaps, int perLine = 10);
+
+    // frame mailbox of the Frame task, guarded by g_registryMutex
+    std::vector<FlapFrameEntry> _pendingFrame;                                  // newest frame not started yet
+    bool                        _framePending = false;
 };
 #endif                                                                          // FlapRegistry_h
@@ -43,7 +43,6 @@ constexpr int W_OG    = 3;
 constexpr int W_G     = 3;                                                      // goals 0..999 (3-stellig, z.B. 122)
 
 // globar routines for JSON Format
-void   sendStatusHtmlStream(const char* filename);
 String formatIsoTime(time_t t);
 String getIsoTimestamp();
 
@@ -93,6 +92,8 @@ class FlapReporting {
     const char* selectSparklineLevel(int value, int minVal, int maxVal);        // helper to select sparkling
     void        printBar(uint32_t value, float scale, const char* symbol, uint8_t maxLength); // print bar with value
     void        printI2CHistory();                                              // print I2C history
+    void        printI2CLatency();                                              // print I2C latency percentiles
+    void        printLatencyRow(const char* label, const LatencyHistogram& h);  // one percentile row
     void        printUptime();                                                  // Helper to report up time
     static void printTableRow(const LigaRow& r);                                // Bundesliga table row
     static void renderLigaTable(const LigaSnapshot& s);                         // build Bundesliga tabel trace
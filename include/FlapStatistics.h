@@ -12,12 +12,64 @@
 //
 
 #include <Arduino.h>
+#include <atomic>
+#include <FlapGlobal.h>
 
 #ifndef FlapStatistics_h
     #define FlapStatistics_h
 
     // global defined statistic counters and history
     #define HISTORY_SIZE 10                                                     // i2c statistics history length in minutes
+    #define STAT_SHARDS portNUM_PROCESSORS                                      // one counter shard per core
+
+    // I2C latency histograms (log2 buckets in µs)
+    #define LATENCY_BUCKETS 12                                                  // bucket 0: < 128 µs, bucket n: < 128 µs * 2^n, last: open end
+    #define LATENCY_FIRST_BUCKET_US 128                                         // upper bound of bucket 0
+    #define LATENCY_ADDRESSES (numberOfTwins + 2)                               // address pool + base address + spare
+
+// kind of I2C transaction
+enum I2CLatencyType : uint8_t {
+    LAT_LONG,                                                                   // LongMessage (move, calibrate, ...)
+    LAT_MID,                                                                    // MidMessage (address handling)
+    LAT_SHORT,                                                                  // ShortMessage with answer
+    LAT_PROBE,                                                                  // ARE_YOU_READY
+    LAT_TYPES
+};
+
+// latency histogram with percentile estimate
+struct LatencyHistogram {
+    uint32_t bucket[LATENCY_BUCKETS];                                           // transactions per bucket
+    uint32_t count;                                                             // all transactions
+    uint32_t maxUs;                                                             // slowest transaction
+
+    void     clear();
+    void     add(uint32_t us);
+    void     merge(const LatencyHistogram& other);
+    uint32_t percentile(uint8_t p) const;                                       // µs, interpolated inside bucket
+
+    static uint8_t bucketOf(uint32_t us);                                       // log2 bucket of a latency
+};
+
+// latency histogram counted lock-free from the I2C path, copied to LatencyHistogram for reporting
+struct AtomicLatencyHistogram {
+    std::atomic<uint32_t> bucket[LATENCY_BUCKETS];                              // transactions per bucket (count = sum)
+    std::atomic<uint32_t> maxUs;                                                // slowest transaction
+
+    void clear();
+    void add(uint32_t us);
+    void copyTo(LatencyHistogram& out) const;
+};
+
+// I2C counters of one core
+// a task may change the core between xPortGetCoreID() and the add, so the counters stay atomic;
+// the shard only keeps both cores from fighting for the same word; one cache line per shard,
+// else both cores' counters would share a line
+struct alignas(64) StatShard {
+    std::atomic<uint32_t> access;                                               // number of i2c accesses
+    std::atomic<uint32_t> sentData;                                             // data bytes send by master
+    std::atomic<uint32_t> readData;                                             // data bytes read by master
+    std::atomic<uint32_t> timeOut;                                              // timeouts
+};
 
 class FlapStatistics {
    public:
@@ -25,20 +77,31 @@ class FlapStatistics {
     FlapStatistics();
 
     // ----------------------------
-    void makeHistory();                                                         // transfer actual conter to history
-    void increment(uint32_t access = 0, uint32_t sentData = 0, uint32_t readData = 0, uint32_t timeOut = 0); // count
+    void makeHistory();                                                         // sum up shards into history, start next cycle
+    void updateCurrentCycle();                                                  // sum up shards into history of running cycle
+    void increment(uint32_t access = 0, uint32_t sentData = 0, uint32_t readData = 0, uint32_t timeOut = 0); // count, lock-free
+    void recordLatency(I2Caddress address, I2CLatencyType type, uint32_t us);   // bus time of one transaction, lock-free
+    void recordMutexWait(uint32_t us);                                          // wait for g_i2c_mutex, lock-free
+
+    // copies for reporting
+    bool latencyBySlot(int slot, I2Caddress& address, LatencyHistogram out[LAT_TYPES]); // false = slot unused
+    void latencyByType(LatencyHistogram out[LAT_TYPES]);                        // all addresses merged
+    void mutexWait(LatencyHistogram& out);
 
     uint32_t _accessHistory[HISTORY_SIZE];                                      // history for number of i2c accesses
     uint32_t _dataHistory[HISTORY_SIZE];                                        // history for data bytes send by master via i2c
     uint32_t _readHistory[HISTORY_SIZE];                                        // history for data bytes read by master via i2c
     uint32_t _timeoutHistory[HISTORY_SIZE];                                     // history for timeouts via i2c
     uint8_t  _historyIndex;                                                     // index for histroy
-    uint32_t _busAccessCounter;                                                 // counter for I2C accesses
-    uint32_t _busDataCounter;                                                   // counter for I2C written data
-    uint32_t _busReadCounter;                                                   // counter for I2C read data
-    uint32_t _busTimeoutCounter;                                                // counter for I2C timeouts
 
    private:
-    SemaphoreHandle_t _statsMutex = nullptr;                                    // semaphore to protect statistics access
+    void sumShards(uint32_t& access, uint32_t& sentData, uint32_t& readData, uint32_t& timeOut, bool reset);
+
+    SemaphoreHandle_t _statsMutex = nullptr;                                    // protects history, only taken by statistic and reporting
+
+    StatShard              _shard[STAT_SHARDS];                                 // counters of running cycle per core
+    std::atomic<uint32_t>  _latencyAddress[LATENCY_ADDRESSES];                  // address of slot, 0 = unused
+    AtomicLatencyHistogram _latency[LATENCY_ADDRESSES][LAT_TYPES];              // per address and message type
+    AtomicLatencyHistogram _mutexWait;                                          // g_i2c_mutex wait time
 };
 #endif                                                                          // FlapStatistics_h
@@ -19,7 +19,7 @@
 #define FlapTasks_h
 
 #include <FlapGlobal.h>
-#include <WebServer.h>
+#include <ESPAsyncWebServer.h>
 #include "FlapFile.h"
 #include "Liga.h"
 #include "cert.all"
@@ -32,21 +32,29 @@
 // Task Priorites
 #define PRIO_LIGA 6                                                             // Liga task
 #define PRIO_TWIN 5                                                             // Twin Tasks 0-n
+#define PRIO_READY_POLL 5                                                       // shared ARE_YOU_READY scheduler
 #define PRIO_REGISTRY 4                                                         // Registry Task
 #define PRIO_REPORT 3                                                           // Reportimg Task
 #define PRIO_WEB_SERVER 2                                                       // Web Server task
 #define PRIO_REMOTE 2                                                           // Remote Control Task
 #define PRIO_PARSER 3                                                           // Remote Parser Task
 #define PRIO_STATISTICS 1                                                       // Statistics Task
+#define PRIO_TRACE 1                                                            // TraceLog Task (writes trace ring to Serial)
+#define PRIO_PUSH 3                                                             // LivePush Task (SSE events, above web server)
+#define PRIO_FRAME 3                                                            // Frame Task (display frames of the Parser)
 
 // Task Stack sizes
 #define STACK_WEB_SERVER 5 * 1024                                               // Web Server Task (20kB)
 #define STACK_LIGA 5.5 * 1024                                                   // Liga Task (22kB)
 #define STACK_TWIN 2 * 1024                                                     // Twin Tasks 0-n (2 kB per Task, in bytes; 1.5k reichte ohne REGISTRYVERBOSE knapp)
+#define STACK_READY_POLL 3 * 1024                                               // ARE_YOU_READY scheduler Task (SPIFFS access of MoveModel)
 #define STACK_REGISTRY 2 * 1024                                                 // Registry Task (8 kB)
 #define STACK_REPORT 8 * 1024                                                   // Reporting Task (32 kB)
 #define STACK_REMOTE 2 * 1024                                                   // Remote Control Task (8 kB)
 #define STACK_PARSER 2 * 1024                                                   // Remote Parser Task (8 kB)
+#define STACK_TRACE 3 * 1024                                                    // TraceLog Task (record copy + printf line)
+#define STACK_PUSH 3 * 1024                                                     // LivePush Task (event JSON)
+#define STACK_FRAME 3 * 1024                                                    // Frame Task (frame vectors, ready tickets)
 
 #ifdef STATISTICVERBOSE
     #define STACK_STATISTICS 2 * 1024                                           // Statistics Task
@@ -62,9 +70,11 @@
 #define AVAILABILITY_CHECK_COUNTDOWN (1000UL * (8UL * 60UL + 7UL))              // 8:07 minutes 7 seconds
 #define FAST_AVAI_COUNTDOWN 1000UL * 1UL                                        // 1 second
 #define BOOT_WINDOW 1000UL * 30UL                                               // 30 seconds duration of fast mode
+#define WEB_TIME_SYNC_CHECK_MS 1000UL * 60UL                                    // Flap Server task checks time-sync every minute
 
 // Global Web Server
-extern WebServer server;
+extern AsyncWebServer         server;
+extern AtomicLatencyHistogram g_webLatency;                                     // handler time of web requests
 
 // Global variables for RTOS task handles https://www.freertos.org/a00019.html#xTaskHandle
 extern TaskHandle_t g_remoteControlHandle;                                      // RTOS Task Handler
@@ -76,6 +86,10 @@ extern TaskHandle_t g_availCheckHandle;
 extern TaskHandle_t g_reportHandle;                                             // RTOS Task Handler
 extern TaskHandle_t g_statisticHandle;                                          // RTOS Task Handler
 extern TaskHandle_t g_twinHandle[numberOfTwins];                                // RTOS Task Handler
+extern TaskHandle_t g_readyPollHandle;                                          // RTOS Task Handler
+extern TaskHandle_t g_traceLogHandle;                                           // RTOS Task Handler
+extern TaskHandle_t g_livePushHandle;                                           // RTOS Task Handler
+extern TaskHandle_t g_frameHandle;                                              // RTOS Task Handler (display frames, off the Parser)
 
 // Global variables for RTOS Queue handles
 extern QueueHandle_t g_reportQueue;                                             // Queue for Report Task to receive remote control keys
@@ -102,6 +116,9 @@ extern void ligaScanCallback(TimerHandle_t xTimer);
 // Availability worker task (does availabilityCheck/registerUnregistered/repair off the timer daemon)
 extern void availCheckTask(void* pvParameters);
 
+// Frame worker task (runs showFrame off the Parser, which only posts the frame)
+extern void frameTask(void* pvParameters);
+
 // Global Scan modes
 enum scanModes { SCAN_FAST, SCAN_SHORT, SCAN_LONG, NO_SCAN };
 extern scanModes g_scanMode;                                                    // registry scan mode
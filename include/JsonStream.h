@@ -0,0 +1,200 @@
+// #################################################################################################################
+//
+//       ██ ███████  ██████  ███    ██     ███████ ████████ ██████  ███████  █████  ███    ███
+//       ██ ██      ██    ██ ████   ██     ██         ██    ██   ██ ██      ██   ██ ████  ████
+//       ██ ███████ ██    ██ ██ ██  ██     ███████    ██    ██████  █████   ███████ ██ ████ ██
+//  ██   ██      ██ ██    ██ ██  ██ ██          ██    ██    ██   ██ ██      ██   ██ ██  ██  ██
+//   █████  ███████  ██████  ██   ████     ███████    ██    ██   ██ ███████ ██   ██ ██      ██
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Json%20Stream
+//
+/*
+
+    Incremental JSON parser for chunked HTTP bodies (openLigaDB)
+
+    The parser is fed with every HTTP_EVENT_ON_DATA chunk as it arrives and reports
+    each scalar value together with its path. The body is never stored: memory is
+    bounded by JSON_STREAM_MAX_DEPTH keys and one value of JSON_STREAM_VALUE_LEN.
+
+    Path syntax for at():   ""                  root value
+                            "groupOrderID"      member of root object
+                            "[].teamName"       member of any element of root array
+                            "goals[].scoreTeam1"
+
+    Typed decoding:         a decoder declares its fields once as a constexpr table of
+                            JsonField (path hash, member offset, member size). Every value
+                            is matched by one 32-bit compare against the running path hash
+                            instead of comparing key strings level by level.
+
+*/
+#ifndef JsonStream_h
+#define JsonStream_h
+
+#include <Arduino.h>
+#include <stddef.h>
+#include <type_traits>
+
+#define JSON_STREAM_MAX_DEPTH 8                                                 // nesting of objects and arrays
+#define JSON_STREAM_KEY_LEN 24                                                  // longest key (openLigaDB: "lastUpdateDateTime")
+#define JSON_STREAM_VALUE_LEN 128                                               // longer values are truncated
+
+enum JsonStreamEvent {
+    JSON_VALUE,                                                                 // string, number, true, false, null
+    JSON_OBJECT_BEGIN,                                                          // path is the position of the object
+    JSON_OBJECT_END,
+    JSON_ARRAY_BEGIN,                                                           // path is the position of the array
+    JSON_ARRAY_END
+};
+
+// ---- path hash (FNV-1a), identical at compile time and while parsing ----
+static constexpr uint32_t JSON_PATH_ROOT = 2166136261u;                         // hash of path "" (root value)
+
+constexpr uint32_t jsonPathStep(uint32_t hash, char c) {
+    return (hash ^ (uint8_t)c) * 16777619u;
+}
+
+/**
+ * @brief hash of a path in at() syntax, members of the root object get a leading '.'
+ *
+ * @param path e.g. "[].team1.teamName" or "goals[].goalID"
+ * @return uint32_t same value as JsonStream::pathHash() while the parser is at this path
+ */
+constexpr uint32_t jsonPath(const char* path) {
+    uint32_t hash = JSON_PATH_ROOT;
+    if (*path && *path != '[')
+        hash = jsonPathStep(hash, '.');                                         // "groupOrderID" == ".groupOrderID"
+    for (; *path; path++)
+        hash = jsonPathStep(hash, *path);
+    return hash;
+}
+
+class JsonStream;
+typedef void (*JsonStreamHandler)(JsonStream& json, JsonStreamEvent event, void* context);
+
+class JsonStream {
+   public:
+    void begin(JsonStreamHandler handler, void* context = nullptr);             // reset parser for a new body
+    bool feed(const char* data, size_t len);                                    // parse next chunk, false on syntax error
+    bool finish();                                                              // end of body, true if one complete value was parsed
+
+    // path of current event
+    bool        at(const char* path) const;                                     // compare path, "[]" matches every index
+    uint8_t     depth() const { return _depth; }
+    int         index(uint8_t level = 0) const;                                 // array index at level, -1 if no array
+    const char* key() const;                                                    // member name of current value, "" in arrays
+    uint32_t    pathHash() const { return _depth ? _levels[_depth - 1].hash : JSON_PATH_ROOT; } // == jsonPath(path)
+
+    // value of JSON_VALUE event
+    const char* text() const { return _value; }                                 // string content or literal text
+    bool        isString() const { return _isString; }
+    bool        isNull() const { return !_isString && strcmp(_value, "null") == 0; }
+    bool        isTruncated() const { return _truncated; }
+    long        asLong() const { return _isString ? 0 : strtol(_value, nullptr, 10); }
+    bool        asBool() const { return !_isString && strcmp(_value, "true") == 0; }
+    void        copyTo(char* target, size_t size) const;                        // copy string, "" for null
+
+    // statistics
+    size_t bytes() const { return _bytes; }                                     // bytes fed since begin()
+    bool   failed() const { return _state == ERROR; }
+    static constexpr size_t footprint() { return sizeof(JsonStream); }          // RAM used for any body size
+
+   private:
+    enum State : uint8_t {
+        VALUE,                                                                  // expect a value
+        FIRST_VALUE,                                                            // after '[': value or ']'
+        KEY,                                                                    // after ',' in object: key string
+        FIRST_KEY,                                                              // after '{': key string or '}'
+        COLON,                                                                  // after key
+        NEXT,                                                                   // after value: ',' or closing bracket
+        STRING,                                                                 // inside string
+        ESCAPE,                                                                 // after backslash
+        UNICODE,                                                                // inside \uXXXX
+        LITERAL,                                                                // number, true, false, null
+        DONE,                                                                   // root value complete
+        ERROR
+    };
+
+    struct Level {
+        bool     isArray;                                                       // array or object
+        int16_t  index;                                                         // current element in array
+        uint32_t base;                                                          // path hash of this container
+        uint32_t hash;                                                          // path hash including key or "[]"
+        char     key[JSON_STREAM_KEY_LEN];                                      // current member in object
+    };
+
+    bool parse(char c);                                                         // state machine for one character
+    bool open(bool isArray);                                                    // '{' or '['
+    bool close(bool isArray);                                                   // '}' or ']'
+    void valueDone();                                                           // report value, expect ',' or end
+    void append(char c);                                                        // to key or value buffer
+    void appendCodepoint(uint32_t cp);                                          // \uXXXX as UTF-8
+
+    JsonStreamHandler _handler   = nullptr;
+    void*             _context   = nullptr;
+    State             _state     = DONE;
+    uint8_t           _depth     = 0;
+    bool              _isKey     = false;                                       // string is a member name
+    bool              _isString  = false;                                       // value is a string
+    bool              _truncated = false;
+    uint8_t           _hexCount  = 0;
+    uint16_t          _hex       = 0;
+    uint16_t          _surrogate = 0;                                           // high surrogate of 😀 pair
+    size_t            _len       = 0;                                           // length in key or value buffer
+    size_t            _bytes     = 0;
+    Level             _levels[JSON_STREAM_MAX_DEPTH];
+    char              _value[JSON_STREAM_VALUE_LEN];
+};
+
+// ----------------------------
+// typed decoding into plain structs
+
+enum JsonFieldType : uint8_t {
+    JSON_FIELD_INT,                                                             // integral member of 1, 2 or 4 bytes
+    JSON_FIELD_BOOL,                                                            // bool member
+    JSON_FIELD_TEXT                                                             // char array member, truncated, "" for null
+};
+
+struct JsonField {
+    uint32_t      path;                                                         // jsonPath() of value
+    JsonFieldType type;
+    uint16_t      offset;                                                       // offsetof(Record, member)
+    uint16_t      size;                                                         // sizeof(member)
+};
+
+template <typename T>
+constexpr JsonFieldType jsonFieldType() {
+    static_assert(std::is_same<T, bool>::value || (std::is_integral<T>::value && sizeof(T) <= 4) ||
+                      (std::is_array<T>::value && std::is_same<typename std::remove_extent<T>::type, char>::value),
+                  "JsonField: member must be bool, integer up to 32 bit or char array");
+    return std::is_same<T, bool>::value ? JSON_FIELD_BOOL : (std::is_array<T>::value ? JSON_FIELD_TEXT : JSON_FIELD_INT);
+}
+
+// field table entry: value at path goes into Record::member, type follows the member
+#define JSON_FIELD(path, Record, member)                                                                                     \
+    JsonField {                                                                                                              \
+        jsonPath(path), jsonFieldType<decltype(Record::member)>(), (uint16_t)offsetof(Record, member),                       \
+            (uint16_t)sizeof(Record::member)                                                                                 \
+    }
+
+bool jsonStore(const JsonStream& json, const JsonField& field, void* record);   // write current value into record
+
+/**
+ * @brief write current JSON_VALUE into the matching field of a record
+ *
+ * Decoder is a struct with "typedef ... Record" and "static constexpr JsonField fields[]".
+ *
+ * @return true value belongs to a declared field and was stored
+ */
+template <typename Decoder>
+bool jsonDecode(const JsonStream& json, typename Decoder::Record& record) {
+    const uint32_t path = json.pathHash();
+    for (const JsonField& field : Decoder::fields) {
+        if (field.path == path)
+            return jsonStore(json, field, &record);
+    }
+    return false;                                                               // not declared: skipped
+}
+
+#endif // JsonStream_h
@@ -0,0 +1,152 @@
+// #################################################################################################################
+//
+//  ██      ███████  █████   ██████  ██    ██ ███████     ███████  ██████ ██   ██ ███████ ██████  ██    ██ ██      ███████ ██████
+//  ██      ██      ██   ██ ██       ██    ██ ██          ██      ██      ██   ██ ██      ██   ██ ██    ██ ██      ██      ██   ██
+//  ██      █████   ███████ ██   ███ ██    ██ █████       ███████ ██      ███████ █████   ██   ██ ██    ██ ██      █████   ██████
+//  ██      ██      ██   ██ ██    ██ ██    ██ ██               ██ ██      ██   ██ ██      ██   ██ ██    ██ ██      ██      ██   ██
+//  ███████ ███████ ██   ██  ██████   ██████  ███████     ███████  ██████ ██   ██ ███████ ██████   ██████  ███████ ███████ ██   ██
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=League%20Scheduler
+//
+//
+/*
+
+    Tracking of all leagues at once in the Liga task
+
+    The poll machinery of the Liga task works on globals (ligaMatchday, liveMatches,
+    goalsInfos, poll mode, ...). LeagueScheduler keeps one LeagueState per league and
+    swaps the state of the league it polls next into these globals (std::swap, no copy
+    of strings), so the poll code stays single-league and every league stays warm:
+
+    - every tracked league has its own PollScheduler and a due time (its earliest deadline);
+      the league due first runs its next poll cycle, the shown league wins a tie, so the
+      waits of BL1, BL2 and BL3 overlap instead of adding up
+    - all leagues share the request budget of openLigaDB.pacer(); a league not shown
+      starts its cycle only while the budget holds LIGA_SHOWN_RESERVE requests for the
+      shown league, else it is postponed until it does; the shown league is never postponed
+    - tables have one LigaSnapshotStore per league, conditional GETs one cache group
+    - between cycles the shown league is loaded; while another league is loaded the
+      Liga task holds the view lock, reports of the league globals skip that moment
+
+    toggleLeague() only changes activeLeague and wakes the Liga task, which loads the
+    warm state of the new league at once.
+
+*/
+#ifndef LeagueScheduler_h
+#define LeagueScheduler_h
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "Liga.h"
+#include "MatchdayModel.h"
+#include "PollScheduler.h"
+
+#define LIGA_TRACKED_LEAGUES 0x07                                               // bit per leagueIndex(): BL1, BL2, BL3
+#define LIGA_SHOWN_RESERVE 2                                                    // pacer requests a league not shown leaves to the shown one
+
+// ----------------------------
+// state of one league while it is not loaded into the Liga globals
+struct LeagueState {
+    int               maxTeams;
+    int               season;
+    int               matchday;
+    int               liveMatchID;
+    char              lastScan[32];
+    String            currentLastChange;
+    String            previousLastChange;
+    bool              matchdayChanged;
+    time_t            currentNextKickoff;
+    time_t            previousNextKickoff;
+    bool              nextKickoffChanged;
+    bool              nextKickoffFarAway;
+    bool              connectionRefused;
+    bool              matchIsLive;
+    bool              someThingNew;
+    MatchInfo         liveMatches[MAX_MATCHES_PER_MATCHDAY];
+    int               liveMatchCount;
+    int               finiMatchCount;
+    int               liveMatchIndex;
+    MatchInfo         nextMatches[MAX_MATCHES_PER_MATCHDAY];
+    int               nextMatchCount;
+    MatchInfo         planMatches[MAX_MATCHES_PER_MATCHDAY];
+    int               planMatchCount;
+    LiveMatchGoalInfo goals[MAX_GOALS_PER_MATCHDAY];
+    int               goalCount;
+    int               lastGoalID;
+    LiveGoalStore     goalStore;
+    double            secondsUntilKickoff;
+    std::string       nextKickoffString;
+    PollScope         pollScope;
+    PollMode          pollMode;
+    PollMode          nextPollMode;
+    PollScheduler     polls;
+    uint32_t          dynamicWait;
+    uint32_t          startOfWaiting;
+    MatchdayModel     matchdayModel;
+    MatchdayModel     nextMatchdayModel;
+
+    void clear(League lg);                                                      // cold state of a league, bootstrap scopes due now
+};
+
+class LeagueScheduler {
+   public:
+    LeagueScheduler();
+
+    void   begin();                                                             // all leagues cold, due now (Liga task start)
+    League next(uint32_t& waitMs);                                              // league to poll now, waitMs > 0: nothing due yet
+    void   load(League lg);                                                     // swap state of lg into the Liga globals
+    void   beginCycle(League lg);                                               // load lg, count its requests
+    void   endCycle(uint32_t delayMs);                                          // loaded league is due again after delayMs
+    void   setTracked(uint8_t mask) { _tracked = mask; }                        // bit per leagueIndex()
+    bool   tracked(League lg) const { return _tracked & (1 << leagueIndex(lg)); }
+
+    // statistics per league
+    PollMode pollMode(League lg) const;                                         // current poll mode, also of a league not loaded
+    int32_t  dueInMs(League lg) const;                                          // time until next cycle, < 0 = overdue
+    uint32_t cycles(League lg) const { return _cycles[leagueIndex(lg)]; }
+    uint32_t requests(League lg) const { return _requests[leagueIndex(lg)]; }
+    uint32_t postponed() const { return _postponed; }                           // cycles moved behind the shown-league reserve
+
+    template <typename... Args>
+    void leaguePrintln(const Args&... args) {
+        tracePrintln("[FLAP  - LEAGUE ] ", args...);
+    }
+
+   private:
+    void swapState(LeagueState& state);                                         // globals <-> state
+
+    LeagueState       _state[LEAGUE_COUNT];                                     // slot of the loaded league holds no data
+    uint32_t          _due[LEAGUE_COUNT];                                       // millis() of next cycle
+    uint32_t          _cycles[LEAGUE_COUNT];
+    uint32_t          _requests[LEAGUE_COUNT];
+    uint8_t           _tracked;
+    uint32_t          _requestsAtStart;                                         // openLigaDB.requests() at beginCycle()
+    League            _cycleLeague;
+    uint32_t          _postponed;
+    SemaphoreHandle_t _viewMutex;                                               // held while a league not shown is loaded
+    bool              _viewHeld;
+
+    friend class LeagueViewLock;
+};
+
+extern LeagueScheduler ligaLeagues;                                             // leagues of the Liga task
+
+// ----------------------------
+// Reader guard for the league globals (Report task): fails instead of waiting while the
+// Liga task has loaded a league that is not shown.
+class LeagueViewLock {
+   public:
+    LeagueViewLock();
+    ~LeagueViewLock();
+    explicit operator bool() const { return _owned; }                           // globals belong to activeLeague
+    LeagueViewLock(const LeagueViewLock&)            = delete;
+    LeagueViewLock& operator=(const LeagueViewLock&) = delete;
+
+   private:
+    bool _owned;
+};
+
+#endif // LeagueScheduler_h
@@ -21,7 +21,9 @@
 #include <Arduino.h>
 #include "TracePrint.h"
 #include "ArduinoJson.h"
+#include "JsonStream.h"
 #include "esp_http_client.h"
+#include <atomic>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
 
@@ -36,6 +38,9 @@
 
 #define MAX_MATCHES_PER_MATCHDAY 10                                             // max. number of matches per matchday to track
 #define MAX_GOALS_PER_MATCHDAY 50                                               // max. number of goals per matchday to track
+#define GOAL_MATCH_SLOTS 16                                                     // per-match index of goalsInfos[], power of 2 > MAX_MATCHES_PER_MATCHDAY
+#define GOAL_SEEN_SLOTS 128                                                     // hash set of goal IDs, power of 2 > 2 * MAX_GOALS_PER_MATCHDAY
+#define GOAL_SEEN_KEEP_CYCLES 32                                                // goal IDs not streamed for so many live cycles are forgotten
 #define MAX_MATCH_DURATION 150 * 60                                             // 2,5 hours in seconds
 #define SIXTY_MINUTES_BEFORE_MATCH 6 * 10 * 60                                  // 60 minutes in seconds
 
@@ -51,7 +56,14 @@
 // ==== enums ====
 // --- Chooseable league -------------------------------------------------------
 enum class League : uint8_t { BL1 = 1, BL2 = 2, BL3 = 3 };                      // Bundesliga 1, 2, 3
-extern League activeLeague;
+#define LEAGUE_COUNT 3                                                          // leagues tracked by the Liga task
+extern League activeLeague;                                                     // league shown (reports, web, push), toggled by the Parser
+extern League ligaLeague;                                                       // league whose state the Liga task has loaded (LeagueScheduler.h)
+
+/** @brief Return dense index 0..LEAGUE_COUNT-1 of a league. */
+static inline uint8_t leagueIndex(League lg) {
+    return (uint8_t)lg - 1;
+}
 
 /** @brief Return OpenLigaDB league shortcut string for the given enum. */
 static inline const char* leagueShortcut(League lg) {
@@ -80,10 +92,11 @@ enum PollScope {
     FETCH_TABLE,                                                                // fetch actualized table
     FETCH_CURRENT_MATCHDAY,                                                     // fetch actual matchday
     CALC_CURRENT_SEASON,                                                        // calculate actuel season
-    FETCH_NEXT_KICKOFF,                                                         // fetch next kickoff (don't fetch during game is live)
-    FETCH_LIVE_MATCHES,                                                         // fetch live matches, that are in future or kickoff was 2,5 hours ago
+    CALC_NEXT_KICKOFF,                                                          // next kickoff from the MatchdayModel
+    FETCH_MATCHES,                                                              // fetch all matches of the matchday into the MatchdayModel
+    CALC_LIVE_MATCHES,                                                          // live matches from the MatchdayModel (kickoff up to 2,5 hours ago)
     FETCH_LIVE_GOALS,                                                           // fetch goals for live matches by mathchID
-    FETCH_NEXT_MATCH_LIST,                                                      // fetch list of next matches with nearest kickoff
+    CALC_NEXT_MATCH_LIST,                                                       // list of next matches with nearest kickoff from the MatchdayModel
     SHOW_NEXT_KICKOFF,                                                          // show next kickoff from stored data
     CALC_LIVE_TABLE,                                                            // calculate table changes from old and new table
     CALC_LEADER_CHANGE,                                                         // calculate leader change from table
@@ -91,8 +104,9 @@ enum PollScope {
     CALC_RED_LANTERN_CHANGE,                                                    // calculate red lantern change from table
     CALC_GOALS                                                                  // calculate goals from table
 };
+#define POLL_SCOPE_COUNT (CALC_GOALS + 1)                                       // number of PollScopes
 
-// global Poll Modes
+// Poll Modes: label of the poll state, the deadlines of PollScheduler decide what is polled
 enum PollMode {
     POLL_MODE_NONE,                                                             // no polling at all, but wait
     POLL_MODE_ONCE,                                                             // poll only once and then switch to relaxed
@@ -102,51 +116,8 @@ enum PollMode {
     POLL_MODE_LIVE                                                              // during live games until it's over (2h past kickoff)
 };
 
-// global Poll Scopes for actual PollCycle for Poll-Manager
-const PollScope noCycle[] = {};                                                 // no polling
-
-// do it only once to initiate data
-const PollScope onceCycle[] = {
-    CALC_CURRENT_SEASON,                                                        // initialize season
-    FETCH_CURRENT_MATCHDAY,                                                     // initialize matchday
-    CHECK_FOR_CHANGES                                                           // request openLigaDB for changes at current matchday
-};
-
-const PollScope relaxedCycle[] = {
-    CALC_CURRENT_SEASON,                                                        // initialize season
-    FETCH_CURRENT_MATCHDAY,                                                     // initialize matchday
-    FETCH_TABLE,                                                                // get actual table from openLigaDB first time
-    FETCH_NEXT_MATCH_LIST,                                                      // fetch list of next matches with nearest kickoff
-    FETCH_NEXT_KICKOFF,                                                         // fetch next kickoff
-    CHECK_FOR_CHANGES                                                           // request openLigaDB for changes at current matchday
-};
-
-const PollScope reactiveCycle[] = {
-    FETCH_LIVE_MATCHES,                                                         // are there actual live matches? to get into live Poll immediately
-    FETCH_NEXT_MATCH_LIST,                                                      // fetch list of next matches with nearest kickoff
-    FETCH_NEXT_KICKOFF,                                                         // fetch next kickoff (don't fetch during game is live)
-    FETCH_TABLE,                                                                // get actual table from openLigaDB first time
-    CHECK_FOR_CHANGES                                                           // request openLigaDB for changes at current matchday
-};
-
-const PollScope preLiveCycle[] = {
-    FETCH_LIVE_MATCHES,                                                         // are there actual live matches? to get into live Poll immediately
-    FETCH_NEXT_KICKOFF,                                                         // fetch next kickoff
-    CHECK_FOR_CHANGES                                                           // request openLigaDB for changes at current matchday
-};
-
-// don't ask for nextKickoff during live games, you will get kickoff from next live matches
-const PollScope liveCycle[] = {
-    FETCH_LIVE_GOALS,                                                           // get goals from live matches
-    CALC_LIVE_TABLE,                                                            // calculate table changes from old and new table
-    CALC_LEADER_CHANGE,                                                         // calculate leader change from goals
-    CALC_RELEGATION_GHOST_CHANGE,                                               // calculate relegation ghost change from goals
-    CALC_RED_LANTERN_CHANGE,                                                    // calculate red lantern change from goals
-    FETCH_LIVE_MATCHES                                                          // are there actual live matches? to get into live Poll immediately
-};
-
 // ==== enums ====
-extern int ligaMaxTeams;                                                        // max. number of teams in selected league
+extern int ligaMaxTeams;                                                        // max. number of teams in loaded league (ligaLeague)
 
 // ==== Structures / Data Types ====
 // ---------- Liga Table row (ASCII-only snapshot) ----------
@@ -161,6 +132,7 @@ struct LigaRow {
     uint8_t l;                                                                  // matches lost
     uint8_t d;                                                                  // matches drawn
     uint8_t flap;                                                               // number on flap display
+    int8_t  teamIdx;                                                            // dense team index (TeamIndex.h), -1 = unknown
     char    team[MAX_TEAMNAME_LENGTH];                                          // ASCII only (pretransliterated)
     char    dfb[MAX_DFB_SHORT];                                                 // ASCII (3-letter + NUL)
 };
@@ -178,10 +150,11 @@ struct LigaSnapshot {
         nextKickoffUTC = 0;
         fetchedAtUTC   = 0;
         teamCount      = 0;
-        for (uint8_t i = 0; i < ligaMaxTeams; i++) {
+        for (uint8_t i = 0; i < LIGA3_MAX_TEAMS; i++) {                         // all rows, the loaded league may differ
             rows[i].pos = rows[i].sp = rows[i].pkt = 0;
             rows[i].diff = rows[i].og = rows[i].g = 0;
             rows[i].w = rows[i].l = rows[i].d = 0;
+            rows[i].teamIdx = -1;
             rows[i].team[0] = rows[i].dfb[0] = '\0';
         }
     }
@@ -217,6 +190,47 @@ struct LiveMatchGoalInfo {
     }
 };
 
+// ==== Live goal store ====
+// Index over goalsInfos[] of the Liga task, updated in O(1) while the goals are streamed in.
+// - latest(matchID): entry with the current score of a match (last stored goal or the 0:0 entry)
+// - seen goal IDs: open-addressing hash set that lives across the live cycles. Every cycle streams
+//   all goals again, so a goal is GOAL_NEW only once (log, push, lastGoalID), afterwards GOAL_KNOWN;
+//   the same goal twice in one cycle is a GOAL_DUPLICATE and not stored. A full set drops the goals
+//   streamed longest ago, never one of the current cycle.
+enum GoalAdmit : uint8_t { GOAL_NEW, GOAL_KNOWN, GOAL_DUPLICATE };
+
+class LiveGoalStore {
+   public:
+    LiveGoalStore();
+
+    void                     beginCycle();                                      // goalsInfos[] empty, next live cycle
+    GoalAdmit                admit(uint32_t goalID);                            // classify a streamed goal, mark it seen in this cycle
+    LiveMatchGoalInfo*       add(uint32_t matchID);                             // next cleared entry for matchID, nullptr if full
+    const LiveMatchGoalInfo* latest(uint32_t matchID) const;                    // current score of a match, nullptr if none
+    void                     rollback(int firstGoal);                           // drop entries from firstGoal on (incomplete body)
+    uint32_t                 duplicates() const { return _duplicates; }         // goals rejected as duplicate
+
+   private:
+    struct MatchSlot {
+        uint32_t matchID;                                                       // 0 = empty
+        int8_t   goal;                                                          // latest entry in goalsInfos[]
+    };
+    struct SeenSlot {
+        uint32_t goalID;                                                        // 0 = empty
+        uint32_t cycle;                                                         // cycle the goal was streamed last
+    };
+
+    int  slotOf(uint32_t matchID) const;                                        // slot of matchID or its empty slot, -1 if full
+    void clearMatches();
+    bool evictOldest();                                                         // seen set full: drop goals streamed longest ago
+    void erase(uint32_t i);                                                     // empty a seen slot, keep probe chains intact
+
+    MatchSlot _match[GOAL_MATCH_SLOTS];
+    SeenSlot  _seen[GOAL_SEEN_SLOTS];
+    uint32_t  _cycle;
+    uint32_t  _duplicates;
+};
+
 // ==== Live Match structure ====
 struct MatchInfo {
     uint32_t    matchID;
@@ -240,7 +254,7 @@ struct DfbMap {
 
 // ==== global Variables ====
 // 1. Bundesliga
-static const DfbMap DFB1[] PROGMEM = {{"FC Bayern München", "FCB", 1},     {"Borussia Dortmund", "BVB", 7}, {"RB Leipzig", "RBL", 13},
+static constexpr DfbMap DFB1[] PROGMEM = {{"FC Bayern München", "FCB", 1},     {"Borussia Dortmund", "BVB", 7}, {"RB Leipzig", "RBL", 13},
                                       {"Bayer 04 Leverkusen", "B04", 2},   {"1. FSV Mainz 05", "M05", 8},   {"Borussia Mönchengladbach", "BMG", 14},
                                       {"Eintracht Frankfurt", "SGE", 3},   {"VfL Wolfsburg", "WOB", 9},     {"1. FC Union Berlin", "FCU", 15},
                                       {"SC Freiburg", "SCF", 4},           {"TSG Hoffenheim", "TSG", 10},   {"VfB Stuttgart", "VFB", 16},
@@ -248,7 +262,7 @@ static const DfbMap DFB1[] PROGMEM = {{"FC Bayern München", "FCB", 1},     {"Bo
                                       {"1. FC Heidenheim 1846", "HDH", 6}, {"Hamburger SV", "HSV", 12},     {"FC St. Pauli", "STP", 18}};
 
 // 2. Bundesliga (ergänzbar – strikt nach Namen)
-static const DfbMap DFB2[] PROGMEM = {{"Hertha BSC", "BSC", 19},           {"VfL Bochum", "BOC", 25},         {"Eintracht Braunschweig", "EBS", 30},
+static constexpr DfbMap DFB2[] PROGMEM = {{"Hertha BSC", "BSC", 19},           {"VfL Bochum", "BOC", 25},         {"Eintracht Braunschweig", "EBS", 30},
                                       {"SV Darmstadt 98", "SVD", 20},      {"Fortuna Düsseldorf", "F95", 26}, {"SV 07 Elversberg", "ELV", 31},
                                       {"SpVgg Greuther Fürth", "SGF", 21}, {"Hannover 96", "H96", 27},        {"1. FC Kaiserslautern", "FCK", 32},
                                       {"Karlsruher SC", "KSC", 22},        {"1. FC Magdeburg", "FCM", 28},    {"1. FC Nürnberg", "FCN", 33},
@@ -256,7 +270,7 @@ static const DfbMap DFB2[] PROGMEM = {{"Hertha BSC", "BSC", 19},           {"VfL
                                       {"Preußen Münster", "PRM", 24},      {"DSC Arminia Bielefeld", "DSC", 35},  {"Dynamo Dresden", "DYN", 0}};
 
 // 3. Liga (DFB-Kürzel gepflegt; Flap = -1 = Platzhalter -> erscheint im Report/Web, NICHT auf dem physischen Flap-Display)
-static const DfbMap DFB3[] PROGMEM = {{"VfL Osnabrück", "OSN", -1},          {"Energie Cottbus", "COT", -1},         {"Rot-Weiss Essen", "RWE", -1},
+static constexpr DfbMap DFB3[] PROGMEM = {{"VfL Osnabrück", "OSN", -1},          {"Energie Cottbus", "COT", -1},         {"Rot-Weiss Essen", "RWE", -1},
                                       {"MSV Duisburg", "MSV", -1},           {"Hansa Rostock", "HRO", -1},           {"SC Verl", "SCV", -1},
                                       {"Alemannia Aachen", "AAC", -1},       {"TSV 1860 München", "M60", -1},        {"SV Wehen Wiesbaden", "WEH", -1},
                                       {"SV Waldhof Mannheim", "WAL", -1},    {"Viktoria Köln", "VIK", -1},           {"FC Ingolstadt 04", "FCI", -1},
@@ -265,33 +279,73 @@ static const DfbMap DFB3[] PROGMEM = {{"VfL Osnabrück", "OSN", -1},          {"
                                       {"SSV Ulm 1846", "ULM", -1},           {"1. FC Schweinfurt 05", "SFT", -1}};
 
 // HTTP request and evaluation
-extern size_t jsonBufferPos;
-extern bool   jsonBufferPrepared;                                               // flag is buffer space allready prepared
-extern int    realJsonBufferSize;                                               // cunked buffers size cummulated
+extern JsonStream ligaJson;                                                     // incremental parser, fed chunk by chunk
+extern bool       jsonStreamPrepared;                                           // flag is parser allready prepared for current body
 
 // Poll-Manager Control
 extern bool             currentMatchdayChanged;                                 // actuel state of openLigaDB matchday data
-extern const PollScope* activeCycle;                                            // PollScope list for active cycle
-extern size_t           activeCycleLength;                                      // number of PollSopes in activeCycle
 extern PollMode         currentPollMode;                                        // current poll mode of poll mananger
 extern PollScope        currentPollScope;                                       // current poll scope of poll mananger
 extern PollMode         nextPollMode;                                           // poll mode for next PollCycle
-extern uint32_t         pollManagerDynamicWait;                                 // wait time according to current poll mode
+extern uint32_t         pollManagerDynamicWait;                                 // wait time until the earliest poll deadline
 extern uint32_t         pollManagerStartOfWaiting;                              // time_t when entering waiting state
 extern bool             isSomeThingNew;                                         // flag that openLigaDB data has changed
+extern uint32_t         pollCacheHits[POLL_SCOPE_COUNT];                        // unchanged payloads per PollScope (conditional GET)
+extern uint32_t         pollCacheMisses[POLL_SCOPE_COUNT];                      // processed payloads per PollScope
 
-// openLigaDB data
-extern LigaSnapshot snap[2];                                                    // current and previus table snapshot
-extern uint8_t      snapshotIndex;                                              // 0 oder 1
+// ----------------------------
+// Published table snapshots: current and previous table of the Liga task, lock-free for readers.
+// Three slots rotate through the roles current, previous and back. The writer fills the back slot
+// privately and publishes it with one atomic store of the slot index; current becomes previous, the old
+// previous becomes the next back slot. Every slot has a sequence counter (odd while it is written), a
+// reader copies the current slot and retries only if the writer has reused that very slot meanwhile
+// (reader slower than two publications). Readers never block the writer and never see a torn row.
+class LigaSnapshotStore {
+   public:
+    LigaSnapshotStore();
+
+    // writer side (Liga task), serialized by LigaSnapshotLock
+    LigaSnapshot&       build();                                                // back slot, cleared, invisible to readers
+    void                publish();                                              // built slot becomes current, current becomes previous
+    void                keep();                                                 // table unchanged: previous = current, detectors see no change
+    void                clear();                                                // forget both tables (Liga task start)
+    const LigaSnapshot& current() const { return _slot[_current.load(std::memory_order_relaxed)]; }
+    const LigaSnapshot& previous() const { return _slot[_previous]; }
+
+    // reader side (Report, Web, Liga), any task, lock-free
+    uint32_t read(LigaSnapshot& out) const;                                     // consistent copy of current, returns its version
+    uint32_t version() const { return _version.load(std::memory_order_acquire); } // publications so far
+    uint32_t retries() const { return _retries.load(std::memory_order_relaxed); }  // reads repeated because of a reused slot
+
+   private:
+    void beginWrite(uint8_t slot);                                              // sequence odd: readers of this slot retry
+    void endWrite(uint8_t slot);                                                // sequence even again
+
+    LigaSnapshot                  _slot[3];
+    std::atomic<uint32_t>         _sequence[3];
+    uint32_t                      _slotVersion[3];                              // version published with the slot
+    std::atomic<uint8_t>          _current;                                     // slot readers copy
+    uint8_t                       _previous;                                    // slot of the table before, writer side only
+    uint8_t                       _back;                                        // slot the writer fills next
+    std::atomic<uint32_t>         _version;
+    mutable std::atomic<uint32_t> _retries;
+};
+
+extern LigaSnapshotStore ligaSnapshotStores[LEAGUE_COUNT];                      // current and previous table per league
+
+/** @brief Table store of a league: ligaSnapshotsOf(ligaLeague) in the Liga task, ligaSnapshotsOf(activeLeague) for readers. */
+static inline LigaSnapshotStore& ligaSnapshotsOf(League lg) {
+    return ligaSnapshotStores[leagueIndex(lg)];
+}
 
 // ----------------------------
-// Concurrency guard for snap[]/snapshotIndex: written by the Liga task (table fill + index flip) and the
-// Parser task (toggleLeague clear), read by the Report/Web tasks. A mutex serializes every access so readers
-// never see a half-filled table. ligaSnapshotMutexInit() must run once in setup() before any task starts.
+// Writer guard for the table stores: the Liga task writes (fill, publish, detectors on current/previous,
+// clear at start), readers use ligaSnapshotsOf(activeLeague).read() without any lock.
+// ligaSnapshotMutexInit() must run once in setup() before any task starts.
 extern SemaphoreHandle_t g_ligaSnapshotMutex;
 void                     ligaSnapshotMutexInit();                               // create the snapshot mutex (call once in setup)
 
-class LigaSnapshotLock {                                                        // RAII lock for snap[]/snapshotIndex
+class LigaSnapshotLock {                                                        // RAII writer lock for ligaSnapshotStores
    public:
     LigaSnapshotLock() {
         if (g_ligaSnapshotMutex)
@@ -305,6 +359,56 @@ class LigaSnapshotLock {
     LigaSnapshotLock& operator=(const LigaSnapshotLock&) = delete;
 };
 
+// ----------------------------
+// Live table of the Liga task: published table plus the latest score of every live match.
+// update() applies only what changed since the last call (old result of a match out, new result in)
+// and moves just the affected rows up or down until the order is restored. Rows that changed their
+// place come out as moves. A new base table (other version) is copied and ranked once.
+// No heap; the rank key packs points, goal difference and goals into one integer.
+struct LiveTableMove {
+    uint8_t row;                                                                // row in table(), new position = row + 1
+    uint8_t fromPos;                                                            // position before update()
+};
+
+class LiveTable {
+   public:
+    LiveTable();
+
+    bool                 update(const LigaSnapshot& base, uint32_t baseVersion); // apply live score changes, true if table changed
+    const LigaSnapshot&  table() const { return _table; }                       // live table, sorted, pos set
+    uint8_t              moveCount() const { return _moveCount; }               // rows with a new position after update()
+    const LiveTableMove& move(uint8_t i) const { return _moves[i]; }
+    uint32_t             rebuilds() const { return _rebuilds; }                 // base tables taken over
+
+   private:
+    struct LiveResult {                                                         // score of a live match inside _table
+        uint32_t matchID;
+        int8_t   home1;                                                         // row of team 1 in the base table
+        int8_t   home2;                                                         // row of team 2 in the base table
+        uint8_t  score1;
+        uint8_t  score2;
+    };
+
+    void   rebuild(const LigaSnapshot& base, uint32_t baseVersion);             // copy base, rank all rows
+    int8_t homeOf(const std::string& team) const;                               // base row of a team, -1 = not in table
+    void   setResult(int8_t home, int own, int other, int sign);                // result of one team in (+1) or out (-1), re-rank row
+    void   swapSlots(uint8_t a, uint8_t b);
+    void   collectMoves();                                                      // rows of the touched range with a new position
+
+    LigaSnapshot  _table;
+    uint32_t      _baseVersion;
+    bool          _valid;                                                       // _table holds a base table
+    int8_t        _slotOf[LIGA3_MAX_TEAMS];                                     // base row -> current row
+    int8_t        _homeOf[LIGA3_MAX_TEAMS];                                     // current row -> base row
+    LiveResult    _applied[MAX_MATCHES_PER_MATCHDAY];
+    uint8_t       _appliedCount;
+    uint8_t       _touchedLow;                                                  // rows moved during this update()
+    uint8_t       _touchedHigh;
+    LiveTableMove _moves[LIGA3_MAX_TEAMS];
+    uint8_t       _moveCount;
+    uint32_t      _rebuilds;
+};
+
 extern int               ligaSeason;                                            // global actual Season
 extern int               ligaMatchday;                                          // global actual Matchday
 extern int               liveMatchID;                                           // iD of current live match
@@ -331,6 +435,7 @@ extern MatchInfo         planMatches[MAX_MATCHES_PER_MATCHDAY];
 extern MatchInfo         nextMatches[MAX_MATCHES_PER_MATCHDAY];                 // max. 10 next-Spiele
 extern MatchInfo         liveMatches[MAX_MATCHES_PER_MATCHDAY];                 // max. 10 Live-Spiele
 extern LiveMatchGoalInfo goalsInfos[MAX_GOALS_PER_MATCHDAY];                    // max. 50 goals per matchday
+extern LiveGoalStore     liveGoals;                                             // index of goalsInfos[], seen goal IDs
 
 extern uint8_t currScoreTeam1;                                                  // current score of team 1
 extern uint8_t currScoreTeam2;                                                  // current score of team 2
@@ -341,28 +446,23 @@ extern uint8_t prevScoreTeam2;
 
 // global Funtions
 bool        initLigaTask();
+void        createLigaInstance();
 int         calcCurrentSeason();
 bool        connectToWifi();
 void        configureTime();
 bool        waitForTime(uint32_t maxMs = 15000, bool report = false);           // Wait until system time (NTP) is valid, up to maxMs.
 void        printTime(const char* label);
-uint32_t    getPollDelay(PollMode mode);
-void        selectPollCycle(PollMode mode);
 const char* pollModeToString(PollMode mode);
 const char* pollScopeToString(PollScope scope);
-bool        recalcLiveTable(LigaSnapshot& baseTable, LigaSnapshot& tempTable);  // recalculate table with live goals
-void        printLigaLiveTable(LigaSnapshot& LiveTable);                        // print recalculated live table
-bool        readHttpResult(esp_http_client_event_t* evt);
-
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-template <typename TFilter>
-bool deserializeHttpResult(DynamicJsonDocument& doc, const TFilter& filter);
-bool deserializeHttpResult(DynamicJsonDocument& doc);
-#pragma GCC diagnostic pop
+String      pollCycleToString(const PollScope* cycle, size_t length);           // "{scope, scope, ...}" for the log
+void        sortSnapshot(LigaSnapshot& snapshot);                               // order rows by points, diff, goals and set pos
+bool        recalcLiveTable(LigaSnapshot& baseTable, LigaSnapshot& tempTable);  // full recalculation, reference for LiveTable
+void        printLigaLiveTable(const LigaSnapshot& LiveTable);                  // print recalculated live table
+bool        readHttpResult(esp_http_client_event_t* evt, JsonStreamHandler handler, void* context = nullptr); // feed chunk to JSON stream
+bool        finishHttpResult();                                                 // end of body, JSON complete?
+bool        unchangedHttpResult();                                              // body of conditional GET unchanged, keep data
 
-void     processPollScope(PollScope scope);
-PollMode determineNextPollMode();
+void processPollScope(PollScope scope);
 
 bool openLigaDBHealthCheck();
 bool checkForMatchdayChanges();
@@ -381,9 +481,7 @@ class LigaTable {
     bool pollForChanges();
     bool pollForTable();                                                        // get Bundesligatabelle
     bool pollForCurrentMatchday();                                              // get current matchday
-    bool pollForNextKickoff();                                                  // get next kickoff
-    void pollForLiveMatches();                                                  // get Bundesligatabelle
-    bool pollForNextMatchList(int machdayOffset);                               // get list of next matches with nearest kickoff
+    bool pollForMatches(int matchdayOffset);                                    // all matches of a matchday into the MatchdayModel
     bool detectLeaderChange(const LigaSnapshot& oldSnap, const LigaSnapshot& newSnap, //
                             const LigaRow** oldLeaderOut, const LigaRow** newLeaderOut);
     bool detectRelegationGhostChange(const LigaSnapshot& oldSnap, const LigaSnapshot& newSnap, //
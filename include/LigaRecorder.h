@@ -0,0 +1,63 @@
+// #################################################################################################################
+//
+//  ██      ██  ██████   █████      ██████  ███████  ██████  ██████  ██████  ██████  ███████ ██████
+//  ██      ██ ██       ██   ██     ██   ██ ██      ██      ██    ██ ██   ██ ██   ██ ██      ██   ██
+//  ██      ██ ██   ███ ███████     ██████  █████   ██      ██    ██ ██████  ██   ██ █████   ██████
+//  ██      ██ ██    ██ ██   ██     ██   ██ ██      ██      ██    ██ ██   ██ ██   ██ ██      ██   ██
+//  ███████ ██  ██████  ██   ██     ██   ██ ███████  ██████  ██████  ██   ██ ██████  ███████ ██   ██
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Liga%20Recorder
+//
+/*
+
+    Recorder of all openLigaDB responses (build flag LIGARECORD)
+
+    Every response the Liga task receives is appended to /liga.rec on SPIFFS with
+    the wall-clock time it arrived. A match day recorded on the device can be
+    downloaded with http://<master>/record and replayed in the native build
+    (FLAP_REPLAY=<file>), which drives the full poll state machine with it.
+
+    Format, one block per response:
+
+        @<epoch> <status> <url>\n
+        +<len>\n<len bytes of body>                     one per HTTP_EVENT_ON_DATA chunk
+        .\n                                             end of response
+
+    A block without its end line (reset, transport error) is skipped by the replay.
+    Recording stops at LIGA_RECORD_MAX_BYTES, /record/clear starts a new file.
+
+*/
+#ifndef LigaRecorder_h
+#define LigaRecorder_h
+
+#include <Arduino.h>
+#include <FS.h>
+
+#define LIGA_RECORD_FILE "/liga.rec"
+#define LIGA_RECORD_MAX_BYTES (1024 * 1024)                                     // SPIFFS budget of one recording
+
+class LigaRecorder {
+   public:
+    void begin(int status, const char* url);                                    // start block of response
+    void chunk(const void* data, size_t len);                                   // append body chunk
+    void end();                                                                 // close block of response
+    void abort();                                                               // response failed, block stays open
+    void clear();                                                               // delete recording
+
+    bool     active() const { return (bool)_file; }                             // block of response open
+    uint32_t responses() const { return _responses; }                           // blocks written since start
+    bool     full() const { return _full; }                                     // recording stopped at size limit
+
+   private:
+    File     _file;                                                             // open while one response is recorded
+    size_t   _bytes     = 0;                                                    // size of recording
+    bool     _sized     = false;                                                // _bytes read from file system
+    bool     _full      = false;
+    uint32_t _responses = 0;
+};
+
+extern LigaRecorder ligaRecorder;                                               // recorder of LigaSession
+
+#endif // LigaRecorder_h
@@ -0,0 +1,168 @@
+// #################################################################################################################
+//
+//  ██      ██  ██████   █████      ███████ ███████ ███████ ███████ ██  ██████  ███    ██
+//  ██      ██ ██       ██   ██     ██      ██      ██      ██      ██ ██    ██ ████   ██
+//  ██      ██ ██   ███ ███████     ███████ █████   ███████ ███████ ██ ██    ██ ██ ██  ██
+//  ██      ██ ██    ██ ██   ██          ██ ██           ██      ██ ██ ██    ██ ██  ██ ██
+//  ███████ ██  ██████  ██   ██     ███████ ███████ ███████ ███████ ██  ██████  ██   ████
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Liga%20Session
+//
+/*
+
+    Persistent HTTPS session to api.openligadb.de
+
+    Every poll used to run esp_http_client_init, perform, close and cleanup, so each
+    request paid a full TCP and TLS handshake. LigaSession keeps one client per host
+    and reuses its connection for all requests of the poll cycles:
+
+    - the url is switched with esp_http_client_set_url() between requests
+    - the event handler of the endpoint is called through one dispatcher
+    - the connection is only dropped after a transport error; a request on a
+      connection the server closed while idle is repeated once on a new one
+    - requests, handshakes, errors and request time are counted for the reports
+
+    Conditional GET (getIfChanged): every endpoint handler owns one cache slot per
+    cache group (league, setCacheGroup()) with the url, ETag/Last-Modified and a
+    FNV-1a hash of the body it processed last.
+    The validators are sent as If-None-Match/If-Modified-Since; a 304, or a 200
+    whose streamed body hashes like the stored one, marks the request unchanged()
+    and the handler keeps its data instead of rebuilding it. A handler with a slot
+    must always be requested with getIfChanged(), else the slot misses a body.
+
+    Pacing (LigaPacer): all requests of the session draw from one token bucket instead
+    of fixed pauses after every poll scope. A full bucket lets LIGA_PACE_BURST requests
+    go back-to-back, on average there is one request per LIGA_PACE_INTERVAL_MS. A refused
+    connection (ESP_ERR_HTTP_CONNECT) or a server refusal (429, 503) doubles the interval
+    and drops the burst to one; every LIGA_PACE_RECOVER answered requests halve it again
+    until the configured pace is back.
+
+    Only the Liga task sends requests, so the session needs no lock.
+
+*/
+#ifndef LigaSession_h
+#define LigaSession_h
+
+#include <Arduino.h>
+#include "esp_http_client.h"
+#include "TracePrint.h"
+#include "Liga.h"                                                               // LEAGUE_COUNT
+
+#define LIGA_SESSION_BUFFER 2048                                                // receive buffer, also size of HTTP_EVENT_ON_DATA chunks
+#define LIGA_SESSION_TIMEOUT_MS 5000                                            // network timeout of one request
+#define LIGA_CACHE_SLOTS (3 * LEAGUE_COUNT)                                     // matches, next matchday, table x leagues
+#define LIGA_PACE_INTERVAL_MS 2000                                              // average distance of requests (former gap of goal polls)
+#define LIGA_PACE_BURST 6                                                       // requests back-to-back from a full budget
+#define LIGA_PACE_MAX_INTERVAL_MS (32 * 1000)                                   // slowest pace after repeated refusals
+#define LIGA_PACE_RECOVER 8                                                     // answered requests until a shrunk interval is halved
+
+// payload fingerprint of the last body one endpoint handler processed
+struct LigaCacheSlot {
+    http_event_handle_cb handler;                                               // owner, nullptr = free
+    uint8_t              group;                                                 // cache group of owner (league)
+    uint32_t             urlHash;                                               // FNV-1a of url of processed body
+    uint32_t             bodyHash;                                              // FNV-1a of processed body, 0 = none
+    char                 etag[48];                                              // ETag of processed body
+    char                 lastModified[32];                                      // Last-Modified of processed body
+};
+
+// token bucket shared by all requests of a session, credit is counted in milliseconds
+class LigaPacer {
+   public:
+    LigaPacer(uint32_t intervalMs, uint8_t burst);
+
+    void     configure(uint32_t intervalMs, uint8_t burst);                     // pace of an unrestricted server, budget full
+    uint32_t acquire();                                                         // wait for budget of one request, returns waited ms
+    uint32_t msUntil(uint8_t requests);                                         // wait until that many requests are in the budget
+    void     answered();                                                        // server answered: shrunk budget grows back
+    void     refused();                                                         // connect error, 429, 503: budget shrinks
+
+    uint32_t intervalMs() const { return _interval; }                           // current average distance of requests
+    uint8_t  burst() const { return _burst; }                                   // current requests back-to-back
+    uint32_t throttled() const { return _throttled; }                           // requests that had to wait
+    uint32_t waitedMs() const { return _waitedMs; }                             // total wait for budget
+    uint32_t refusals() const { return _refusals; }
+
+   private:
+    void refill();
+
+    uint32_t _baseInterval;                                                     // configured pace
+    uint8_t  _baseBurst;
+    uint32_t _interval;                                                         // pace now (> base after refusals)
+    uint8_t  _burst;
+    uint32_t _credit;                                                           // ms of budget, at most _interval * _burst
+    uint32_t _refillMs;                                                         // millis() of last refill
+    uint8_t  _answered;                                                         // answered requests since last change
+    uint32_t _throttled = 0;
+    uint32_t _waitedMs  = 0;
+    uint32_t _refusals  = 0;
+};
+
+class LigaSession {
+   public:
+    explicit LigaSession(const char* host);
+
+    esp_err_t get(const char* url, http_event_handle_cb handler, void* userData = nullptr); // GET url, events go to handler
+    esp_err_t getIfChanged(const char* url, http_event_handle_cb handler, void* userData = nullptr, bool reuse = true); // conditional GET
+    bool      unchanged() const { return _unchanged; }                          // body equals the one handler processed last
+    void      forget();                                                         // processed body was not used, drop fingerprint
+    void      reset();                                                          // drop connection, next get() reconnects
+    void      setCacheGroup(uint8_t group) { _group = group; }                  // conditional GETs use the slots of this group
+    LigaPacer& pacer() { return _pacer; }                                       // request budget of the session
+
+    // statistics
+    uint32_t requests() const { return _requests; }                             // requests sent
+    uint32_t handshakes() const { return _handshakes; }                         // TCP/TLS connections opened
+    uint32_t errors() const { return _errors; }                                 // requests failed with transport error
+    uint32_t lastRequestMs() const { return _lastRequestMs; }                   // duration of last request
+    uint32_t maxRequestMs() const { return _maxRequestMs; }                     // longest request since start
+    uint32_t notModified() const { return _notModified; }                       // requests answered with 304
+
+    // session trace
+    template <typename... Args>
+    void sessionPrintln(const Args&... args) {
+        tracePrintln("[FLAP  -  HTTP  ] ", args...);
+    }
+
+   private:
+    static esp_err_t dispatch(esp_http_client_event_t* evt);                    // forwards events to handler of running request
+    bool             connect();                                                 // create client for host
+    esp_err_t        perform(const char* url);                                  // one request on current client
+    LigaCacheSlot*   slotFor(http_event_handle_cb handler);                     // cache slot of endpoint handler in _group
+    void             sendValidators();                                          // If-None-Match/If-Modified-Since of slot
+    void             track(esp_http_client_event_t* evt);                       // fingerprint body of conditional request
+#ifdef LIGARECORD
+    void             record(esp_http_client_event_t* evt);                      // append response to recording
+#endif
+
+    const char*              _host;                                             // e.g. "api.openligadb.de"
+    esp_http_client_handle_t _client   = nullptr;                               // long-lived client, nullptr after error
+    http_event_handle_cb     _handler  = nullptr;                               // event handler of running request
+    void*                    _userData = nullptr;                               // user_data of running request
+    const char*              _url      = nullptr;                               // url of running request
+    bool                     _fresh    = false;                                 // connection opened by running request
+    LigaPacer                _pacer{LIGA_PACE_INTERVAL_MS, LIGA_PACE_BURST};    // budget of all requests
+
+    LigaCacheSlot  _slots[LIGA_CACHE_SLOTS] = {};                               // one slot per endpoint handler
+    LigaCacheSlot* _slot             = nullptr;                                 // slot of running conditional request
+    uint8_t        _group            = 0;                                       // cache group of next conditional requests
+    uint32_t       _urlHash          = 0;                                       // url of running conditional request
+    bool           _reuse            = false;                                   // handler can keep data of unchanged body
+    bool           _unchanged        = false;                                   // result of last conditional request
+    uint32_t       _bodyHash         = 0;                                       // running hash of streamed body
+    char           _etag[48]         = {};                                      // ETag of streamed body
+    char           _lastModified[32] = {};                                      // Last-Modified of streamed body
+
+    uint32_t _requests      = 0;
+    uint32_t _handshakes    = 0;
+    uint32_t _errors        = 0;
+    uint32_t _lastRequestMs = 0;
+    uint32_t _maxRequestMs  = 0;
+    uint32_t _notModified   = 0;
+};
+
+extern LigaSession openLigaDB;                                                  // session used by all Liga polls
+
+#endif // LigaSession_h
@@ -0,0 +1,115 @@
+// #################################################################################################################
+//
+//  ██      ██ ██    ██ ███████     ██████  ██    ██ ███████ ██   ██
+//  ██      ██ ██    ██ ██          ██   ██ ██    ██ ██      ██   ██
+//  ██      ██ ██    ██ █████       ██████  ██    ██ ███████ ███████
+//  ██      ██  ██  ██  ██          ██      ██    ██      ██ ██   ██
+//  ███████ ██   ████   ███████     ██       ██████  ███████ ██   ██
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Live%20Push
+//
+/*
+
+    Push channel for live goals, table changes and module state (Server-Sent Events)
+
+    Dashboards subscribe to /events instead of polling /1 and /2. The producers only note
+    what changed and wake the LivePush task, they never wait for the network:
+
+    - goal()        new entry in goalsInfos[]             -> event "goal", one per goal
+    - tableChange() detectLeader/RelegationGhost/RedLanternChange -> event "table"
+    - moduleMoved() twin finished a move                  -> event "modules", all moves of a burst
+
+    The task waits PUSH_COALESCE_MS after the first change of a burst and sends what has
+    accumulated: a second change of the same table position or module replaces the first,
+    so the traffic is bounded by the burst rate, not by the number of changes. Without
+    changes nothing is sent. A subscriber that has more than PUSH_MAX_BACKLOG messages
+    waiting is closed, the browser reconnects and gets "hello" again. If more goals arrive
+    than PUSH_GOAL_QUEUE in one burst, event "resync" tells the clients to fetch /2.
+
+*/
+#ifndef LivePush_h
+#define LivePush_h
+
+#include <Arduino.h>
+#include <vector>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <ESPAsyncWebServer.h>
+
+#define PUSH_COALESCE_MS 25                                                     // collect one burst of changes into one send
+#define PUSH_MAX_BACKLOG 8                                                      // messages waiting per subscriber before it is dropped
+#define PUSH_GOAL_QUEUE 16                                                      // goals per burst, more -> "resync"
+#define PUSH_MODULES 128                                                        // I2C address space of the modules
+#define PUSH_RECONNECT_MS 3000                                                  // browser reconnect delay after drop
+
+struct LiveMatchGoalInfo;
+struct LigaRow;
+
+enum PushTable : uint8_t { PUSH_LEADER = 0, PUSH_RELEGATION_GHOST, PUSH_RED_LANTERN, PUSH_TABLE_KINDS };
+
+class LivePush {
+   public:
+    LivePush();
+
+    void attach(AsyncWebServer& server);                                        // register /events, before server.begin()
+    void run();                                                                 // push task loop (livePushTask)
+
+    // producers, called from Liga and twin tasks
+    void goal(const LiveMatchGoalInfo& goal);
+    void tableChange(PushTable kind, const LigaRow* oldRow, const LigaRow* newRow);
+    void moduleMoved(uint8_t address, uint8_t flap);
+
+    // statistics
+    uint32_t subscribers() const { return _subscribers; }                       // connected clients
+    uint32_t messages() const { return _messages; }                             // messages sent (broadcast)
+    uint32_t dropped() const { return _dropped; }                               // slow subscribers closed
+
+   private:
+    struct Goal {
+        uint32_t matchID;
+        uint32_t goalID;
+        uint8_t  minute;
+        uint8_t  score1;
+        uint8_t  score2;
+        uint8_t  flags;                                                         // 1 own goal, 2 penalty, 4 overtime
+        char     team[32];
+        char     player[32];
+    };
+    struct Table {
+        bool changed;
+        char oldTeam[4];                                                        // DFB code before the first change of a burst
+        char newTeam[4];                                                        // DFB code after the last change
+    };
+    struct Pending {
+        Goal     goals[PUSH_GOAL_QUEUE];
+        uint8_t  goalCount;
+        bool     goalOverflow;
+        Table    table[PUSH_TABLE_KINDS];
+        uint32_t moduleDirty[PUSH_MODULES / 32];                                // bit per address
+        uint8_t  moduleFlap[PUSH_MODULES];
+    };
+
+    void wake();                                                                // notify push task, _lock not held
+    void flush();                                                               // send pending changes of one burst
+    void send(const char* event, const char* data);                             // broadcast and drop slow subscribers
+    void removeClient(AsyncEventSourceClient* client);                          // drop from _clients, _clientLock held
+
+    AsyncEventSource                     _events;
+    Pending                              _pending;                              // filled by producers
+    Pending                              _burst;                                // copy sent by the push task
+    SemaphoreHandle_t                    _lock;                                 // protects _pending
+    SemaphoreHandle_t                    _clientLock;                           // protects _clients (recursive: close() may disconnect at once)
+    std::vector<AsyncEventSourceClient*> _clients;
+    TaskHandle_t                         _task;                                 // push task, nullptr until run()
+    uint32_t                             _eventId;
+    uint32_t                             _subscribers;
+    uint32_t                             _messages;
+    uint32_t                             _dropped;
+};
+
+extern LivePush* Push;                                                          // push channel /events
+
+#endif                                                                          // LivePush_h
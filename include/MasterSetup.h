@@ -25,12 +25,15 @@ void masterSlaveControlObject();
 void masterStartRtosTasks();                                                    // start all RTOS Tasks
 void masterOutrodution();                                                       // setup finishc message
 void createTwinTasks();                                                         // create Twins
+void createReadyPollTask();                                                     // create ARE_YOU_READY scheduler
+void createTraceLogTask();                                                      // create asynchronous trace writer
 void createStatisticTask();                                                     // create Statistic
 void createReportTask();                                                        // create Report task
 void createRemoteControlTask();                                                 // create Remote Control
 void createRegisterTwinsTask();                                                 // create Registry
 void createParserTask();                                                        // create Parser task
 void createWebServerTask();                                                     // create web server
+void createLivePushTask();                                                      // create push channel for live events
 void createLigaTask();                                                          // create Liga task
 
 #endif                                                                          // MasterSetup_h
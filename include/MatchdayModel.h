@@ -0,0 +1,87 @@
+// #################################################################################################################
+//
+//  ███    ███  █████  ████████  ██████ ██   ██ ██████   █████  ██    ██     ███    ███  ██████  ██████  ███████ ██
+//  ████  ████ ██   ██    ██    ██      ██   ██ ██   ██ ██   ██  ██  ██      ████  ████ ██    ██ ██   ██ ██      ██
+//  ██ ████ ██ ███████    ██    ██      ███████ ██   ██ ███████   ████       ██ ████ ██ ██    ██ ██   ██ █████   ██
+//  ██  ██  ██ ██   ██    ██    ██      ██   ██ ██   ██ ██   ██    ██        ██  ██  ██ ██    ██ ██   ██ ██      ██
+//  ██      ██ ██   ██    ██     ██████ ██   ██ ██████  ██   ██    ██        ██      ██  ██████  ██████  ███████ ███████
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Matchday%20Model
+//
+//
+/*
+
+    Matches of one matchday from one request
+
+    getmatchdata/<league>/<season>/<matchday> has every match of the matchday with
+    matchID, kickoff, teams and final whistle. MatchdayModel keeps that body (kickoffs
+    converted to time_t once) and the Liga task derives in memory what used to be three
+    requests with three parsers, so the views can never disagree:
+
+    - live matches: kicked off, not finished, kickoff at most MAX_MATCH_DURATION ago
+    - next matches (nearest kickoff ahead) and planned matches (later kickoffs)
+    - next kickoff of the league
+
+    After the last kickoff of a matchday the model of the following matchday
+    (ligaNextMatchdayModel) gives next matches and next kickoff; at season end there
+    are none. The views only change with a new body, a final whistle (marked by the goal
+    polls without a request) or when the clock passes a kickoff or the end of a live
+    match; version() and the kickoff queries give PollScheduler these moments.
+
+*/
+#ifndef MatchdayModel_h
+#define MatchdayModel_h
+
+#include <Arduino.h>
+#include <time.h>
+#include "Liga.h"
+
+#define MATCHDAY_NEVER ((time_t)INT32_MAX)                                      // no kickoff / no change ahead
+
+// one match of the matchday
+struct MatchdayMatch {
+    uint32_t matchID;
+    time_t   kickoff;                                                           // 0 = no kickoff date
+    bool     finished;
+    char     team1[MAX_TEAMNAME_LENGTH];
+    char     team2[MAX_TEAMNAME_LENGTH];
+};
+
+class MatchdayModel {
+   public:
+    MatchdayModel();
+
+    void clear();                                                               // no body known
+
+    // body of getmatchdata/<league>/<season>/<matchday>
+    void begin(int matchday);                                                   // new body: matches are rebuilt
+    void add(uint32_t matchID, const char* kickoff, bool finished, const char* team1, const char* team2);
+    void end();
+    bool matchFinished(uint32_t matchID);                                       // final whistle from getmatchdata/<matchID>
+
+    int                  matchday() const { return _matchday; }                 // 0 = no body
+    uint8_t              count() const { return _count; }
+    uint8_t              finishedCount() const;
+    uint32_t             version() const { return _version; }                   // new body or final whistle
+    const MatchdayMatch& match(uint8_t i) const { return _matches[i]; }
+
+    // views, derived in memory
+    uint8_t liveMatches(time_t now, MatchInfo* live) const;                     // live matches into live[], count
+    uint8_t nextMatches(time_t now, MatchInfo* next, MatchInfo* plan, uint8_t& planCount) const; // nearest / later kickoffs
+    time_t  nextKickoff(time_t now) const;                                      // first kickoff after now, MATCHDAY_NEVER if none
+    time_t  liveChangeAfter(time_t t) const;                                    // next kickoff or end of a live match after t
+    bool    pending(time_t now) const;                                          // a match is ahead or live
+
+   private:
+    MatchdayMatch _matches[MAX_MATCHES_PER_MATCHDAY];
+    uint8_t       _count;
+    int           _matchday;
+    uint32_t      _version;
+};
+
+extern MatchdayModel ligaMatchdayModel;                                         // current matchday of the loaded league
+extern MatchdayModel ligaNextMatchdayModel;                                     // following matchday, after the last kickoff
+
+#endif // MatchdayModel_h
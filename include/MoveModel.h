@@ -0,0 +1,75 @@
+// #################################################################################################################
+//
+//  ███    ███  ██████  ██    ██ ███████     ███    ███  ██████  ██████  ███████ ██
+//  ████  ████ ██    ██ ██    ██ ██          ████  ████ ██    ██ ██   ██ ██      ██
+//  ██ ████ ██ ██    ██ ██    ██ █████       ██ ████ ██ ██    ██ ██   ██ █████   ██
+//  ██  ██  ██ ██    ██  ██  ██  ██          ██  ██  ██ ██    ██ ██   ██ ██      ██
+//  ██      ██  ██████    ████   ███████     ██      ██  ██████  ██████  ███████ ███████
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Move%20Model
+//
+/*
+
+    Self-learning duration model of one flap module for the AreYouReady limiter
+
+    For every LONG command the static ETA (estimateAYRdurationMs + guards) is scaled by a
+    learned factor per command type. The factor is fitted from the ARE_YOU_READY answers:
+
+    - BUSY seen, then READY:  the module finished between both probes → move toward the later part
+    - READY on the first probe: the module finished earlier than planned → shrink the factor a bit,
+      so the first probe keeps approaching the real end of the move
+
+    Once MOVE_MODEL_MIN_SAMPLES samples are known, planFirstPollAt() probes at the learned
+    ETA + MOVE_MODEL_MARGIN_MS instead of static ETA + overshoot. Timeouts stay static.
+    The model is stored per serial number in SPIFFS (/ayr_<serial>.bin).
+
+*/
+#ifndef MoveModel_h
+#define MoveModel_h
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#define MOVE_MODEL_COMMANDS 5                                                   // MOVE, CALIBRATE, SPEED_MEASURE, STEP_MEASURE, SENSOR_CHECK
+#define MOVE_MODEL_MIN_SAMPLES 3                                                // samples before the model drives the first poll
+#define MOVE_MODEL_MARGIN_MS 40                                                 // first poll after learned end of move
+#define MOVE_MODEL_SHRINK 0.02f                                                 // factor step down after READY on first probe
+#define MOVE_MODEL_ALPHA 0.2f                                                   // weight of a new BUSY/READY sample
+#define MOVE_MODEL_MIN_SCALE 0.5f                                               // learned ETA at least 50% of static ETA
+#define MOVE_MODEL_MAX_SCALE 1.5f                                               // learned ETA at most 150% of static ETA
+#define MOVE_MODEL_SAVE_MS (10UL * 60UL * 1000UL)                               // min. time between two flash writes
+#define MOVE_MODEL_VERSION 1                                                    // file layout
+
+class MoveModel {
+   public:
+    MoveModel();
+
+    uint32_t predict(uint8_t longCmd, uint32_t staticEtaMs) const;              // learned ETA, 0 = not learned yet
+    void     learn(uint8_t longCmd, uint32_t staticEtaMs, uint32_t lastBusyMs, uint32_t readyMs); // lastBusyMs 0 = READY on first probe
+    void     sync(uint32_t serialnumber);                                       // load model of module, save if changed
+    float    scale(uint8_t longCmd) const;                                      // learned factor (1.0 = static)
+    uint16_t samples(uint8_t longCmd) const;                                    // samples of command
+
+   private:
+    struct Stored {
+        uint32_t version;
+        uint32_t serialnumber;
+        float    scale[MOVE_MODEL_COMMANDS];
+        uint16_t samples[MOVE_MODEL_COMMANDS];
+    };
+
+    int  slot(uint8_t longCmd) const;                                           // index of command, -1 = not modelled
+    void fileName(char* buf, size_t size, uint32_t serialnumber) const;
+    bool load(uint32_t serialnumber);
+    bool save();
+
+    Stored            _data;                                                    // model of _data.serialnumber
+    bool              _dirty;                                                   // learned since last save
+    uint32_t          _savedMs;                                                 // millis() of last save
+    SemaphoreHandle_t _lock;                                                    // twin task learns, scheduler task saves
+};
+
+#endif                                                                          // MoveModel_h
@@ -51,7 +51,7 @@ class ParserClass {
     void       analyseClickEvent();                                             // analyse if there is more than a single click
     void       dispatchToTwins();                                               // dispatch key stroke to twins for execution
     void       dispatchToOther();                                               // dispatch key stroke to other task for execution
-    void       toggleLeague();                                                  // toggle between BL1 and BL2
+    void       toggleLeague();                                                  // toggle shown league BL1 / BL2 / BL3
 
     // Parser trace
     template <typename... Args>
@@ -0,0 +1,103 @@
+// #################################################################################################################
+//
+//  ██████   ██████  ██      ██          ███████  ██████ ██   ██ ███████ ██████  ██    ██ ██      ███████ ██████
+//  ██   ██ ██    ██ ██      ██          ██      ██      ██   ██ ██      ██   ██ ██    ██ ██      ██      ██   ██
+//  ██████  ██    ██ ██      ██          ███████ ██      ███████ █████   ██   ██ ██    ██ ██      █████   ██████
+//  ██      ██    ██ ██      ██               ██ ██      ██   ██ ██      ██   ██ ██    ██ ██      ██      ██   ██
+//  ██       ██████  ███████ ███████     ███████  ██████ ██   ██ ███████ ██████   ██████  ███████ ███████ ██   ██
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Poll%20Scheduler
+//
+//
+/*
+
+    Deadline-driven poll scheduler of the Liga task
+
+    Every PollScope has a deadline; an indexed binary min-heap orders them by deadline
+    and cycle order, a poll cycle runs the scopes whose deadline has passed. The deadlines
+    follow the kickoff schedule of the whole matchday (MatchdayModel of the getmatchdata
+    body of the matchday), so a scope only runs when its data can have changed:
+
+    - FETCH_MATCHES on a new matchday, on changes of openLigaDB and once per POLL_IDLE_S
+      after the last match of the matchday (kickoffs of the following matchday)
+    - CALC_LIVE_MATCHES, CALC_NEXT_MATCH_LIST and CALC_NEXT_KICKOFF (no request) after
+      every new model or final whistle and when the clock passes a kickoff or the end of
+      a live window (staggered kickoffs start their own live window)
+    - FETCH_LIVE_GOALS every POLL_GOALS_S while matches are live, the live table follows
+    - FETCH_TABLE after a new goal (again after POLL_TABLE_SETTLE_S) and after a final
+      whistle, the leader / relegation ghost / red lantern detectors follow once
+    - CHECK_FOR_CHANGES every POLL_IDLE_S and POLL_PRELIVE_CHECK_S before the next
+      kickoff, never while matches are live (the goal polls see every change)
+    - FETCH_CURRENT_MATCHDAY only when the matchday has no match left
+
+    Events (changes of openLigaDB, new goals, final whistles, new matchday) make a scope
+    due at once. The poll mode is no longer a cycle selector, only the label of the state
+    (mode()). One PollScheduler per league, ligaPolls belongs to the loaded league
+    (LeagueScheduler swaps it with the other Liga globals).
+
+*/
+#ifndef PollScheduler_h
+#define PollScheduler_h
+
+#include <Arduino.h>
+#include <time.h>
+#include "Liga.h"
+#include "MatchdayModel.h"
+
+#define POLL_NEVER MATCHDAY_NEVER                                               // scope not needed
+#define POLL_GOALS_S (POLL_DURING_GAME / 1000)                                  // goal polls while matches are live
+#define POLL_IDLE_S (POLL_NORMAL / 1000)                                        // CHECK_FOR_CHANGES outside of live windows
+#define POLL_BACKOFF_S (POLL_WAIT / 1000)                                       // openLigaDB refused the connection
+#define POLL_RETRY_S 60                                                         // bootstrap scope without result
+#define POLL_SEASON_S (24 * 60 * 60)                                            // season is calculated once a day
+#define POLL_PRELIVE_CHECK_S (10 * 60)                                          // CHECK_FOR_CHANGES before the next kickoff
+#define POLL_TABLE_SETTLE_S 120                                                 // table once more after a goal (late update)
+
+class PollScheduler {
+   public:
+    PollScheduler();
+
+    void      reset();                                                          // nothing known: bootstrap scopes due now
+    void      beginCycle() { _ranMask = 0; }                                    // every scope runs once per cycle at most
+    bool      pop(time_t now, PollScope& scope);                                // earliest due scope of this cycle
+    void      done(PollScope scope, time_t now);                                // scope ran: events, new deadlines
+    uint32_t  waitMs(time_t now) const;                                         // until the earliest deadline
+    PollMode  mode(time_t now) const;                                           // label of the state for reports and log
+    time_t    deadline(PollScope scope) const { return _deadline[scope]; }      // POLL_NEVER if not queued
+    PollScope nextScope() const { return (PollScope)_heap[0]; }                 // valid if waitMs() < POLL_IDLE_S
+    uint32_t  runs(PollScope scope) const { return _runs[scope]; }
+
+   private:
+    time_t rule(PollScope scope, time_t now) const;                             // deadline from state, without events
+    void   plan(time_t now);                                                    // deadlines of all scopes into the heap
+    void   matchesChanged();                                                    // new model or final whistle: views, table
+    void   want(PollScope scope) { _wanted |= (1u << scope); }                  // event: due at once
+    void   queue(uint8_t scope, time_t at);
+    void   unqueue(uint8_t scope);
+    bool   before(uint8_t a, uint8_t b) const;                                  // heap order: deadline, then cycle order
+    void   siftUp(uint8_t i);
+    void   siftDown(uint8_t i);
+    void   place(uint8_t i, uint8_t scope);
+
+    time_t         _deadline[POLL_SCOPE_COUNT];
+    time_t         _last[POLL_SCOPE_COUNT];                                     // last run, 0 = never
+    uint32_t       _runs[POLL_SCOPE_COUNT];
+    uint8_t        _heap[POLL_SCOPE_COUNT];                                     // scopes, earliest deadline first
+    int8_t         _pos[POLL_SCOPE_COUNT];                                      // index in _heap, -1 = not queued
+    uint8_t        _heapSize;
+    uint32_t       _wanted;                                                     // scopes due by event
+    uint32_t       _ranMask;                                                    // scopes of the running cycle
+    time_t         _backoffUntil;
+    time_t         _tableRecheck;                                               // FETCH_TABLE after a goal
+    int            _matchday;                                                   // matchday of the schedule
+    int            _lastGoalID;                                                 // newest goal seen by FETCH_LIVE_GOALS
+    uint32_t       _matchesVersion;                                             // ligaMatchdayModel.version() seen last
+    uint32_t       _nextMatchesVersion;                                         // ligaNextMatchdayModel.version() seen last
+    uint8_t        _finishedCount;                                              // final whistles in ligaMatchdayModel
+};
+
+extern PollScheduler ligaPolls;                                                 // scheduler of the loaded league
+
+#endif // PollScheduler_h
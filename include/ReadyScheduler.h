@@ -0,0 +1,118 @@
+// #################################################################################################################
+//
+//  ██████  ███████  █████  ██████  ██    ██     ███████  ██████ ██   ██ ███████ ██████  ██    ██ ██      ███████ ██████
+//  ██   ██ ██      ██   ██ ██   ██  ██  ██      ██      ██      ██   ██ ██      ██   ██ ██    ██ ██      ██      ██   ██
+//  ██████  █████   ███████ ██   ██   ████       ███████ ██      ███████ █████   ██   ██ ██    ██ ██      █████   ██████
+//  ██   ██ ██      ██   ██ ██   ██    ██             ██ ██      ██   ██ ██      ██   ██ ██    ██ ██      ██      ██   ██
+//  ██   ██ ███████ ██   ██ ██████     ██        ███████  ██████ ██   ██ ███████ ██████   ██████  ███████ ███████ ██   ██
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Ready%20Scheduler
+//
+/*
+
+    Shared ARE_YOU_READY scheduler for all twins (timer wheel)
+
+    After a LONG command a twin does not poll its slave itself. It books a ticket with the
+    first-poll time of its ETA plan and its timeout, and sleeps until the scheduler wakes it
+    with a task notification. One scheduler task serves all twins:
+
+    - a hashed timer wheel of READY_WHEEL_SLOTS slots with READY_WHEEL_TICK_MS each,
+      ETAs beyond one revolution wait extra rounds
+    - due probes are sent one after the other in the order of their planned time,
+      so ARE_YOU_READY probes never collide on the bus
+    - BUSY answers are re-booked: READY_POLL_MS inside the READY_WINDOW_MS after the
+      first poll, READY_FOLLOW_UP_MS afterwards, never beyond the timeout
+
+    Until readyPollTask is running (setup), the waiting caller drives the wheel itself.
+    While the wheel is idle the task loads and saves the MoveModel of every twin.
+
+*/
+#ifndef ReadyScheduler_h
+#define ReadyScheduler_h
+
+#include <Arduino.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <FlapGlobal.h>
+#include "TracePrint.h"
+
+#define READY_WHEEL_TICK_MS 10                                                  // resolution of the wheel
+#define READY_WHEEL_SLOTS 128                                                   // one revolution = 1.28 s
+#define READY_WHEEL_ENTRIES (numberOfTwins + 2)                                 // one wait per twin + spare
+#define READY_FOLLOW_UP_MS 200                                                  // AYR cadence after the fast window
+#define READY_MODEL_SYNC_MS 5000                                                // idle cycle to load / persist MoveModel
+
+class SlaveTwin;
+
+// ----------------------------
+// one booked wait, owned by the waiting task
+struct ReadyTicket {
+    std::atomic<bool> done{false};                                              // scheduler finished this ticket
+    bool              ready  = false;                                           // READY observed before timeout
+    uint16_t          polls  = 0;                                               // AYR probes used
+    uint32_t          startMs    = 0;                                           // millis() at booking
+    uint32_t          lastBusyMs = 0;                                           // last BUSY after booking, 0 = none
+    uint32_t          readyMs    = 0;                                           // READY after booking
+    TaskHandle_t      waiter = nullptr;                                         // task to notify
+};
+
+class ReadyScheduler {
+   public:
+    ReadyScheduler();
+
+    bool     book(SlaveTwin* twin, ReadyTicket& ticket, uint32_t firstPollMs, uint32_t timeoutMs); // false if wheel is full
+    bool     await(ReadyTicket& ticket);                                        // sleep until ticket is done, returns ready
+    bool     wait(SlaveTwin* twin, uint32_t firstPollMs, uint32_t timeoutMs);   // book + await for the calling task
+    void     attach(TaskHandle_t task);                                         // scheduler task created, wake it from now on
+    void     run();                                                             // scheduler task loop (readyPollTask)
+
+    // statistics
+    uint32_t probes() const { return _probes; }                                 // AYR probes sent
+    uint32_t readyCount() const { return _ready; }                              // waits finished READY
+    uint32_t timeouts() const { return _timeouts; }                             // waits finished by timeout
+    uint32_t maxLateMs() const { return _maxLateMs; }                           // worst delay of a probe behind its plan
+
+    template <typename... Args>                                                 // scheduler trace with new line
+    void readyPrintln(const Args&... args) const {
+        tracePrintln("[AYR SCHEDULER   ] ", args...);
+    }
+
+   private:
+    struct Entry {
+        SlaveTwin*   twin;                                                      // twin to probe
+        ReadyTicket* ticket;                                                    // result goes here
+        uint32_t     dueMs;                                                     // planned probe time (millis)
+        uint32_t     windowEndMs;                                               // end of fast poll window (millis)
+        uint32_t     timeoutMs;                                                 // give up after (millis)
+        uint16_t     rounds;                                                    // wheel revolutions left
+        int16_t      next;                                                      // next entry in slot / free list
+    };
+
+    uint32_t service();                                                         // probe due entries, returns ms to next tick
+    void     insert(int16_t e);                                                 // put entry into its wheel slot, _lock held
+    void     finish(int16_t e, bool ready);                                     // wake waiter and free entry, _lock held
+
+    Entry             _entries[READY_WHEEL_ENTRIES];
+    int16_t           _slots[READY_WHEEL_SLOTS];                                // first entry per slot, -1 = empty
+    int16_t           _free;                                                    // free list of _entries
+    uint16_t          _cursor;                                                  // current slot
+    uint32_t          _wheelMs;                                                 // time of current slot (millis)
+    uint16_t          _pending;                                                 // entries in wheel
+    SemaphoreHandle_t _lock;                                                    // protects wheel and entries
+    SemaphoreHandle_t _serviceLock;                                             // one caller drives the wheel at a time
+
+    std::atomic<TaskHandle_t> _task;                                            // scheduler task, nullptr until attach()
+
+    uint32_t _probes;
+    uint32_t _ready;
+    uint32_t _timeouts;
+    uint32_t _maxLateMs;
+};
+
+extern ReadyScheduler* ReadyPoll;                                               // shared AYR scheduler
+
+#endif                                                                          // ReadyScheduler_h
@@ -23,4 +23,7 @@ void twinRegister(void* pvParameters);
 void reportTask(void* pvParameters);                                            // free RTOS Task for Report Task
 void statisticTask(void* param);                                                // free RTOS Task for Statistics Task
 void slaveTwinTask(void* pvParameters);                                         // free RTOS Task for Twin 0...n
+void readyPollTask(void* pvParameters);                                         // free RTOS Task for shared ARE_YOU_READY scheduler
+void traceLogTask(void* pvParameters);                                          // free RTOS Task writing the trace ring to Serial
+void livePushTask(void* pvParameters);                                          // free RTOS Task pushing live events to subscribers
 #endif                                                                          // RtosTasks_h
@@ -29,6 +29,17 @@
     - scan for new devices
     - remote control via IR
 
+    Command queue
+    -------------
+    Every twin owns a bounded queue of TWIN_QUEUE_DEPTH commands that its task works off
+    in order. Senders (registry, parser, Liga redraws) no longer overwrite each other:
+    - consecutive TWIN_SHOW_FLAP collapse to the last target (no move to a stale flap)
+    - on a full queue a new TWIN_SHOW_FLAP replaces the oldest queued TWIN_SHOW_FLAP
+    - manual moves (next/prev flap or steps) are dropped on a full queue
+    - show-flap and manual moves never use the last TWIN_QUEUE_RESERVED slots
+    - all other commands (calibration, availability, register ...) are never dropped, they
+      find a reserved slot or wait for a free one without timeout
+
 */
 #ifndef SlaveTwin_h
 #define SlaveTwin_h
@@ -36,10 +47,17 @@
 #include <Arduino.h>
 #include "sstream"
 #include "driver/i2c.h"
+#include <freertos/semphr.h>
 #include <FlapGlobal.h>
 #include "TracePrint.h"
 #include "RemoteControl.h"
 #include "AreYouReadyLimiter.h"
+#include "MoveModel.h"
+#include "ReadyScheduler.h"
+
+#define TWIN_QUEUE_DEPTH 8                                                      // pending commands per twin
+#define TWIN_QUEUE_RESERVED 2                                                   // slots kept free for commands that are never dropped
+#define TWIN_QUEUE_SEND_TIMEOUT_MS 2000                                         // max. wait of a show-flap sender for a free slot
 
 enum TwinCommands {
     TWIN_NO_COMMAND        = 0,                                                 // no command
@@ -141,26 +159,62 @@ class SlaveTwin {
     esp_err_t i2cMidCommand(MidMessage midCmd, I2Caddress slaveaddress, uint8_t* answer, int size); // send mid command to slave
     esp_err_t i2cShortCommand(ShortMessage ShortCommand, uint8_t* answer, int size); // send short command to slave
 
+    // ---------------------------
+    // display frame (FlapRegistry::showFrame drives many twins at once)
+    bool     tryLockCommands(TickType_t wait);                                  // reserve twin, no queued command runs meanwhile
+    void     unlockCommands();                                                  // release twin
+    void     dropQueuedShowFlap();                                              // queued TWIN_SHOW_FLAP superseded by frame
+    uint16_t planFrameMove(int flapnumber);                                     // steps to flapnumber, 0 = no move
+    bool     sendFrameMove(uint16_t steps, uint32_t& firstPollMs, uint32_t& timeoutMs); // MOVE, caller holds I2C semaphore
+    void     finishFrameMove(const ReadyTicket* ticket);                        // learn, read state and update registry (nullptr = failed)
+
+    // ---------------------------
+    // self-learning move duration
+    void             syncMoveModel() { _moveModel.sync(_parameter.serialnumber); } // load / persist model of connected module
+    const MoveModel& moveModel() const { return _moveModel; }                   // learned durations (reporting)
+
     // ---------------------------
     // RTOS queue procedures
     void readQueue();                                                           // read command from Twin queue
     void createQueue();                                                         // create queue for Twin commands
     bool sendQueue(TwinCommand twinCmd);                                        // send command to Twin queue
+    uint8_t  queueDepth() const { return _cmdCount; }                           // commands waiting now
+    uint8_t  queueMaxDepth() const { return _cmdMaxDepth; }                     // most commands waiting at once
+    uint32_t queueCommands() const { return _cmdQueued; }                       // commands accepted into queue
+    uint32_t queueCoalesced() const { return _cmdCoalesced; }                   // TWIN_SHOW_FLAP merged into a queued one
+    uint32_t queueDropped() const { return _cmdDropped; }                       // commands rejected (queue full)
     int  stepsByFlap[MAXIMUM_FLAPS];                                            // steps needed to move flap by flap (Bresenham-artige Verteilung)
 
    private:
     // -------------------------------
     // private Variables
     int           _targetFlapNumber = -1;                                       // flap to be shown
-    QueueHandle_t _twinQueue;                                                   // command entry queue
+
+    // --- command queue (ring buffer, see header comment) ---
+    TwinCommand       _cmdRing[TWIN_QUEUE_DEPTH];                               // pending commands, oldest at _cmdHead
+    uint8_t           _cmdHead      = 0;                                        // index of next command to run
+    uint8_t           _cmdCount     = 0;                                        // commands in ring
+    uint8_t           _cmdMoves     = 0;                                        // show-flap and manual moves in ring
+    uint8_t           _cmdMaxDepth  = 0;
+    uint32_t          _cmdQueued    = 0;
+    uint32_t          _cmdCoalesced = 0;
+    uint32_t          _cmdDropped   = 0;
+    SemaphoreHandle_t _cmdLock      = nullptr;                                  // protects ring and counters
+    SemaphoreHandle_t _cmdReady     = nullptr;                                  // counts commands in ring
+    SemaphoreHandle_t _cmdSpace     = nullptr;                                  // counts free slots in ring
+    SemaphoreHandle_t _runLock      = nullptr;                                  // held while a command or display frame drives the twin
 
     // --- Per-instance state for AYR/ready polling ---
     bool     _inAYRwait            = false;                                     // true while AYR-based wait is running
     uint32_t _readyPollGateUntilMs = 0;                                         // next allowed millis() for external ready polls
+    MoveModel _moveModel;                                                       // learned durations of LONG commands
+    uint32_t  _frameEtaMs           = 0;                                        // static ETA of running display frame MOVE
 
     // -------------------------------
     // internal Helpers
     void systemHalt(const char* reason, int blinkCode);                         // system halt with reason and blink code
+    bool coalesceCommand(const TwinCommand& twinCmd);                           // merge TWIN_SHOW_FLAP into ring (lock held)
+    void appendCommand(const TwinCommand& twinCmd);                             // put command at end of ring (lock held)
     void twinControl(TwinCommand twinCmd);                                      // handle Twin command
     void logAndRun(const char* message, std::function<void()> action);          // log message and run action
     void printSlaveReadyInfo();                                                 // trace output Read Structure
@@ -170,6 +224,7 @@ class SlaveTwin {
     // ---------------------------
     // I2C Helper
     LongMessage i2cCommandParameter(i2cCommand command, u_int16_t parameter);   // prepare I2C LongCommand from paramter
+    esp_err_t   i2cLongTransfer(LongMessage mess);                              // long command, I2C semaphore already taken
 
     // -------------------------------
     // internal i2c Helpers
@@ -0,0 +1,75 @@
+// #################################################################################################################
+//
+//  ███████ ████████  █████  ████████ ██    ██ ███████     ███    ███  ██████  ██████  ███████ ██
+//  ██         ██    ██   ██    ██    ██    ██ ██          ████  ████ ██    ██ ██   ██ ██      ██
+//  ███████    ██    ███████    ██    ██    ██ ███████     ██ ████ ██ ██    ██ ██   ██ █████   ██
+//       ██    ██    ██   ██    ██    ██    ██      ██     ██  ██  ██ ██    ██ ██   ██ ██      ██
+//  ███████    ██    ██   ██    ██     ██████  ███████     ██      ██  ██████  ██████  ███████ ███████
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Status%20Model
+//
+/*
+
+    In-memory status documents for the web server
+
+    FlapReporting publishes every new task and poll status into a StatusDocument. The
+    document is serialized to JSON once (flat documents are rendered to HTML once as well)
+    and gets a new version and an ETag (FNV-1a of the body). The endpoints /1, /2 and
+    /status send the pre-rendered body from RAM and answer a matching If-None-Match with
+    304 Not Modified.
+
+    - SPIFFS is written for persistence only and read once after boot, as long as this
+      run has not published a status yet
+    - publish() swaps a shared body: a response that is still sending keeps the body
+      it started with, the next request gets the new one
+
+*/
+#ifndef StatusModel_h
+#define StatusModel_h
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <atomic>
+#include <memory>
+
+class AsyncWebServerRequest;
+
+// one rendered version of a status document
+struct StatusBody {
+    uint32_t version;                                                           // 0 = restored from SPIFFS
+    String   json;                                                              // compact JSON incl. _meta
+    String   html;                                                              // key/value page, empty for nested documents
+    char     etag[12];                                                          // "xxxxxxxx" of json
+    char     htmlEtag[13];                                                      // "xxxxxxxxh" of json
+};
+
+class StatusDocument {
+   public:
+    StatusDocument(const char* filename, bool withHtml);
+
+    void publish(JsonDocument& doc);                                            // render new version (doc incl. _meta)
+    bool send(AsyncWebServerRequest* request, bool html);                       // false: no status yet
+
+    uint32_t version() const { return _version.load(); }
+    uint32_t served() const { return _served.load(); }                          // 200 responses
+    uint32_t notModified() const { return _notModified.load(); }                // 304 responses
+
+   private:
+    void   restore();                                                           // once: status of last run from SPIFFS
+    String renderHtml(JsonDocument& doc) const;
+
+    const char*                       _filename;                                // persistence in SPIFFS
+    bool                              _withHtml;                                // flat document, /status page
+    std::shared_ptr<const StatusBody> _body;                                    // only with std::atomic_load/store
+    std::atomic<uint32_t>             _version{0};
+    std::atomic<bool>                 _restored{false};
+    std::atomic<uint32_t>             _served{0};
+    std::atomic<uint32_t>             _notModified{0};
+};
+
+extern StatusDocument TaskStatusDoc;                                            // /1 and /status
+extern StatusDocument PollStatusDoc;                                            // /2
+
+#endif // StatusModel_h
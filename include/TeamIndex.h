@@ -0,0 +1,31 @@
+
+/*
+
+    Team name -> dense team index, perfect hash generated at compile time
+
+    All teams of DFB1, DFB2 and DFB3 get a dense index 0..TEAM_COUNT-1 in this order. A constexpr
+    search finds a seed for which the hash of every team name lands in its own slot of a
+    TEAM_HASH_SLOTS table, so a lookup is one hash, one slot and one strcmp to reject
+    unknown names. The table lives in flash, no heap, no scan over the DFB arrays.
+
+    - the build fails (static_assert) if a new team collides for every seed:
+      double TEAM_HASH_SLOTS
+    - the index of a table row is kept in LigaRow::teamIdx, so rows are compared and found
+      by index instead of by name
+
+*/
+#ifndef TeamIndex_h
+#define TeamIndex_h
+
+#include <Arduino.h>
+#include "Liga.h"
+
+#define TEAM_HASH_SLOTS 256                                                     // power of 2, > 4 * TEAM_COUNT keeps the seed search short
+#define TEAM_NONE -1                                                            // name not in DFB1/DFB2/DFB3
+
+constexpr int TEAM_COUNT = sizeof(DFB1) / sizeof(DFB1[0]) + sizeof(DFB2) / sizeof(DFB2[0]) + sizeof(DFB3) / sizeof(DFB3[0]);
+
+int           teamIndexOf(const char* teamName);                                // dense index or TEAM_NONE, O(1)
+const DfbMap& teamEntry(int index);                                             // entry in DFB1/DFB2/DFB3, index must be valid
+
+#endif                                                                          // TeamIndex_h
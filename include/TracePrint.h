@@ -1,6 +1,10 @@
 #ifndef TracePrint_h
 #define TracePrint_h
 
+#include <Arduino.h>
+#include <atomic>
+#include <type_traits>
+
 /*
 Usage examples:
 
@@ -77,40 +81,149 @@ Usage examples:
 
 */
 
+/*
+    Asynchronous trace
+
+    A tracePrint/tracePrintln/tracePrintf call does not write to Serial. It encodes prefix,
+    format and raw arguments into one TraceRecord (strings are copied, numbers stay binary)
+    and puts it into a lock-free ring with several producers. The low priority task TraceLog
+    formats the records and writes them to Serial. So a trace line inside an I2C transaction
+    costs some µs instead of the time Serial needs at 115200 baud.
+
+    - a full ring drops the line and counts it, the caller never waits
+    - records longer than TRACE_RECORD_BYTES are cut and end with "..."; a record holds the
+      twin prefix, the longest format literal and one TRACE_TEXT_BYTES argument, so a call
+      site that builds its text (answer dumps, steps by flap) into a TRACE_TEXT_BYTES buffer
+      is never cut
+    - until TraceLog runs (and always with -DTRACESYNC) lines are written at once
+    - masterPrint and direct Serial output stay synchronous, they may overtake queued lines;
+      a line is therefore always one trace call, never a trace prefix followed by Serial.print
+    - TraceLog writes every line with one Serial.write and does not take the trace semaphore;
+      the ring serializes the producers, so twin and registry trace calls need no TraceScope
+      (it stays where a block mixes trace calls with direct Serial output)
+
+*/
+
+#define TRACE_RING_SLOTS 64                                                     // records in ring (power of 2)
+#define TRACE_RECORD_BYTES 192                                                  // encoded prefix, format and arguments
+#define TRACE_TEXT_BYTES 96                                                     // text a call site builds for one line
+#define TRACE_DRAIN_IDLE_MS 10                                                  // TraceLog sleeps, if ring is empty
+#define TRACE_FORMAT_BUFFER 200                                                 // formatted printf line
+#define TRACE_LINE_BUFFER 256                                                   // prefix + formatted line + "...\r\n"
+
+enum TraceKind : uint8_t {
+    TRACE_PRINT,                                                                // prefix + arguments
+    TRACE_PRINTLN,                                                              // prefix + arguments + new line
+    TRACE_PRINTF,                                                               // prefix + printf format
+    TRACE_PRINTFLN                                                              // prefix + printf format + new line
+};
+
+enum TraceTag : uint8_t {
+    TRACE_INT,                                                                  // int64_t
+    TRACE_UINT,                                                                 // uint64_t
+    TRACE_CHAR,                                                                 // int64_t, printed as character
+    TRACE_DOUBLE,                                                               // double
+    TRACE_STR                                                                   // copied string with terminating 0
+};
+
+// one trace line: prefix, [format,] tagged arguments
+struct TraceRecord {
+    uint8_t  kind;                                                              // TraceKind
+    uint8_t  truncated;                                                         // record was too short
+    uint16_t length;                                                            // used bytes of data
+    uint8_t  data[TRACE_RECORD_BYTES];
+
+    explicit TraceRecord(TraceKind k) : kind(k), truncated(0), length(0) {}
+    void putStr(const char* s);                                                 // string with terminating 0
+    void putValue(TraceTag tag, const void* value, uint8_t size);               // tag + binary value
+};
+
+void     traceSubmit(const TraceRecord& record);                                // into ring, or write at once
+void     traceStart();                                                          // TraceLog runs, use ring from now on
+uint32_t traceDrain();                                                          // write queued records, returns number
+uint32_t traceWritten();                                                        // lines written by TraceLog
+uint32_t traceDropped();                                                        // lines lost because ring was full
+
+// ----------------------------
+// encode one argument
+
+inline void traceArg(TraceRecord& record, const char* s) {
+    record.putValue(TRACE_STR, nullptr, 0);                                     // tag only, string follows
+    record.putStr(s ? s : "(null)");
+}
+
+inline void traceArg(TraceRecord& record, char* s) {
+    traceArg(record, (const char*)s);
+}
+
+inline void traceArg(TraceRecord& record, const String& s) {
+    traceArg(record, s.c_str());
+}
+
+template <typename T>
+void traceArg(TraceRecord& record, const T& value) {
+    if constexpr (std::is_same_v<T, char>) {
+        int64_t v = value;
+        record.putValue(TRACE_CHAR, &v, sizeof(v));
+    } else if constexpr (std::is_floating_point_v<T>) {
+        double v = value;
+        record.putValue(TRACE_DOUBLE, &v, sizeof(v));
+    } else if constexpr (std::is_same_v<T, bool> || std::is_enum_v<T> || std::is_signed_v<T>) {
+        int64_t v = (int64_t)value;                                             // bool prints as 0/1 like Serial.print
+        record.putValue(TRACE_INT, &v, sizeof(v));
+    } else if constexpr (std::is_unsigned_v<T>) {
+        uint64_t v = value;
+        record.putValue(TRACE_UINT, &v, sizeof(v));
+    } else if constexpr (std::is_pointer_v<T>) {
+        uint64_t v = (uintptr_t)value;
+        record.putValue(TRACE_UINT, &v, sizeof(v));
+    } else {
+        traceArg(record, String(value));                                        // everything else String can take
+    }
+}
+
+// ----------------------------
+
 template <typename... Args>
 void tracePrint(const char* prefix, const Args&... args) {
-    Serial.print(prefix);
-    (Serial.print(args), ...);
+    TraceRecord record(TRACE_PRINT);
+    record.putStr(prefix);
+    (traceArg(record, args), ...);
+    traceSubmit(record);
 }
 
 template <typename... Args>
 void tracePrintln(const char* prefix, const Args&... args) {
-    Serial.print(prefix);
-    (Serial.print(args), ...);
-    Serial.println();
+    TraceRecord record(TRACE_PRINTLN);
+    record.putStr(prefix);
+    (traceArg(record, args), ...);
+    traceSubmit(record);
 }
 
 template <typename... Args>
 void tracePrintf(const char* prefix, const char* fmt, const Args&... args) {
-    char buf[200];
-    snprintf(buf, sizeof(buf), fmt, args...);
-    Serial.print(prefix);
-    Serial.print(buf);
+    TraceRecord record(TRACE_PRINTF);
+    record.putStr(prefix);
+    record.putStr(fmt);
+    (traceArg(record, args), ...);
+    traceSubmit(record);
 }
 template <typename... Args>
 void tracePrint(const char* prefix, const char* fmt, const Args&... args) {
-    char buf[200];
-    snprintf(buf, sizeof(buf), fmt, args...);
-    Serial.print(prefix);
-    Serial.print(buf);
+    TraceRecord record(TRACE_PRINTF);
+    record.putStr(prefix);
+    record.putStr(fmt);
+    (traceArg(record, args), ...);
+    traceSubmit(record);
 }
 
 template <typename... Args>
 void tracePrintln(const char* prefix, const char* fmt, const Args&... args) {
-    char buf[200];
-    snprintf(buf, sizeof(buf), fmt, args...);
-    Serial.print(prefix);
-    Serial.println(buf);
+    TraceRecord record(TRACE_PRINTFLN);
+    record.putStr(prefix);
+    record.putStr(fmt);
+    (traceArg(record, args), ...);
+    traceSubmit(record);
 }
 
 #endif                                                                          // TracePrint_h
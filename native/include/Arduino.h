@@ -0,0 +1,289 @@
+// Native shim: Arduino core subset (String, Serial, IPAddress, timing) for the host build
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <algorithm>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/timers.h"
+
+using std::max;
+using std::min;
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define PROGMEM
+#define IRAM_ATTR
+#define F(string_literal) (string_literal)
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_ptr(addr) (*(void* const*)(addr))
+#define strcpy_P strcpy
+#define strcmp_P strcmp
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+unsigned long millis();
+unsigned long micros();
+void          delay(uint32_t ms);
+void          delayMicroseconds(uint32_t us);
+void          yield();
+bool          getLocalTime(struct tm* info, uint32_t ms = 5000);
+void          configTime(long gmtOffset_sec, int daylightOffset_sec, const char* server1, const char* server2 = nullptr,
+                         const char* server3 = nullptr);
+void          configTzTime(const char* tz, const char* server1, const char* server2 = nullptr, const char* server3 = nullptr);
+
+// ----------------------------
+// Arduino String on top of std::string
+class String {
+   public:
+    String() = default;
+    String(const char* s) : _s(s ? s : "") {}
+    String(const std::string& s) : _s(s) {}
+    String(char c) : _s(1, c) {}
+    String(int value, unsigned char base = DEC) : _s(fromInteger((long long)value, base)) {}
+    String(unsigned int value, unsigned char base = DEC) : _s(fromUnsigned(value, base)) {}
+    String(long value, unsigned char base = DEC) : _s(fromInteger(value, base)) {}
+    String(unsigned long value, unsigned char base = DEC) : _s(fromUnsigned(value, base)) {}
+    String(long long value, unsigned char base = DEC) : _s(fromInteger(value, base)) {}
+    String(unsigned long long value, unsigned char base = DEC) : _s(fromUnsigned(value, base)) {}
+    String(float value, unsigned int decimals = 2) : _s(fromDouble(value, decimals)) {}
+    String(double value, unsigned int decimals = 2) : _s(fromDouble(value, decimals)) {}
+
+    String& operator=(const char* s) {
+        _s = s ? s : "";
+        return *this;
+    }
+
+    const char* c_str() const { return _s.c_str(); }
+    unsigned    length() const { return (unsigned)_s.size(); }
+    bool        isEmpty() const { return _s.empty(); }
+    bool        reserve(unsigned size) {
+        _s.reserve(size);
+        return true;
+    }
+    const std::string& str() const { return _s; }
+
+    bool concat(const String& s) {
+        _s += s._s;
+        return true;
+    }
+    bool concat(const char* s) {
+        if (s)
+            _s += s;
+        return true;
+    }
+    bool concat(const char* s, unsigned len) {
+        if (s)
+            _s.append(s, len);
+        return true;
+    }
+    bool concat(char c) {
+        _s += c;
+        return true;
+    }
+    template <typename T>
+    String& operator+=(const T& rhs) {
+        concat(String(rhs));
+        return *this;
+    }
+    String& operator+=(const char* rhs) {
+        concat(rhs);
+        return *this;
+    }
+    String& operator+=(char rhs) {
+        concat(rhs);
+        return *this;
+    }
+
+    char  charAt(unsigned index) const { return index < _s.size() ? _s[index] : 0; }
+    char  operator[](unsigned index) const { return charAt(index); }
+    char& operator[](unsigned index) { return _s[index]; }
+
+    bool equals(const String& s) const { return _s == s._s; }
+    bool equalsIgnoreCase(const String& s) const { return strcasecmp(_s.c_str(), s.c_str()) == 0; }
+    int  compareTo(const String& s) const { return _s.compare(s._s); }
+    bool startsWith(const String& prefix) const { return _s.compare(0, prefix._s.size(), prefix._s) == 0; }
+    bool endsWith(const String& suffix) const {
+        return _s.size() >= suffix._s.size() && _s.compare(_s.size() - suffix._s.size(), suffix._s.size(), suffix._s) == 0;
+    }
+
+    int indexOf(char c, unsigned from = 0) const { return toIndex(_s.find(c, from)); }
+    int indexOf(const String& s, unsigned from = 0) const { return toIndex(_s.find(s._s, from)); }
+    int lastIndexOf(char c) const { return toIndex(_s.rfind(c)); }
+    int lastIndexOf(const String& s) const { return toIndex(_s.rfind(s._s)); }
+
+    String substring(unsigned from) const { return from < _s.size() ? String(_s.substr(from)) : String(); }
+    String substring(unsigned from, unsigned to) const {
+        if (from > to)
+            std::swap(from, to);
+        if (from >= _s.size())
+            return String();
+        return String(_s.substr(from, to - from));
+    }
+
+    void remove(unsigned index) {
+        if (index < _s.size())
+            _s.erase(index);
+    }
+    void remove(unsigned index, unsigned count) {
+        if (index < _s.size())
+            _s.erase(index, count);
+    }
+    void replace(const String& find, const String& with) {
+        if (find._s.empty())
+            return;
+        for (size_t pos = _s.find(find._s); pos != std::string::npos; pos = _s.find(find._s, pos + with._s.size()))
+            _s.replace(pos, find._s.size(), with._s);
+    }
+    void trim() {
+        size_t b = _s.find_first_not_of(" \t\r\n");
+        size_t e = _s.find_last_not_of(" \t\r\n");
+        _s       = (b == std::string::npos) ? std::string() : _s.substr(b, e - b + 1);
+    }
+    void toUpperCase() { std::transform(_s.begin(), _s.end(), _s.begin(), ::toupper); }
+    void toLowerCase() { std::transform(_s.begin(), _s.end(), _s.begin(), ::tolower); }
+    long toInt() const { return atol(_s.c_str()); }
+    float toFloat() const { return (float)atof(_s.c_str()); }
+
+    friend bool operator==(const String& a, const String& b) { return a._s == b._s; }
+    friend bool operator==(const String& a, const char* b) { return a._s == (b ? b : ""); }
+    friend bool operator!=(const String& a, const String& b) { return a._s != b._s; }
+    friend bool operator!=(const String& a, const char* b) { return !(a == b); }
+    friend bool operator<(const String& a, const String& b) { return a._s < b._s; }
+
+    friend String operator+(const String& a, const String& b) { return String(a._s + b._s); }
+    friend String operator+(const String& a, const char* b) { return String(a._s + (b ? b : "")); }
+    friend String operator+(const char* a, const String& b) { return String((a ? a : "") + b._s); }
+    friend String operator+(const String& a, char b) { return String(a._s + b); }
+    template <typename T>
+    friend String operator+(const String& a, const T& b) {
+        return a + String(b);
+    }
+
+   private:
+    static int         toIndex(size_t pos) { return pos == std::string::npos ? -1 : (int)pos; }
+    static std::string fromUnsigned(unsigned long long value, unsigned char base) {
+        char buf[72];
+        char* p = buf + sizeof(buf) - 1;
+        *p      = 0;
+        do {
+            unsigned digit = (unsigned)(value % base);
+            *--p           = (char)(digit < 10 ? '0' + digit : 'A' + digit - 10);
+            value /= base;
+        } while (value);
+        return p;
+    }
+    static std::string fromInteger(long long value, unsigned char base) {
+        if (value < 0 && base == DEC)
+            return "-" + fromUnsigned((unsigned long long)(-value), base);
+        return fromUnsigned((unsigned long long)value, base);
+    }
+    static std::string fromDouble(double value, unsigned decimals) {
+        char buf[64];
+        snprintf(buf, sizeof(buf), "%.*f", (int)decimals, value);
+        return buf;
+    }
+
+    std::string _s;
+};
+
+// result type of String concatenation in the Arduino core, referenced by ArduinoJson
+class StringSumHelper : public String {
+   public:
+    using String::String;
+    StringSumHelper(const String& s) : String(s) {}
+};
+
+// ----------------------------
+// IPv4 address
+class IPAddress {
+   public:
+    IPAddress() = default;
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _bytes{a, b, c, d} {}
+    String  toString() const;
+    uint8_t operator[](int index) const { return _bytes[index]; }
+
+   private:
+    uint8_t _bytes[4] = {0, 0, 0, 0};
+};
+
+// ----------------------------
+// Serial: writes to stdout of the host process
+class HardwareSerial {
+   public:
+    void   begin(unsigned long baud) { (void)baud; }
+    void   end() {}
+    void   flush() { fflush(stdout); }
+    int    available() { return 0; }
+    int    read() { return -1; }
+    explicit operator bool() const { return true; }
+
+    size_t write(uint8_t c) { return fwrite(&c, 1, 1, stdout); }
+    size_t write(const uint8_t* buffer, size_t size) { return fwrite(buffer, 1, size, stdout); }
+    size_t write(const char* s) { return s ? fwrite(s, 1, strlen(s), stdout) : 0; }
+
+    size_t print(const char* s) { return write(s); }
+    size_t print(const String& s) { return write(s.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(const IPAddress& ip) { return print(ip.toString()); }
+    size_t print(int value, int base = DEC) { return print(String(value, (unsigned char)base)); }
+    size_t print(unsigned int value, int base = DEC) { return print(String(value, (unsigned char)base)); }
+    size_t print(long value, int base = DEC) { return print(String(value, (unsigned char)base)); }
+    size_t print(unsigned long value, int base = DEC) { return print(String(value, (unsigned char)base)); }
+    size_t print(long long value, int base = DEC) { return print(String(value, (unsigned char)base)); }
+    size_t print(unsigned long long value, int base = DEC) { return print(String(value, (unsigned char)base)); }
+    size_t print(unsigned char value, int base = DEC) { return print((unsigned int)value, base); }
+    size_t print(double value, int digits = 2) { return print(String(value, (unsigned)digits)); }
+
+    size_t println() { return write("\r\n"); }
+    template <typename T>
+    size_t println(const T& value) {
+        size_t n = print(value);
+        return n + println();
+    }
+    template <typename T>
+    size_t println(const T& value, int format) {
+        size_t n = print(value, format);
+        return n + println();
+    }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+        va_list args;
+        va_start(args, format);
+        int n = vprintf(format, args);
+        va_end(args);
+        return n < 0 ? 0 : (size_t)n;
+    }
+};
+
+extern HardwareSerial Serial;
+
+// ----------------------------
+// heap information, answered from fixed values on the host
+class EspClass {
+   public:
+    uint32_t getFreeHeap() { return 200u * 1024u; }
+    uint32_t getMinFreeHeap() { return 180u * 1024u; }
+    uint32_t getMaxAllocHeap() { return 110u * 1024u; }
+    uint32_t getHeapSize() { return 320u * 1024u; }
+    void     restart();
+};
+
+extern EspClass ESP;
+
+#endif // Arduino_h
@@ -0,0 +1,210 @@
+// Native shim: AsyncWebServer without sockets, handlers can be invoked with AsyncWebServer::dispatch() from host code
+// Signatures (overloads, defaults, return types) follow ESP32Async/ESPAsyncWebServer 3.7, the lib_deps of env:ESP32-WROOM-32D
+#ifndef ESPAsyncWebServer_h
+#define ESPAsyncWebServer_h
+
+#include <Arduino.h>
+#include <SPIFFS.h>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+typedef enum { HTTP_GET = 0b01, HTTP_POST = 0b10, HTTP_ANY = 0b11 } WebRequestMethod;
+
+using AwsResponseFiller = std::function<size_t(uint8_t* buffer, size_t maxLen, size_t index)>;
+using WebHeaders        = std::map<std::string, String>;
+
+class AsyncWebHeader {
+   public:
+    AsyncWebHeader(const String& name, const String& value) : _name(name), _value(value) {}
+    const String& name() const { return _name; }
+    const String& value() const { return _value; }
+
+   private:
+    String _name;
+    String _value;
+};
+
+class AsyncWebServerResponse {
+   public:
+    virtual ~AsyncWebServerResponse() = default;
+    bool addHeader(const char* name, const char* value, bool replaceExisting = true) {
+        if (!replaceExisting && headers.count(name))
+            return false;
+        headers[name] = value;
+        return true;
+    }
+
+    int        code = 200;
+    String     body;
+    WebHeaders headers;
+};
+
+class AsyncResponseStream : public AsyncWebServerResponse {
+   public:
+    size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+    size_t print(const String& s) { return write((const uint8_t*)s.c_str(), s.length()); }
+    size_t write(const uint8_t* data, size_t size) {
+        body += String(std::string((const char*)data, size));
+        return size;
+    }
+};
+
+class AsyncWebServerRequest {
+   public:
+    using ArDisconnectHandler = std::function<void(void)>;
+
+    explicit AsyncWebServerRequest(const String& url, const WebHeaders& headers = WebHeaders()) : _url(url) {
+        for (const auto& h : headers)
+            _headers.emplace_back(String(h.first.c_str()), h.second);
+    }
+    ~AsyncWebServerRequest() {
+        if (_onDisconnect)
+            _onDisconnect();
+    }
+
+    const String& url() const { return _url; }
+    void          onDisconnect(ArDisconnectHandler fn) { _onDisconnect = fn; }
+    bool          hasHeader(const char* name) const { return getHeader(name) != nullptr; }
+    const AsyncWebHeader* getHeader(const char* name) const;
+
+    AsyncWebServerResponse* beginResponse(int code, const char* contentType = "", const char* content = "");
+    AsyncWebServerResponse* beginResponse(const char* contentType, size_t len, AwsResponseFiller callback);
+    AsyncWebServerResponse* beginResponse(SPIFFSFS& fs, const String& path, const char* contentType);
+    AsyncResponseStream*    beginResponseStream(const char* contentType);
+
+    void send(AsyncWebServerResponse* response) { _response.reset(response); }
+    void send(int code, const char* contentType = "", const char* content = "") { send(beginResponse(code, contentType, content)); }
+    void send(SPIFFSFS& fs, const String& path, const char* contentType) { send(beginResponse(fs, path, contentType)); }
+
+    // host side: result of the handler
+    int               code() const { return _response ? _response->code : 0; }
+    String            body() const { return _response ? _response->body : String(); }
+    const WebHeaders* responseHeaders() const { return _response ? &_response->headers : nullptr; }
+
+   private:
+    String                                  _url;
+    std::vector<AsyncWebHeader>             _headers;
+    std::unique_ptr<AsyncWebServerResponse> _response;
+    ArDisconnectHandler                     _onDisconnect;
+};
+
+class AsyncWebHandler {
+   public:
+    virtual ~AsyncWebHandler() = default;
+};
+
+class AsyncEventSource;
+
+// host side: a subscriber records the SSE text it would receive; a slow one does not drain
+class AsyncEventSourceClient {
+   public:
+    explicit AsyncEventSourceClient(AsyncEventSource* source) : _source(source) {}
+    bool   send(const char* message, const char* event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
+    size_t packetsWaiting() const { return slow ? messages.size() : 0; }
+    void   close();                                                             // disconnects at once, deletes the client
+
+    std::vector<String> messages;
+    bool                slow = false;
+
+   private:
+    AsyncEventSource* _source;
+};
+
+class AsyncEventSource : public AsyncWebHandler {
+   public:
+    using ArEventHandlerFunction = std::function<void(AsyncEventSourceClient*)>;
+    typedef enum { DISCARDED = 0, ENQUEUED = 1, PARTIALLY_ENQUEUED = 2 } SendStatus;
+
+    explicit AsyncEventSource(const String& url) : _url(url) {}
+    ~AsyncEventSource() {
+        for (AsyncEventSourceClient* c : _clients)
+            delete c;
+    }
+    void       onConnect(ArEventHandlerFunction cb) { _connect = cb; }
+    void       onDisconnect(ArEventHandlerFunction cb) { _disconnect = cb; }
+    SendStatus send(const char* message, const char* event = nullptr, uint32_t id = 0, uint32_t reconnect = 0) {
+        std::lock_guard<std::recursive_mutex> lock(_mutex);
+        for (AsyncEventSourceClient* c : _clients)
+            c->send(message, event, id, reconnect);
+        return _clients.empty() ? DISCARDED : ENQUEUED;
+    }
+    size_t     count() {
+        std::lock_guard<std::recursive_mutex> lock(_mutex);
+        return _clients.size();
+    }
+
+    // host side: new subscriber / subscriber gone
+    AsyncEventSourceClient* connect() {
+        AsyncEventSourceClient* c = new AsyncEventSourceClient(this);
+        {
+            std::lock_guard<std::recursive_mutex> lock(_mutex);
+            _clients.push_back(c);
+        }
+        if (_connect)
+            _connect(c);
+        return c;
+    }
+    void disconnect(AsyncEventSourceClient* c) {
+        if (_disconnect)
+            _disconnect(c);
+        std::lock_guard<std::recursive_mutex> lock(_mutex);
+        for (size_t i = 0; i < _clients.size(); ++i)
+            if (_clients[i] == c)
+                _clients.erase(_clients.begin() + i);
+        delete c;
+    }
+
+   private:
+    String                               _url;
+    std::vector<AsyncEventSourceClient*> _clients;
+    std::recursive_mutex                 _mutex;
+    ArEventHandlerFunction               _connect;
+    ArEventHandlerFunction               _disconnect;
+};
+
+inline bool AsyncEventSourceClient::send(const char* message, const char* event, uint32_t id, uint32_t reconnect) {
+    String text;
+    if (reconnect)
+        text += String("retry: ") + String(reconnect) + "\n";
+    if (id)
+        text += String("id: ") + String(id) + "\n";
+    if (event)
+        text += String("event: ") + event + "\n";
+    text += String("data: ") + message + "\n\n";
+    messages.push_back(text);
+    return true;
+}
+
+inline void AsyncEventSourceClient::close() {
+    _source->disconnect(this);
+}
+
+class AsyncWebServer {
+   public:
+    using ArRequestHandlerFunction = std::function<void(AsyncWebServerRequest*)>;
+
+    explicit AsyncWebServer(uint16_t port = 80) : _port(port) {}
+    void begin() {}
+    void on(const char* uri, WebRequestMethod method, ArRequestHandlerFunction handler) { (void)method, _handlers[uri] = handler; }
+    void onNotFound(ArRequestHandlerFunction handler) { _notFound = handler; }
+    AsyncWebHandler& addHandler(AsyncWebHandler* handler) {
+        _webHandlers.push_back(handler);
+        return *handler;
+    }
+
+    // host side: run the handler of uri with request headers and return the response body (and headers)
+    String dispatch(const String& uri, int* code = nullptr, const WebHeaders& headers = WebHeaders(), WebHeaders* responseHeaders = nullptr);
+    // host side: handlers of addHandler(), e.g. the AsyncEventSource to connect subscribers
+    const std::vector<AsyncWebHandler*>& webHandlers() const { return _webHandlers; }
+
+   private:
+    uint16_t                                        _port;
+    std::map<std::string, ArRequestHandlerFunction> _handlers;
+    ArRequestHandlerFunction                        _notFound;
+    std::vector<AsyncWebHandler*>                   _webHandlers;
+};
+
+#endif // ESPAsyncWebServer_h
@@ -0,0 +1,42 @@
+// Native shim: Arduino File on top of a host FILE*
+#ifndef FS_h
+#define FS_h
+
+#include <Arduino.h>
+#include <memory>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+
+class File {
+   public:
+    File() = default;
+    explicit File(FILE* handle) : _handle(handle, &fclose) {}
+
+    explicit operator bool() const { return _handle != nullptr; }
+    void     close() { _handle.reset(); }
+    size_t   size() const;
+
+    size_t write(uint8_t c) { return _handle ? fwrite(&c, 1, 1, _handle.get()) : 0; }
+    size_t write(const uint8_t* buffer, size_t size) { return _handle ? fwrite(buffer, 1, size, _handle.get()) : 0; }
+    size_t print(const char* s) { return s ? write((const uint8_t*)s, strlen(s)) : 0; }
+    size_t print(const String& s) { return write((const uint8_t*)s.c_str(), s.length()); }
+    size_t println(const String& s) { return print(s) + print("\n"); }
+
+    int    read() { return _handle ? fgetc(_handle.get()) : -1; }
+    size_t readBytes(char* buffer, size_t length) { return _handle ? fread(buffer, 1, length, _handle.get()) : 0; }
+    int    available();
+    String readString();
+
+   private:
+    std::shared_ptr<FILE> _handle;
+};
+
+}  // namespace fs
+
+using fs::File;
+
+#endif // FS_h
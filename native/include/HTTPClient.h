@@ -0,0 +1,20 @@
+// Native shim: Arduino HTTPClient, GET is served by the same responder as esp_http_client
+#ifndef HTTPClient_h
+#define HTTPClient_h
+
+#include <Arduino.h>
+
+class HTTPClient {
+   public:
+    bool   begin(const String& url) { return (_url = url, true); }
+    int    GET();
+    String getString() { return _body; }
+    void   end() { _body = String(); }
+    static String errorToString(int error) { return String("HTTP error ") + String(error); }
+
+   private:
+    String _url;
+    String _body;
+};
+
+#endif // HTTPClient_h
@@ -0,0 +1,28 @@
+// Native shim: IR receiver that never decodes a key
+#ifndef IRrecv_h
+#define IRrecv_h
+
+#include <IRremoteESP8266.h>
+
+typedef enum { UNKNOWN = -1, UNUSED = 0, NEC = 3 } decode_type_t;
+
+class decode_results {
+   public:
+    decode_type_t decode_type = UNKNOWN;
+    uint64_t      value       = 0;
+    uint32_t      address     = 0;
+    uint32_t      command     = 0;
+    uint16_t      bits        = 0;
+    bool          repeat      = false;
+};
+
+class IRrecv {
+   public:
+    explicit IRrecv(uint16_t recvpin, uint16_t bufsize = 1024, uint8_t timeout = 15, bool save_buffer = false) { (void)recvpin, (void)bufsize, (void)timeout, (void)save_buffer; }
+    void enableIRIn(bool pullup = false) { (void)pullup; }
+    void disableIRIn() {}
+    bool decode(decode_results* results) { return (void)results, false; }
+    void resume() {}
+};
+
+#endif // IRrecv_h
@@ -0,0 +1,7 @@
+// Native shim: IR remote library, no receiver hardware on the host
+#ifndef IRremoteESP8266_h
+#define IRremoteESP8266_h
+
+#include <Arduino.h>
+
+#endif // IRremoteESP8266_h
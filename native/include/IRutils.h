@@ -0,0 +1,10 @@
+// Native shim: IR helper functions
+#ifndef IRutils_h
+#define IRutils_h
+
+#include <IRrecv.h>
+
+inline String resultToHumanReadableBasic(const decode_results* results) { return String((unsigned long long)results->value, HEX); }
+inline String typeToString(decode_type_t protocol, bool isRepeat = false) { return (void)isRepeat, String((int)protocol); }
+
+#endif // IRutils_h
@@ -0,0 +1,61 @@
+// #################################################################################################################
+//
+//  ███    ██  █████  ████████ ██ ██    ██ ███████          ██ ███████  ██████  ███    ██
+//  ████   ██ ██   ██    ██    ██ ██    ██ ██               ██ ██      ██    ██ ████   ██
+//  ██ ██  ██ ███████    ██    ██ ██    ██ █████            ██ ███████ ██    ██ ██ ██  ██
+//  ██  ██ ██ ██   ██    ██    ██  ██  ██  ██          ██   ██      ██ ██    ██ ██  ██ ██
+//  ██   ████ ██   ██    ██    ██   ████   ███████      █████  ███████  ██████  ██   ████
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Native%20Json
+//
+/*
+
+    Benchmark of the openLigaDB body parsing in the native host build
+
+    Start the native binary with FLAP_JSONBENCH=<directory>. Every file in the directory
+    is one captured response body, named after its url path, e.g.
+
+        curl -s https://api.openligadb.de/getmatchdata/bl1/2025 -o payloads/getmatchdata_bl1_2025.json
+
+    Each body is cut into JSONBENCH_CHUNK chunks like HTTP_EVENT_ON_DATA and goes through
+    both paths:
+
+    - buffered:  chunks copied into the 32 KB jsonBuffer, at the end one ArduinoJson
+                 document of the whole body (parsing up to now)
+    - streamed:  chunks fed to JsonStream, every value reported with its path
+
+    The report shows per body the µs per parse, the peak heap and whether the body was
+    cut at 32 KB on the buffered path, plus the static RAM of each path. The exit code is
+    1 if the streamed path rejects a body the buffered path accepts.
+
+    FLAP_HANDLERBENCH=<directory> is the microbenchmark of the typed decoders: every body
+    goes as ON_DATA chunks and ON_FINISH through the event handler of Liga.cpp that reads
+    its endpoint, with the Liga state its request would have:
+
+    - getmatchdata_<league>_<season>_<matchday>  next match list and live matches
+    - getmatchdata_<matchID>                     goals of a live match
+    - getnextmatchbyleagueshortcut_<league>      next kickoff
+    - getlastchangedate_...                      last change
+    - getcurrentgroup_<league>                   current matchday
+    - getbltable_...                             table
+
+    Time is thread CPU time, so the vTaskDelay(1) per ON_DATA chunk does not count. Trace
+    lines of the handlers go to /dev/null. The report shows ns per body (mean, p50, p99)
+    and MB/s per handler; the exit code is 1 if a handler leaves the parser prepared after
+    ON_FINISH.
+
+*/
+#ifndef NativeJson_h
+#define NativeJson_h
+
+#define JSONBENCH_ROUNDS 20                                                     // timed passes over every body
+#define JSONBENCH_BUFFER (32 * 1024)                                            // jsonBuffer of the buffered path
+#define JSONBENCH_CHUNK 2048                                                    // buffer_size of the openLigaDB requests
+#define HANDLERBENCH_ROUNDS 20                                                  // passes over every body
+
+int nativeJsonBenchRun(const char* directory);                                  // run benchmark, returns exit code
+int nativeHandlerBenchRun(const char* directory);                               // run benchmark, returns exit code
+
+#endif // NativeJson_h
@@ -0,0 +1,55 @@
+// #################################################################################################################
+//
+//  ███    ██  █████  ████████ ██ ██    ██ ███████     ██████  ███████ ██████  ██       █████  ██    ██
+//  ████   ██ ██   ██    ██    ██ ██    ██ ██          ██   ██ ██      ██   ██ ██      ██   ██  ██  ██
+//  ██ ██  ██ ███████    ██    ██ ██    ██ █████       ██████  █████   ██████  ██      ███████   ████
+//  ██  ██ ██ ██   ██    ██    ██  ██  ██  ██          ██   ██ ██      ██      ██      ██   ██    ██
+//  ██   ████ ██   ██    ██    ██   ████   ███████     ██   ██ ███████ ██      ███████ ██   ██    ██
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Native%20Replay
+//
+/*
+
+    Replay of recorded openLigaDB match days in the native host build
+
+    A recording (/liga.rec of a master built with -DLIGARECORD, see LigaRecorder.h)
+    answers the requests of the Liga task: every url gets the latest response that
+    was recorded at or before the current wall-clock time. The virtual clock jumps
+    over all waits of the poll state machine, so a whole match day replays in seconds
+    with the real poll modes, poll delays and detection logic.
+
+    Start the native binary with FLAP_REPLAY=<recording>; FLAP_REPLAY_TAIL=<hours>
+    sets how long the replay continues after the last recorded response (default 2).
+    Only the Liga task runs, in the main thread; setup() and the other tasks are not
+    started. At the end the replay reports
+
+    - requests per matchday (and in total) and per openLigaDB endpoint
+    - detection latency of goals, leader changes and red-lantern changes: virtual
+      time from the first recorded response that contained the change until the
+      master state shows it
+
+    Without a board, native/replay/ generates recordings in the same format:
+    staggered_matchday.py (9 kickoffs Fri-Sun, 26 goals) and two_matches.py.
+
+*/
+#ifndef NativeReplay_h
+#define NativeReplay_h
+
+#include <ctime>
+#include <string>
+#include <vector>
+
+// one complete response of a recording
+struct NativeRecordedResponse {
+    std::string url;
+    time_t      at;                                                             // wall-clock time of response
+    int         status;                                                         // HTTP status code
+    std::string body;
+};
+
+int    nativeReplayRun(const char* recording);                                  // replay recording, returns exit code
+size_t nativeReadRecording(const char* path, std::vector<NativeRecordedResponse>& responses); // in file order
+
+#endif // NativeReplay_h
@@ -0,0 +1,144 @@
+// #################################################################################################################
+//
+//  ███    ██  █████  ████████ ██ ██    ██ ███████     ███████ ██   ██ ██ ███    ███
+//  ████   ██ ██   ██    ██    ██ ██    ██ ██          ██      ██   ██ ██ ████  ████
+//  ██ ██  ██ ███████    ██    ██ ██    ██ █████       ███████ ███████ ██ ██ ████ ██
+//  ██  ██ ██ ██   ██    ██    ██  ██  ██  ██               ██ ██   ██ ██ ██  ██  ██
+//  ██   ████ ██   ██    ██    ██   ████   ███████     ███████ ██   ██ ██ ██      ██
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Native%20Shim
+//
+/*
+
+    Native host build (PlatformIO [env:native])
+
+    Thin replacement for Arduino core, FreeRTOS and ESP-IDF so the master logic
+    links and runs as a Linux binary. Only the API surface the master really uses
+    is provided, the behaviour is modelled closely enough to measure poll loop,
+    registry and ready-poll timing off the board.
+
+    Features:
+
+    - Serial, String, millis/micros/delay on the host clock
+    - tasks, queues, semaphores, notifications and timers on std::thread
+    - fake I2C bus: slave devices are attached per address as callbacks
+    - fake esp_http_client: responses are delivered by a pluggable responder,
+      connections are kept like on a keep-alive server and handshakes are counted
+    - SPIFFS mapped to a host directory
+    - virtual clock that jumps over waits, for replays of recorded match days
+
+    The hooks below are only available in the native build (FLAP_NATIVE).
+
+*/
+#ifndef NativeShim_h
+#define NativeShim_h
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <ctime>
+#include "esp_err.h"
+
+// ----------------------------
+// fake I2C bus
+
+/**
+ * @brief one I2C transaction as seen by a slave device
+ *
+ * write holds all bytes the master wrote (without address byte),
+ * read must be filled with readLen bytes if the master requests data.
+ */
+struct NativeI2cTransfer {
+    const uint8_t* write    = nullptr;                                          // bytes written by master
+    size_t         writeLen = 0;                                                // number of written bytes
+    uint8_t*       read     = nullptr;                                          // buffer for bytes requested by master
+    size_t         readLen  = 0;                                                // number of requested bytes
+};
+
+using NativeI2cDevice = std::function<esp_err_t(NativeI2cTransfer&)>;         // slave device answers a transfer
+
+void     nativeI2cAttach(uint8_t address, NativeI2cDevice device);              // connect virtual slave to bus
+void     nativeI2cDetach(uint8_t address);                                      // disconnect virtual slave
+void     nativeI2cSetBusLatencyUs(uint32_t usPerByte);                          // simulated wire time per byte
+uint32_t nativeI2cTransactions();                                               // number of i2c_master_cmd_begin calls
+
+// ----------------------------
+// fake FreeRTOS
+
+uint32_t nativeTaskWakeups();                                                   // returns of vTaskDelay and ulTaskNotifyTake
+
+// ----------------------------
+// fake esp_http_client
+
+/**
+ * @brief responder for fake HTTP requests
+ *
+ * gets the requested url, fills body and returns HTTP status code,
+ * or a negative esp_err_t (e.g. -ESP_ERR_HTTP_CONNECT) to simulate a transport error.
+ */
+using NativeHttpResponder = std::function<int(const std::string& url, std::string& body)>;
+
+/**
+ * @brief timing and connection policy of the fake server
+ *
+ * a new connection costs handshakeMs (TCP + TLS) before the request, every request costs requestMs.
+ * The server closes a kept connection after idleTimeoutMs without request or after maxRequests
+ * requests; the next request on that connection fails like on the ESP32 (ESP_ERR_HTTP_FETCH_HEADER).
+ * With etag the server tags every body with a hash and answers a matching If-None-Match with 304.
+ */
+struct NativeHttpServerModel {
+    uint32_t handshakeMs   = 0;                                                 // TCP + TLS handshake of a new connection
+    uint32_t requestMs     = 0;                                                 // round trip of one request
+    uint32_t idleTimeoutMs = 0;                                                 // server closes idle connection (0 = never)
+    uint32_t maxRequests   = 0;                                                 // server closes after n requests (0 = unlimited)
+    bool     etag          = false;                                             // send ETag, answer If-None-Match with 304
+};
+
+/**
+ * @brief counters of the fake server since start or nativeHttpResetStats()
+ */
+struct NativeHttpStats {
+    uint32_t requests    = 0;                                                   // requests answered by responder
+    uint32_t handshakes  = 0;                                                   // new connections
+    uint32_t dropped     = 0;                                                   // requests on connections closed by server
+    uint32_t notModified = 0;                                                   // requests answered with 304
+    uint64_t busyUs      = 0;                                                   // time spent in perform (handshake + request)
+};
+
+void            nativeHttpSetResponder(NativeHttpResponder responder);          // install responder (nullptr = no network)
+void            nativeHttpSetServerModel(const NativeHttpServerModel& model);   // handshake/request cost and close policy
+NativeHttpStats nativeHttpStats();                                              // counters of fake server
+void            nativeHttpResetStats();                                         // clear counters
+
+// ----------------------------
+// host file system and clock
+
+void     nativeFsSetRoot(const char* directory);                                // host directory that backs SPIFFS
+uint64_t nativeMicros();                                                        // monotonic µs since start of binary
+void     nativeSleepUs(uint64_t us);                                            // sleep on host clock or advance virtual clock
+
+// ----------------------------
+// virtual clock (replay)
+
+/**
+ * @brief observer of the virtual clock, called before the clock jumps over a wait
+ */
+using NativeClockObserver = std::function<void()>;
+
+/**
+ * @brief switch to the virtual clock, time() starts at epoch
+ *
+ * The virtual clock only moves when a task waits: delay, vTaskDelay and every timed
+ * FreeRTOS wait that would block jump the clock by their timeout instead of sleeping.
+ * A season of polling runs in seconds, but only one task may run (the replay harness
+ * drives the Liga task in the main thread); a wait without timeout that would block
+ * ends the binary.
+ */
+void nativeClockStartVirtual(time_t epoch);
+bool nativeClockIsVirtual();                                                    // true after nativeClockStartVirtual()
+void nativeClockSetObserver(NativeClockObserver observer);                      // e.g. replay harness samples master state
+
+#endif // NativeShim_h
@@ -0,0 +1,38 @@
+// #################################################################################################################
+//
+//  ███    ██  █████  ████████ ██ ██    ██ ███████     ███████ ███    ██  █████  ██████  ███████ ██   ██  ██████  ████████
+//  ████   ██ ██   ██    ██    ██ ██    ██ ██          ██      ████   ██ ██   ██ ██   ██ ██      ██   ██ ██    ██    ██
+//  ██ ██  ██ ███████    ██    ██ ██    ██ █████       ███████ ██ ██  ██ ███████ ██████  ███████ ███████ ██    ██    ██
+//  ██  ██ ██ ██   ██    ██    ██  ██  ██  ██               ██ ██  ██ ██ ██   ██ ██           ██ ██   ██ ██    ██    ██
+//  ██   ████ ██   ██    ██    ██   ████   ███████     ███████ ██   ████ ██   ██ ██      ███████ ██   ██  ██████     ██
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Native%20Snapshot
+//
+/*
+
+    Stress test of the Liga table publication in the native host build
+
+    Start the native binary with FLAP_SNAPBENCH=<publications>. One writer task publishes
+    tables like the Liga task does after a table poll, while SNAPBENCH_READERS reader tasks
+    copy and render the current table all the time like reportLigaTable(). Every row of a
+    published table carries the table's stamp, so a reader detects a torn table. Two runs
+    are compared:
+
+    - mutex:     readers hold the snapshot mutex for copy and render (stalls the writer)
+    - lock-free: ligaSnapshotsOf(), readers copy with read() and render without lock
+
+    The report shows reads, torn tables (must be 0) and the writer latency p50/p99/max.
+
+*/
+#ifndef NativeSnapshot_h
+#define NativeSnapshot_h
+
+#define SNAPBENCH_READERS 4                                                     // Report, Web, Liga, spare
+#define SNAPBENCH_RENDER_US 200                                                 // Serial output of a rendered table blocks the reader
+#define SNAPBENCH_WRITER_GAP_US 50                                              // writer pause between two publications
+
+int nativeSnapBenchRun(const char* publications);                               // run stress test, returns exit code
+
+#endif // NativeSnapshot_h
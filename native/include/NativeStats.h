@@ -0,0 +1,32 @@
+// #################################################################################################################
+//
+//  ███    ██  █████  ████████ ██ ██    ██ ███████     ███████ ████████  █████  ████████ ███████
+//  ████   ██ ██   ██    ██    ██ ██    ██ ██          ██         ██    ██   ██    ██    ██
+//  ██ ██  ██ ███████    ██    ██ ██    ██ █████       ███████    ██    ███████    ██    ███████
+//  ██  ██ ██ ██   ██    ██    ██  ██  ██  ██               ██    ██    ██   ██    ██         ██
+//  ██   ████ ██   ██    ██    ██   ████   ███████     ███████    ██    ██   ██    ██    ███████
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Native%20Stats
+//
+/*
+
+    Microbenchmark of the I2C statistics path in the native host build
+
+    Start the native binary with FLAP_STATBENCH=<accesses per task>. numberOfTwins tasks
+    count like a twin task does for every ShortMessage (increment + recordLatency) while
+    a reporting task reads the statistics all the time. Two runs are compared:
+
+    - mutex:    counters and histograms under one semaphore (statistics path up to now)
+    - sharded:  FlapStatistics with per-core atomic counters, summed up in makeHistory
+
+    The report shows ns per access and checks that no access got lost.
+
+*/
+#ifndef NativeStats_h
+#define NativeStats_h
+
+int nativeStatBenchRun(const char* accesses);                                   // run benchmark, returns exit code
+
+#endif // NativeStats_h
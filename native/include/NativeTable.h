@@ -0,0 +1,41 @@
+// #################################################################################################################
+//
+//  ███    ██  █████  ████████ ██ ██    ██ ███████     ████████  █████  ██████  ██      ███████
+//  ████   ██ ██   ██    ██    ██ ██    ██ ██             ██    ██   ██ ██   ██ ██      ██
+//  ██ ██  ██ ███████    ██    ██ ██    ██ █████          ██    ███████ ██████  ██      █████
+//  ██  ██ ██ ██   ██    ██    ██  ██  ██  ██             ██    ██   ██ ██   ██ ██      ██
+//  ██   ████ ██   ██    ██    ██   ████   ███████        ██    ██   ██ ██████  ███████ ███████
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Native%20Table
+//
+//
+/*
+
+    Benchmark of the live table recalculation in the native host build
+
+    Start the native binary with FLAP_TABLEBENCH=<matchdays>. Every simulated matchday has
+    ligaMaxTeams / 2 live matches; the goals fall into goalsInfos[] like the Liga task
+    stores them, and every TABLEBENCH_POLL_S seconds of match time CALC_LIVE_TABLE runs
+    once. At half time the table is published again (new base), at the end the matches
+    leave the live list and the final table is published. Two paths are compared on the
+    same polls:
+
+    - full:         recalcLiveTable(), copy of the table, every live score, sortSnapshot()
+    - incremental:  LiveTable::update(), only changed scores, affected rows moved
+
+    After every poll both tables must be equal (order and all counters). The report shows
+    ns per poll (mean, p50, p99) and the position changes update() reported.
+
+*/
+#ifndef NativeTable_h
+#define NativeTable_h
+
+#define TABLEBENCH_POLL_S 20                                                    // live poll interval (POLL_MODE_LIVE)
+#define TABLEBENCH_GOALS_PER_MATCH 3                                            // mean goals per match and 90 minutes
+#define TABLEBENCH_SEED 0x5EED2025u                                             // same matchdays in every run
+
+int nativeTableBenchRun(const char* matchdays);                                 // run benchmark, returns exit code
+
+#endif // NativeTable_h
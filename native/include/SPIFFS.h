@@ -0,0 +1,20 @@
+// Native shim: SPIFFS mapped onto a host directory (nativeFsSetRoot, default ./native_fs)
+#ifndef SPIFFS_h
+#define SPIFFS_h
+
+#include <FS.h>
+
+class SPIFFSFS {
+   public:
+    bool   begin(bool formatOnFail = false, const char* basePath = "/spiffs", uint8_t maxOpenFiles = 10, const char* partitionLabel = nullptr);
+    File   open(const char* path, const char* mode = FILE_READ);
+    File   open(const String& path, const char* mode = FILE_READ) { return open(path.c_str(), mode); }
+    bool   exists(const char* path);
+    bool   remove(const char* path);
+    size_t totalBytes() { return 1024u * 1024u; }
+    size_t usedBytes();
+};
+
+extern SPIFFSFS SPIFFS;
+
+#endif // SPIFFS_h
@@ -0,0 +1,141 @@
+// #################################################################################################################
+//
+//  ██    ██ ██ ██████  ████████ ██    ██  █████  ██          ███████ ██       █████  ██████
+//  ██    ██ ██ ██   ██    ██    ██    ██ ██   ██ ██          ██      ██      ██   ██ ██   ██
+//  ██    ██ ██ ██████     ██    ██    ██ ███████ ██          █████   ██      ███████ ██████
+//   ██  ██  ██ ██   ██    ██    ██    ██ ██   ██ ██          ██      ██      ██   ██ ██
+//    ████   ██ ██   ██    ██     ██████  ██   ██ ███████     ██      ███████ ██   ██ ██
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Virtual%20Flap
+//
+/*
+
+    Simulated flap modules (I2C slaves) for the native host build
+
+    Every virtual module answers the same Long/Mid/Short messages as the slave
+    firmware and models the stepper timing, so the master sees realistic busy
+    phases, ARE_YOU_READY answers and registration by CMD_NEW_ADDRESS.
+
+    Features:
+
+    - LongMessage:  MOVE, CALIBRATE, SPEED_MEASURE, STEP_MEASURE, SENSOR_CHECK, SET_OFFSET, RESET
+    - MidMessage:   CMD_NEW_ADDRESS (answers serial number and moves to new address)
+    - ShortMessage: ARE_YOU_READY, GET_STATE, serial/offset/flaps/speed/steps/sensor reads, boot flag
+    - configurable steps-per-revolution, ms-per-revolution, sensor faults and answer latency
+    - fleet: 30+ modules on one bus, plug&play at I2C_BASE_ADDRESS, bus time per byte
+    - counters per command and bus transactions to measure a full table redraw
+
+    Start the native binary with FLAP_VIRTUAL_MODULES=<n> to plug in n modules.
+    FLAP_READYBENCH=<n> moves n twins at once, with per-twin polling and with the ReadyScheduler.
+
+*/
+#ifndef VirtualFlap_h
+#define VirtualFlap_h
+
+#include <Arduino.h>
+#include <FlapGlobal.h>
+#include <atomic>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include "NativeShim.h"
+
+#define VIRTUAL_BUS_US_PER_BYTE 36                                              // 9 bit per byte at 250 kHz
+#define VIRTUAL_REBOOT_MS 800                                                   // module does not ACK while rebooting
+#define VIRTUAL_EEPROM_MS 20                                                    // SET_OFFSET writes EEPROM
+#define VIRTUAL_STEP_MEASURE_PAUSE_MS 1000                                      // pause between the 3 step measurements
+#define VIRTUAL_SENSOR_CHECK_SLOWDOWN 1.6                                       // sensor check runs slower than MOVE
+#define READYBENCH_ROUNDS 5                                                     // SHOW_FLAP rounds per variant of the ready bench
+
+// ----------------------------
+// mechanical and electrical properties of one module
+struct VirtualFlapConfig {
+    uint32_t serialnumber   = 0;                                                // 0 = derived from fleet counter
+    uint16_t stepsPerRev    = DEFAULT_STEPS;                                    // steps of one drum revolution
+    uint16_t msPerRev       = DEFAULT_SPEED;                                    // ms of one drum revolution
+    uint8_t  flaps          = 40;                                               // flaps on the drum
+    uint16_t offset         = 0;                                                // steps from hall sensor to flap 0
+    bool     sensorFault    = false;                                            // hall sensor never triggers
+    uint8_t  sensorMissRate = 0;                                                // % of sensor passes that are missed
+    uint8_t  speedJitter    = 1;                                                // % jitter of real motion time
+    uint32_t answerDelayUs  = 0;                                                // clock stretching per transfer
+};
+
+// ----------------------------
+// one simulated flap module
+class VirtualFlapModule {
+   public:
+    VirtualFlapModule(I2Caddress address, const VirtualFlapConfig& config);
+
+    esp_err_t  transfer(NativeI2cTransfer& t, I2Caddress& newAddress);          // answer one I2C transaction
+    I2Caddress address() const { return _address; }
+    void       setAddress(I2Caddress address) { _address = address; }
+    bool       isBusy();                                                        // motion still running
+    uint32_t   serialnumber() const { return _config.serialnumber; }
+    uint16_t   position();                                                      // logical step position
+    uint32_t   ignored() const { return _ignored; }                             // LongMessages received while busy
+
+   private:
+    void      longCommand(uint8_t command, uint16_t param);                     // start motion task
+    esp_err_t shortCommand(uint8_t command, NativeI2cTransfer& t);              // answer status request
+    esp_err_t midCommand(uint8_t command, uint8_t param, NativeI2cTransfer& t, I2Caddress& newAddress);
+    void      update();                                                         // finish motion if time is over
+    void      startTask(uint8_t command, uint32_t durationMs);                  // module is busy for durationMs
+    uint32_t  stepsToMs(uint32_t steps);                                        // motion time with jitter
+    uint32_t  stepsToSensor();                                                  // steps until hall sensor triggers
+    bool      sensorHit();                                                      // sensor detected this pass?
+
+    I2Caddress        _address;                                                 // current bus address
+    VirtualFlapConfig _config;                                                  // properties, offset is EEPROM
+    std::minstd_rand  _random;                                                  // jitter and sensor misses
+    std::mutex        _lock;                                                    // transfer vs. fleet queries
+
+    uint64_t _busyUntilUs   = 0;                                                // end of running task
+    uint64_t _rebootUntilUs = 0;                                                // no ACK until then
+    bool     _running       = false;                                            // motion task is running
+    uint8_t  _taskCode      = NO_COMMAND;                                       // running or last task
+    bool     _bootFlag      = true;                                             // set after power-on and RESET
+    bool     _sensorOk      = true;                                             // result of last sensor usage
+    uint16_t _physical      = 0;                                                // drum position relative to sensor
+    uint16_t _pending       = 0;                                                // physical position at end of task
+    uint16_t _measuredSpeed = 0;                                                // result of SPEED_MEASURE
+    uint16_t _measuredSteps = 0;                                                // result of STEP_MEASURE
+    uint32_t _ignored       = 0;                                                // LongMessages while busy
+};
+
+// ----------------------------
+// all simulated modules on the bus
+class VirtualFlapFleet {
+   public:
+    explicit VirtualFlapFleet(uint32_t usPerByte = VIRTUAL_BUS_US_PER_BYTE);
+
+    VirtualFlapModule* addModule(I2Caddress address, const VirtualFlapConfig& config = VirtualFlapConfig()); // module with fixed address
+    void               plugIn(int count, const VirtualFlapConfig& config = VirtualFlapConfig()); // new modules at I2C_BASE_ADDRESS
+    void               setBusLatencyUs(uint32_t usPerByte);                     // wire time per byte
+    int                size();                                                  // modules with own address
+    bool               waitUntilIdle(uint32_t timeoutMs);                       // all motions finished
+    uint32_t           busTransactions() const { return nativeI2cTransactions(); }
+    uint32_t           commandCount(uint8_t command) const { return _commands[command].load(); }
+    void               resetCounters();
+    void               printReport();                                           // counters to Serial
+
+   private:
+    esp_err_t route(I2Caddress address, NativeI2cTransfer& t);                  // bus callback for one address
+    void      attach(I2Caddress address);                                       // connect address to route()
+
+    std::mutex                                               _lock;             // protects module containers
+    std::map<I2Caddress, std::unique_ptr<VirtualFlapModule>> _modules;          // modules with own address
+    std::deque<std::unique_ptr<VirtualFlapModule>>           _unregistered;     // waiting at I2C_BASE_ADDRESS
+    uint32_t                                                 _nextSerial = 0x56460001; // "VF" + counter
+    std::atomic<uint32_t>                                    _commands[256];    // received commands by code
+};
+
+extern VirtualFlapFleet g_virtualFleet;                                         // fleet used by the native binary
+
+int nativeReadyBenchRun(int modules);                                           // FLAP_READYBENCH: twin polling vs ReadyScheduler
+
+#endif // VirtualFlap_h
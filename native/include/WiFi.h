@@ -0,0 +1,29 @@
+// Native shim: WiFi station, the host network is always "connected"
+#ifndef WiFi_h
+#define WiFi_h
+
+#include <Arduino.h>
+
+typedef enum { WL_IDLE_STATUS = 0, WL_NO_SSID_AVAIL = 1, WL_CONNECTED = 3, WL_CONNECT_FAILED = 4, WL_DISCONNECTED = 6 } wl_status_t;
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+
+class WiFiClass {
+   public:
+    wl_status_t begin(const char* ssid, const char* password) {
+        (void)ssid;
+        (void)password;
+        return WL_CONNECTED;
+    }
+    wl_status_t status() { return WL_CONNECTED; }
+    bool        mode(wifi_mode_t mode) { return (void)mode, true; }
+    bool        setHostname(const char* name) { return (void)name, true; }
+    bool        setSleep(bool enable) { return (void)enable, true; }
+    bool        disconnect(bool wifiOff = false) { return (void)wifiOff, true; }
+    IPAddress   localIP() { return IPAddress(127, 0, 0, 1); }
+    int         RSSI() { return -40; }
+    int         hostByName(const char* host, IPAddress& result);
+};
+
+extern WiFiClass WiFi;
+
+#endif // WiFi_h
@@ -0,0 +1,7 @@
+// Native shim: TLS client is not needed on the host, esp_http_client is faked
+#ifndef WiFiClientSecure_h
+#define WiFiClientSecure_h
+
+#include <WiFi.h>
+
+#endif // WiFiClientSecure_h
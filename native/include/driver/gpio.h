@@ -0,0 +1,14 @@
+// Native shim: GPIO numbers and pull modes referenced by the I2C setup
+#ifndef driver_gpio_h
+#define driver_gpio_h
+
+typedef enum {
+    GPIO_NUM_NC = -1,
+    GPIO_NUM_4  = 4,
+    GPIO_NUM_21 = 21,
+    GPIO_NUM_22 = 22,
+} gpio_num_t;
+
+typedef enum { GPIO_PULLUP_DISABLE = 0, GPIO_PULLUP_ENABLE = 1 } gpio_pullup_t;
+
+#endif // driver_gpio_h
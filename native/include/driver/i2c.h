@@ -0,0 +1,47 @@
+// Native shim: ESP-IDF legacy I2C master driver on a fake bus (see NativeShim.h, nativeI2cAttach)
+#ifndef driver_i2c_h
+#define driver_i2c_h
+
+#include <cstddef>
+#include <cstdint>
+#include "esp_err.h"
+#include "driver/gpio.h"
+#include "freertos/FreeRTOS.h"
+
+typedef int i2c_port_t;
+#define I2C_NUM_0 0
+#define I2C_NUM_1 1
+
+typedef enum { I2C_MODE_SLAVE = 0, I2C_MODE_MASTER = 1 } i2c_mode_t;
+typedef enum { I2C_MASTER_WRITE = 0, I2C_MASTER_READ = 1 } i2c_rw_t;
+typedef enum { I2C_MASTER_ACK = 0, I2C_MASTER_NACK = 1, I2C_MASTER_LAST_NACK = 2 } i2c_ack_type_t;
+
+typedef struct {
+    i2c_mode_t    mode;
+    int           sda_io_num;
+    int           scl_io_num;
+    gpio_pullup_t sda_pullup_en;
+    gpio_pullup_t scl_pullup_en;
+    struct {
+        uint32_t clk_speed;
+    } master;
+    uint32_t clk_flags;
+} i2c_config_t;
+
+struct NativeI2cCmd;
+typedef NativeI2cCmd* i2c_cmd_handle_t;
+
+esp_err_t        i2c_param_config(i2c_port_t port, const i2c_config_t* conf);
+esp_err_t        i2c_driver_install(i2c_port_t port, i2c_mode_t mode, size_t slvRxBuf, size_t slvTxBuf, int intrAllocFlags);
+esp_err_t        i2c_driver_delete(i2c_port_t port);
+i2c_cmd_handle_t i2c_cmd_link_create();
+void             i2c_cmd_link_delete(i2c_cmd_handle_t cmd);
+esp_err_t        i2c_master_start(i2c_cmd_handle_t cmd);
+esp_err_t        i2c_master_stop(i2c_cmd_handle_t cmd);
+esp_err_t        i2c_master_write_byte(i2c_cmd_handle_t cmd, uint8_t data, bool ackEn);
+esp_err_t        i2c_master_write(i2c_cmd_handle_t cmd, const uint8_t* data, size_t len, bool ackEn);
+esp_err_t        i2c_master_read_byte(i2c_cmd_handle_t cmd, uint8_t* data, i2c_ack_type_t ack);
+esp_err_t        i2c_master_read(i2c_cmd_handle_t cmd, uint8_t* data, size_t len, i2c_ack_type_t ack);
+esp_err_t        i2c_master_cmd_begin(i2c_port_t port, i2c_cmd_handle_t cmd, TickType_t ticksToWait);
+
+#endif // driver_i2c_h
@@ -0,0 +1,13 @@
+// Native shim: bluetooth controller, always idle on the host
+#ifndef esp_bt_h
+#define esp_bt_h
+
+#include "esp_err.h"
+
+typedef enum { ESP_BT_CONTROLLER_STATUS_IDLE = 0, ESP_BT_CONTROLLER_STATUS_INITED, ESP_BT_CONTROLLER_STATUS_ENABLED } esp_bt_controller_status_t;
+typedef enum { ESP_BT_MODE_IDLE = 0, ESP_BT_MODE_BLE, ESP_BT_MODE_CLASSIC_BT, ESP_BT_MODE_BTDM } esp_bt_mode_t;
+
+esp_bt_controller_status_t esp_bt_controller_get_status();
+esp_err_t                  esp_bt_controller_mem_release(esp_bt_mode_t mode);
+
+#endif // esp_bt_h
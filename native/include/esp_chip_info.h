@@ -0,0 +1,23 @@
+// Native shim: chip information, the host reports itself as an ESP32
+#ifndef esp_chip_info_h
+#define esp_chip_info_h
+
+#include <cstdint>
+
+typedef enum { CHIP_ESP32 = 1, CHIP_ESP32S2 = 2, CHIP_ESP32S3 = 9, CHIP_ESP32C3 = 5 } esp_chip_model_t;
+
+#define CHIP_FEATURE_EMB_FLASH (1 << 0)
+#define CHIP_FEATURE_WIFI_BGN (1 << 1)
+#define CHIP_FEATURE_BLE (1 << 4)
+#define CHIP_FEATURE_BT (1 << 5)
+
+typedef struct {
+    esp_chip_model_t model;
+    uint32_t         features;
+    uint16_t         revision;
+    uint8_t          cores;
+} esp_chip_info_t;
+
+void esp_chip_info(esp_chip_info_t* out_info);
+
+#endif // esp_chip_info_h
@@ -0,0 +1,9 @@
+// Native shim: flash configuration strings used by the memory report
+#ifndef esp_flash_h
+#define esp_flash_h
+
+#define CONFIG_ESPTOOLPY_FLASHMODE "host"
+#define CONFIG_ESPTOOLPY_FLASHFREQ "n/a"
+#define CONFIG_ESPTOOLPY_FLASHSIZE "n/a"
+
+#endif // esp_flash_h
@@ -0,0 +1,71 @@
+// Native shim: esp_http_client, responses come from the responder installed by nativeHttpSetResponder()
+#ifndef esp_http_client_h
+#define esp_http_client_h
+
+#include <cstdint>
+#include "esp_err.h"
+
+typedef enum {
+    HTTP_EVENT_ERROR = 0,
+    HTTP_EVENT_ON_CONNECTED,
+    HTTP_EVENT_HEADERS_SENT,
+    HTTP_EVENT_HEADER_SENT = HTTP_EVENT_HEADERS_SENT,
+    HTTP_EVENT_ON_HEADER,
+    HTTP_EVENT_ON_DATA,
+    HTTP_EVENT_ON_FINISH,
+    HTTP_EVENT_DISCONNECTED,
+    HTTP_EVENT_REDIRECT,
+} esp_http_client_event_id_t;
+
+typedef enum { HTTP_METHOD_GET = 0, HTTP_METHOD_POST, HTTP_METHOD_HEAD } esp_http_client_method_t;
+typedef enum { HTTP_TRANSPORT_UNKNOWN = 0, HTTP_TRANSPORT_OVER_TCP, HTTP_TRANSPORT_OVER_SSL } esp_http_client_transport_t;
+
+struct NativeHttpClient;
+typedef NativeHttpClient* esp_http_client_handle_t;
+
+typedef struct esp_http_client_event {
+    esp_http_client_event_id_t event_id;
+    esp_http_client_handle_t   client;
+    void*                      data;
+    int                        data_len;
+    void*                      user_data;
+    char*                      header_key;
+    char*                      header_value;
+} esp_http_client_event_t;
+
+typedef esp_err_t (*http_event_handle_cb)(esp_http_client_event_t* evt);
+
+typedef struct {
+    const char*                 url;
+    const char*                 host;
+    int                         port;
+    const char*                 path;
+    const char*                 query;
+    const char*                 cert_pem;
+    const char*                 user_agent;
+    esp_http_client_method_t    method;
+    int                         timeout_ms;
+    http_event_handle_cb        event_handler;
+    esp_http_client_transport_t transport_type;
+    int                         buffer_size;
+    int                         buffer_size_tx;
+    void*                       user_data;
+    bool                        is_async;
+    bool                        use_global_ca_store;
+    bool                        skip_cert_common_name_check;
+    bool                        keep_alive_enable;
+} esp_http_client_config_t;
+
+esp_http_client_handle_t esp_http_client_init(const esp_http_client_config_t* config);
+esp_err_t                esp_http_client_perform(esp_http_client_handle_t client);
+esp_err_t                esp_http_client_set_url(esp_http_client_handle_t client, const char* url);
+esp_err_t                esp_http_client_set_header(esp_http_client_handle_t client, const char* key, const char* value);
+esp_err_t                esp_http_client_delete_header(esp_http_client_handle_t client, const char* key);
+esp_err_t                esp_http_client_get_header(esp_http_client_handle_t client, const char* key, char** value);
+esp_err_t                esp_http_client_set_user_data(esp_http_client_handle_t client, void* data);
+int                      esp_http_client_get_status_code(esp_http_client_handle_t client);
+int64_t                  esp_http_client_get_content_length(esp_http_client_handle_t client);
+esp_err_t                esp_http_client_close(esp_http_client_handle_t client);
+esp_err_t                esp_http_client_cleanup(esp_http_client_handle_t client);
+
+#endif // esp_http_client_h
@@ -0,0 +1,14 @@
+// Native shim: ESP-IDF system information (fixed values on the host)
+#ifndef esp_system_h
+#define esp_system_h
+
+#include <cstdint>
+#include "esp_err.h"
+
+typedef enum { ESP_MAC_WIFI_STA = 0, ESP_MAC_WIFI_SOFTAP, ESP_MAC_BT, ESP_MAC_ETH } esp_mac_type_t;
+
+esp_err_t esp_read_mac(uint8_t* mac, esp_mac_type_t type);
+uint32_t  esp_get_free_heap_size();
+void      esp_restart();
+
+#endif // esp_system_h
@@ -0,0 +1,7 @@
+// Native shim: nothing of esp_wifi is used directly, WiFi.h covers the master
+#ifndef esp_wifi_h
+#define esp_wifi_h
+
+#include "esp_err.h"
+
+#endif // esp_wifi_h
@@ -0,0 +1,35 @@
+// Native shim: FreeRTOS base types on top of std::thread (see native/src/NativeRtos.cpp)
+#ifndef freertos_FreeRTOS_h
+#define freertos_FreeRTOS_h
+
+#include <cstddef>
+#include <cstdint>
+
+typedef uint32_t TickType_t;
+typedef int      BaseType_t;
+typedef unsigned UBaseType_t;
+
+#define pdFALSE ((BaseType_t)0)
+#define pdTRUE ((BaseType_t)1)
+#define pdFAIL pdFALSE
+#define pdPASS pdTRUE
+#define portMAX_DELAY ((TickType_t)0xffffffffUL)
+#define configTICK_RATE_HZ 1000
+#define portTICK_PERIOD_MS ((TickType_t)1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(xTimeInMs) ((TickType_t)(((TickType_t)(xTimeInMs) * (TickType_t)configTICK_RATE_HZ) / (TickType_t)1000U))
+#define pdTICKS_TO_MS(xTicks) ((TickType_t)(((TickType_t)(xTicks) * (TickType_t)1000U) / (TickType_t)configTICK_RATE_HZ))
+#define configMAX_PRIORITIES 25
+#define tskNO_AFFINITY 0x7FFFFFFF
+#define portNUM_PROCESSORS 2                                                    // like the ESP32 (PRO_CPU, APP_CPU)
+
+struct NativeTask;
+struct NativeQueue;
+struct NativeTimer;
+
+typedef NativeTask*  TaskHandle_t;
+typedef NativeQueue* QueueHandle_t;
+typedef NativeQueue* SemaphoreHandle_t;
+typedef NativeTimer* TimerHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+#endif // freertos_FreeRTOS_h
@@ -0,0 +1,19 @@
+// Native shim: FreeRTOS semaphores and mutexes, built on the queue shim
+#ifndef freertos_semphr_h
+#define freertos_semphr_h
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+SemaphoreHandle_t xSemaphoreCreateBinary();
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t maxCount, UBaseType_t initialCount);
+SemaphoreHandle_t xSemaphoreCreateMutex();
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex();
+void              vSemaphoreDelete(SemaphoreHandle_t semaphore);
+BaseType_t        xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait);
+BaseType_t        xSemaphoreGive(SemaphoreHandle_t semaphore);
+BaseType_t        xSemaphoreTakeRecursive(SemaphoreHandle_t semaphore, TickType_t ticksToWait);
+BaseType_t        xSemaphoreGiveRecursive(SemaphoreHandle_t semaphore);
+TaskHandle_t      xSemaphoreGetMutexHolder(SemaphoreHandle_t semaphore);
+
+#endif // freertos_semphr_h
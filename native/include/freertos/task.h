@@ -0,0 +1,26 @@
+// Native shim: FreeRTOS task API, every task is a detached std::thread
+#ifndef freertos_task_h
+#define freertos_task_h
+
+#include "freertos/FreeRTOS.h"
+
+BaseType_t  xTaskCreate(TaskFunction_t code, const char* name, uint32_t stackDepth, void* parameter, UBaseType_t priority, TaskHandle_t* handle);
+BaseType_t  xTaskCreatePinnedToCore(TaskFunction_t code, const char* name, uint32_t stackDepth, void* parameter, UBaseType_t priority,
+                                    TaskHandle_t* handle, BaseType_t core);
+void        vTaskDelete(TaskHandle_t task);
+void        vTaskDelay(TickType_t ticks);
+void        vTaskDelayUntil(TickType_t* previousWakeTime, TickType_t increment);
+void        vTaskSuspend(TaskHandle_t task);
+TickType_t  xTaskGetTickCount();
+TaskHandle_t xTaskGetCurrentTaskHandle();
+char*       pcTaskGetName(TaskHandle_t task);
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task);
+UBaseType_t uxTaskGetNumberOfTasks();
+UBaseType_t uxTaskPriorityGet(TaskHandle_t task);
+BaseType_t  xPortGetCoreID();
+
+// direct to task notification (counting semantic)
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+uint32_t   ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait);
+
+#endif // freertos_task_h
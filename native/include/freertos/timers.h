@@ -0,0 +1,21 @@
+// Native shim: FreeRTOS software timers, served by one timer service thread
+#ifndef freertos_timers_h
+#define freertos_timers_h
+
+#include "freertos/FreeRTOS.h"
+
+typedef void (*TimerCallbackFunction_t)(TimerHandle_t timer);
+
+TimerHandle_t xTimerCreate(const char* name, TickType_t period, UBaseType_t autoReload, void* timerID, TimerCallbackFunction_t callback);
+BaseType_t    xTimerStart(TimerHandle_t timer, TickType_t ticksToWait);
+BaseType_t    xTimerStop(TimerHandle_t timer, TickType_t ticksToWait);
+BaseType_t    xTimerReset(TimerHandle_t timer, TickType_t ticksToWait);
+BaseType_t    xTimerDelete(TimerHandle_t timer, TickType_t ticksToWait);
+BaseType_t    xTimerChangePeriod(TimerHandle_t timer, TickType_t newPeriod, TickType_t ticksToWait);
+BaseType_t    xTimerIsTimerActive(TimerHandle_t timer);
+TickType_t    xTimerGetExpiryTime(TimerHandle_t timer);
+TickType_t    xTimerGetPeriod(TimerHandle_t timer);
+void*         pvTimerGetTimerID(TimerHandle_t timer);
+const char*   pcTimerGetName(TimerHandle_t timer);
+
+#endif // freertos_timers_h
@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+# Generates the recording of a staggered 1. Bundesliga matchday for the native replay (NativeReplay.h)
+#
+#   python3 native/replay/staggered_matchday.py md.rec
+#   FLAP_REPLAY=md.rec FLAP_REPLAY_TAIL=1 .pio/build/native/program
+#
+# Matchday 5 with 9 kickoffs from Friday 20:30 to Sunday 17:30 (Fri 20:30, Sat 5x 15:30,
+# Sat 18:30, Sun 15:30, Sun 17:30), 26 goals with realistic data entry delay, the final
+# whistles and the table after every goal. Every url is sampled every 30 s, only changed
+# responses are written, so the file looks like a -DLIGARECORD recording (LigaRecorder.h).
+# The generator is deterministic (fixed seed): the replay numbers in the commit log of the
+# poll scheduler, the MatchdayModel and the request pacer were taken with this recording.
+import calendar
+import json
+import random
+import sys
+import time
+
+random.seed(7)
+
+
+def utc(day, hour, minute):
+    return calendar.timegm((2025, 9, day, hour, minute, 0))                     # CEST = UTC+2
+
+
+def iso(t):
+    return time.strftime("%Y-%m-%dT%H:%M:%S", time.gmtime(t + 7200))           # openLigaDB sends local time
+
+
+teams = ["FC Bayern München", "Borussia Dortmund", "RB Leipzig", "Bayer 04 Leverkusen", "1. FSV Mainz 05", "Borussia Mönchengladbach",
+         "Eintracht Frankfurt", "VfL Wolfsburg", "1. FC Union Berlin", "SC Freiburg", "TSG Hoffenheim", "VfB Stuttgart", "SV Werder Bremen",
+         "FC Augsburg", "1. FC Köln", "1. FC Heidenheim 1846", "Hamburger SV", "FC St. Pauli"]
+kick = [utc(26, 18, 30)] + [utc(27, 13, 30)] * 5 + [utc(27, 16, 30), utc(28, 13, 30), utc(28, 15, 30)]
+pts = {t: 10 - i // 4 for i, t in enumerate(teams)}                             # points before the matchday
+
+matches = []
+gid = 7000
+for i in range(9):
+    m = {"id": 1101 + i, "t1": teams[2 * i], "t2": teams[2 * i + 1], "ko": kick[i], "end": kick[i] + random.randint(108, 116) * 60, "goals": []}
+    s1 = s2 = 0
+    for minute in sorted(random.sample(range(3, 93), random.randint(0, 5))):
+        if random.random() < 0.5:
+            s1 += 1
+        else:
+            s2 += 1
+        gid += 1
+        at = m["ko"] + (minute + (15 if minute > 45 else 0)) * 60 + random.randint(20, 90) # half time break, data entry delay
+        m["goals"].append((at, {"goalID": gid, "matchMinute": minute, "scoreTeam1": s1, "scoreTeam2": s2, "goalGetterName": "Spieler %d" % gid,
+                                "isPenalty": False, "isOwnGoal": False, "isOvertime": False}))
+    matches.append(m)
+
+
+def match_object(m, t):
+    return {"matchID": m["id"], "matchDateTime": iso(m["ko"]), "matchIsFinished": t >= m["end"], "team1": {"teamName": m["t1"]},
+            "team2": {"teamName": m["t2"]}, "goals": [g for at, g in m["goals"] if at <= t], "lastUpdateDateTime": iso(m["ko"] - 86400)}
+
+
+def score(m, t):
+    goals = [g for at, g in m["goals"] if at <= t]
+    return (goals[-1]["scoreTeam1"], goals[-1]["scoreTeam2"]) if goals else (0, 0)
+
+
+out = open(sys.argv[1] if len(sys.argv) > 1 else "md.rec", "wb")
+last = {}
+
+
+def record(t, url, obj):
+    body = json.dumps(obj, ensure_ascii=False, separators=(",", ":")).encode()
+    if last.get(url) == body:
+        return                                                                  # unchanged response is not recorded
+    last[url] = body
+    out.write(b"@%d 200 %s\n" % (t, url.encode()))
+    for i in range(0, len(body), 2048):                                         # chunks like the ESP32 receives them
+        chunk = body[i:i + 2048]
+        out.write(b"+%d\n" % len(chunk))
+        out.write(chunk)
+    out.write(b".\n")
+
+
+base = "https://api.openligadb.de/"
+matchday6 = [{"matchID": 1201 + i, "matchDateTime": iso(kick[i] + 7 * 86400), "matchIsFinished": False, "team1": {"teamName": teams[(2 * i + 3) % 18]},
+              "team2": {"teamName": teams[(2 * i + 8) % 18]}, "goals": [], "lastUpdateDateTime": iso(kick[0])} for i in range(9)]
+T0 = utc(26, 16, 0)
+T1 = utc(28, 18, 30)
+for t in range(T0, T1, 30):
+    record(t, base + "getcurrentgroup/bl1", {"groupName": "5. Spieltag", "groupOrderID": 5, "groupID": 1})
+    future = [m for m in matches if m["ko"] > t]
+    record(t, base + "getnextmatchbyleagueshortcut/bl1", match_object(min(future, key=lambda m: m["ko"]), t) if future else matchday6[0])
+    record(t, base + "getmatchdata/bl1/2025/5", [match_object(m, t) for m in matches])
+    record(t, base + "getmatchdata/bl1/2025/6", matchday6)
+    for m in matches:
+        record(t, base + "getmatchdata/%d" % m["id"], match_object(m, t))
+    changes = [m["ko"] - 86400] + [at for m in matches for at, g in m["goals"] if at <= t] + [m["end"] for m in matches if m["end"] <= t]
+    record(t, base + "getlastchangedate/bl1/2025/5", iso(max(changes)) + ".123")
+    p = dict(pts)
+    for m in matches:
+        if m["ko"] > t:
+            continue
+        a, b = score(m, t)
+        p[m["t1"]] += 3 if a > b else 1 if a == b else 0
+        p[m["t2"]] += 3 if b > a else 1 if a == b else 0
+    table = sorted(teams, key=lambda n: (-p[n], n))
+    record(t, base + "getbltable/bl1/2025", [{"teamName": n, "matches": 5, "points": p[n], "won": 1, "lost": 1, "draw": 1, "goals": 5,
+                                              "opponentGoals": 4, "goalDiff": 1} for n in table])
+out.close()
+print(sum(len(m["goals"]) for m in matches), "goals")
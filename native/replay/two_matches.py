@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+# Generates a small recording with two parallel matches for the native replay (NativeReplay.h)
+#
+#   python3 native/replay/two_matches.py liga.rec
+#   FLAP_REPLAY=liga.rec .pio/build/native/program
+#
+# Saturday 15:30 kickoff of two 1. Bundesliga matches with three goals, sampled every 30 s
+# from 30 minutes before kickoff until two hours after it. Every sample is written, also
+# unchanged responses, like a recorder that stores every answer.
+import calendar
+import json
+import sys
+import time
+
+T0 = calendar.timegm((2025, 9, 27, 13, 0, 0))
+KO = calendar.timegm((2025, 9, 27, 13, 30, 0))
+teams = ["FC Bayern München", "Borussia Dortmund", "RB Leipzig", "VfB Stuttgart", "Bayer 04 Leverkusen", "1. FC Heidenheim 1846"]
+
+
+def match(matchID, team1, team2, goals, finished):
+    return {"matchID": matchID, "matchDateTime": "2025-09-27T15:30:00", "matchIsFinished": finished,
+            "team1": {"teamName": team1}, "team2": {"teamName": team2}, "goals": goals, "lastUpdateDateTime": "2025-09-27T15:00:00"}
+
+
+def goal(goalID, minute, score1, score2, scorer):
+    return {"goalID": goalID, "matchMinute": minute, "scoreTeam1": score1, "scoreTeam2": score2, "goalGetterName": scorer,
+            "isPenalty": False, "isOwnGoal": False, "isOvertime": False}
+
+
+out = open(sys.argv[1] if len(sys.argv) > 1 else "liga.rec", "wb")
+
+
+def record(t, url, obj):
+    body = json.dumps(obj, ensure_ascii=False, separators=(",", ":")).encode()
+    out.write(b"@%d 200 %s\n" % (t, url.encode()))
+    for i in range(0, len(body), 2048):                                         # chunks like the ESP32 receives them
+        chunk = body[i:i + 2048]
+        out.write(b"+%d\n" % len(chunk))
+        out.write(chunk)
+    out.write(b".\n")
+
+
+base = "https://api.openligadb.de/"
+for t in range(T0, KO + 2 * 3600, 30):
+    live     = t >= KO
+    finished = t >= KO + 6600
+    goals1   = []
+    if t >= KO + 1200:
+        goals1.append(goal(501, 20, 0, 1, "Guirassy"))
+    if t >= KO + 3000:
+        goals1.append(goal(502, 50, 0, 2, "Adeyemi"))
+    goals2 = []
+    if t >= KO + 2400:
+        goals2.append(goal(601, 40, 0, 1, "Sesko"))
+    m1 = match(1001, teams[0], teams[1], goals1, finished)
+    m2 = match(1002, teams[5], teams[2], goals2, finished)
+    record(t, base + "getcurrentgroup/bl1", {"groupName": "5. Spieltag", "groupOrderID": 5, "groupID": 1})
+    record(t, base + "getnextmatchbyleagueshortcut/bl1", m1)
+    record(t, base + "getmatchdata/bl1/2025/5", [m1, m2])
+    record(t, base + "getmatchdata/1001", m1)
+    record(t, base + "getmatchdata/1002", m2)
+    change = "2025-09-27T15:00:00" if not live else time.strftime("%Y-%m-%dT%H:%M:%S", time.gmtime(t + 7200 - (t - KO) % 300))
+    record(t, base + "getlastchangedate/bl1/2025/5", change)
+    pts = {teams[0]: 12, teams[1]: 11, teams[2]: 10, teams[3]: 7, teams[4]: 5, teams[5]: 3}
+    if goals1:
+        pts[teams[1]] += 3
+    if t >= KO + 2400:
+        pts[teams[2]] += 3
+    if t >= KO + 3600:
+        pts[teams[4]] -= 3
+    table = sorted(teams, key=lambda n: -pts[n])
+    record(t, base + "getbltable/bl1/2025", [{"teamName": n, "matches": 5, "points": pts[n], "won": 1, "lost": 1, "draw": 1, "goals": 5,
+                                              "opponentGoals": 4, "goalDiff": 1} for n in table])
+out.close()
@@ -0,0 +1,269 @@
+// #################################################################################################################
+//
+//  ███    ██  █████  ████████ ██ ██    ██ ███████      ██████  ██████  ██████  ███████
+//  ████   ██ ██   ██    ██    ██ ██    ██ ██          ██      ██    ██ ██   ██ ██
+//  ██ ██  ██ ███████    ██    ██ ██    ██ █████       ██      ██    ██ ██████  █████
+//  ██  ██ ██ ██   ██    ██    ██  ██  ██  ██          ██      ██    ██ ██   ██ ██
+//  ██   ████ ██   ██    ██    ██   ████   ███████      ██████  ██████  ██   ██ ███████
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Native%20Core
+//
+/*
+
+    Arduino core and ESP-IDF system functions for the native host build
+
+    Timing is taken from the host steady clock, everything hardware related
+    (chip info, MAC, bluetooth, WiFi) answers with fixed plausible values.
+
+*/
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <Arduino.h>
+#include <WiFi.h>
+#include <ESPAsyncWebServer.h>
+#include "NativeShim.h"
+#include "esp_bt.h"
+#include "esp_chip_info.h"
+#include "esp_system.h"
+
+HardwareSerial Serial;
+EspClass       ESP;
+WiFiClass      WiFi;
+
+static const auto g_startTime = std::chrono::steady_clock::now();             // time base of millis()/micros()
+
+static std::atomic<bool>     g_virtualClock{false};                             // clock moves only by waits
+static std::atomic<uint64_t> g_virtualUs{0};                                    // nativeMicros() of virtual clock
+static time_t                g_virtualEpoch = 0;                                // time() at g_virtualUs == 0
+static NativeClockObserver&  g_clockObserver = *new NativeClockObserver;        // called before every jump
+
+// ----------------------------
+// timing
+
+static uint64_t hostMicros() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - g_startTime).count();
+}
+
+uint64_t nativeMicros() {
+    return g_virtualClock ? g_virtualUs.load() : hostMicros();
+}
+
+void nativeSleepUs(uint64_t us) {
+    if (!g_virtualClock) {
+        std::this_thread::sleep_for(std::chrono::microseconds(us));
+        return;
+    }
+    if (g_clockObserver)
+        g_clockObserver();                                                      // sample state before time passes
+    g_virtualUs += us;
+}
+
+void nativeClockStartVirtual(time_t epoch) {
+    g_virtualUs    = hostMicros();                                              // millis() keeps counting from here
+    g_virtualEpoch = epoch - (time_t)(g_virtualUs / 1000000ull);
+    g_virtualClock = true;
+}
+
+bool nativeClockIsVirtual() {
+    return g_virtualClock;
+}
+
+void nativeClockSetObserver(NativeClockObserver observer) {
+    g_clockObserver = std::move(observer);
+}
+
+/**
+ * @brief wall clock of the master, replaces time() of the C library in the native build
+ */
+time_t time(time_t* result) noexcept {
+    time_t now;
+    if (g_virtualClock) {
+        now = g_virtualEpoch + (time_t)(g_virtualUs / 1000000ull);
+    } else {
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        now = ts.tv_sec;
+    }
+    if (result)
+        *result = now;
+    return now;
+}
+
+unsigned long millis() {
+    return (unsigned long)(nativeMicros() / 1000ull);
+}
+
+unsigned long micros() {
+    return (unsigned long)nativeMicros();
+}
+
+void delay(uint32_t ms) {
+    nativeSleepUs((uint64_t)ms * 1000);
+}
+
+void delayMicroseconds(uint32_t us) {
+    nativeSleepUs(us);
+}
+
+void yield() {
+    std::this_thread::yield();
+}
+
+bool getLocalTime(struct tm* info, uint32_t ms) {
+    (void)ms;                                                                   // host clock is always synchronized
+    time_t now = time(nullptr);
+    return localtime_r(&now, info) != nullptr;
+}
+
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char* server1, const char* server2, const char* server3) {
+    (void)gmtOffset_sec, (void)daylightOffset_sec, (void)server1, (void)server2, (void)server3;
+}
+
+void configTzTime(const char* tz, const char* server1, const char* server2, const char* server3) {
+    (void)server1, (void)server2, (void)server3;
+    setenv("TZ", tz, 1);                                                        // POSIX TZ string works on the host as well
+    tzset();
+}
+
+void EspClass::restart() {
+    fflush(stdout);
+    exit(0);
+}
+
+// ----------------------------
+// network
+
+String IPAddress::toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _bytes[0], _bytes[1], _bytes[2], _bytes[3]);
+    return String(buf);
+}
+
+int WiFiClass::hostByName(const char* host, IPAddress& result) {
+    (void)host;
+    result = IPAddress(127, 0, 0, 1);                                           // requests are answered by the fake HTTP client
+    return 1;
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse(int code, const char* contentType, const char* content) {
+    (void)contentType;
+    AsyncWebServerResponse* response = new AsyncWebServerResponse;
+    response->code                   = code;
+    response->body                   = content ? content : "";
+    return response;
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse(const char* contentType, size_t len, AwsResponseFiller callback) {
+    (void)contentType;
+    AsyncWebServerResponse* response = new AsyncWebServerResponse;
+    uint8_t                 chunk[256];                                         // filled in chunks like the AsyncTCP send buffer
+    while (response->body.length() < len) {
+        size_t n = callback(chunk, sizeof(chunk), response->body.length());
+        if (n == 0)
+            break;
+        response->body += String(std::string((const char*)chunk, n));
+    }
+    return response;
+}
+
+const AsyncWebHeader* AsyncWebServerRequest::getHeader(const char* name) const {
+    for (const AsyncWebHeader& h : _headers)
+        if (h.name().equalsIgnoreCase(name))
+            return &h;
+    return nullptr;
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse(SPIFFSFS& fs, const String& path, const char* contentType) {
+    (void)contentType;
+    AsyncWebServerResponse* response = new AsyncWebServerResponse;
+    File                    file     = fs.open(path, FILE_READ);
+    response->code                   = file ? 200 : 404;                        // like the library
+    if (file)
+        response->body = file.readString();
+    return response;
+}
+
+AsyncResponseStream* AsyncWebServerRequest::beginResponseStream(const char* contentType) {
+    (void)contentType;
+    return new AsyncResponseStream;
+}
+
+String AsyncWebServer::dispatch(const String& uri, int* code, const WebHeaders& headers, WebHeaders* responseHeaders) {
+    String body;
+    int    status = 404;
+    {
+        AsyncWebServerRequest request(uri, headers);                            // onDisconnect runs at end of scope
+        auto                  it = _handlers.find(uri.str());
+        if (it != _handlers.end())
+            it->second(&request);
+        else if (_notFound)
+            _notFound(&request);
+        if (request.code() != 0) {
+            status = request.code();
+            body   = request.body();
+            if (responseHeaders)
+                *responseHeaders = *request.responseHeaders();
+        }
+    }
+    if (code)
+        *code = status;
+    return body;
+}
+
+// ----------------------------
+// ESP-IDF system
+
+const char* esp_err_to_name(esp_err_t code) {
+    switch (code) {
+        case ESP_OK:                    return "ESP_OK";
+        case ESP_FAIL:                  return "ESP_FAIL";
+        case ESP_ERR_NO_MEM:            return "ESP_ERR_NO_MEM";
+        case ESP_ERR_INVALID_ARG:       return "ESP_ERR_INVALID_ARG";
+        case ESP_ERR_INVALID_STATE:     return "ESP_ERR_INVALID_STATE";
+        case ESP_ERR_INVALID_SIZE:      return "ESP_ERR_INVALID_SIZE";
+        case ESP_ERR_NOT_FOUND:         return "ESP_ERR_NOT_FOUND";
+        case ESP_ERR_NOT_SUPPORTED:     return "ESP_ERR_NOT_SUPPORTED";
+        case ESP_ERR_TIMEOUT:           return "ESP_ERR_TIMEOUT";
+        case ESP_ERR_HTTP_MAX_REDIRECT: return "ESP_ERR_HTTP_MAX_REDIRECT";
+        case ESP_ERR_HTTP_CONNECT:      return "ESP_ERR_HTTP_CONNECT";
+        case ESP_ERR_HTTP_WRITE_DATA:   return "ESP_ERR_HTTP_WRITE_DATA";
+        case ESP_ERR_HTTP_FETCH_HEADER: return "ESP_ERR_HTTP_FETCH_HEADER";
+        case ESP_ERR_HTTP_CONNECTING:   return "ESP_ERR_HTTP_CONNECTING";
+        case ESP_ERR_HTTP_EAGAIN:       return "ESP_ERR_HTTP_EAGAIN";
+        default:                        return "UNKNOWN ERROR";
+    }
+}
+
+esp_err_t esp_read_mac(uint8_t* mac, esp_mac_type_t type) {
+    static const uint8_t hostMac[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};   // locally administered address
+    memcpy(mac, hostMac, sizeof(hostMac));
+    mac[5] += (uint8_t)type;
+    return ESP_OK;
+}
+
+uint32_t esp_get_free_heap_size() {
+    return ESP.getFreeHeap();
+}
+
+void esp_restart() {
+    ESP.restart();
+}
+
+void esp_chip_info(esp_chip_info_t* out_info) {
+    out_info->model    = CHIP_ESP32;
+    out_info->features = CHIP_FEATURE_WIFI_BGN | CHIP_FEATURE_BT | CHIP_FEATURE_BLE;
+    out_info->revision = 3;
+    out_info->cores    = (uint8_t)std::min(2u, std::max(1u, std::thread::hardware_concurrency()));
+}
+
+esp_bt_controller_status_t esp_bt_controller_get_status() {
+    return ESP_BT_CONTROLLER_STATUS_IDLE;
+}
+
+esp_err_t esp_bt_controller_mem_release(esp_bt_mode_t mode) {
+    (void)mode;
+    return ESP_OK;
+}
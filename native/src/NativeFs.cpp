@@ -0,0 +1,136 @@
+// #################################################################################################################
+//
+//  ███    ██  █████  ████████ ██ ██    ██ ███████     ███████ ███████
+//  ████   ██ ██   ██    ██    ██ ██    ██ ██          ██      ██
+//  ██ ██  ██ ███████    ██    ██ ██    ██ █████       █████   ███████
+//  ██  ██ ██ ██   ██    ██    ██  ██  ██  ██          ██           ██
+//  ██   ████ ██   ██    ██    ██   ████   ███████     ██      ███████
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Native%20FS
+//
+/*
+
+    SPIFFS for the native host build
+
+    Files live in a host directory (default ./native_fs, see nativeFsSetRoot),
+    "/TaskStatus.json" becomes "<root>/TaskStatus.json".
+
+*/
+#include <sys/stat.h>
+#include <dirent.h>
+#include <mutex>
+#include <string>
+#include <SPIFFS.h>
+#include "NativeShim.h"
+#include "esp_partition.h"
+
+SPIFFSFS SPIFFS;
+
+// never destroyed: task threads may still write status files while the binary exits
+static std::mutex&  g_fsLock = *new std::mutex;                                 // protects g_fsRoot
+static std::string& g_fsRoot = *new std::string("native_fs");                   // host directory behind SPIFFS
+
+void nativeFsSetRoot(const char* directory) {
+    std::lock_guard<std::mutex> lk(g_fsLock);
+    g_fsRoot = directory ? directory : "native_fs";
+}
+
+static std::string hostPath(const char* path) {
+    std::lock_guard<std::mutex> lk(g_fsLock);
+    std::string                 p = path ? path : "";
+    if (p.empty() || p[0] != '/')
+        p = "/" + p;
+    return g_fsRoot + p;
+}
+
+// ----------------------------
+// File
+
+size_t fs::File::size() const {
+    if (!_handle)
+        return 0;
+    struct stat st;
+    return fstat(fileno(_handle.get()), &st) == 0 ? (size_t)st.st_size : 0;
+}
+
+int fs::File::available() {
+    if (!_handle)
+        return 0;
+    long pos = ftell(_handle.get());
+    return pos < 0 ? 0 : (int)(size() - (size_t)pos);
+}
+
+String fs::File::readString() {
+    std::string content;
+    char        buf[512];
+    size_t      n;
+    while (_handle && (n = fread(buf, 1, sizeof(buf), _handle.get())) > 0)
+        content.append(buf, n);
+    return String(content);
+}
+
+// ----------------------------
+// SPIFFS
+
+bool SPIFFSFS::begin(bool formatOnFail, const char* basePath, uint8_t maxOpenFiles, const char* partitionLabel) {
+    (void)basePath, (void)maxOpenFiles, (void)partitionLabel;
+    std::string root = hostPath("");
+    root.pop_back();                                                            // strip trailing '/'
+    struct stat st;
+    if (stat(root.c_str(), &st) == 0)
+        return S_ISDIR(st.st_mode);
+    return formatOnFail && mkdir(root.c_str(), 0755) == 0;
+}
+
+File SPIFFSFS::open(const char* path, const char* mode) {
+    FILE* handle = fopen(hostPath(path).c_str(), mode);
+    return handle ? File(handle) : File();
+}
+
+bool SPIFFSFS::exists(const char* path) {
+    struct stat st;
+    return stat(hostPath(path).c_str(), &st) == 0;
+}
+
+bool SPIFFSFS::remove(const char* path) {
+    return ::remove(hostPath(path).c_str()) == 0;
+}
+
+size_t SPIFFSFS::usedBytes() {
+    std::string root = hostPath("");
+    size_t      used = 0;
+    DIR*        dir  = opendir(root.c_str());
+    if (dir == nullptr)
+        return 0;
+    while (struct dirent* entry = readdir(dir)) {
+        struct stat st;
+        if (stat((root + entry->d_name).c_str(), &st) == 0 && S_ISREG(st.st_mode))
+            used += (size_t)st.st_size;
+    }
+    closedir(dir);
+    return used;
+}
+
+// ----------------------------
+// partitions, the host has none
+
+esp_partition_iterator_t esp_partition_find(esp_partition_type_t type, esp_partition_subtype_t subtype, const char* label) {
+    (void)type, (void)subtype, (void)label;
+    return nullptr;
+}
+
+const esp_partition_t* esp_partition_get(esp_partition_iterator_t iterator) {
+    (void)iterator;
+    return nullptr;
+}
+
+esp_partition_iterator_t esp_partition_next(esp_partition_iterator_t iterator) {
+    (void)iterator;
+    return nullptr;
+}
+
+void esp_partition_iterator_release(esp_partition_iterator_t iterator) {
+    (void)iterator;
+}
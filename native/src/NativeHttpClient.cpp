@@ -0,0 +1,296 @@
+// #################################################################################################################
+//
+//  ███    ██  █████  ████████ ██ ██    ██ ███████     ██   ██ ████████ ████████ ██████
+//  ████   ██ ██   ██    ██    ██ ██    ██ ██          ██   ██    ██       ██    ██   ██
+//  ██ ██  ██ ███████    ██    ██ ██    ██ █████       ███████    ██       ██    ██████
+//  ██  ██ ██ ██   ██    ██    ██  ██  ██  ██          ██   ██    ██       ██    ██
+//  ██   ████ ██   ██    ██    ██   ████   ███████     ██   ██    ██       ██    ██
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Native%20HTTP
+//
+/*
+
+    Fake esp_http_client (and Arduino HTTPClient) for the native host build
+
+    esp_http_client_perform() asks the responder installed by nativeHttpSetResponder()
+    for the body of the requested url and feeds it to the event handler in chunks of
+    buffer_size bytes, like the real client does with a chunked TLS response.
+    Without responder every request fails with ESP_ERR_HTTP_CONNECT.
+
+    The connection of a client stays open between requests until close/cleanup, like
+    on a keep-alive server. The server model set by nativeHttpSetServerModel() adds the
+    cost of handshakes and requests and lets the server drop idle connections, the
+    counters of nativeHttpStats() show how many handshakes a poll cycle really needs.
+    With etag in the model the server tags bodies and answers If-None-Match with 304.
+
+*/
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <HTTPClient.h>
+#include "NativeShim.h"
+#include "esp_http_client.h"
+
+struct NativeHttpClient {
+    esp_http_client_config_t           config;                                 // copy of init config
+    std::string                        url;                                    // current request url
+    std::map<std::string, std::string> headers;                                // request headers
+    int                                status        = 0;                      // HTTP status of last perform
+    int64_t                            contentLength = -1;                     // body length of last perform
+    bool                               connected     = false;                  // DISCONNECTED pending on close
+    uint32_t                           connRequests  = 0;                      // requests on current connection
+    uint64_t                           lastUseUs     = 0;                      // end of last request on connection
+};
+
+// never destroyed: the liga task may still poll while the binary exits
+static std::mutex&            g_responderLock = *new std::mutex;                // protects responder, server model and stats
+static NativeHttpResponder&   g_responder     = *new NativeHttpResponder;       // answers all requests
+static NativeHttpServerModel& g_serverModel   = *new NativeHttpServerModel;     // timing and close policy of server
+static NativeHttpStats&       g_httpStats     = *new NativeHttpStats;           // counters of server
+
+void nativeHttpSetResponder(NativeHttpResponder responder) {
+    std::lock_guard<std::mutex> lk(g_responderLock);
+    g_responder = std::move(responder);
+}
+
+void nativeHttpSetServerModel(const NativeHttpServerModel& model) {
+    std::lock_guard<std::mutex> lk(g_responderLock);
+    g_serverModel = model;
+}
+
+NativeHttpStats nativeHttpStats() {
+    std::lock_guard<std::mutex> lk(g_responderLock);
+    return g_httpStats;
+}
+
+void nativeHttpResetStats() {
+    std::lock_guard<std::mutex> lk(g_responderLock);
+    g_httpStats = NativeHttpStats();
+}
+
+static NativeHttpServerModel serverModel() {
+    std::lock_guard<std::mutex> lk(g_responderLock);
+    return g_serverModel;
+}
+
+/**
+ * @brief add to server counters
+ */
+static void countRequest(uint32_t handshakes, uint32_t dropped, uint32_t notModified, uint64_t busyUs) {
+    std::lock_guard<std::mutex> lk(g_responderLock);
+    g_httpStats.requests += (dropped ? 0 : 1);
+    g_httpStats.handshakes += handshakes;
+    g_httpStats.dropped += dropped;
+    g_httpStats.notModified += notModified;
+    g_httpStats.busyUs += busyUs;
+}
+
+static void sleepMs(uint32_t ms) {
+    if (ms)
+        nativeSleepUs((uint64_t)ms * 1000);
+}
+
+/**
+ * @brief has the server closed the kept connection of client
+ */
+static bool serverClosed(const NativeHttpClient* client, const NativeHttpServerModel& model) {
+    if (model.idleTimeoutMs && nativeMicros() - client->lastUseUs > (uint64_t)model.idleTimeoutMs * 1000)
+        return true;                                                            // idle too long
+    return model.maxRequests && client->connRequests >= model.maxRequests;      // request limit per connection
+}
+
+/**
+ * @brief ask responder for url
+ *
+ * @return HTTP status code, or negative esp_err_t on transport error
+ */
+static int nativeHttpRespond(const std::string& url, std::string& body) {
+    NativeHttpResponder responder;
+    {
+        std::lock_guard<std::mutex> lk(g_responderLock);
+        responder = g_responder;
+    }
+    if (!responder)
+        return -ESP_ERR_HTTP_CONNECT;                                           // no network on the host
+    return responder(url, body);
+}
+
+static void fireEvent(NativeHttpClient* client, esp_http_client_event_id_t id, const char* data = nullptr, int len = 0) {
+    if (client->config.event_handler == nullptr)
+        return;
+    esp_http_client_event_t evt = {};
+    evt.event_id                = id;
+    evt.client                  = client;
+    evt.data                    = const_cast<char*>(data);
+    evt.data_len                = len;
+    evt.user_data               = client->config.user_data;
+    client->config.event_handler(&evt);
+}
+
+static void fireHeader(NativeHttpClient* client, const char* key, const std::string& value) {
+    if (client->config.event_handler == nullptr)
+        return;
+    esp_http_client_event_t evt = {};
+    evt.event_id                = HTTP_EVENT_ON_HEADER;
+    evt.client                  = client;
+    evt.header_key              = const_cast<char*>(key);
+    evt.header_value            = const_cast<char*>(value.c_str());
+    evt.user_data               = client->config.user_data;
+    client->config.event_handler(&evt);
+}
+
+// ----------------------------
+// esp_http_client
+
+esp_http_client_handle_t esp_http_client_init(const esp_http_client_config_t* config) {
+    if (config == nullptr)
+        return nullptr;
+    NativeHttpClient* client = new NativeHttpClient;
+    client->config           = *config;
+    if (config->url) {
+        client->url = config->url;
+    } else if (config->host) {
+        client->url = std::string("https://") + config->host + (config->path ? config->path : "/");
+    }
+    return client;
+}
+
+esp_err_t esp_http_client_set_url(esp_http_client_handle_t client, const char* url) {
+    if (client == nullptr || url == nullptr)
+        return ESP_ERR_INVALID_ARG;
+    client->url = url;
+    return ESP_OK;
+}
+
+esp_err_t esp_http_client_set_header(esp_http_client_handle_t client, const char* key, const char* value) {
+    if (client == nullptr || key == nullptr)
+        return ESP_ERR_INVALID_ARG;
+    client->headers[key] = value ? value : "";
+    return ESP_OK;
+}
+
+esp_err_t esp_http_client_delete_header(esp_http_client_handle_t client, const char* key) {
+    if (client == nullptr || key == nullptr)
+        return ESP_ERR_INVALID_ARG;
+    client->headers.erase(key);
+    return ESP_OK;
+}
+
+esp_err_t esp_http_client_get_header(esp_http_client_handle_t client, const char* key, char** value) {
+    if (client == nullptr || key == nullptr || value == nullptr)
+        return ESP_ERR_INVALID_ARG;
+    auto it = client->headers.find(key);
+    *value  = (it == client->headers.end()) ? nullptr : const_cast<char*>(it->second.c_str());
+    return ESP_OK;
+}
+
+esp_err_t esp_http_client_set_user_data(esp_http_client_handle_t client, void* data) {
+    if (client == nullptr)
+        return ESP_ERR_INVALID_ARG;
+    client->config.user_data = data;
+    return ESP_OK;
+}
+
+esp_err_t esp_http_client_perform(esp_http_client_handle_t client) {
+    if (client == nullptr)
+        return ESP_ERR_INVALID_ARG;
+
+    NativeHttpServerModel model = serverModel();
+    uint64_t              start = nativeMicros();
+
+    if (client->connected && serverClosed(client, model)) {
+        client->connected = false;                                              // request hits socket closed by server
+        fireEvent(client, HTTP_EVENT_ERROR);
+        fireEvent(client, HTTP_EVENT_DISCONNECTED);
+        countRequest(0, 1, 0, nativeMicros() - start);
+        return ESP_ERR_HTTP_FETCH_HEADER;
+    }
+
+    std::string body;
+    int         result = nativeHttpRespond(client->url, body);
+    if (result < 0) {
+        fireEvent(client, HTTP_EVENT_ERROR);
+        return (esp_err_t)-result;
+    }
+
+    uint32_t handshakes = 0;
+    if (!client->connected) {
+        sleepMs(model.handshakeMs);                                             // TCP + TLS handshake
+        client->connected    = true;
+        client->connRequests = 0;
+        handshakes           = 1;
+        fireEvent(client, HTTP_EVENT_ON_CONNECTED);
+    }
+    sleepMs(model.requestMs);
+    client->connRequests++;
+
+    uint32_t notModified = 0;
+    if (model.etag && result == 200) {
+        char etag[16];
+        snprintf(etag, sizeof(etag), "\"%08x\"", (unsigned)std::hash<std::string>()(body));
+        auto match = client->headers.find("If-None-Match");
+        if (match != client->headers.end() && match->second == etag) {
+            result      = 304;                                                  // client has this body already
+            notModified = 1;
+            body.clear();
+        }
+        fireHeader(client, "ETag", etag);
+    }
+    client->status        = result;
+    client->contentLength = (int64_t)body.size();
+
+    size_t chunk = client->config.buffer_size > 0 ? (size_t)client->config.buffer_size : 512;
+    for (size_t pos = 0; pos < body.size(); pos += chunk) {
+        size_t len = std::min(chunk, body.size() - pos);
+        fireEvent(client, HTTP_EVENT_ON_DATA, body.data() + pos, (int)len);
+    }
+    fireEvent(client, HTTP_EVENT_ON_FINISH);
+    client->lastUseUs = nativeMicros();
+    countRequest(handshakes, 0, notModified, client->lastUseUs - start);
+    return ESP_OK;
+}
+
+int esp_http_client_get_status_code(esp_http_client_handle_t client) {
+    return client ? client->status : -1;
+}
+
+int64_t esp_http_client_get_content_length(esp_http_client_handle_t client) {
+    return client ? client->contentLength : -1;
+}
+
+esp_err_t esp_http_client_close(esp_http_client_handle_t client) {
+    if (client == nullptr)
+        return ESP_ERR_INVALID_ARG;
+    if (client->connected) {
+        client->connected = false;
+        fireEvent(client, HTTP_EVENT_DISCONNECTED);
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_http_client_cleanup(esp_http_client_handle_t client) {
+    if (client == nullptr)
+        return ESP_ERR_INVALID_ARG;
+    esp_http_client_close(client);
+    delete client;
+    return ESP_OK;
+}
+
+// ----------------------------
+// Arduino HTTPClient
+
+int HTTPClient::GET() {
+    NativeHttpServerModel model = serverModel();
+    uint64_t              start = nativeMicros();
+    std::string           body;
+    int                   result = nativeHttpRespond(_url.c_str(), body);
+    if (result >= 0) {
+        sleepMs(model.handshakeMs + model.requestMs);                           // one connection per GET
+        countRequest(1, 0, 0, nativeMicros() - start);
+    }
+    _body              = String(body);
+    return result < 0 ? -1 : result;                                            // HTTPC_ERROR_CONNECTION_REFUSED
+}
@@ -0,0 +1,195 @@
+// #################################################################################################################
+//
+//  ███    ██  █████  ████████ ██ ██    ██ ███████     ██ ██████   ██████
+//  ████   ██ ██   ██    ██    ██ ██    ██ ██          ██      ██ ██
+//  ██ ██  ██ ███████    ██    ██ ██    ██ █████       ██  █████  ██
+//  ██  ██ ██ ██   ██    ██    ██  ██  ██  ██          ██ ██      ██
+//  ██   ████ ██   ██    ██    ██   ████   ███████     ██ ███████  ██████
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Native%20I2C
+//
+/*
+
+    Fake I2C bus for the native host build
+
+    i2c_cmd_link_* records the command chain, i2c_master_cmd_begin() replays it
+    against the virtual slave attached to the addressed device (nativeI2cAttach).
+    An address without device answers with ESP_FAIL, like a real NACK.
+
+*/
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "NativeShim.h"
+#include "driver/i2c.h"
+
+struct NativeI2cCmd {
+    struct Op {
+        enum Kind { START, STOP, WRITE, READ } kind;
+        std::vector<uint8_t> data;                                              // WRITE: bytes to send
+        uint8_t*             target = nullptr;                                  // READ: destination of received bytes
+        size_t               len    = 0;                                        // READ: number of bytes
+    };
+    std::vector<Op> ops;                                                        // recorded command chain
+};
+
+// never destroyed: detached task threads may still use the bus while the binary exits
+static std::mutex&                         g_busLock    = *new std::mutex;      // one master transaction at a time
+static std::mutex&                         g_deviceLock = *new std::mutex;      // protects g_devices (devices may re-attach inside a transfer)
+static std::map<uint8_t, NativeI2cDevice>& g_devices    = *new std::map<uint8_t, NativeI2cDevice>; // attached virtual slaves
+static std::atomic<uint32_t>               g_busLatencyUs{0};                   // simulated wire time per byte
+static std::atomic<uint32_t>               g_transactions{0};                   // count of i2c_master_cmd_begin
+
+void nativeI2cAttach(uint8_t address, NativeI2cDevice device) {
+    std::lock_guard<std::mutex> lk(g_deviceLock);
+    g_devices[address] = std::move(device);
+}
+
+void nativeI2cDetach(uint8_t address) {
+    std::lock_guard<std::mutex> lk(g_deviceLock);
+    g_devices.erase(address);
+}
+
+void nativeI2cSetBusLatencyUs(uint32_t usPerByte) {
+    g_busLatencyUs = usPerByte;
+}
+
+uint32_t nativeI2cTransactions() {
+    return g_transactions.load();
+}
+
+// ----------------------------
+// driver setup, nothing to do on the host
+
+esp_err_t i2c_param_config(i2c_port_t port, const i2c_config_t* conf) {
+    (void)port;
+    return conf ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t i2c_driver_install(i2c_port_t port, i2c_mode_t mode, size_t slvRxBuf, size_t slvTxBuf, int intrAllocFlags) {
+    (void)port, (void)mode, (void)slvRxBuf, (void)slvTxBuf, (void)intrAllocFlags;
+    return ESP_OK;
+}
+
+esp_err_t i2c_driver_delete(i2c_port_t port) {
+    (void)port;
+    return ESP_OK;
+}
+
+// ----------------------------
+// command chain
+
+i2c_cmd_handle_t i2c_cmd_link_create() {
+    return new NativeI2cCmd;
+}
+
+void i2c_cmd_link_delete(i2c_cmd_handle_t cmd) {
+    delete cmd;
+}
+
+esp_err_t i2c_master_start(i2c_cmd_handle_t cmd) {
+    cmd->ops.push_back({NativeI2cCmd::Op::START, {}, nullptr, 0});
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_stop(i2c_cmd_handle_t cmd) {
+    cmd->ops.push_back({NativeI2cCmd::Op::STOP, {}, nullptr, 0});
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_write_byte(i2c_cmd_handle_t cmd, uint8_t data, bool ackEn) {
+    (void)ackEn;
+    cmd->ops.push_back({NativeI2cCmd::Op::WRITE, {data}, nullptr, 0});
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_write(i2c_cmd_handle_t cmd, const uint8_t* data, size_t len, bool ackEn) {
+    (void)ackEn;
+    cmd->ops.push_back({NativeI2cCmd::Op::WRITE, std::vector<uint8_t>(data, data + len), nullptr, 0});
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_read_byte(i2c_cmd_handle_t cmd, uint8_t* data, i2c_ack_type_t ack) {
+    return i2c_master_read(cmd, data, 1, ack);
+}
+
+esp_err_t i2c_master_read(i2c_cmd_handle_t cmd, uint8_t* data, size_t len, i2c_ack_type_t ack) {
+    (void)ack;
+    cmd->ops.push_back({NativeI2cCmd::Op::READ, {}, data, len});
+    return ESP_OK;
+}
+
+/**
+ * @brief replay command chain against the addressed virtual slave
+ *
+ * The first byte after each START is the address byte. All other written bytes
+ * are collected into one write buffer, all reads are served from one read buffer.
+ */
+esp_err_t i2c_master_cmd_begin(i2c_port_t port, i2c_cmd_handle_t cmd, TickType_t ticksToWait) {
+    (void)port, (void)ticksToWait;
+    g_transactions++;
+
+    std::vector<uint8_t>                      written;
+    std::vector<std::pair<uint8_t*, size_t>>  reads;
+    size_t                                    readLen   = 0;
+    size_t                                    wireBytes = 0;
+    int                                       address   = -1;
+    bool                                      expectAdr = false;
+
+    for (NativeI2cCmd::Op& op : cmd->ops) {
+        switch (op.kind) {
+            case NativeI2cCmd::Op::START: expectAdr = true; break;
+            case NativeI2cCmd::Op::STOP:  break;
+            case NativeI2cCmd::Op::WRITE: {
+                size_t first = 0;
+                if (expectAdr && !op.data.empty()) {
+                    address   = op.data[0] >> 1;                                // 7-bit address, R/W bit dropped
+                    expectAdr = false;
+                    first     = 1;
+                }
+                written.insert(written.end(), op.data.begin() + first, op.data.end());
+                wireBytes += op.data.size();
+                break;
+            }
+            case NativeI2cCmd::Op::READ:
+                reads.push_back({op.target, op.len});
+                readLen += op.len;
+                wireBytes += op.len;
+                break;
+        }
+    }
+
+    std::lock_guard<std::mutex> bus(g_busLock);                                 // bus is busy until transaction is done
+    NativeI2cDevice             device;
+    {
+        std::lock_guard<std::mutex> lk(g_deviceLock);
+        auto                        it = g_devices.find((uint8_t)address);
+        if (address < 0 || it == g_devices.end())
+            return ESP_FAIL;                                                    // no ACK from address
+        device = it->second;
+    }
+
+    if (g_busLatencyUs)
+        nativeSleepUs((uint64_t)g_busLatencyUs * wireBytes);
+
+    std::vector<uint8_t> answer(readLen, 0xFF);                                 // idle bus reads 0xFF
+    NativeI2cTransfer    transfer;
+    transfer.write    = written.data();
+    transfer.writeLen = written.size();
+    transfer.read     = answer.data();
+    transfer.readLen  = answer.size();
+    esp_err_t err     = device(transfer);
+
+    size_t pos = 0;
+    for (auto& r : reads) {
+        memcpy(r.first, answer.data() + pos, r.second);
+        pos += r.second;
+    }
+    return err;
+}
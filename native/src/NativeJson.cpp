@@ -0,0 +1,396 @@
+// #################################################################################################################
+//
+//  ███    ██  █████  ████████ ██ ██    ██ ███████          ██ ███████  ██████  ███    ██
+//  ████   ██ ██   ██    ██    ██ ██    ██ ██               ██ ██      ██    ██ ████   ██
+//  ██ ██  ██ ███████    ██    ██ ██    ██ █████            ██ ███████ ██    ██ ██ ██  ██
+//  ██  ██ ██ ██   ██    ██    ██  ██  ██  ██          ██   ██      ██ ██    ██ ██  ██ ██
+//  ██   ████ ██   ██    ██    ██   ████   ███████      █████  ███████  ██████  ██   ████
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Native%20Json
+//
+/*
+
+    Benchmark of the openLigaDB body parsing, see NativeJson.h
+
+*/
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <FlapGlobal.h>
+#include <dirent.h>
+#include <malloc.h>
+#include <time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "JsonStream.h"
+#include "Liga.h"
+#include "NativeJson.h"
+
+static char   jsonBuffer[JSONBENCH_BUFFER];                                     // like the former buffer in Liga.cpp
+static size_t jsonBufferPos = 0;
+
+// heap of the ArduinoJson document, current and peak bytes
+class CountingAllocator : public ArduinoJson::Allocator {
+   public:
+    void* allocate(size_t size) override {
+        void* p = malloc(size);
+        count(p, true);
+        return p;
+    }
+    void deallocate(void* p) override {
+        count(p, false);
+        free(p);
+    }
+    void* reallocate(void* p, size_t size) override {
+        count(p, false);
+        p = realloc(p, size);
+        count(p, true);
+        return p;
+    }
+
+    void   reset() { _used = _peak = 0; }
+    size_t peak() const { return _peak; }
+
+   private:
+    void count(void* p, bool add) {
+        if (p == nullptr)
+            return;
+        const size_t size = malloc_usable_size(p);
+        _used             = add ? _used + size : _used - size;
+        _peak             = std::max(_peak, _used);
+    }
+
+    size_t _used = 0;
+    size_t _peak = 0;
+};
+
+// result of one path for one body
+struct JsonPathResult {
+    double us       = 0;                                                        // mean per parse
+    size_t heapPeak = 0;                                                        // heap while parsing
+    bool   ok       = false;                                                    // body parsed
+    bool   cut      = false;                                                    // body over jsonBuffer
+};
+
+// one captured response body
+struct JsonBody {
+    std::string name;                                                           // file name = url path
+    std::string body;
+};
+
+static CountingAllocator documentHeap;
+static size_t            streamHeapBase = 0;
+static size_t            streamHeapPeak = 0;
+
+// heap in use right now (glibc)
+static size_t heapInUse() {
+    return mallinfo2().uordblks;
+}
+
+// ----------------------------
+// buffered path
+
+/**
+ * @brief copy one chunk like the former readHttpResult, cut at the end of jsonBuffer
+ *
+ * @return false if the chunk did not fit completely
+ */
+static bool bufferChunk(const char* data, size_t len) {
+    size_t copyLen = len;
+    if (jsonBufferPos + copyLen >= sizeof(jsonBuffer))                          // prevent buffer overflow
+        copyLen = sizeof(jsonBuffer) - jsonBufferPos - 1;
+    memcpy(&jsonBuffer[jsonBufferPos], data, copyLen);
+    jsonBufferPos += copyLen;
+    return copyLen == len;
+}
+
+/**
+ * @brief body through jsonBuffer and one ArduinoJson document
+ *
+ * @param cut set if the body did not fit into jsonBuffer
+ * @return true document is valid
+ */
+static bool parseBuffered(const std::string& body, bool& cut) {
+    jsonBufferPos = 0;
+    cut           = false;
+    for (size_t pos = 0; pos < body.size(); pos += JSONBENCH_CHUNK)
+        cut |= !bufferChunk(body.data() + pos, std::min((size_t)JSONBENCH_CHUNK, body.size() - pos));
+
+    JsonDocument               doc(&documentHeap);                              // grows like DynamicJsonDocument(size * 1.2) did
+    const DeserializationError error = deserializeJson(doc, jsonBuffer, jsonBufferPos);
+    return !error && !doc.overflowed();
+}
+
+// ----------------------------
+// streamed path
+
+// touch every value like a stream handler that looks at its path
+static void countValue(JsonStream& json, JsonStreamEvent event, void* context) {
+    if (event == JSON_VALUE)
+        *(uint32_t*)context += json.pathHash() ^ (uint32_t)strlen(json.text());
+}
+
+// same, plus heap sample at every value
+static void sampleValue(JsonStream& json, JsonStreamEvent event, void* context) {
+    countValue(json, event, context);
+    const size_t used = heapInUse();
+    if (used > streamHeapBase)
+        streamHeapPeak = std::max(streamHeapPeak, used - streamHeapBase);
+}
+
+/**
+ * @brief body in chunks through JsonStream
+ *
+ * @return true one complete JSON value
+ */
+static bool parseStreamed(const std::string& body, JsonStreamHandler handler, uint32_t& values) {
+    JsonStream json;
+    json.begin(handler, &values);
+    for (size_t pos = 0; pos < body.size(); pos += JSONBENCH_CHUNK) {
+        if (!json.feed(body.data() + pos, std::min((size_t)JSONBENCH_CHUNK, body.size() - pos)))
+            return false;
+    }
+    return json.finish();
+}
+
+// ----------------------------
+
+/**
+ * @brief both paths over one body
+ */
+static void runBody(const JsonBody& body, JsonPathResult& buffered, JsonPathResult& streamed) {
+    uint32_t values = 0;
+    documentHeap.reset();
+    buffered.ok       = parseBuffered(body.body, buffered.cut);                 // heap and correctness, one pass
+    buffered.heapPeak = documentHeap.peak();
+
+    streamHeapBase    = heapInUse();
+    streamHeapPeak    = 0;
+    streamed.ok       = parseStreamed(body.body, sampleValue, values);
+    streamed.heapPeak = streamHeapPeak;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int round = 0; round < JSONBENCH_ROUNDS; ++round) {
+        bool cut;
+        parseBuffered(body.body, cut);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int round = 0; round < JSONBENCH_ROUNDS; ++round)
+        parseStreamed(body.body, countValue, values);
+    auto t2     = std::chrono::steady_clock::now();
+    buffered.us = std::chrono::duration<double, std::micro>(t1 - t0).count() / JSONBENCH_ROUNDS;
+    streamed.us = std::chrono::duration<double, std::micro>(t2 - t1).count() / JSONBENCH_ROUNDS;
+}
+
+/**
+ * @brief all files of a directory, sorted by name
+ *
+ * @return size_t number of bodies read
+ */
+static size_t readBodies(const char* directory, std::vector<JsonBody>& bodies) {
+    DIR* dir = opendir(directory);
+    if (dir == nullptr)
+        return 0;
+    while (struct dirent* entry = readdir(dir)) {
+        if (entry->d_name[0] == '.')
+            continue;
+        std::ifstream in(std::string(directory) + "/" + entry->d_name, std::ios::binary);
+        if (!in)
+            continue;
+        std::stringstream buffer;
+        buffer << in.rdbuf();
+        bodies.push_back(JsonBody{entry->d_name, buffer.str()});
+    }
+    closedir(dir);
+    std::sort(bodies.begin(), bodies.end(), [](const JsonBody& a, const JsonBody& b) { return a.name < b.name; });
+    return bodies.size();
+}
+
+/**
+ * @brief captured bodies through the buffered and the streamed path
+ *
+ * @param directory host directory with one response body per file
+ * @return int exit code, 1 if the streamed path rejects a body the buffered path accepts
+ */
+int nativeJsonBenchRun(const char* directory) {
+    std::vector<JsonBody> bodies;
+    if (readBodies(directory, bodies) == 0) {
+        fprintf(stderr, "[FLAP  -  JSON  ] no bodies in %s\n", directory);
+        return 1;
+    }
+
+    printf("[FLAP  -  JSON  ] %zu bodies, %d byte chunks, %d rounds\n", bodies.size(), JSONBENCH_CHUNK, JSONBENCH_ROUNDS);
+    printf("[FLAP  -  JSON  ] %-40s %7s | %-32s | %-22s\n", "body", "bytes", "buffered: us, heap peak, cut", "streamed: us, heap peak");
+    uint32_t mismatches = 0, bufferedFailed = 0, streamedFailed = 0;
+    size_t   bufferedPeak = 0, streamedPeak = 0;
+    for (const JsonBody& body : bodies) {
+        JsonPathResult buffered, streamed;
+        runBody(body, buffered, streamed);
+        printf("[FLAP  -  JSON  ] %-40s %7zu | %8.1f us %8zu B %4s | %8.1f us %8zu B\n", body.name.c_str(), body.body.size(), buffered.us,
+               buffered.heapPeak, buffered.cut ? "cut" : "", streamed.us, streamed.heapPeak);
+        bufferedPeak = std::max(bufferedPeak, buffered.heapPeak);
+        streamedPeak = std::max(streamedPeak, streamed.heapPeak);
+        bufferedFailed += !buffered.ok;
+        streamedFailed += !streamed.ok;
+        mismatches += buffered.ok && !streamed.ok;
+    }
+    printf("[FLAP  -  JSON  ] peak RAM buffered: %zu B heap + %u B jsonBuffer, streamed: %zu B heap + %zu B parser\n", bufferedPeak,
+           (unsigned)JSONBENCH_BUFFER, streamedPeak, JsonStream::footprint());
+    printf("[FLAP  -  JSON  ] failed bodies buffered: %u, streamed: %u, streamed rejects accepted body: %u\n", bufferedFailed, streamedFailed, mismatches);
+    return mismatches ? 1 : 0;
+}
+
+// ----------------------------
+// event handlers of Liga.cpp
+
+esp_err_t _http_event_handler_pollForMatches(esp_http_client_event_t* evt);
+esp_err_t _http_event_handler_pollForGoalsInLiveMatches(esp_http_client_event_t* evt);
+esp_err_t _http_event_handler_pollForChanges(esp_http_client_event_t* evt);
+esp_err_t _http_event_handler_pollCurrentMatchday(esp_http_client_event_t* evt);
+esp_err_t _http_event_handler_pollForTable(esp_http_client_event_t* evt);
+
+struct JsonHandler {
+    const char*          name;
+    http_event_handle_cb handler;
+};
+
+enum JsonHandlerIndex { H_MATCHES, H_GOALS, H_CHANGES, H_MATCHDAY, H_TABLE, H_COUNT };
+
+static const JsonHandler jsonHandlers[H_COUNT] = {
+    {"pollForMatches (matchday)", _http_event_handler_pollForMatches},
+    {"pollForGoalsInLiveMatches", _http_event_handler_pollForGoalsInLiveMatches},
+    {"pollForChanges", _http_event_handler_pollForChanges},
+    {"pollCurrentMatchday", _http_event_handler_pollCurrentMatchday},
+    {"pollForTable", _http_event_handler_pollForTable},
+};
+
+static int benchMatchday = 0;                                                   // user_data of the matchday request
+
+/**
+ * @brief handlers that read the body of this file
+ *
+ * @param name file name = url path with '_' instead of '/'
+ * @param handlers gets the indices in jsonHandlers[]
+ * @return size_t number of handlers, 0 if no handler reads this endpoint
+ */
+static size_t handlersOf(const std::string& name, int handlers[2]) {
+    const size_t parts = std::count(name.begin(), name.end(), '_');             // url path segments + capture index
+    if (name.rfind("getmatchdata_", 0) == 0 && parts == 4)                      // getmatchdata/<league>/<season>/<matchday>
+        return handlers[0] = H_MATCHES, 1;
+    if (name.rfind("getmatchdata_", 0) == 0 && parts == 2 && isdigit(name[13])) // getmatchdata/<matchID>
+        return handlers[0] = H_GOALS, 1;
+    if (name.rfind("getlastchangedate_", 0) == 0)
+        return handlers[0] = H_CHANGES, 1;
+    if (name.rfind("getcurrentgroup_", 0) == 0)
+        return handlers[0] = H_MATCHDAY, 1;
+    if (name.rfind("getbltable_", 0) == 0)
+        return handlers[0] = H_TABLE, 1;
+    return 0;                                                                   // e.g. whole season, next kickoff: not requested
+}
+
+/**
+ * @brief Liga state the request of this body would have, like the poll scope sets it
+ */
+static void prepareHandler(int handler, const std::string& name) {
+    if (handler == H_MATCHES)                                                   // getmatchdata_<league>_<season>_<matchday>_<n>
+        benchMatchday = atoi(name.c_str() + name.find_last_of('_', name.find_last_of('_') - 1) + 1);
+    if (handler != H_GOALS)
+        return;
+    liveMatchID            = atoi(name.c_str() + strlen("getmatchdata_"));
+    liveMatches[0].matchID = liveMatchID;                                       // requested match is live
+    ligaLiveMatchCount     = 1;
+    ligaFiniMatchCount     = 0;
+    liveGoalCount          = 0;                                                 // goals of one cycle
+}
+
+/**
+ * @brief body as HTTP_EVENT_ON_DATA chunks and HTTP_EVENT_ON_FINISH, like esp_http_client delivers it
+ */
+static void deliver(http_event_handle_cb handler, const std::string& body) {
+    esp_http_client_event_t evt = {};
+    evt.user_data               = &benchMatchday;
+    evt.event_id                = HTTP_EVENT_ON_DATA;
+    for (size_t pos = 0; pos < body.size(); pos += JSONBENCH_CHUNK) {
+        evt.data     = (void*)(body.data() + pos);
+        evt.data_len = (int)std::min((size_t)JSONBENCH_CHUNK, body.size() - pos);
+        handler(&evt);
+    }
+    evt.event_id = HTTP_EVENT_ON_FINISH;
+    evt.data     = nullptr;
+    evt.data_len = 0;
+    handler(&evt);
+}
+
+// CPU time of this thread, without the sleeps of vTaskDelay()
+static double threadNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * @brief captured bodies through the event handlers of Liga.cpp
+ *
+ * @param directory host directory with one response body per file
+ * @return int exit code, 1 if a handler left the parser prepared after ON_FINISH
+ */
+int nativeHandlerBenchRun(const char* directory) {
+    std::vector<JsonBody> bodies;
+    if (readBodies(directory, bodies) == 0) {
+        fprintf(stderr, "[FLAP  - HANDLER] no bodies in %s\n", directory);
+        return 1;
+    }
+    FILE* report = fdopen(dup(fileno(stdout)), "w");                            // Serial of the handlers goes to /dev/null
+    freopen("/dev/null", "w", stdout);
+
+    traceSemaphore = xSemaphoreCreateMutex();                                   // what setup() provides for the Liga task
+    ligaSnapshotMutexInit();
+    createLigaInstance();
+    ligaMaxTeams = LIGA1_MAX_TEAMS;
+
+    std::vector<double> ns[H_COUNT];
+    size_t              bytes[H_COUNT] = {};
+    uint32_t            unfinished     = 0;
+    for (int round = 0; round < HANDLERBENCH_ROUNDS; ++round) {
+        for (const JsonBody& body : bodies) {
+            int          handlers[2];
+            const size_t count = handlersOf(body.name, handlers);
+            for (size_t i = 0; i < count; ++i) {
+                const int h = handlers[i];
+                prepareHandler(h, body.name);
+                const double t0 = threadNs();
+                deliver(jsonHandlers[h].handler, body.body);
+                ns[h].push_back(threadNs() - t0);
+                bytes[h] += body.body.size();
+                if (jsonStreamPrepared) {                                       // next body would continue this one
+                    unfinished++;
+                    jsonStreamPrepared = false;
+                }
+            }
+        }
+    }
+
+    fprintf(report, "[FLAP  - HANDLER] %zu bodies, %d byte chunks, %d rounds\n", bodies.size(), JSONBENCH_CHUNK, HANDLERBENCH_ROUNDS);
+    for (int h = 0; h < H_COUNT; ++h) {
+        if (ns[h].empty()) {
+            fprintf(report, "[FLAP  - HANDLER] %-27s no bodies\n", jsonHandlers[h].name);
+            continue;
+        }
+        std::sort(ns[h].begin(), ns[h].end());
+        double sum = 0;
+        for (double v : ns[h])
+            sum += v;
+        fprintf(report, "[FLAP  - HANDLER] %-27s %6zu bodies, mean %8.0f ns, p50 %8.0f ns, p99 %8.0f ns, %6.1f MB/s\n", jsonHandlers[h].name,
+                ns[h].size(), sum / ns[h].size(), ns[h][ns[h].size() / 2], ns[h][ns[h].size() * 99 / 100], bytes[h] / (sum / 1e3));
+    }
+    fprintf(report, "[FLAP  - HANDLER] parser left prepared after ON_FINISH: %u\n", unfinished);
+    fclose(report);
+    return unfinished ? 1 : 0;
+}
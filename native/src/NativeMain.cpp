@@ -0,0 +1,67 @@
+// #################################################################################################################
+//
+//  ███    ██  █████  ████████ ██ ██    ██ ███████     ███    ███  █████  ██ ███    ██
+//  ████   ██ ██   ██    ██    ██ ██    ██ ██          ████  ████ ██   ██ ██ ████   ██
+//  ██ ██  ██ ███████    ██    ██ ██    ██ █████       ██ ████ ██ ███████ ██ ██ ██  ██
+//  ██  ██ ██ ██   ██    ██    ██  ██  ██  ██          ██  ██  ██ ██   ██ ██ ██  ██ ██
+//  ██   ████ ██   ██    ██    ██   ████   ███████     ██      ██ ██   ██ ██ ██   ████
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Native%20Main
+//
+/*
+
+    Entry point of the native host build
+
+    Runs setup() and loop() like the Arduino loopTask on the ESP32.
+    FLAP_VIRTUAL_MODULES=<n> plugs n simulated flap modules into the I2C bus before setup().
+    FLAP_REPLAY=<recording> replays a recorded match day through the Liga task instead (NativeReplay.h).
+    FLAP_JSONBENCH=<directory> runs the buffered vs streamed JSON benchmark instead (NativeJson.h).
+    FLAP_HANDLERBENCH=<directory> runs the Liga event handlers over captured bodies instead (NativeJson.h).
+    FLAP_READYBENCH=<n> compares per-twin AYR polling with the ReadyScheduler on n modules instead (VirtualFlap.h).
+    FLAP_STATBENCH=<accesses> runs the I2C statistics microbenchmark instead (NativeStats.h).
+    FLAP_SNAPBENCH=<publications> runs the Liga table publication stress test instead (NativeSnapshot.h).
+    FLAP_TABLEBENCH=<matchdays> runs the live table benchmark instead (NativeTable.h).
+
+    `pio test -e native` links the master sources without this main(), every test in test/
+    brings its own.
+
+*/
+#include <Arduino.h>
+#include "VirtualFlap.h"
+#include "NativeReplay.h"
+#include "NativeJson.h"
+#include "NativeStats.h"
+#include "NativeSnapshot.h"
+#include "NativeTable.h"
+
+#ifndef PIO_UNIT_TESTING
+void setup();
+void loop();
+
+int main() {
+    setvbuf(stdout, nullptr, _IOLBF, 0);                                        // Serial output line by line, also into pipes
+    if (const char* recording = getenv("FLAP_REPLAY"))
+        return nativeReplayRun(recording);                                      // virtual clock, Liga task only
+    if (const char* directory = getenv("FLAP_JSONBENCH"))
+        return nativeJsonBenchRun(directory);                                   // captured bodies, buffered vs streamed
+    if (const char* directory = getenv("FLAP_HANDLERBENCH"))
+        return nativeHandlerBenchRun(directory);                                // Liga event handlers only
+    if (const char* modules = getenv("FLAP_READYBENCH"))
+        return nativeReadyBenchRun(atoi(modules));                              // twins against the virtual fleet
+    if (const char* accesses = getenv("FLAP_STATBENCH"))
+        return nativeStatBenchRun(accesses);                                    // statistics path only
+    if (const char* publications = getenv("FLAP_SNAPBENCH"))
+        return nativeSnapBenchRun(publications);                                // table publication only
+    if (const char* matchdays = getenv("FLAP_TABLEBENCH"))
+        return nativeTableBenchRun(matchdays);                                  // live table recalculation only
+    if (const char* modules = getenv("FLAP_VIRTUAL_MODULES"))
+        g_virtualFleet.plugIn(atoi(modules));                                   // new modules wait at I2C_BASE_ADDRESS
+    setup();
+    while (true) {
+        loop();
+        vTaskDelay(1);                                                          // loop() is empty, do not burn a host core
+    }
+}
+#endif // PIO_UNIT_TESTING
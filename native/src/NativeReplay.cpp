@@ -0,0 +1,326 @@
+// #################################################################################################################
+//
+//  ███    ██  █████  ████████ ██ ██    ██ ███████     ██████  ███████ ██████  ██       █████  ██    ██
+//  ████   ██ ██   ██    ██    ██ ██    ██ ██          ██   ██ ██      ██   ██ ██      ██   ██  ██  ██
+//  ██ ██  ██ ███████    ██    ██ ██    ██ █████       ██████  █████   ██████  ██      ███████   ████
+//  ██  ██ ██ ██   ██    ██    ██  ██  ██  ██          ██   ██ ██      ██      ██      ██   ██    ██
+//  ██   ████ ██   ██    ██    ██   ████   ███████     ██   ██ ███████ ██      ███████ ██   ██    ██
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Native%20Replay
+//
+/*
+
+    Replay of recorded openLigaDB match days, see NativeReplay.h
+
+*/
+#include <Arduino.h>
+#include <FlapGlobal.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Liga.h"
+#include "RtosTasks.h"
+#include "LeagueScheduler.h"
+#include "NativeShim.h"
+#include "NativeReplay.h"
+
+#define REPLAY_LEAD_SECONDS 60                                                  // clock starts before first response
+#define REPLAY_TAIL_HOURS 2                                                     // default replay time after last response
+
+// one recorded response
+struct ReplayRecord {
+    time_t      at;                                                             // wall-clock time of response
+    time_t      since;                                                          // first response of url with same body
+    int         status;                                                         // HTTP status code
+    std::string body;
+};
+
+// detection latency of one event type
+struct ReplayLatency {
+    uint32_t count = 0;
+    uint64_t sum   = 0;                                                         // seconds
+    uint32_t max   = 0;                                                         // seconds
+
+    void add(time_t seconds) {
+        if (seconds < 0)
+            seconds = 0;
+        count++;
+        sum += (uint64_t)seconds;
+        if ((uint32_t)seconds > max)
+            max = (uint32_t)seconds;
+    }
+};
+
+using ReplayRecords = std::map<std::string, std::vector<ReplayRecord>>;
+
+static ReplayRecords                         g_records;                         // responses per url, sorted by time
+static std::map<int, uint32_t>               g_requestsPerMatchday;             // requests while ligaMatchday was n
+static std::map<std::string, uint32_t>       g_requestsPerEndpoint;             // requests per openLigaDB endpoint
+static const ReplayRecord*                   g_tableServed = nullptr;           // last getbltable response served
+static time_t                                g_replayStart = 0;                 // start of replay (virtual wall-clock)
+static time_t                                g_replayEnd   = 0;                 // end of replay (virtual wall-clock)
+static std::chrono::steady_clock::time_point g_hostStart;                       // start of replay (host clock)
+
+static std::string        g_leader;                                             // team on position 1 of published table
+static std::string        g_lantern;                                            // team on last position of published table
+static std::set<uint32_t> g_goalsSeen;                                          // goalIDs the master has detected
+static ReplayLatency      g_goalLatency;
+static ReplayLatency      g_leaderLatency;
+static ReplayLatency      g_lanternLatency;
+
+// ----------------------------
+// recording
+
+/**
+ * @brief read all complete response blocks of a recording in file order
+ *
+ * Aborted blocks and 304 blocks are skipped, the body of the last 200 stays valid.
+ *
+ * @param path host path of the recording
+ * @param responses gets the responses
+ * @return size_t number of responses read
+ */
+size_t nativeReadRecording(const char* path, std::vector<NativeRecordedResponse>& responses) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        return 0;
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    const std::string data = buffer.str();
+
+    size_t loaded = 0;
+    size_t pos    = 0;
+    while (pos < data.size()) {
+        size_t eol = data.find('\n', pos);
+        if (eol == std::string::npos)
+            break;
+        if (data[pos] != '@') {                                                 // rest of aborted block
+            pos = eol + 1;
+            continue;
+        }
+
+        long epoch  = 0;
+        int  status = 0;
+        int  offset = 0;
+        std::string head(data, pos + 1, eol - pos - 1);
+        if (sscanf(head.c_str(), "%ld %d %n", &epoch, &status, &offset) < 2) {
+            pos = eol + 1;
+            continue;
+        }
+        NativeRecordedResponse record{head.substr(offset), (time_t)epoch, status, std::string()};
+        pos = eol + 1;
+
+        bool complete = false;
+        while (pos < data.size()) {
+            if (data.compare(pos, 2, ".\n") == 0) {
+                pos += 2;
+                complete = true;
+                break;
+            }
+            if (data[pos] != '+')
+                break;                                                          // block without end line
+            eol = data.find('\n', pos);
+            if (eol == std::string::npos)
+                break;
+            size_t len = strtoul(data.c_str() + pos + 1, nullptr, 10);
+            if (eol + 1 + len > data.size())
+                break;
+            record.body.append(data, eol + 1, len);
+            pos = eol + 1 + len;
+        }
+        if (!complete || status == 304)                                         // 304: body of last 200 stays valid
+            continue;
+        responses.push_back(std::move(record));
+        loaded++;
+    }
+    return loaded;
+}
+
+/**
+ * @brief responses of the recording per url
+ *
+ * @return number of responses loaded
+ */
+static size_t loadRecording(const char* path) {
+    std::vector<NativeRecordedResponse> responses;
+    const size_t                        loaded = nativeReadRecording(path, responses);
+    for (NativeRecordedResponse& response : responses)
+        g_records[response.url].push_back(ReplayRecord{response.at, response.at, response.status, std::move(response.body)});
+
+    for (auto& entry : g_records) {
+        std::vector<ReplayRecord>& list = entry.second;
+        std::stable_sort(list.begin(), list.end(), [](const ReplayRecord& a, const ReplayRecord& b) { return a.at < b.at; });
+        for (size_t i = 1; i < list.size(); ++i)
+            if (list[i].status == list[i - 1].status && list[i].body == list[i - 1].body)
+                list[i].since = list[i - 1].since;                              // body first available earlier
+    }
+    return loaded;
+}
+
+/**
+ * @brief time the recording first contained a goal
+ */
+static bool goalAvailableSince(uint32_t matchID, uint32_t goalID, time_t& since) {
+    const std::string key = "\"goalID\":" + std::to_string(goalID);
+    const auto        it  = g_records.find("https://api.openligadb.de/getmatchdata/" + std::to_string(matchID));
+    if (it == g_records.end())
+        return false;
+    for (const ReplayRecord& record : it->second)
+        if (record.body.find(key) != std::string::npos) {
+            since = record.at;
+            return true;
+        }
+    return false;
+}
+
+// ----------------------------
+// server and observer
+
+/**
+ * @brief endpoint of a request: path without host and arguments, getmatchdata of one match apart
+ */
+static std::string replayEndpoint(const std::string& url) {
+    const size_t host = url.find("://");
+    size_t       path = url.find('/', host == std::string::npos ? 0 : host + 3);
+    path              = (path == std::string::npos) ? url.size() : path + 1;
+    const size_t args = url.find('/', path);
+    std::string  name = url.substr(path, args == std::string::npos ? std::string::npos : args - path);
+    if (name == "getmatchdata" && args != std::string::npos)
+        name += (url.find('/', args + 1) == std::string::npos) ? "/<matchID>" : "/<league>/<season>/<matchday>";
+    return name;
+}
+
+/**
+ * @brief answer a request of the Liga task with the response recorded for now
+ */
+static int replayRespond(const std::string& url, std::string& body) {
+    g_requestsPerMatchday[ligaMatchday]++;
+    g_requestsPerEndpoint[replayEndpoint(url)]++;
+
+    const auto it = g_records.find(url);
+    if (it == g_records.end())
+        return 404;
+
+    const time_t        now    = time(nullptr);
+    const ReplayRecord* record = &it->second.front();                           // before first response: earliest one
+    for (const ReplayRecord& candidate : it->second) {
+        if (candidate.at > now)
+            break;
+        record = &candidate;
+    }
+    if (url.find("/getbltable/") != std::string::npos)
+        g_tableServed = record;
+    body = record->body;
+    return record->status;
+}
+
+static void replayReport() {
+    const double host = std::chrono::duration<double>(std::chrono::steady_clock::now() - g_hostStart).count();
+    printf("\n[FLAP  - REPLAY ] ---------------------------------------------\n");
+    uint32_t total = 0;
+    for (const auto& entry : g_requestsPerMatchday) {
+        printf("[FLAP  - REPLAY ] matchday %2d: %6u requests\n", entry.first, entry.second);
+        total += entry.second;
+    }
+    printf("[FLAP  - REPLAY ] total      : %6u requests, %u TLS handshakes\n", total, nativeHttpStats().handshakes);
+    for (const auto& entry : g_requestsPerEndpoint)
+        printf("[FLAP  - REPLAY ]   %6u %s\n", entry.second, entry.first.c_str());
+
+    const std::pair<const char*, const ReplayLatency*> latencies[] = {
+        {"goals        ", &g_goalLatency}, {"leader       ", &g_leaderLatency}, {"red lantern  ", &g_lanternLatency}};
+    for (const auto& latency : latencies) {
+        const ReplayLatency& l = *latency.second;
+        if (l.count == 0)
+            printf("[FLAP  - REPLAY ] %s: no events\n", latency.first);
+        else
+            printf("[FLAP  - REPLAY ] %s: %3u events, latency mean %5.1f s, max %4u s\n", latency.first, l.count,
+                   (double)l.sum / l.count, l.max);
+    }
+    printf("[FLAP  - REPLAY ] replayed %ld s in %.1f s host time\n", (long)(time(nullptr) - g_replayStart), host);
+}
+
+/**
+ * @brief sample master state before the virtual clock jumps, end replay after the tail
+ */
+static void replayObserve() {
+    const time_t now = time(nullptr);
+
+    LigaSnapshot published;
+    ligaSnapshotsOf(activeLeague).read(published);
+    if (published.teamCount > 0) {
+        const std::string leader  = published.rows[0].team;
+        const std::string lantern = published.rows[published.teamCount - 1].team;
+        const time_t      since   = g_tableServed ? g_tableServed->since : now;
+        if (!g_leader.empty() && leader != g_leader)
+            g_leaderLatency.add(now - since);
+        if (!g_lantern.empty() && lantern != g_lantern)
+            g_lanternLatency.add(now - since);
+        g_leader  = leader;
+        g_lantern = lantern;
+    }
+
+    for (int i = 0; i < liveGoalCount && i < MAX_GOALS_PER_MATCHDAY; ++i) {
+        const LiveMatchGoalInfo& goal = goalsInfos[i];
+        if (!g_goalsSeen.insert(goal.goalID).second)
+            continue;
+        time_t since;
+        if (goalAvailableSince(goal.matchID, goal.goalID, since))
+            g_goalLatency.add(now - since);
+    }
+
+    if (now > g_replayEnd) {
+        replayReport();
+        fflush(stdout);
+        exit(0);
+    }
+}
+
+// ----------------------------
+
+/**
+ * @brief replay recording through the Liga task, does not return on success
+ *
+ * @param recording host path of the recording
+ * @return int exit code if the recording can not be used
+ */
+int nativeReplayRun(const char* recording) {
+    g_hostStart         = std::chrono::steady_clock::now();
+    const size_t loaded = loadRecording(recording);
+    if (loaded == 0) {
+        fprintf(stderr, "[FLAP  - REPLAY ] no responses in %s\n", recording);
+        return 1;
+    }
+
+    time_t first = 0, last = 0;
+    for (const auto& entry : g_records) {
+        if (first == 0 || entry.second.front().at < first)
+            first = entry.second.front().at;
+        if (entry.second.back().at > last)
+            last = entry.second.back().at;
+    }
+    const char* tail = getenv("FLAP_REPLAY_TAIL");
+    g_replayEnd      = last + (time_t)(tail ? atof(tail) : REPLAY_TAIL_HOURS) * 3600;
+
+    printf("[FLAP  - REPLAY ] %zu responses of %zu urls, %ld s recorded\n", loaded, g_records.size(), (long)(last - first));
+
+    g_replayStart = first - REPLAY_LEAD_SECONDS;
+    nativeClockStartVirtual(g_replayStart);
+    nativeHttpSetResponder(replayRespond);
+    nativeClockSetObserver(replayObserve);
+
+    traceSemaphore = xSemaphoreCreateMutex();                                   // what setup() provides for the Liga task
+    ligaSnapshotMutexInit();
+    createLigaInstance();
+    configureTime();                                                            // CET/CEST like the web server task
+    ligaLeagues.setTracked(1 << leagueIndex(League::BL1));                      // recordings hold one league
+    ligaTask(nullptr);                                                          // ends in replayObserve()
+    return 0;
+}
@@ -0,0 +1,520 @@
+// #################################################################################################################
+//
+//  ███    ██  █████  ████████ ██ ██    ██ ███████     ██████  ████████  ██████  ███████
+//  ████   ██ ██   ██    ██    ██ ██    ██ ██          ██   ██    ██    ██    ██ ██
+//  ██ ██  ██ ███████    ██    ██ ██    ██ █████       ██████     ██    ██    ██ ███████
+//  ██  ██ ██ ██   ██    ██    ██  ██  ██  ██          ██   ██    ██    ██    ██      ██
+//  ██   ████ ██   ██    ██    ██   ████   ███████     ██   ██    ██     ██████  ███████
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Native%20RTOS
+//
+/*
+
+    FreeRTOS on std::thread for the native host build
+
+    - every task is a detached thread, priorities are only recorded
+    - one tick is one millisecond of the host steady clock (or of the virtual clock)
+    - queues copy items like FreeRTOS, semaphores and mutexes share the queue object
+    - software timers run in one timer service thread (like the FreeRTOS timer daemon)
+
+*/
+#include <atomic>
+#include <chrono>
+#include <sched.h>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "NativeShim.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/timers.h"
+
+struct NativeTask {
+    explicit NativeTask(const char* taskName = "") : name(taskName) {}
+
+    std::string             name;                                               // task name as given to xTaskCreate
+    uint32_t                stackDepth = 0;                                     // requested stack, only reported
+    UBaseType_t             priority   = 0;                                     // requested priority, only reported
+    std::mutex              lock;                                               // protects notifyValue
+    std::condition_variable wake;                                               // signalled by xTaskNotifyGive
+    uint32_t                notifyValue = 0;                                    // counting notification value
+};
+
+struct NativeQueue {
+    enum Kind { QUEUE, BINARY, COUNTING, MUTEX, RECURSIVE_MUTEX };
+
+    Kind                             kind;                                      // what this object emulates
+    UBaseType_t                      length;                                    // queue depth or max semaphore count
+    UBaseType_t                      itemSize;                                  // size of one queue item
+    std::deque<std::vector<uint8_t>> items;                                     // queued items
+    UBaseType_t                      count     = 0;                             // semaphore count
+    NativeTask*                      holder    = nullptr;                       // mutex owner
+    UBaseType_t                      recursion = 0;                             // recursive mutex depth
+    std::mutex                       lock;                                      // protects all members
+    std::condition_variable          changed;                                   // signalled on every give/send/receive
+};
+
+struct NativeTimer {
+    std::string             name;                                               // timer name
+    TickType_t              period    = 0;                                      // period in ticks
+    bool                    autoReload = false;                                 // restart after expiry
+    void*                   id         = nullptr;                               // timer ID
+    TimerCallbackFunction_t callback   = nullptr;                               // called in timer service thread
+    bool                    active     = false;                                 // timer is running
+    TickType_t              expiry     = 0;                                     // tick of next expiry
+};
+
+static thread_local NativeTask* t_currentTask = nullptr;                       // task of calling thread
+static NativeTask               g_loopTask("loopTask");                         // main thread runs setup() and loop()
+static std::atomic<UBaseType_t> g_taskCount{1};                                 // loopTask is always there
+static std::atomic<uint32_t>    g_wakeups{0};                                   // vTaskDelay and ulTaskNotifyTake returns
+
+// ----------------------------
+// helper
+
+static NativeTask* currentTask() {
+    return t_currentTask ? t_currentTask : &g_loopTask;
+}
+
+/**
+ * @brief wait on cv until pred() is true or ticksToWait elapsed
+ *
+ * @return true if pred() became true
+ */
+template <typename Pred>
+static bool waitTicks(std::unique_lock<std::mutex>& lk, std::condition_variable& cv, TickType_t ticksToWait, Pred pred) {
+    if (nativeClockIsVirtual() && !pred()) {                                    // single task: nobody else can wake us
+        if (ticksToWait == portMAX_DELAY) {
+            fprintf(stderr, "[NATIVE] task '%s' would wait forever on the virtual clock\n", currentTask()->name.c_str());
+            exit(1);
+        }
+        lk.unlock();
+        nativeSleepUs((uint64_t)pdTICKS_TO_MS(ticksToWait) * 1000);             // jump over the timeout
+        lk.lock();
+        return pred();
+    }
+    if (ticksToWait == portMAX_DELAY) {
+        cv.wait(lk, pred);
+        return true;
+    }
+    return cv.wait_for(lk, std::chrono::milliseconds(pdTICKS_TO_MS(ticksToWait)), pred);
+}
+
+// ----------------------------
+// tasks
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char* name, uint32_t stackDepth, void* parameter, UBaseType_t priority, TaskHandle_t* handle) {
+    NativeTask* task = new NativeTask;
+    task->name       = name ? name : "";
+    task->stackDepth = stackDepth;
+    task->priority   = priority;
+    if (handle)
+        *handle = task;
+    g_taskCount++;
+    std::thread([code, parameter, task]() {
+        t_currentTask = task;
+        code(parameter);
+        g_taskCount--;
+    }).detach();
+    return pdPASS;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t code, const char* name, uint32_t stackDepth, void* parameter, UBaseType_t priority,
+                                   TaskHandle_t* handle, BaseType_t core) {
+    (void)core;                                                                 // the host scheduler decides
+    return xTaskCreate(code, name, stackDepth, parameter, priority, handle);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    if (task == nullptr || task == currentTask()) {                             // a thread can only end itself
+        g_taskCount--;
+        vTaskSuspend(nullptr);
+    }
+}
+
+void vTaskDelay(TickType_t ticks) {
+    nativeSleepUs((uint64_t)pdTICKS_TO_MS(ticks) * 1000);
+    g_wakeups++;
+}
+
+void vTaskDelayUntil(TickType_t* previousWakeTime, TickType_t increment) {
+    *previousWakeTime += increment;
+    TickType_t now = xTaskGetTickCount();
+    if ((int32_t)(*previousWakeTime - now) > 0)
+        vTaskDelay(*previousWakeTime - now);
+}
+
+void vTaskSuspend(TaskHandle_t task) {
+    if (task != nullptr && task != currentTask())
+        return;                                                                 // foreign threads can not be suspended
+    std::mutex              m;
+    std::condition_variable never;
+    std::unique_lock<std::mutex> lk(m);
+    never.wait(lk, [] { return false; });
+}
+
+TickType_t xTaskGetTickCount() {
+    return (TickType_t)(nativeMicros() / (1000000ull / configTICK_RATE_HZ));
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    return currentTask();
+}
+
+char* pcTaskGetName(TaskHandle_t task) {
+    return const_cast<char*>((task ? task : currentTask())->name.c_str());
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+    return (task ? task : currentTask())->stackDepth;                           // host threads do not report stack usage
+}
+
+UBaseType_t uxTaskGetNumberOfTasks() {
+    return g_taskCount.load();
+}
+
+UBaseType_t uxTaskPriorityGet(TaskHandle_t task) {
+    return (task ? task : currentTask())->priority;
+}
+
+BaseType_t xPortGetCoreID() {
+    const int cpu = sched_getcpu();                                             // host cpu folded onto the two ESP32 cores
+    return (cpu < 0) ? 0 : cpu % portNUM_PROCESSORS;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    {
+        std::lock_guard<std::mutex> lk(task->lock);
+        task->notifyValue++;
+    }
+    task->wake.notify_one();
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait) {
+    NativeTask*                  task = currentTask();
+    std::unique_lock<std::mutex> lk(task->lock);
+    waitTicks(lk, task->wake, ticksToWait, [task] { return task->notifyValue != 0; });
+    uint32_t value = task->notifyValue;
+    if (value != 0)
+        task->notifyValue = clearCountOnExit ? 0 : value - 1;
+    g_wakeups++;
+    return value;
+}
+
+uint32_t nativeTaskWakeups() {
+    return g_wakeups.load();
+}
+
+// ----------------------------
+// queues
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    NativeQueue* q = new NativeQueue;
+    q->kind        = NativeQueue::QUEUE;
+    q->length      = length;
+    q->itemSize    = itemSize;
+    return q;
+}
+
+void vQueueDelete(QueueHandle_t queue) {
+    delete queue;
+}
+
+static BaseType_t queueSend(QueueHandle_t q, const void* item, TickType_t ticksToWait, bool toFront) {
+    std::unique_lock<std::mutex> lk(q->lock);
+    if (!waitTicks(lk, q->changed, ticksToWait, [q] { return q->items.size() < q->length; }))
+        return pdFAIL;                                                          // errQUEUE_FULL
+    const uint8_t*       p = static_cast<const uint8_t*>(item);
+    std::vector<uint8_t> copy(p, p + q->itemSize);
+    if (toFront)
+        q->items.push_front(std::move(copy));
+    else
+        q->items.push_back(std::move(copy));
+    lk.unlock();
+    q->changed.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticksToWait) {
+    return queueSend(queue, item, ticksToWait, false);
+}
+
+BaseType_t xQueueSendToBack(QueueHandle_t queue, const void* item, TickType_t ticksToWait) {
+    return queueSend(queue, item, ticksToWait, false);
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t queue, const void* item, TickType_t ticksToWait) {
+    return queueSend(queue, item, ticksToWait, true);
+}
+
+BaseType_t xQueueOverwrite(QueueHandle_t queue, const void* item) {
+    {
+        std::lock_guard<std::mutex> lk(queue->lock);
+        const uint8_t*              p = static_cast<const uint8_t*>(item);
+        queue->items.clear();                                                   // only valid for queues of length 1
+        queue->items.emplace_back(p, p + queue->itemSize);
+    }
+    queue->changed.notify_all();
+    return pdPASS;
+}
+
+static BaseType_t queueReceive(QueueHandle_t q, void* buffer, TickType_t ticksToWait, bool remove) {
+    std::unique_lock<std::mutex> lk(q->lock);
+    if (!waitTicks(lk, q->changed, ticksToWait, [q] { return !q->items.empty(); }))
+        return pdFAIL;                                                          // errQUEUE_EMPTY
+    memcpy(buffer, q->items.front().data(), q->itemSize);
+    if (remove)
+        q->items.pop_front();
+    lk.unlock();
+    q->changed.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* buffer, TickType_t ticksToWait) {
+    return queueReceive(queue, buffer, ticksToWait, true);
+}
+
+BaseType_t xQueuePeek(QueueHandle_t queue, void* buffer, TickType_t ticksToWait) {
+    return queueReceive(queue, buffer, ticksToWait, false);
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue) {
+    {
+        std::lock_guard<std::mutex> lk(queue->lock);
+        queue->items.clear();
+    }
+    queue->changed.notify_all();
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> lk(queue->lock);
+    return (UBaseType_t)queue->items.size();
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> lk(queue->lock);
+    return queue->length - (UBaseType_t)queue->items.size();
+}
+
+// ----------------------------
+// semaphores and mutexes
+
+static SemaphoreHandle_t createSemaphore(NativeQueue::Kind kind, UBaseType_t maxCount, UBaseType_t initialCount) {
+    NativeQueue* s = new NativeQueue;
+    s->kind        = kind;
+    s->length      = maxCount;
+    s->itemSize    = 0;
+    s->count       = initialCount;
+    return s;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+    return createSemaphore(NativeQueue::BINARY, 1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t maxCount, UBaseType_t initialCount) {
+    return createSemaphore(NativeQueue::COUNTING, maxCount, initialCount);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    return createSemaphore(NativeQueue::MUTEX, 1, 1);
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() {
+    return createSemaphore(NativeQueue::RECURSIVE_MUTEX, 1, 1);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore) {
+    delete semaphore;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t ticksToWait) {
+    std::unique_lock<std::mutex> lk(s->lock);
+    if (!waitTicks(lk, s->changed, ticksToWait, [s] { return s->count > 0; }))
+        return pdFAIL;
+    s->count--;
+    s->holder = currentTask();
+    return pdPASS;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t s) {
+    {
+        std::lock_guard<std::mutex> lk(s->lock);
+        if (s->count >= s->length)
+            return pdFAIL;                                                      // not taken
+        s->count++;
+        s->holder = nullptr;
+    }
+    s->changed.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t s, TickType_t ticksToWait) {
+    NativeTask*                  me = currentTask();
+    std::unique_lock<std::mutex> lk(s->lock);
+    if (s->holder == me) {
+        s->recursion++;
+        return pdPASS;
+    }
+    if (!waitTicks(lk, s->changed, ticksToWait, [s] { return s->count > 0; }))
+        return pdFAIL;
+    s->count--;
+    s->holder    = me;
+    s->recursion = 1;
+    return pdPASS;
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t s) {
+    {
+        std::lock_guard<std::mutex> lk(s->lock);
+        if (s->holder != currentTask())
+            return pdFAIL;                                                      // only the holder may give
+        if (--s->recursion > 0)
+            return pdPASS;
+        s->holder = nullptr;
+        s->count++;
+    }
+    s->changed.notify_all();
+    return pdPASS;
+}
+
+TaskHandle_t xSemaphoreGetMutexHolder(SemaphoreHandle_t s) {
+    std::lock_guard<std::mutex> lk(s->lock);
+    return s->holder;
+}
+
+// ----------------------------
+// software timers
+
+// never destroyed: detached threads may still use them while the binary exits
+static std::mutex&              g_timerLock    = *new std::mutex;               // protects g_timers and all timer members
+static std::condition_variable& g_timerChanged = *new std::condition_variable;  // wakes timer service thread
+static std::list<NativeTimer*>& g_timers       = *new std::list<NativeTimer*>;  // all created timers
+static std::once_flag          g_timerServiceStarted;                           // start service thread on first use
+
+/**
+ * @brief timer service thread, calls expired callbacks in order of expiry
+ */
+static void timerService() {
+    t_currentTask = new NativeTask("Tmr Svc");
+    std::unique_lock<std::mutex> lk(g_timerLock);
+    while (true) {
+        NativeTimer* next = nullptr;
+        for (NativeTimer* t : g_timers) {
+            if (t->active && (next == nullptr || (int32_t)(t->expiry - next->expiry) < 0))
+                next = t;
+        }
+        if (next == nullptr) {
+            g_timerChanged.wait(lk);
+            continue;
+        }
+        int32_t remaining = (int32_t)(next->expiry - xTaskGetTickCount());
+        if (remaining > 0) {
+            g_timerChanged.wait_for(lk, std::chrono::milliseconds(pdTICKS_TO_MS(remaining)));
+            continue;                                                           // timers may have changed meanwhile
+        }
+        if (next->autoReload)
+            next->expiry += next->period;
+        else
+            next->active = false;
+        TimerCallbackFunction_t callback = next->callback;
+        lk.unlock();
+        callback(next);                                                         // callback may use the timer API
+        lk.lock();
+    }
+}
+
+static void armTimer(NativeTimer* t) {
+    std::call_once(g_timerServiceStarted, [] { std::thread(timerService).detach(); });
+    t->active = true;
+    t->expiry = xTaskGetTickCount() + t->period;
+}
+
+TimerHandle_t xTimerCreate(const char* name, TickType_t period, UBaseType_t autoReload, void* timerID, TimerCallbackFunction_t callback) {
+    NativeTimer* t = new NativeTimer;
+    t->name        = name ? name : "";
+    t->period      = period;
+    t->autoReload  = autoReload != pdFALSE;
+    t->id          = timerID;
+    t->callback    = callback;
+    std::lock_guard<std::mutex> lk(g_timerLock);
+    g_timers.push_back(t);
+    return t;
+}
+
+BaseType_t xTimerStart(TimerHandle_t timer, TickType_t ticksToWait) {
+    (void)ticksToWait;
+    {
+        std::lock_guard<std::mutex> lk(g_timerLock);
+        armTimer(timer);
+    }
+    g_timerChanged.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xTimerReset(TimerHandle_t timer, TickType_t ticksToWait) {
+    return xTimerStart(timer, ticksToWait);
+}
+
+BaseType_t xTimerStop(TimerHandle_t timer, TickType_t ticksToWait) {
+    (void)ticksToWait;
+    {
+        std::lock_guard<std::mutex> lk(g_timerLock);
+        timer->active = false;
+    }
+    g_timerChanged.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xTimerDelete(TimerHandle_t timer, TickType_t ticksToWait) {
+    (void)ticksToWait;
+    std::lock_guard<std::mutex> lk(g_timerLock);
+    g_timers.remove(timer);
+    delete timer;
+    return pdPASS;
+}
+
+BaseType_t xTimerChangePeriod(TimerHandle_t timer, TickType_t newPeriod, TickType_t ticksToWait) {
+    (void)ticksToWait;
+    {
+        std::lock_guard<std::mutex> lk(g_timerLock);
+        timer->period = newPeriod;
+        armTimer(timer);                                                        // like FreeRTOS: changing the period starts the timer
+    }
+    g_timerChanged.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xTimerIsTimerActive(TimerHandle_t timer) {
+    std::lock_guard<std::mutex> lk(g_timerLock);
+    return timer->active ? pdTRUE : pdFALSE;
+}
+
+TickType_t xTimerGetExpiryTime(TimerHandle_t timer) {
+    std::lock_guard<std::mutex> lk(g_timerLock);
+    return timer->expiry;
+}
+
+TickType_t xTimerGetPeriod(TimerHandle_t timer) {
+    std::lock_guard<std::mutex> lk(g_timerLock);
+    return timer->period;
+}
+
+void* pvTimerGetTimerID(TimerHandle_t timer) {
+    return timer->id;
+}
+
+const char* pcTimerGetName(TimerHandle_t timer) {
+    return timer->name.c_str();
+}
@@ -0,0 +1,213 @@
+// #################################################################################################################
+//
+//  ███    ██  █████  ████████ ██ ██    ██ ███████     ███████ ███    ██  █████  ██████  ███████ ██   ██  ██████  ████████
+//  ████   ██ ██   ██    ██    ██ ██    ██ ██          ██      ████   ██ ██   ██ ██   ██ ██      ██   ██ ██    ██    ██
+//  ██ ██  ██ ███████    ██    ██ ██    ██ █████       ███████ ██ ██  ██ ███████ ██████  ███████ ███████ ██    ██    ██
+//  ██  ██ ██ ██   ██    ██    ██  ██  ██  ██               ██ ██  ██ ██ ██   ██ ██           ██ ██   ██ ██    ██    ██
+//  ██   ████ ██   ██    ██    ██   ████   ███████     ███████ ██   ████ ██   ██ ██      ███████ ██   ██  ██████     ██
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Native%20Snapshot
+//
+/*
+
+    Stress test of the Liga table publication, see NativeSnapshot.h
+
+*/
+#include <Arduino.h>
+#include <FlapGlobal.h>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include "Liga.h"
+#include "NativeSnapshot.h"
+
+// publication up to now: two buffers and an index under one mutex, readers render under the lock
+class MutexSnapshots {
+   public:
+    MutexSnapshots() : _index(0) {
+        memset(_snap, 0, sizeof(_snap));
+        _mutex = xSemaphoreCreateMutex();
+    }
+
+    template <typename Fill>
+    void publish(Fill fill) {
+        xSemaphoreTake(_mutex, portMAX_DELAY);
+        LigaSnapshot& back = _snap[_index];
+        back.clear();
+        fill(back);
+        _index ^= 1;
+        xSemaphoreGive(_mutex);
+    }
+
+    template <typename Render>
+    void read(LigaSnapshot& out, Render render) {
+        xSemaphoreTake(_mutex, portMAX_DELAY);
+        out = _snap[_index ^ 1];
+        render(out);                                                            // whole render under the lock
+        xSemaphoreGive(_mutex);
+    }
+
+   private:
+    SemaphoreHandle_t _mutex;
+    LigaSnapshot      _snap[2];
+    uint8_t           _index;
+};
+
+// lock-free: ligaSnapshotsOf(), render outside
+class StoreSnapshots {
+   public:
+    template <typename Fill>
+    void publish(Fill fill) {
+        LigaSnapshotLock _lock;                                                 // writer lock, readers do not take it
+        fill(ligaSnapshotsOf(ligaLeague).build());
+        ligaSnapshotsOf(ligaLeague).publish();
+    }
+
+    template <typename Render>
+    void read(LigaSnapshot& out, Render render) {
+        ligaSnapshotsOf(ligaLeague).read(out);
+        render(out);
+    }
+};
+
+// table with stamp in every row
+static void fillTable(LigaSnapshot& s, uint32_t stamp) {
+    s.season       = 2025;
+    s.matchday     = (uint8_t)stamp;
+    s.fetchedAtUTC = stamp;
+    s.teamCount    = ligaMaxTeams;
+    for (uint8_t i = 0; i < s.teamCount; ++i) {
+        LigaRow& row = s.rows[i];
+        row.pos      = i + 1;
+        row.pkt      = (uint8_t)stamp;
+        row.sp       = (uint8_t)(stamp >> 8);
+        row.flap     = i;
+        snprintf(row.team, sizeof(row.team), "Team %02u #%lu", i, (unsigned long)stamp);
+        snprintf(row.dfb, sizeof(row.dfb), "%03u", (unsigned)(stamp % 1000));
+    }
+}
+
+// false if rows of different tables are mixed
+static bool checkTable(const LigaSnapshot& s) {
+    if (s.teamCount == 0)
+        return true;                                                            // nothing published yet
+    const uint32_t stamp = s.fetchedAtUTC;
+    if (s.matchday != (uint8_t)stamp || s.teamCount != ligaMaxTeams)
+        return false;
+    char team[MAX_TEAMNAME_LENGTH];
+    char dfb[MAX_DFB_SHORT];
+    snprintf(dfb, sizeof(dfb), "%03u", (unsigned)(stamp % 1000));
+    for (uint8_t i = 0; i < s.teamCount; ++i) {
+        const LigaRow& row = s.rows[i];
+        snprintf(team, sizeof(team), "Team %02u #%lu", i, (unsigned long)stamp);
+        if (row.pos != i + 1 || row.pkt != (uint8_t)stamp || row.sp != (uint8_t)(stamp >> 8) || strcmp(row.team, team) != 0 ||
+            strcmp(row.dfb, dfb) != 0)
+            return false;
+    }
+    return true;
+}
+
+// render like renderLigaTable: one formatted line per row, then the Serial output blocks the reader
+static uint32_t renderTable(const LigaSnapshot& s) {
+    char     line[96];
+    uint32_t bytes = 0;
+    for (uint8_t i = 0; i < s.teamCount; ++i)
+        bytes += snprintf(line, sizeof(line), "║ %2u %-24s %2u %3d %3u:%-3u %3u ║", s.rows[i].pos, s.rows[i].team, s.rows[i].sp, s.rows[i].diff,
+                          s.rows[i].g, s.rows[i].og, s.rows[i].pkt);
+    std::this_thread::sleep_for(std::chrono::microseconds(SNAPBENCH_RENDER_US));
+    return bytes;
+}
+
+// one stress run
+template <typename Snapshots>
+struct SnapRun {
+    Snapshots*            snapshots;
+    std::atomic<bool>     reading{true};
+    std::atomic<int>      readers{0};
+    std::atomic<uint64_t> reads{0};
+    std::atomic<uint64_t> torn{0};
+    std::atomic<uint64_t> backwards{0};                                         // stamp older than the last read
+};
+
+template <typename Snapshots>
+static void snapReaderTask(void* param) {
+    SnapRun<Snapshots>* run  = static_cast<SnapRun<Snapshots>*>(param);
+    LigaSnapshot        local;
+    uint32_t            last = 0;
+    uint64_t            reads = 0, torn = 0, backwards = 0;
+    while (run->reading.load()) {
+        run->snapshots->read(local, [](const LigaSnapshot& s) { renderTable(s); });
+        if (!checkTable(local))
+            torn++;
+        if (local.fetchedAtUTC < last)
+            backwards++;
+        last = local.fetchedAtUTC;
+        reads++;
+    }
+    run->reads += reads;
+    run->torn += torn;
+    run->backwards += backwards;
+    run->readers--;
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief publish tables while the readers copy and render
+ *
+ * @return double writer latency p99 in µs, -1 if a reader saw a torn table
+ */
+template <typename Snapshots>
+static double snapRun(const char* name, Snapshots* snapshots, uint32_t publications) {
+    SnapRun<Snapshots> run;
+    run.snapshots = snapshots;
+    run.readers   = SNAPBENCH_READERS;
+    for (int i = 0; i < SNAPBENCH_READERS; i++)
+        xTaskCreate(snapReaderTask<Snapshots>, "Reader", 4096, &run, 1, NULL);
+
+    std::vector<double> writer;                                                 // µs per publication
+    writer.reserve(publications);
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t p = 1; p <= publications; p++) {
+        const auto t0 = std::chrono::steady_clock::now();
+        snapshots->publish([p](LigaSnapshot& s) { fillTable(s, p); });
+        writer.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count());
+        std::this_thread::sleep_for(std::chrono::microseconds(SNAPBENCH_WRITER_GAP_US));
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    run.reading          = false;
+    while (run.readers.load() > 0)
+        std::this_thread::yield();
+
+    std::sort(writer.begin(), writer.end());
+    const double p50 = writer[writer.size() / 2];
+    const double p99 = writer[writer.size() * 99 / 100];
+    printf("[FLAP  - SNAP   ] %-9s %u publications in %.2f s, %d readers: %llu reads, torn %llu, backwards %llu, writer p50/p99/max %.1f/%.1f/%.1f µs\n",
+           name, publications, seconds, SNAPBENCH_READERS, (unsigned long long)run.reads.load(), (unsigned long long)run.torn.load(),
+           (unsigned long long)run.backwards.load(), p50, p99, writer.back());
+    return (run.torn.load() == 0 && run.backwards.load() == 0) ? p99 : -1.0;
+}
+
+/**
+ * @brief compare mutex publication and ligaSnapshotsOf()
+ *
+ * @param publications tables published by the writer
+ * @return int exit code, 1 if a reader saw a torn table
+ */
+int nativeSnapBenchRun(const char* publications) {
+    uint32_t n = (uint32_t)atol(publications);
+    if (n == 0)
+        n = 20000;
+    traceSemaphore = xSemaphoreCreateMutex();                                   // what setup() provides
+    ligaSnapshotMutexInit();
+
+    MutexSnapshots mutexSnapshots;
+    const double   before = snapRun("mutex", &mutexSnapshots, n);
+    StoreSnapshots storeSnapshots;
+    const double   after = snapRun("lock-free", &storeSnapshots, n);
+    printf("[FLAP  - SNAP   ] reader retries %lu, writer p99 %.1fx faster\n", (unsigned long)ligaSnapshotsOf(ligaLeague).retries(), (after > 0) ? before / after : 0.0);
+    return (before < 0 || after < 0) ? 1 : 0;
+}
@@ -0,0 +1,172 @@
+// #################################################################################################################
+//
+//  ███    ██  █████  ████████ ██ ██    ██ ███████     ███████ ████████  █████  ████████ ███████
+//  ████   ██ ██   ██    ██    ██ ██    ██ ██          ██         ██    ██   ██    ██    ██
+//  ██ ██  ██ ███████    ██    ██ ██    ██ █████       ███████    ██    ███████    ██    ███████
+//  ██  ██ ██ ██   ██    ██    ██  ██  ██  ██               ██    ██    ██   ██    ██         ██
+//  ██   ████ ██   ██    ██    ██   ████   ███████     ███████    ██    ██   ██    ██    ███████
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Native%20Stats
+//
+/*
+
+    Microbenchmark of the I2C statistics path, see NativeStats.h
+
+*/
+#include <Arduino.h>
+#include <FlapGlobal.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "FlapStatistics.h"
+#include "NativeStats.h"
+
+// statistics path up to now: every access takes the semaphore
+class MutexStatistics {
+   public:
+    MutexStatistics() {
+        _mutex = xSemaphoreCreateMutex();
+        for (int a = 0; a < LATENCY_ADDRESSES; a++) {
+            _address[a] = 0;
+            for (int t = 0; t < LAT_TYPES; t++)
+                _latency[a][t].clear();
+        }
+    }
+
+    void increment(uint32_t access, uint32_t sentData, uint32_t readData, uint32_t timeOut) {
+        xSemaphoreTake(_mutex, portMAX_DELAY);
+        _access += access;
+        _sent += sentData;
+        _read += readData;
+        _timeOut += timeOut;
+        _history[0] = _access;                                                  // actualize history of current cycle
+        xSemaphoreGive(_mutex);
+    }
+
+    void recordLatency(I2Caddress address, I2CLatencyType type, uint32_t us) {
+        xSemaphoreTake(_mutex, portMAX_DELAY);
+        for (int a = 0; a < LATENCY_ADDRESSES; a++) {
+            if (_address[a] == 0)
+                _address[a] = address;
+            if (_address[a] == address) {
+                _latency[a][type].add(us);
+                break;
+            }
+        }
+        xSemaphoreGive(_mutex);
+    }
+
+    uint32_t makeHistory() {
+        xSemaphoreTake(_mutex, portMAX_DELAY);
+        const uint32_t access = _access;
+        _history[1]           = _access;
+        _access = _sent = _read = _timeOut = 0;
+        xSemaphoreGive(_mutex);
+        return access;
+    }
+
+   private:
+    SemaphoreHandle_t _mutex;
+    uint32_t          _access = 0, _sent = 0, _read = 0, _timeOut = 0;
+    uint32_t          _history[2];
+    I2Caddress        _address[LATENCY_ADDRESSES];
+    LatencyHistogram  _latency[LATENCY_ADDRESSES][LAT_TYPES];
+};
+
+// reporting side: start next cycle, return accesses of the finished one
+static uint32_t collect(MutexStatistics* stats) {
+    return stats->makeHistory();
+}
+
+static uint32_t collect(FlapStatistics* stats) {
+    const uint8_t index = stats->_historyIndex;
+    stats->makeHistory();
+    LatencyHistogram h[LAT_TYPES];
+    stats->latencyByType(h);                                                    // reporting reads the histograms as well
+    return stats->_accessHistory[index];
+}
+
+// one benchmark run
+template <typename Stats>
+struct BenchRun {
+    Stats*                stats;
+    uint32_t              accesses;                                             // per task
+    std::atomic<int>      running{0};                                           // twin tasks not finished
+    std::atomic<bool>     reporting{true};                                      // reporting task keeps reading
+    std::atomic<uint64_t> collected{0};                                         // accesses summed up by makeHistory
+    std::atomic<uint32_t> nextTwin{0};
+};
+
+template <typename Stats>
+static void benchTwinTask(void* param) {
+    BenchRun<Stats>*  run     = static_cast<BenchRun<Stats>*>(param);
+    const I2Caddress address = (I2Caddress)(I2C_BASE_ADDRESS + 1 + run->nextTwin.fetch_add(1));
+    for (uint32_t i = 0; i < run->accesses; i++) {
+        run->stats->increment(2, 1, 0, 0);                                      // like i2cShortCommand
+        run->stats->recordLatency(address, LAT_PROBE, 150 + (i & 1023));
+    }
+    run->running--;
+    vTaskDelete(NULL);
+}
+
+template <typename Stats>
+static void benchReportTask(void* param) {
+    BenchRun<Stats>* run = static_cast<BenchRun<Stats>*>(param);
+    while (run->reporting.load())
+        run->collected += collect(run->stats);
+    run->running--;
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief run twin tasks and reporting task on one statistics object
+ *
+ * @return double ns per access (increment + recordLatency)
+ */
+template <typename Stats>
+static double benchRun(const char* name, Stats* stats, uint32_t accesses) {
+    BenchRun<Stats> run;
+    run.stats    = stats;
+    run.accesses = accesses;
+    run.running  = numberOfTwins + 1;
+
+    const auto start = std::chrono::steady_clock::now();
+    xTaskCreate(benchReportTask<Stats>, "Report", 4096, &run, 1, NULL);
+    for (int i = 0; i < numberOfTwins; i++)
+        xTaskCreate(benchTwinTask<Stats>, "Twin", 4096, &run, 1, NULL);
+    while (run.running.load() > 1)
+        std::this_thread::yield();
+    const auto end = std::chrono::steady_clock::now();
+    run.reporting  = false;
+    while (run.running.load() > 0)
+        std::this_thread::yield();
+    run.collected += collect(stats);                                            // rest of last cycle
+
+    const uint64_t total = (uint64_t)accesses * numberOfTwins;
+    const double   ns    = std::chrono::duration<double, std::nano>(end - start).count() / total;
+    printf("[FLAP  - STATS  ] %-8s %2d tasks x %u accesses: %8.1f ns/access, counted %s\n", name, numberOfTwins, accesses, ns,
+           (run.collected.load() == total * 2) ? "ok" : "LOST");
+    return ns;
+}
+
+/**
+ * @brief compare mutex path and sharded counters
+ *
+ * @param accesses accesses per twin task
+ * @return int exit code
+ */
+int nativeStatBenchRun(const char* accesses) {
+    uint32_t n = (uint32_t)atol(accesses);
+    if (n == 0)
+        n = 100000;
+    traceSemaphore = xSemaphoreCreateMutex();                                   // what setup() provides
+
+    MutexStatistics mutexStats;
+    const double    before = benchRun("mutex", &mutexStats, n);
+    FlapStatistics* sharded = new FlapStatistics();
+    const double    after   = benchRun("sharded", sharded, n);
+    printf("[FLAP  - STATS  ] speedup %.1fx\n", (after > 0) ? before / after : 0.0);
+    return 0;
+}
@@ -0,0 +1,192 @@
+// #################################################################################################################
+//
+//  ███    ██  █████  ████████ ██ ██    ██ ███████     ████████  █████  ██████  ██      ███████
+//  ████   ██ ██   ██    ██    ██ ██    ██ ██             ██    ██   ██ ██   ██ ██      ██
+//  ██ ██  ██ ███████    ██    ██ ██    ██ █████          ██    ███████ ██████  ██      █████
+//  ██  ██ ██ ██   ██    ██    ██  ██  ██  ██             ██    ██   ██ ██   ██ ██      ██
+//  ██   ████ ██   ██    ██    ██   ████   ███████        ██    ██   ██ ██████  ███████ ███████
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Native%20Table
+//
+//
+/*
+
+    Benchmark of the live table recalculation, see NativeTable.h
+
+*/
+#include <Arduino.h>
+#include <FlapGlobal.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "Liga.h"
+#include "TeamIndex.h"
+#include "NativeTable.h"
+
+static uint32_t benchRandom = TABLEBENCH_SEED;
+
+// xorshift32, deterministic matchdays
+static uint32_t nextRandom() {
+    benchRandom ^= benchRandom << 13;
+    benchRandom ^= benchRandom >> 17;
+    benchRandom ^= benchRandom << 5;
+    return benchRandom;
+}
+
+// publish a table like the Liga task after a table poll
+static void publishTable(const LigaSnapshot& table) {
+    LigaSnapshotLock _lock;
+    LigaSnapshot&    back = ligaSnapshotsOf(ligaLeague).build();
+    memcpy(&back, &table, sizeof(LigaSnapshot));
+    ligaSnapshotsOf(ligaLeague).publish();
+}
+
+// table before the first simulated matchday, 1. Bundesliga teams after a few matchdays
+static void firstTable(LigaSnapshot& table) {
+    table.clear();
+    table.season    = 2025;
+    table.matchday  = 10;
+    table.teamCount = ligaMaxTeams;
+    for (uint8_t i = 0; i < table.teamCount; ++i) {
+        LigaRow& row = table.rows[i];
+        row.w        = nextRandom() % 7;
+        row.d        = nextRandom() % (10 - row.w);
+        row.l        = 9 - row.w - row.d;
+        row.sp       = 9;
+        row.pkt      = 3 * row.w + row.d;
+        row.g        = row.w * 2 + nextRandom() % 8;
+        row.og       = row.l * 2 + nextRandom() % 8;
+        row.diff     = row.g - row.og;
+        row.flap     = DFB1[i].flap;
+        row.teamIdx  = (int8_t)teamIndexOf(DFB1[i].key);
+        strncpy(row.team, DFB1[i].key, sizeof(row.team) - 1);
+        strncpy(row.dfb, DFB1[i].code, sizeof(row.dfb) - 1);
+    }
+    sortSnapshot(table);                                                        // openLigaDB delivers the table in order
+}
+
+// false if order or any counter differs
+static bool sameTable(const LigaSnapshot& a, const LigaSnapshot& b) {
+    if (a.teamCount != b.teamCount)
+        return false;
+    for (uint8_t i = 0; i < a.teamCount; ++i) {
+        const LigaRow& x = a.rows[i];
+        const LigaRow& y = b.rows[i];
+        if (strcmp(x.team, y.team) != 0 || x.pos != y.pos || x.sp != y.sp || x.pkt != y.pkt || x.diff != y.diff || x.g != y.g || x.og != y.og ||
+            x.w != y.w || x.d != y.d || x.l != y.l)
+            return false;
+    }
+    return true;
+}
+
+// new goal entry (or 0:0 at kickoff) of a live match
+static void storeGoal(uint32_t matchID, uint8_t score1, uint8_t score2) {
+    LiveMatchGoalInfo* goal = liveGoals.add(matchID);                           // like storeStreamGoal()
+    if (!goal)
+        return;
+    goal->goalID     = (uint32_t)liveGoalCount;
+    goal->scoreTeam1 = score1;
+    goal->scoreTeam2 = score2;
+}
+
+//
+static void report(const char* name, std::vector<double>& ns) {
+    std::sort(ns.begin(), ns.end());
+    double sum = 0;
+    for (double v : ns)
+        sum += v;
+    printf("[FLAP  - TABLE  ] %-11s %zu polls: mean %.0f ns, p50 %.0f ns, p99 %.0f ns, max %.0f ns\n", name, ns.size(), sum / ns.size(), ns[ns.size() / 2],
+           ns[ns.size() * 99 / 100], ns.back());
+}
+
+/**
+ * @brief replay simulated matchdays through both live table paths
+ *
+ * @param matchdays number of matchdays
+ * @return int exit code, 1 if the incremental table differs from the full recalculation
+ */
+int nativeTableBenchRun(const char* matchdays) {
+    uint32_t days = (uint32_t)atol(matchdays);
+    if (days == 0)
+        days = 200;
+    traceSemaphore = xSemaphoreCreateMutex();                                   // what setup() provides
+    ligaSnapshotMutexInit();
+    ligaMaxTeams = LIGA1_MAX_TEAMS;
+
+    LigaSnapshot table;
+    firstTable(table);
+    publishTable(table);
+
+    LiveTable           live;
+    LigaSnapshot        base;
+    LigaSnapshot        full;
+    std::vector<double> fullNs, liveNs;
+    const uint32_t      pollsPerMatch = 90 * 60 / TABLEBENCH_POLL_S;
+    fullNs.reserve(days * (pollsPerMatch + 1));
+    liveNs.reserve(days * (pollsPerMatch + 1));
+    uint32_t mismatches = 0, moves = 0, changes = 0;
+
+    for (uint32_t day = 0; day < days; ++day) {
+        uint8_t team[LIGA3_MAX_TEAMS];                                          // pairing of this matchday
+        for (uint8_t i = 0; i < ligaMaxTeams; ++i)
+            team[i] = i;
+        for (uint8_t i = ligaMaxTeams - 1; i > 0; --i)
+            std::swap(team[i], team[nextRandom() % (i + 1)]);
+
+        ligaSnapshotsOf(ligaLeague).read(base);
+        liveGoals.beginCycle();
+        ligaLiveMatchCount = ligaMaxTeams / 2;
+        uint8_t score[MAX_MATCHES_PER_MATCHDAY][2] = {};
+        for (uint8_t m = 0; m < ligaLiveMatchCount; ++m) {
+            liveMatches[m].matchID = day * 100 + m + 1;
+            liveMatches[m].team1   = base.rows[team[2 * m]].team;
+            liveMatches[m].team2   = base.rows[team[2 * m + 1]].team;
+            storeGoal(liveMatches[m].matchID, 0, 0);                            // kickoff
+        }
+
+        for (uint32_t poll = 0; poll <= pollsPerMatch; ++poll) {
+            if (poll == pollsPerMatch / 2)
+                publishTable(base);                                             // table poll at half time: new base version
+            if (poll == pollsPerMatch)
+                ligaLiveMatchCount = 0;                                         // final whistle, matches leave the live list
+            for (uint8_t m = 0; m < ligaLiveMatchCount; ++m) {
+                if (nextRandom() % pollsPerMatch >= TABLEBENCH_GOALS_PER_MATCH)
+                    continue;
+                score[m][nextRandom() & 1]++;
+                storeGoal(liveMatches[m].matchID, score[m][0], score[m][1]);
+            }
+
+            const uint32_t version = ligaSnapshotsOf(ligaLeague).read(base);
+            auto           t0      = std::chrono::steady_clock::now();
+            const bool     fullOk  = recalcLiveTable(base, full);
+            auto           t1      = std::chrono::steady_clock::now();
+            const bool     changed = live.update(base, version);
+            auto           t2      = std::chrono::steady_clock::now();
+            fullNs.push_back(std::chrono::duration<double, std::nano>(t1 - t0).count());
+            liveNs.push_back(std::chrono::duration<double, std::nano>(t2 - t1).count());
+            changes += changed;
+            moves += live.moveCount();
+            if (fullOk && !sameTable(full, live.table())) {
+                if (mismatches++ == 0)
+                    printf("[FLAP  - TABLE  ] mismatch on matchday %u, poll %u\n", day, poll);
+            }
+            if (poll == pollsPerMatch - 1)
+                table = full;                                                   // last live table is the final table
+        }
+        table.matchday++;
+        publishTable(table);
+    }
+
+    report("full", fullNs);
+    report("incremental", liveNs);
+    double fullSum = 0, liveSum = 0;
+    for (double v : fullNs)
+        fullSum += v;
+    for (double v : liveNs)
+        liveSum += v;
+    printf("[FLAP  - TABLE  ] %u matchdays, %u changed live tables, %u position changes, %lu rebuilds, mismatches %u, %.1fx faster\n", days, changes, moves,
+           (unsigned long)live.rebuilds(), mismatches, (liveSum > 0) ? fullSum / liveSum : 0.0);
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,622 @@
+// #################################################################################################################
+//
+//  ██    ██ ██ ██████  ████████ ██    ██  █████  ██          ███████ ██       █████  ██████
+//  ██    ██ ██ ██   ██    ██    ██    ██ ██   ██ ██          ██      ██      ██   ██ ██   ██
+//  ██    ██ ██ ██████     ██    ██    ██ ███████ ██          █████   ██      ███████ ██████
+//   ██  ██  ██ ██   ██    ██    ██    ██ ██   ██ ██          ██      ██      ██   ██ ██
+//    ████   ██ ██   ██    ██     ██████  ██   ██ ███████     ██      ███████ ██   ██ ██
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Virtual%20Flap
+//
+/*
+
+    Simulated flap modules (I2C slaves) for the native host build
+
+    A module is a small state machine on top of nativeMicros(): a LongMessage starts a motion
+    task and sets the time it will be finished, every later transaction first checks if that
+    time is over. Nothing runs in the background, so hundreds of modules cost no host threads.
+
+*/
+#include "VirtualFlap.h"
+#include <cstdlib>
+#include <time.h>
+#include "SlaveTwin.h"
+#include "FlapRegistry.h"
+#include "FlapTasks.h"
+#include "Parser.h"
+#include "ReadyScheduler.h"
+#include "RtosTasks.h"
+#include "i2cMaster.h"
+
+VirtualFlapFleet g_virtualFleet;                                                // fleet used by the native binary
+
+// ----------------------------
+#ifdef SIMVERBOSE
+template <typename... Args>
+void simPrint(const Args&... args) {
+    Serial.print("[VIRTUAL  ] ");
+    (Serial.print(args), ...);
+}
+#endif
+
+// ----------------------------------------------------------------------------------------------------------------
+// VirtualFlapModule
+
+VirtualFlapModule::VirtualFlapModule(I2Caddress address, const VirtualFlapConfig& config)
+    : _address(address), _config(config), _random(config.serialnumber) {
+    if (_config.stepsPerRev == 0)
+        _config.stepsPerRev = DEFAULT_STEPS;                                    // avoid division by zero
+    if (_config.msPerRev == 0)
+        _config.msPerRev = DEFAULT_SPEED;
+    _physical = (uint16_t)(_random() % _config.stepsPerRev);                    // drum stops anywhere after power-on
+    _sensorOk = !_config.sensorFault;
+}
+
+// ----------------------------
+
+/**
+ * @brief answer one I2C transaction like the slave firmware
+ *
+ * @param t transaction with written bytes and read buffer
+ * @param newAddress set if the module moved to a new address (CMD_NEW_ADDRESS)
+ * @return esp_err_t ESP_OK = ACK, ESP_FAIL = no ACK
+ */
+esp_err_t VirtualFlapModule::transfer(NativeI2cTransfer& t, I2Caddress& newAddress) {
+    if (_config.answerDelayUs)
+        delayMicroseconds(_config.answerDelayUs);                               // clock stretching of slow slave
+
+    std::lock_guard<std::mutex> lk(_lock);
+    update();
+    if (nativeMicros() < _rebootUntilUs)
+        return ESP_FAIL;                                                        // module is rebooting, no ACK
+
+    if (t.writeLen == 0)
+        return ESP_OK;                                                          // ping (i2c_probe_device)
+
+    if (t.writeLen == sizeof(LongMessage) && t.readLen == 0) {
+        longCommand(t.write[0], (uint16_t)(t.write[1] | (t.write[2] << 8)));
+        return ESP_OK;
+    }
+
+    if (t.writeLen == 1)
+        return shortCommand(t.write[0], t);
+
+    if (t.writeLen == sizeof(MidMessage))
+        return midCommand(t.write[0], t.write[1], t, newAddress);
+
+    return ESP_OK;                                                              // unknown message, slave ACKs and ignores it
+}
+
+// ----------------------------
+
+/**
+ * @brief start motion task of a LongMessage
+ *
+ * timing model of the slave firmware, see estimateAYRdurationMs() on master side
+ *
+ * @param command LongMessage command
+ * @param param steps or offset
+ */
+void VirtualFlapModule::longCommand(uint8_t command, uint16_t param) {
+    const uint16_t spr = _config.stepsPerRev;
+
+    if (_running) {
+        _ignored++;                                                             // slave does not queue commands
+        #ifdef SIMVERBOSE
+            {
+            TraceScope trace;
+            simPrint("0x", String(_address, HEX), " busy, ignored ", getCommandName(command), "\r\n");
+            }
+        #endif
+        return;
+    }
+
+    switch (command) {
+        case MOVE:
+            _pending = (uint16_t)((_physical + param) % spr);
+            startTask(command, stepsToMs(param));
+            break;
+
+        case CALIBRATE: {
+            uint32_t steps = stepsToSensor();                                   // search hall sensor
+            if (_sensorOk) {
+                _pending = (uint16_t)(_config.offset % spr);                    // logical zero behind sensor
+                steps += _config.offset;
+            } else {
+                _pending = _physical;                                           // gave up after full revolutions
+            }
+            startTask(command, stepsToMs(steps));
+            break;
+        }
+
+        case SPEED_MEASURE: {
+            uint32_t steps = stepsToSensor() + spr;                             // search sensor, then measure one revolution
+            if (_sensorOk) {
+                const int jitter = (int)(_random() % 41) - 20;                  // ±20 ms measuring error
+                _measuredSpeed   = (uint16_t)(_config.msPerRev + jitter);
+                _pending         = 0;                                           // stops at sensor
+            } else {
+                _measuredSpeed = 0;
+                _pending       = _physical;
+            }
+            startTask(command, stepsToMs(steps));
+            break;
+        }
+
+        case STEP_MEASURE: {
+            uint32_t ms = 0;
+            for (int i = 0; i < 3; i++)                                         // 3 measurements with pause
+                ms += stepsToMs(2u * spr + _config.offset) + VIRTUAL_STEP_MEASURE_PAUSE_MS;
+            _sensorOk      = !_config.sensorFault;
+            _measuredSteps = _sensorOk ? spr : 0;
+            _pending       = _sensorOk ? (uint16_t)(_config.offset % spr) : _physical;
+            startTask(command, ms);
+            break;
+        }
+
+        case SENSOR_CHECK:
+            _sensorOk = !_config.sensorFault && (param >= spr || sensorHit());  // a full revolution passes the sensor
+            _pending  = (uint16_t)((_physical + param) % spr);
+            startTask(command, (uint32_t)(stepsToMs(param) * VIRTUAL_SENSOR_CHECK_SLOWDOWN));
+            break;
+
+        case SET_OFFSET:
+            _config.offset = param;                                             // stored in EEPROM of slave
+            _pending       = _physical;
+            startTask(command, VIRTUAL_EEPROM_MS);
+            break;
+
+        case RESET:
+            _rebootUntilUs = nativeMicros() + (uint64_t)VIRTUAL_REBOOT_MS * 1000;
+            _bootFlag      = true;
+            _taskCode      = NO_COMMAND;
+            _running       = false;
+            break;
+
+        default:
+            break;                                                              // unknown LongMessage is ignored
+    }
+}
+
+// ----------------------------
+
+/**
+ * @brief answer a ShortMessage
+ *
+ * @param command ShortMessage command
+ * @param t transaction, answer is written to t.read
+ * @return esp_err_t
+ */
+esp_err_t VirtualFlapModule::shortCommand(uint8_t command, NativeI2cTransfer& t) {
+    uint8_t answer[6] = {0, 0, 0, 0, 0, 0};
+    size_t  len       = 1;
+    auto    put16     = [&](uint16_t v) {
+        answer[0] = (uint8_t)(v & 0xFF);                                        // LSB first
+        answer[1] = (uint8_t)(v >> 8);
+        len       = 2;
+    };
+
+    switch (command) {
+        case CMD_ARE_YOU_READY:
+            answer[0] = !_running;
+            break;
+        case CMD_GET_STATE: {
+            const uint16_t pos = position();
+            answer[0]          = !_running;
+            answer[1]          = _taskCode;
+            answer[2]          = _bootFlag;
+            answer[3]          = _sensorOk;
+            answer[4]          = (uint8_t)(pos & 0xFF);
+            answer[5]          = (uint8_t)(pos >> 8);
+            len                = 6;
+            break;
+        }
+        case CMD_GET_SERIAL:
+            for (int i = 0; i < 4; i++)
+                answer[i] = (uint8_t)(_config.serialnumber >> (8 * i));
+            len = 4;
+            break;
+        case CMD_GET_OFFSET:
+            put16(_config.offset);
+            break;
+        case CMD_GET_FLAPS:
+            answer[0] = _config.flaps;
+            break;
+        case CMD_GET_SPEED:
+            put16(_measuredSpeed);
+            break;
+        case CMD_GET_STEPS:
+            put16(_measuredSteps);
+            break;
+        case CMD_GET_SENSOR:
+            answer[0] = _sensorOk;
+            break;
+        case CMD_GET_BOOT_FLAG:
+            answer[0] = _bootFlag;
+            break;
+        case CMD_RESET_BOOT:
+            _bootFlag = false;
+            answer[0] = _bootFlag;
+            break;
+        default:
+            len = 0;                                                            // unknown request, bus reads 0xFF
+            break;
+    }
+
+    memcpy(t.read, answer, std::min(len, t.readLen));
+    return ESP_OK;
+}
+
+// ----------------------------
+
+/**
+ * @brief answer a MidMessage
+ *
+ * CMD_NEW_ADDRESS answers the serial number, then the module listens to the new address
+ *
+ * @return esp_err_t
+ */
+esp_err_t VirtualFlapModule::midCommand(uint8_t command, uint8_t param, NativeI2cTransfer& t, I2Caddress& newAddress) {
+    if (command != CMD_NEW_ADDRESS)
+        return ESP_OK;
+
+    uint8_t answer[4];
+    for (int i = 0; i < 4; i++)
+        answer[i] = (uint8_t)(_config.serialnumber >> (8 * i));
+    memcpy(t.read, answer, std::min(sizeof(answer), t.readLen));
+    newAddress = param;
+    _address   = param;
+    return ESP_OK;
+}
+
+// ----------------------------
+
+/**
+ * @brief finish running motion task if its time is over
+ *
+ */
+void VirtualFlapModule::update() {
+    if (_running && nativeMicros() >= _busyUntilUs) {
+        _running  = false;
+        _physical = _pending;
+    }
+}
+
+// ----------------------------
+void VirtualFlapModule::startTask(uint8_t command, uint32_t durationMs) {
+    _taskCode    = command;
+    _running     = true;
+    _busyUntilUs = nativeMicros() + (uint64_t)durationMs * 1000;
+}
+
+// ----------------------------
+bool VirtualFlapModule::isBusy() {
+    std::lock_guard<std::mutex> lk(_lock);
+    update();
+    return _running || nativeMicros() < _rebootUntilUs;
+}
+
+// ----------------------------
+
+/**
+ * @brief logical position: steps behind flap 0
+ *
+ * @return uint16_t
+ */
+uint16_t VirtualFlapModule::position() {
+    const uint16_t spr = _config.stepsPerRev;
+    return (uint16_t)((_physical + spr - (_config.offset % spr)) % spr);
+}
+
+// ----------------------------
+uint32_t VirtualFlapModule::stepsToMs(uint32_t steps) {
+    uint64_t ms = (uint64_t)steps * _config.msPerRev / _config.stepsPerRev;
+    if (_config.speedJitter) {
+        const int range = 2 * _config.speedJitter + 1;                          // -jitter..+jitter %
+        ms              = ms * (100 + (int)(_random() % range) - _config.speedJitter) / 100;
+    }
+    return (uint32_t)ms;
+}
+
+// ----------------------------
+
+/**
+ * @brief steps until the hall sensor is detected
+ *
+ * a missed sensor pass costs one more revolution, the slave gives up after 2 revolutions
+ *
+ * @return uint32_t steps to drive
+ */
+uint32_t VirtualFlapModule::stepsToSensor() {
+    const uint16_t spr   = _config.stepsPerRev;
+    uint32_t       steps = (uint32_t)((spr - _physical) % spr);
+    _sensorOk            = false;
+    if (_config.sensorFault)
+        return 2u * spr;                                                        // searched in vain
+    for (int pass = 0; pass < 2; pass++) {
+        if (sensorHit()) {
+            _sensorOk = true;
+            return steps;
+        }
+        steps += spr;
+    }
+    return steps;
+}
+
+// ----------------------------
+bool VirtualFlapModule::sensorHit() {
+    return (uint8_t)(_random() % 100) >= _config.sensorMissRate;
+}
+
+// ----------------------------------------------------------------------------------------------------------------
+// VirtualFlapFleet
+
+VirtualFlapFleet::VirtualFlapFleet(uint32_t usPerByte) {
+    for (auto& c : _commands)
+        c = 0;
+    nativeI2cSetBusLatencyUs(usPerByte);
+}
+
+// ----------------------------
+
+/**
+ * @brief plug in a module that already owns an address (registered before power loss)
+ *
+ */
+VirtualFlapModule* VirtualFlapFleet::addModule(I2Caddress address, const VirtualFlapConfig& config) {
+    VirtualFlapConfig cfg = config;
+    std::lock_guard<std::mutex> lk(_lock);
+    if (cfg.serialnumber == 0)
+        cfg.serialnumber = _nextSerial++;
+    auto& slot = _modules[address];
+    slot.reset(new VirtualFlapModule(address, cfg));
+    attach(address);
+    return slot.get();
+}
+
+// ----------------------------
+
+/**
+ * @brief plug in new modules, they wait at I2C_BASE_ADDRESS to be registered
+ *
+ * only the first waiting module answers; after CMD_NEW_ADDRESS the next one moves up,
+ * like modules that are plugged in one after another
+ *
+ * @param count number of modules
+ * @param config properties of each module
+ */
+void VirtualFlapFleet::plugIn(int count, const VirtualFlapConfig& config) {
+    std::lock_guard<std::mutex> lk(_lock);
+    for (int i = 0; i < count; i++) {
+        VirtualFlapConfig cfg = config;
+        if (cfg.serialnumber == 0 || count > 1)
+            cfg.serialnumber = _nextSerial++;
+        _unregistered.emplace_back(new VirtualFlapModule(I2C_BASE_ADDRESS, cfg));
+    }
+    if (!_unregistered.empty())
+        attach(I2C_BASE_ADDRESS);
+}
+
+// ----------------------------
+void VirtualFlapFleet::setBusLatencyUs(uint32_t usPerByte) {
+    nativeI2cSetBusLatencyUs(usPerByte);
+}
+
+// ----------------------------
+int VirtualFlapFleet::size() {
+    std::lock_guard<std::mutex> lk(_lock);
+    return (int)_modules.size();
+}
+
+// ----------------------------
+void VirtualFlapFleet::attach(I2Caddress address) {
+    nativeI2cAttach(address, [this, address](NativeI2cTransfer& t) { return route(address, t); });
+}
+
+// ----------------------------
+
+/**
+ * @brief bus callback: hand transaction to the module at this address
+ *
+ * @param address addressed slave
+ * @param t transaction
+ * @return esp_err_t
+ */
+esp_err_t VirtualFlapFleet::route(I2Caddress address, NativeI2cTransfer& t) {
+    std::lock_guard<std::mutex> lk(_lock);
+    const bool         waiting = (address == I2C_BASE_ADDRESS && !_unregistered.empty());
+    VirtualFlapModule* module  = nullptr;
+    if (waiting) {
+        module = _unregistered.front().get();
+    } else {
+        auto it = _modules.find(address);
+        if (it == _modules.end())
+            return ESP_FAIL;                                                    // nobody there
+        module = it->second.get();
+    }
+
+    if (t.writeLen > 0)
+        _commands[t.write[0]]++;
+
+    I2Caddress newAddress = address;
+    esp_err_t  ret        = module->transfer(t, newAddress);
+    if (ret != ESP_OK || newAddress == address)
+        return ret;
+
+    std::unique_ptr<VirtualFlapModule> moved;                                   // module changes its address
+    if (waiting) {
+        moved = std::move(_unregistered.front());
+        _unregistered.pop_front();
+    } else {
+        moved = std::move(_modules[address]);
+        _modules.erase(address);
+    }
+    #ifdef ERRORVERBOSE
+        if (_modules.count(newAddress)) {
+            TraceScope trace;
+            Serial.printf("[VIRTUAL  ] address collision at 0x%02X, module 0x%02X replaced\r\n", newAddress, newAddress);
+        }
+    #endif
+    _modules[newAddress] = std::move(moved);
+    attach(newAddress);
+
+    if (!_modules.count(address) && !(address == I2C_BASE_ADDRESS && !_unregistered.empty()))
+        nativeI2cDetach(address);                                               // old address is free now
+
+    #ifdef SIMVERBOSE
+        {
+        TraceScope trace;
+        simPrint("module ", formatSerialNumber(_modules[newAddress]->serialnumber()), " moved from 0x", String(address, HEX),
+                 " to 0x", String(newAddress, HEX), "\r\n");
+        }
+    #endif
+    return ret;
+}
+
+// ----------------------------
+
+/**
+ * @brief wait until all modules finished their motion tasks
+ *
+ * @param timeoutMs maximum wait
+ * @return true all idle
+ * @return false timeout
+ */
+bool VirtualFlapFleet::waitUntilIdle(uint32_t timeoutMs) {
+    const uint64_t end = nativeMicros() + (uint64_t)timeoutMs * 1000;
+    while (nativeMicros() < end) {
+        bool busy = false;
+        {
+            std::lock_guard<std::mutex> lk(_lock);
+            for (auto& m : _modules)
+                busy |= m.second->isBusy();
+        }
+        if (!busy)
+            return true;
+        delay(10);
+    }
+    return false;
+}
+
+// ----------------------------
+void VirtualFlapFleet::resetCounters() {
+    for (auto& c : _commands)
+        c = 0;
+}
+
+// ----------------------------
+
+/**
+ * @brief print modules and command counters
+ *
+ */
+void VirtualFlapFleet::printReport() {
+    std::lock_guard<std::mutex> lk(_lock);
+    TraceScope                  trace;
+    Serial.println("--------------------------- virtual flap fleet ---------------------------");
+    Serial.printf("modules registered: %d, waiting at 0x%02X: %d, bus transactions: %u\r\n", (int)_modules.size(),
+                  I2C_BASE_ADDRESS, (int)_unregistered.size(), (unsigned)nativeI2cTransactions());
+    for (auto& m : _modules)
+        Serial.printf("  0x%02X  %s  position %4u  %s  ignored while busy: %u\r\n", m.first,
+                      formatSerialNumber(m.second->serialnumber()), (unsigned)m.second->position(),
+                      m.second->isBusy() ? "BUSY " : "READY", (unsigned)m.second->ignored());
+    for (int c = 0; c < 256; c++)
+        if (_commands[c])
+            Serial.printf("  %-20s %u\r\n", getCommandName((uint8_t)c), (unsigned)_commands[c].load());
+    Serial.println("--------------------------------------------------------------------------");
+}
+
+// ----------------------------------------------------------------------------------------------------------------
+// ready bench (FLAP_READYBENCH)
+
+void flapRegistryMutexInit();                                                   // defined in FlapRegistry.cpp
+
+struct ReadyBenchJob {
+    int               idx;                                                      // twin index
+    int               flap;                                                     // flap to be shown
+    SemaphoreHandle_t done;                                                     // counts finished twins
+};
+
+static void readyBenchTwin(void* pvParameters) {
+    ReadyBenchJob* job = (ReadyBenchJob*)pvParameters;
+    Twin[job->idx]->showFlap(job->flap);                                        // MOVE + waitUntilYouAreReady()
+    xSemaphoreGive(job->done);
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief one SHOW_FLAP per twin in parallel tasks, READYBENCH_ROUNDS times
+ *
+ * @param label variant in the report
+ * @param modules number of twins
+ */
+static void readyBenchRounds(const char* label, int modules) {
+    SemaphoreHandle_t          done = xSemaphoreCreateCounting(modules, 0);
+    std::vector<ReadyBenchJob> jobs(modules);
+    g_virtualFleet.resetCounters();
+    const uint32_t wakeups = nativeTaskWakeups();
+    timespec       cpu0, cpu1;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpu0);
+    const uint32_t t0 = millis();
+    for (int r = 0; r < READYBENCH_ROUNDS; ++r) {
+        for (int i = 0; i < modules; ++i) {
+            jobs[i] = {i, (Twin[i]->_flapNumber + 5 + 3 * (i % 4)) % Twin[i]->_numberOfFlaps, done}; // 5..14 flaps ahead
+            xTaskCreate(readyBenchTwin, "ReadyBench", 4 * 1024, &jobs[i], 1, nullptr);
+        }
+        for (int i = 0; i < modules; ++i)
+            xSemaphoreTake(done, portMAX_DELAY);
+    }
+    const uint32_t ms = millis() - t0;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpu1);
+    const double cpuMs = (cpu1.tv_sec - cpu0.tv_sec) * 1e3 + (cpu1.tv_nsec - cpu0.tv_nsec) / 1e6;
+    Serial.printf("%-8s %4d twins  %6u ms/round  %5.1f AYR/move  %7u wakeups  %7.1f ms CPU\r\n", label, modules,
+                  (unsigned)(ms / READYBENCH_ROUNDS), (double)g_virtualFleet.commandCount(CMD_ARE_YOU_READY) / (modules * READYBENCH_ROUNDS),
+                  (unsigned)(nativeTaskWakeups() - wakeups), cpuMs);
+    vSemaphoreDelete(done);
+}
+
+/**
+ * @brief compare per-twin AYR polling with the shared ReadyScheduler on the virtual fleet
+ *
+ * Every twin moves 5..14 flaps at the same time, like a full table update. Reported per variant:
+ * time per round, ARE_YOU_READY probes per move, task wakeups and CPU time of the binary.
+ *
+ * @param modules number of twins/modules (1..numberOfTwins)
+ * @return int exit code of the binary
+ */
+int nativeReadyBenchRun(int modules) {
+    if (modules < 1 || modules > numberOfTwins) {
+        Serial.printf("FLAP_READYBENCH: 1..%d modules\r\n", numberOfTwins);
+        return 1;
+    }
+    traceSemaphore = xSemaphoreCreateMutex();                                   // what setup() provides
+    flapRegistryMutexInit();
+    initAddressPool();
+    i2csetup();
+    Parser   = new ParserClass();
+    Register = new FlapRegistry();
+    for (int i = 0; i < modules; ++i) {
+        const I2Caddress  address = I2Caddress(I2C_MINADR + i);
+        VirtualFlapConfig config;                                               // default drum, 1 % speed jitter
+        g_virtualFleet.addModule(address, config);
+        Twin[i] = new SlaveTwin(address);
+        Twin[i]->askSlaveAboutParameter(Twin[i]->_parameter);
+        Twin[i]->_parameter.steps = config.stepsPerRev;                         // what step and speed measurement store
+        Twin[i]->_parameter.speed = config.msPerRev;
+        Twin[i]->_numberOfFlaps   = Twin[i]->_parameter.flaps;
+        Twin[i]->calculateStepsPerFlap();
+        Register->updateRegistry(address, Twin[i]->_parameter);
+    }
+
+    ReadyPoll = nullptr;                                                        // every twin polls on its own
+    readyBenchRounds("polling", modules);
+
+    ReadyPoll = new ReadyScheduler();
+    xTaskCreate(readyPollTask, "ReadyPoll", STACK_READY_POLL, NULL, PRIO_READY_POLL, &g_readyPollHandle);
+    ReadyPoll->attach(g_readyPollHandle);
+    delay(10);                                                                  // scheduler task is waiting for bookings
+    readyBenchRounds("wheel", modules);
+    return 0;
+}
@@ -15,12 +15,16 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "SlaveTwin.h"
+#include "ReadyScheduler.h"
 
 //--------------------------------
 
 /**
  * @brief Waits until the slave is READY using an ETA-driven polling scheme.
  *
+ * The probes are booked at the shared ReadyScheduler, the twin sleeps meanwhile. Only if
+ * the scheduler is missing or full the twin polls on its own.
+ *
  * @param longCmd Command that was sent (affects ETA/overshoot).
  * @param param_sent_to_slave Parameter sent alongside the command (affects ETA).
  * @param timeout_ms Maximum wait time in ms (may be stretched slightly for first poll window).
@@ -45,6 +49,21 @@ bool SlaveTwin::waitUntilYouAreReady(uint8_t longCmd, uint16_t param_sent_to_sla
     const uint32_t first_poll_at = planFirstPollAt(eta_ms, longCmd);            // pick first-poll time slightly after ETA
     stretchTimeoutForFirstWindow(first_poll_at, timeout_ms);                    // ensure timeout covers the first fast-poll window
 
+    ReadyTicket ticket;
+    if (ReadyPoll && ReadyPoll->book(this, ticket, first_poll_at, timeout_ms)) { // shared timer wheel probes for us
+        const bool ready = ReadyPoll->await(ticket);
+        if (ready)
+            _moveModel.learn(longCmd, eta_ms, ticket.lastBusyMs, ticket.readyMs); // fit real duration of this module
+        #ifdef AYRVERBOSE
+            {
+            TraceScope trace;                                                   // serialize log output
+            twinPrintln("AYR %s cmd=0x%X param=%d elapsed_ms=%u eta_ms=%u polls=%u", ready ? "success" : "TIMEOUT", longCmd, param_sent_to_slave,
+                        millis() - t0, eta_ms, ticket.polls);
+            }
+        #endif
+        return ready;
+    }
+
     if (!quietWait(t0, first_poll_at, timeout_ms))                              // stay silent until first-poll moment (or timeout)
         return false;                                                           // gave up before first poll → timeout
 
@@ -192,12 +211,16 @@ uint32_t SlaveTwin::computeOvershoot(uint8_t longCmd) const {
 // 3) part of waitUntilYouAreReady()
 /**
  * @brief Calculates first poll time (ETA + overshoot).
+ * With enough samples the learned duration of this module replaces ETA + overshoot.
  *
  * @param eta_ms Estimated time to completion.
  * @param longCmd Command identifier.
  * @return First poll timestamp in ms.
  */
 uint32_t SlaveTwin::planFirstPollAt(uint32_t eta_ms, uint8_t longCmd) const {
+    const uint32_t learned_ms = _moveModel.predict(longCmd, eta_ms);            // 0 until the model has enough samples
+    if (learned_ms > 0)
+        return learned_ms + MOVE_MODEL_MARGIN_MS;                               // just after the learned end of the command
     return eta_ms + computeOvershoot(longCmd);                                  // schedule first poll slightly after ETA
 }
 
@@ -267,16 +290,7 @@ bool SlaveTwin::tryFirstPoll(uint32_t t0, uint8_t longCmd, uint16_t param, uint3
         {
         TraceScope     trace;                                                   // serialize log output
         const uint32_t elapsed = millis() - t0;                                 // time-to-ready
-        twinPrint("AYR success cmd=0x");                                        // structured verbose logging
-        Serial.print(longCmd, HEX);
-        Serial.print(" param=");
-        Serial.print(param);
-        Serial.print(" elapsed_ms=");
-        Serial.print(elapsed);
-        Serial.print(" eta_ms=");
-        Serial.print(eta_ms);
-        Serial.print(" polls=");
-        Serial.println(polls);
+        twinPrintln("AYR success cmd=0x%X param=%d elapsed_ms=%u eta_ms=%u polls=%u", longCmd, param, elapsed, eta_ms, polls); // structured verbose logging
         }
     #endif
         return true;                                                            // done on first poll
@@ -313,16 +327,7 @@ bool SlaveTwin::followUpPolling(uint32_t t0, uint32_t timeout_ms, uint32_t eta_m
         #ifdef AYRVERBOSE
             {
             TraceScope trace;                                                   // serialize log output
-            twinPrint("AYR TIMEOUT cmd=0x");                                    // diagnostic detail on timeout
-            Serial.print(longCmd, HEX);
-            Serial.print(" param=");
-            Serial.print(param);
-            Serial.print(" polls=");
-            Serial.print(polls);
-            Serial.print(" seenBusy=");
-            Serial.print(seenBusy ? 1 : 0);
-            Serial.print(" eta_ms=");
-            Serial.println(eta_ms);
+            twinPrintln("AYR TIMEOUT cmd=0x%X param=%d polls=%u seenBusy=%d eta_ms=%u", longCmd, param, polls, seenBusy ? 1 : 0, eta_ms); // diagnostic detail on timeout
             }
         #endif
             return false;                                                       // give up on timeout
@@ -345,20 +350,8 @@ bool SlaveTwin::followUpPolling(uint32_t t0, uint32_t timeout_ms, uint32_t eta_m
             {
             TraceScope     trace;                                               // serialize log output
             const uint32_t elapsed2 = millis() - t0;                            // final elapsed time
-            twinPrint("AYR success cmd=0x");                                    // structured verbose logging
-            Serial.print(longCmd, HEX);
-            Serial.print(" param=");
-            Serial.print(param);
-            Serial.print(" elapsed_ms=");
-            Serial.print(elapsed2);
-            Serial.print(" eta_ms=");
-            Serial.print(eta_ms);
-            Serial.print(" polls=");
-            Serial.print(polls);
-            Serial.print(" seenBusy=");
-            Serial.print(seenBusy ? 1 : 0);
-            Serial.print(" firstBusy_ms=");
-            Serial.println(firstBusy_ms);
+            twinPrintln("AYR success cmd=0x%X param=%d elapsed_ms=%u eta_ms=%u polls=%u seenBusy=%d firstBusy_ms=%u", longCmd, param, elapsed2, eta_ms,
+                        polls, seenBusy ? 1 : 0, firstBusy_ms);                 // structured verbose logging
             }
         #endif
             return true;                                                        // done after follow-up poll
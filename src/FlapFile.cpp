@@ -56,26 +56,36 @@ FlapFile::FlapFile() {
 /**
  * @brief Save a JSON file with prepended metadata.
  *
- * This function takes an existing JsonDocument (`dataDoc`), wraps it into a new
- * document (`finalDoc`), and prepends a "_meta" object with metadata fields
- * such as file name, version, timestamp, description and author.
- * The combined JSON is then written to SPIFFS.
- *
  * @param filename Path to the JSON file in SPIFFS (e.g. "/TaskStatus.json")
  * @param dataDoc  The JsonDocument containing the actual data payload
  * @return true    If the file was saved successfully
  * @return false   If opening or writing the file failed
  */
 bool FlapFile::saveFile(const char* filename, JsonDocument& dataDoc) {
-    #pragma GCC diagnostic push
-    #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-    StaticJsonDocument<2048> finalDoc;                                          ///< Final document with metadata + data
+    JsonDocument finalDoc;                                                      ///< Final document with metadata + data
+    composeFile(filename, dataDoc, finalDoc);
+    return writeFile(filename, finalDoc);
+}
+
+// ---------------------------
 
+/**
+ * @brief Prepend metadata to a JSON document.
+ *
+ * This function takes an existing JsonDocument (`dataDoc`), wraps it into a new
+ * document (`finalDoc`), and prepends a "_meta" object with metadata fields
+ * such as file name, version, timestamp, description and author.
+ *
+ * @param filename Path to the JSON file in SPIFFS (e.g. "/TaskStatus.json")
+ * @param dataDoc  The JsonDocument containing the actual data payload
+ * @param finalDoc Document with metadata + data
+ */
+void FlapFile::composeFile(const char* filename, JsonDocument& dataDoc, JsonDocument& finalDoc) {
     // ------------------------------------------------------------
     // 1. Create metadata object first so it will be placed at top
     // ------------------------------------------------------------
-    JsonObject meta = finalDoc.createNestedObject("_meta");                     ///< JSON header object
-    #pragma GCC diagnostic pop
+    finalDoc.clear();
+    JsonObject meta     = finalDoc["_meta"].to<JsonObject>();                   ///< JSON header object
     meta["file"]        = filename;                                             ///< Name of the file in SPIFFS
     meta["version"]     = "1.0";                                                ///< Schema or file version
     meta["created"]     = isoTimestamp();                                       ///< Local MESZ/MEZ timestamp
@@ -88,7 +98,19 @@ bool FlapFile::saveFile(const char* filename, JsonDocument& dataDoc) {
     for (JsonPair kv : dataDoc.as<JsonObject>()) {
         finalDoc[kv.key()] = kv.value();                                        ///< Copy each field into final document
     }
+}
+
+// ---------------------------
 
+/**
+ * @brief Write a composed JSON document to SPIFFS.
+ *
+ * @param filename Path to the JSON file in SPIFFS
+ * @param finalDoc Document with metadata + data (see composeFile)
+ * @return true    If the file was saved successfully
+ * @return false   If opening or writing the file failed
+ */
+bool FlapFile::writeFile(const char* filename, JsonDocument& finalDoc) {
     // ------------------------------------------------------------
     // 3. Open file for writing in SPIFFS
     // ------------------------------------------------------------
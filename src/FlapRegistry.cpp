@@ -23,6 +23,7 @@
 #include "FlapRegistry.h"
 #include "RtosTasks.h"
 #include "FlapTasks.h"
+#include "ReadyScheduler.h"
 
 // ----------------------------------
 
@@ -80,29 +81,19 @@ void FlapRegistry::availabilityCheck() {
     forEachRegisteredIdx([&](int idx, I2Caddress addr) {                        // all registered devices
         {
             #ifdef AVAILABILITYVERBOSE
-                {
-                TraceScope trace;
-                registerPrint("send TWIN_AVAILABILITY to twin 0x");
-                Serial.println(addr, HEX);
-                }
+                registerPrintln("send TWIN_AVAILABILITY to twin 0x%02X", addr);
             #endif
         }
         if (!Twin[idx]) {
             #ifdef ERRORVERBOSE
-                {
-                TraceScope trace;                                               // debug: trace scope
                 registerPrintln("Twin does not exist");
-                }
             #endif
             return;
         }
         bool rc = Twin[idx]->sendQueue(cmd);                                    // send to twin with registered device
         if (!rc) {
             #ifdef ERRORVERBOSE
-                {
-                TraceScope trace;                                               // debug: trace scope
                 registerPrintln("send to Twin Queue failed");
-                }
             #endif
         }
     });                                                                         // next registered device
@@ -133,19 +124,13 @@ void FlapRegistry::deRegisterDevice(I2Caddress slaveAddress) {
  */
 void FlapRegistry::deviceRegistryIntro() {
     #ifdef SCANVERBOSE
-        {
-        TraceScope trace;                                                       // debug: scoped trace output
         registerPrintln("Start I²C-Scan to register new slaves...");            // announce scan start
-        }
     #endif
 
     if (g_masterBooted) {                                                       // master just rebooted? (boot flag set)
     #ifdef SCANVERBOSE
-        {
-        TraceScope trace;                                                       // debug: scoped trace output
         registerPrintln("System-Reset detected → Master has restarted");        // inform about master restart
         registerPrintln("all slaves detected during I²C-bus-scan will be calibrated..."); // note calibration policy
-        }
     #endif
     }
 }
@@ -162,10 +147,7 @@ void FlapRegistry::deviceRegistryOutro() {
     }
 
     #ifdef SCANVERBOSE
-        {
-        TraceScope trace;                                                       // debug: scoped trace output
         registerPrintln("I²C-Scan complete.");                                  // announce scan completion
-        }
     #endif
 }
 
@@ -189,10 +171,7 @@ void FlapRegistry::registerDevice() {
         if (!isAddressRegistered(addr)) {                                       // Only act on addresses that are not yet present in the registry
 
         #ifdef REGISTRYVERBOSE
-            {
-            TraceScope trace;
             registerPrintln("probe/register: idx=%d addr=0x%02x (not registered)", i, addr);
-            }
         #endif
             Twin[i]->sendQueue(cmd);                                            // send to twins entry queue
         }
@@ -260,10 +239,7 @@ void FlapRegistry::updateRegistry(I2Caddress address, slaveParameter parameter)
         Twin[n]->calculateStepsPerFlap();                                       // recalculate relative movement
 
         #ifdef SCANVERBOSE
-            {
-            TraceScope trace;
             printStepsByFlapLines(address, Twin[n]->stepsByFlap, parameter.flaps);
-            }
         #endif
     }
 
@@ -276,51 +252,31 @@ void FlapRegistry::updateRegistry(I2Caddress address, slaveParameter parameter)
 
     if (offChanged) {
         #ifdef SCANVERBOSE
-            {
-            TraceScope trace;
-            registerPrint("device 0x%02X offset changed to: ", address);
-            Serial.println(device->parameter.offset);
-            }
+            registerPrintln("device 0x%02X offset changed to: %d", address, device->parameter.offset);
         #endif
     }
 
     if (speedChanged) {
         #ifdef SCANVERBOSE
-            {
-            TraceScope trace;
-            registerPrint("device 0x%02X speed changed to: ", address);
-            Serial.println(device->parameter.speed);
-            }
+            registerPrintln("device 0x%02X speed changed to: %d", address, device->parameter.speed);
         #endif
     }
 
     if (bootChanged) {
         #ifdef SCANVERBOSE
-            {
-            TraceScope trace;
-            registerPrint("device 0x%02X bootFlag changed to: ", address);
-            Serial.println(device->bootFlag);
-            }
+            registerPrintln("device 0x%02X bootFlag changed to: %d", address, device->bootFlag);
         #endif
     }
 
     if (posChanged) {
         #ifdef SCANVERBOSE
-            {
-            TraceScope trace;
-            registerPrint("device 0x%02X position changed to: ", address);
-            Serial.println(device->position);
-            }
+            registerPrintln("device 0x%02X position changed to: %u", address, device->position);
         #endif
     }
 
     if (sensChanged) {
         #ifdef SCANVERBOSE
-            {
-            TraceScope trace;
-            registerPrint("device 0x%02X sensor status changed to: ", address);
-            device->parameter.sensorworking ? Serial.println("working") : Serial.println("broken");
-            }
+            registerPrintln("device 0x%02X sensor status changed to: %s", address, device->parameter.sensorworking ? "working" : "broken");
         #endif
     }
 }
@@ -339,17 +295,16 @@ void FlapRegistry::printStepsByFlapLines(I2Caddress address, int* steps, int fla
     if (!steps || flaps <= 0) {
         return;
     }
+    char   line[TRACE_TEXT_BYTES];                                              // steps of one trace line
+    size_t used = 0;
     for (int i = 0; i < flaps; ++i) {
-        if ((i % perLine) == 0) {                                               // begin with prefix line
-            registerPrint("device 0x%02X Steps by Flap: ", address);
-        }
-        Serial.print(steps[i]);
+        if ((i % perLine) == 0)                                                 // begin new line
+            used = 0;
+        if (used < sizeof(line))
+            used += snprintf(line + used, sizeof(line) - used, (i % perLine) ? ", %d" : "%d", steps[i]);
         const bool endOfLine = ((i % perLine) == perLine - 1) || (i == flaps - 1);
-        if (endOfLine) {
-            Serial.println();                                                   // line break
-        } else {
-            Serial.print(", ");                                                 // separate steps
-        }
+        if (endOfLine)
+            registerPrintln("device 0x%02X Steps by Flap: %s", address, line);  // one trace line per perLine steps
     }
 }
 
@@ -537,24 +492,18 @@ int FlapRegistry::nextRegisteredIndex(int start, int dir) const {
 bool FlapRegistry::sendToIndex(int idx, const TwinCommand& cmd) const {
     if (!isIndexRegistered(idx)) {
         #ifdef ERRORVERBOSE
-            {
-            TraceScope trace;
             if (idx < 0)
                 registerPrintln("kein Flap-Device verbunden - Kommando verworfen");
             else
                 registerPrintln("Flap-Device Index %d nicht registriert - Kommando verworfen", idx);
-            }
         #endif
         return false;
     }
     const uint8_t addr = addressAt(idx);
     Twin[idx]->sendQueue(cmd);
     #ifdef REGISTRYVERBOSE
-        {
-        TraceScope trace;
         registerPrintln("send Twin_Command: %s to Twin 0x%02x", Parser->twinCommandToString(cmd.twinCommand), addr);
         registerPrintln("send Twin_Parameter: %d to Twin 0x%02x", cmd.twinParameter, addr);
-        }
     #endif
     return true;
 }
@@ -570,17 +519,145 @@ void FlapRegistry::sendToAll(const TwinCommand& cmd) const {
     forEachRegisteredIdx([&](int idx, I2Caddress addr) {
         Twin[idx]->sendQueue(cmd);
         #ifdef REGISTRYVERBOSE
-            {
-            TraceScope trace;
             registerPrintln("send Twin_Command: %s to Twin 0x%02x", Parser->twinCommandToString(cmd.twinCommand), addr);
             registerPrintln("send Twin_Parameter: %d to Twin 0x%02x", cmd.twinParameter, addr);
-            }
         #endif
     });
 }
 
 // ---------------------------------
 
+/**
+ * @brief show a display frame: move all flaps in one bus round
+ *
+ * All MOVE commands are sent back-to-back within one hold of the I2C semaphore, afterwards all
+ * moving devices are booked at the shared ReadyScheduler. The frame needs about as long as the slowest
+ * single move instead of the sum of all moves.
+ * A twin busy with a queued command gets its entry as TWIN_SHOW_FLAP through its queue instead.
+ * Runs in the calling task and returns when all flaps are ready or timed out, callers that
+ * must not block (Parser) use postFrame().
+ *
+ * @param frame list of (address, targetFlap)
+ * @return int number of flaps confirmed READY
+ */
+int FlapRegistry::showFrame(const std::vector<FlapFrameEntry>& frame) const {
+    struct FrameMove {
+        int      idx;                                                           // twin index
+        int      target;                                                        // flap to be shown
+        uint16_t steps;                                                         // steps of MOVE
+        uint32_t firstPollMs;                                                   // first AYR after MOVE
+        uint32_t timeoutMs;                                                     // give up after MOVE
+        bool     sent;                                                          // MOVE acknowledged
+    };
+    std::vector<FrameMove> moves;
+    moves.reserve(frame.size());
+
+    // 1) reserve twins, busy twins get the frame entry through their queue
+    for (const FlapFrameEntry& entry : frame) {
+        const int idx = indexOfAddress(entry.address);
+        if (!isIndexRegistered(idx))
+            continue;                                                           // unknown device
+        SlaveTwin* twin = Twin[idx];
+        if (!twin->tryLockCommands(pdMS_TO_TICKS(FRAME_LOCK_WAIT_MS))) {
+            TwinCommand cmd   = {};
+            cmd.twinCommand   = TWIN_SHOW_FLAP;
+            cmd.twinParameter = entry.targetFlap;
+            twin->sendQueue(cmd);                                               // twin is busy, it will catch up on its own
+            continue;
+        }
+        twin->dropQueuedShowFlap();                                             // older targets are superseded by this frame
+        const uint16_t steps = twin->planFrameMove(entry.targetFlap);
+        if (steps == 0) {
+            twin->unlockCommands();                                             // already shown or invalid flap
+            continue;
+        }
+        moves.push_back({idx, entry.targetFlap, steps, 0, 0, false});
+    }
+    if (moves.empty())
+        return 0;
+
+    // 2) all MOVE commands in one bus round
+    #ifdef REGISTRYVERBOSE
+        const uint32_t t0 = millis();                                           // only for the ready trace below
+    #endif
+    if (!takeI2CSemaphore()) {
+        #ifdef ERRORVERBOSE
+            registerPrintln("showFrame: I2C bus busy - frame via twin queues");
+        #endif
+        for (FrameMove& m : moves) {
+            TwinCommand cmd   = {};
+            cmd.twinCommand   = TWIN_SHOW_FLAP;
+            cmd.twinParameter = m.target;
+            Twin[m.idx]->unlockCommands();
+            Twin[m.idx]->sendQueue(cmd);                                        // classic path, one twin after the other
+        }
+        return 0;
+    }
+    for (FrameMove& m : moves)
+        m.sent = Twin[m.idx]->sendFrameMove(m.steps, m.firstPollMs, m.timeoutMs); // bus is held already
+    giveI2CSemaphore();
+
+    // 3) one ready schedule for all moving devices
+    std::vector<ReadyTicket> tickets(moves.size());
+    std::vector<bool>        booked(moves.size(), false);
+    for (size_t i = 0; i < moves.size(); ++i)
+        if (moves[i].sent && ReadyPoll)
+            booked[i] = ReadyPoll->book(Twin[moves[i].idx], tickets[i], moves[i].firstPollMs, moves[i].timeoutMs);
+
+    // 4) read results and release twins
+    int confirmed = 0;
+    for (size_t i = 0; i < moves.size(); ++i) {
+        const bool ready = booked[i] && ReadyPoll->await(tickets[i]);
+        Twin[moves[i].idx]->finishFrameMove(booked[i] ? &tickets[i] : nullptr);
+        Twin[moves[i].idx]->unlockCommands();
+        if (ready)
+            confirmed++;
+    }
+
+    #ifdef REGISTRYVERBOSE
+        registerPrintln("showFrame: %d of %d flaps ready after %u ms", confirmed, (int)moves.size(), (unsigned)(millis() - t0));
+    #endif
+    return confirmed;
+}
+
+/**
+ * @brief hand a display frame to the Frame task, which runs showFrame()
+ *
+ * A frame that was posted before and has not started yet is replaced, only the newest
+ * frame is shown. The caller never waits for moves or ready polls.
+ *
+ * @param frame list of (address, targetFlap)
+ * @return false no Frame task running, frame not taken
+ */
+bool FlapRegistry::postFrame(const std::vector<FlapFrameEntry>& frame) {
+    if (g_frameHandle == nullptr)
+        return false;
+    {
+        RegistryLock lock;
+        _pendingFrame = frame;                                                  // newer frame supersedes a waiting one
+        _framePending = true;
+    }
+    xTaskNotifyGive(g_frameHandle);
+    return true;
+}
+
+/**
+ * @brief take the newest posted frame (Frame task)
+ *
+ * @param frame receives the frame
+ * @return true a frame was pending
+ */
+bool FlapRegistry::takeFrame(std::vector<FlapFrameEntry>& frame) {
+    RegistryLock lock;
+    if (!_framePending)
+        return false;
+    frame.swap(_pendingFrame);
+    _framePending = false;
+    return true;
+}
+
+// ---------------------------------
+
 /**
  * @brief This function is used to repair devices that are out of the address pool.
  * Because no Twin is connected to out of pool addresses -> Twin[0] is used
@@ -591,10 +668,7 @@ void FlapRegistry::repairOutOfPoolDevices() {
         return;                                                                 // if no address is free, repair not possible
     }
     #ifdef SCANVERBOSE
-        {
-        TraceScope trace;
         registerPrintln("Repairing devices out of address pool...");
-        }
     #endif
 
     for (I2Caddress ii = I2C_MINADR + numberOfTwins; ii <= I2C_MAXADR; ii++) {  // iterate over all address out of pool
@@ -603,12 +677,7 @@ void FlapRegistry::repairOutOfPoolDevices() {
             if (nextFreeAddress >= I2C_MINADR && nextFreeAddress <= I2C_MAXADR) { // if address is valide
                 {
                     #ifdef SCANVERBOSE
-                        {
-                        TraceScope trace;
-                        registerPrint("Slave 0x");
-                        Serial.print(ii, HEX);
-                        Serial.println(" is out of address pool, repairing...");
-                        }
+                        registerPrintln("Slave 0x%02X is out of address pool, repairing...", ii);
                     #endif
                 }
                 MidMessage midCmd;                                              // take over new address from command
@@ -617,13 +686,9 @@ void FlapRegistry::repairOutOfPoolDevices() {
                 uint8_t answer[4];
                 Twin[0]->i2cMidCommand(midCmd, ii, answer, sizeof(answer));     // send command to Twin[0] to set new address
 
-                {
-                    TraceScope trace;                                           // use semaphore to protect this block
-                    #ifdef SCANVERBOSE
-                        registerPrint("Out of range slave will now be reset to I2C address: 0x");
-                        Serial.println(nextFreeAddress, HEX);
-                    #endif
-                }
+                #ifdef SCANVERBOSE
+                    registerPrintln("Out of range slave will now be reset to I2C address: 0x%02X", nextFreeAddress);
+                #endif
             }
         }
     }
@@ -644,14 +709,11 @@ void FlapRegistry::registerUnregistered() {
     }
 
     if (nextFreeAddress >= I2C_MINADR && nextFreeAddress <= I2C_MAXADR) {       // if address is valide
-        {
-            TraceScope trace;                                                   // use semaphore to protect this block
-            #ifdef SCANVERBOSE
-                registerPrintln("Check for unregistered slaves to be registered");
-                //    registerPrintln("Send TWIN_NEW_ADDRESS with free I2C Address: 0x");
-                //    Serial.println(nextFreeAddress, HEX);
-            #endif
-        }
+        #ifdef SCANVERBOSE
+            registerPrintln("Check for unregistered slaves to be registered");
+            //    registerPrintln("Send TWIN_NEW_ADDRESS with free I2C Address: 0x");
+            //    Serial.println(nextFreeAddress, HEX);
+        #endif
 
         TwinCommand twinCmd;
         twinCmd.twinCommand   = TWIN_NEW_ADDRESS;                               // set command to send base address
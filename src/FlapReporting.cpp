@@ -36,6 +36,11 @@
 #include "FlapReporting.h"
 #include "FlapRegistry.h"
 #include "Liga.h"
+#include "LigaSession.h"
+#include "LeagueScheduler.h"
+#include "ReadyScheduler.h"
+#include "StatusModel.h"
+#include "LivePush.h"
 
 // Unicode symbols for reports
 const char  FlapReporting::BLOCK_LIGHT[]      = u8"░";
@@ -54,10 +59,7 @@ FlapReporting::FlapReporting() {}
 // trace liga tabelle
 void FlapReporting::reportLigaTable() {
     LigaSnapshot local;
-    {
-        LigaSnapshotLock _lock;                                                 // copy under lock, render outside (short critical section)
-        local = snap[snapshotIndex ^ 1];
-    }
+    ligaSnapshotsOf(activeLeague).read(local);                                  // lock-free copy, the Liga task is never stalled
     renderLigaTable(local);
 };
 
@@ -243,6 +245,7 @@ void FlapReporting::reportI2CStatistic() {
     Serial.printf("│ FLAP I²C STATISTIC AND HISTORY OF LAST MINUTES     Bus-Frequency: %3dkHz    │\n", I2C_MASTER_FREQ_HZ / 1000);
 
     printI2CHistory();                                                          // show history of I2C usage
+    printI2CLatency();                                                          // show latency per message type and module
 
     // Frame finish
     Serial.println("└─────────────────────────────────────────────────────────────────────────────┘");
@@ -250,6 +253,55 @@ void FlapReporting::reportI2CStatistic() {
 
 // -----------------------------------
 
+/**
+ * @brief print I2C latency percentiles
+ *
+ * bus time per message type (all modules), mutex wait and every module with its own rows,
+ * so a slow redraw can be traced to one module, the bus or the semaphore
+ */
+void FlapReporting::printI2CLatency() {
+    static const char* typeName[LAT_TYPES] = {"Long", "Mid", "Short", "Probe (AYR)"};
+    LatencyHistogram   h[LAT_TYPES];
+
+    Serial.println("├─────────────────────────────────────────────────────────────────────────────┤");
+    Serial.println("│ LATENCY [µs]                     count      p50      p95      p99       max │");
+    Serial.println("├─────────────────────────────────────────────────────────────────────────────┤");
+
+    DataEvaluation->latencyByType(h);
+    char label[32];
+    for (int t = 0; t < LAT_TYPES; t++) {
+        snprintf(label, sizeof(label), "all modules %s", typeName[t]);
+        printLatencyRow(label, h[t]);
+    }
+    LatencyHistogram wait;
+    DataEvaluation->mutexWait(wait);
+    printLatencyRow("g_i2c_mutex wait", wait);
+
+    Serial.println("├─────────────────────────────────────────────────────────────────────────────┤");
+    I2Caddress address = 0;
+    for (int slot = 0; DataEvaluation->latencyBySlot(slot, address, h); slot++) {
+        for (int t = 0; t < LAT_TYPES; t++) {
+            if (h[t].count == 0)
+                continue;
+            snprintf(label, sizeof(label), "0x%02X %s", address, typeName[t]);
+            printLatencyRow(label, h[t]);
+        }
+    }
+}
+
+/**
+ * @brief one row of latency table
+ *
+ * @param label row title
+ * @param h histogram
+ */
+void FlapReporting::printLatencyRow(const char* label, const LatencyHistogram& h) {
+    Serial.printf("│ %-29s%9lu%9lu%9lu%9lu%10lu │\n", label, (unsigned long)h.count, (unsigned long)h.percentile(50), (unsigned long)h.percentile(95),
+                  (unsigned long)h.percentile(99), (unsigned long)h.maxUs);
+}
+
+// -----------------------------------
+
 /**
  * @brief return maxiumum value in history cycle
  *
@@ -278,6 +330,7 @@ void FlapReporting::printI2CHistory() {
     if (barSpace < 0)
         barSpace = 0;
 
+    DataEvaluation->updateCurrentCycle();                                       // minute 0 = running cycle
     uint32_t maxAccess = maxValueFromHistory(DataEvaluation->_accessHistory);
     uint32_t maxSend   = maxValueFromHistory(DataEvaluation->_dataHistory);
     uint32_t maxRead   = maxValueFromHistory(DataEvaluation->_readHistory);
@@ -424,6 +477,15 @@ void FlapReporting::reportRtosTasks() {
     if (g_statisticHandle != nullptr)
         printTaskInfo(pcTaskGetName(g_statisticHandle), uxTaskGetStackHighWaterMark(g_statisticHandle), STACK_STATISTICS, PRIO_STATISTICS);
 
+    if (g_traceLogHandle != nullptr)
+        printTaskInfo(pcTaskGetName(g_traceLogHandle), uxTaskGetStackHighWaterMark(g_traceLogHandle), STACK_TRACE, PRIO_TRACE);
+
+    if (g_livePushHandle != nullptr)
+        printTaskInfo(pcTaskGetName(g_livePushHandle), uxTaskGetStackHighWaterMark(g_livePushHandle), STACK_PUSH, PRIO_PUSH);
+
+    if (g_frameHandle != nullptr)
+        printTaskInfo(pcTaskGetName(g_frameHandle), uxTaskGetStackHighWaterMark(g_frameHandle), STACK_FRAME, PRIO_FRAME);
+
     Serial.println("╚════════════════════════════════════════════════════════════════════════════╝");
 }
 // rechts auffüllen
@@ -542,15 +604,13 @@ uint32_t FlapReporting::getNextAvailabilityRemainingMs() {
 /**
  * @brief Milliseconds remaining until the next scheduled Liga scan.
  *
- * Uses the timer's absolute expiry tick and a signed delta to be safe across
- * tick wraparound. Returns 0 if the timer is inactive or overdue.
+ * Due time of the shown league in the LeagueScheduler, signed delta to be safe
+ * across tick wraparound. Returns 0 if the scan is overdue.
  *
  * @return uint32_t  Remaining time in milliseconds (0 if none).
  */
 uint32_t FlapReporting::getNextLigaScanRemainingMs() {
-    // Quick outs: no timer or not active → no countdown
-    uint32_t now       = millis();
-    int32_t  remaining = (int32_t)(pollManagerStartOfWaiting + pollManagerDynamicWait - now);  // signed Delta (tick-wrap-sicher)
+    int32_t remaining = ligaLeagues.dueInMs(activeLeague);                      // signed Delta (tick-wrap-sicher)
 
     if (remaining < 0)
         remaining = 0;                                                          // schon abgelaufen -> kein Countdown
@@ -573,8 +633,7 @@ void FlapReporting::printUptime() {
     uint32_t minutes = (totalSeconds % 3600) / 60;
     uint32_t seconds = totalSeconds % 60;
 
-    reportPrint("  Uptime:     ");
-    Serial.printf("%u Tage, %02u:%02u:%02u\n", days, hours, minutes, seconds);
+    reportPrintln("  Uptime:     %u Tage, %02u:%02u:%02u", days, hours, minutes, seconds);
 }
 
 void FlapReporting::reportMemory() {
@@ -840,11 +899,47 @@ void FlapReporting::createPollStatusJson() {
     poll["mode"]    = pollModeToString(currentPollMode);
     poll["scope"]   = pollScopeToString(currentPollScope);
 
+    JsonObject cache = poll["cache"].to<JsonObject>();                          // conditional GET per PollScope
+    for (int i = 0; i < POLL_SCOPE_COUNT; ++i) {
+        if (pollCacheHits[i] + pollCacheMisses[i] == 0)
+            continue;                                                           // scope without payload requests
+        JsonObject c = cache[pollScopeToString((PollScope)i)].to<JsonObject>();
+        c["hits"]    = pollCacheHits[i];
+        c["misses"]  = pollCacheMisses[i];
+    }
+
     JsonObject league  = report["league"].to<JsonObject>();
     league["name"]     = leagueName(activeLeague);
     league["season"]   = ligaSeason;
     league["matchday"] = ligaMatchday;
 
+    JsonArray leagues = report["leagues"].to<JsonArray>();                      // all leagues of the Liga task
+    for (uint8_t i = 0; i < LEAGUE_COUNT; ++i) {
+        const League lg = (League)(i + 1);
+        if (!ligaLeagues.tracked(lg) && lg != activeLeague)
+            continue;
+        JsonObject l  = leagues.add<JsonObject>();
+        l["name"]     = leagueShortcut(lg);
+        l["mode"]     = pollModeToString(ligaLeagues.pollMode(lg));
+        l["dueInMs"]  = ligaLeagues.dueInMs(lg);
+        l["cycles"]   = ligaLeagues.cycles(lg);
+        l["requests"] = ligaLeagues.requests(lg);
+    }
+    league["postponed"] = ligaLeagues.postponed();                              // cycles behind the shown-league reserve
+
+    JsonObject http     = report["http"].to<JsonObject>();                      // persistent openLigaDB session
+    http["requests"]    = openLigaDB.requests();
+    http["handshakes"]  = openLigaDB.handshakes();
+    http["errors"]      = openLigaDB.errors();
+    http["lastMs"]      = openLigaDB.lastRequestMs();
+    http["maxMs"]       = openLigaDB.maxRequestMs();
+    http["notModified"] = openLigaDB.notModified();
+    http["paceMs"]      = openLigaDB.pacer().intervalMs();                      // current request budget
+    http["burst"]       = openLigaDB.pacer().burst();
+    http["throttled"]   = openLigaDB.pacer().throttled();
+    http["waitedMs"]    = openLigaDB.pacer().waitedMs();
+    http["refusals"]    = openLigaDB.pacer().refusals();
+
     // --- Live Matches + Goals ---
     JsonArray live = report["liveMatches"].to<JsonArray>();
     for (int i = 0; i < ligaLiveMatchCount; ++i) {
@@ -885,8 +980,11 @@ void FlapReporting::createPollStatusJson() {
         pm["kickoff"] = formatIsoTime(planMatches[i].kickoff);
     }
 
-    // --- Speichern ---
-    Store->saveFile("/PollStatus.json", doc);
+    // --- Veröffentlichen (RAM) und Speichern (SPIFFS) ---
+    JsonDocument finalDoc;
+    Store->composeFile("/PollStatus.json", doc, finalDoc);
+    PollStatusDoc.publish(finalDoc);                                            // /2 is served from RAM
+    Store->writeFile("/PollStatus.json", finalDoc);                             // persistence only
 
     #ifdef LIGAVERBOSE
         Liga->ligaPrintln("PollStatus.json created (%u bytes used)", (unsigned)measureJson(doc));
@@ -941,6 +1039,9 @@ String formatIsoTime(time_t t) {
  *
  */
 void FlapReporting::reportPollStatus() {
+    LeagueViewLock view;                                                        // globals of the shown league only
+    if (!view)
+        return;                                                                 // Liga task polls another league, next report
     createPollStatusJson();
 
     char liga[32];
@@ -958,6 +1059,7 @@ void FlapReporting::reportPollStatus() {
                   pollScopeToString(currentPollScope));
     Serial.println("├──────────────────┼──────────────────────────┼──────────────────┼──────────────────────────┤");
     Serial.printf("│ active League    │ %s            │ Season/Matchday  │ %4d/%2d                  │\n", liga, ligaSeason, ligaMatchday);
+    Serial.printf("│ HTTP Requests    │ %-24u │ TLS Handshakes   │ %-24u │\n", openLigaDB.requests(), openLigaDB.handshakes());
 
     if (ligaLiveMatchCount > 0)
         Serial.println("├──────────────────┼──────────────────────────┼──────────────────┼──────────────────────────┤");
@@ -1123,53 +1225,90 @@ void FlapReporting::createTaskStatusJson() {
         doc["Next OpenLiga scan in"] = buf;
     }
 
-    Store->saveFile("/TaskStatus.json", doc);
-}
-
-// -----------------------------
-
-/**
- * @brief render flat JSON file as html
- *
- */
-void sendStatusHtmlStream(const char* filename) {
-    #pragma GCC diagnostic push
-    #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-    DynamicJsonDocument doc(1024);
-    #pragma GCC diagnostic pop
-
-    if (!Store->readFile(filename, doc))
-        return;
-
-    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
-    server.send(200, "text/html; charset=UTF-8", "");
+    // Twin command queues (sum over all twins)
+    uint32_t queued = 0, coalesced = 0, dropped = 0;
+    uint8_t  maxDepth = 0;
+    for (int i = 0; i < numberOfTwins; ++i) {
+        if (!Twin[i])
+            continue;
+        queued += Twin[i]->queueCommands();
+        coalesced += Twin[i]->queueCoalesced();
+        dropped += Twin[i]->queueDropped();
+        maxDepth = max(maxDepth, Twin[i]->queueMaxDepth());
+    }
+    char queueBuf[48];
+    snprintf(queueBuf, sizeof(queueBuf), "%lu (merged %lu)", (unsigned long)queued, (unsigned long)coalesced);
+    doc["Twin commands"] = queueBuf;
+    snprintf(queueBuf, sizeof(queueBuf), "%lu (max. depth %u/%u)", (unsigned long)dropped, maxDepth, TWIN_QUEUE_DEPTH);
+    doc["Twin commands dropped"] = queueBuf;
+
+    // I2C latency (p50/p95/p99 in µs)
+    if (DataEvaluation) {
+        static const char* latencyKey[LAT_TYPES] = {"I2C Long p50/p95/p99", "I2C Mid p50/p95/p99", "I2C Short p50/p95/p99", "I2C Probe p50/p95/p99"};
+        LatencyHistogram   h[LAT_TYPES];
+        DataEvaluation->latencyByType(h);
+        for (int t = 0; t < LAT_TYPES; t++) {
+            snprintf(queueBuf, sizeof(queueBuf), "%lu/%lu/%lu µs (%lu)", (unsigned long)h[t].percentile(50), (unsigned long)h[t].percentile(95),
+                     (unsigned long)h[t].percentile(99), (unsigned long)h[t].count);
+            doc[latencyKey[t]] = queueBuf;
+        }
+        LatencyHistogram wait;
+        DataEvaluation->mutexWait(wait);
+        snprintf(queueBuf, sizeof(queueBuf), "%lu/%lu/%lu µs", (unsigned long)wait.percentile(50), (unsigned long)wait.percentile(95),
+                 (unsigned long)wait.percentile(99));
+        doc["I2C mutex wait p50/p95/p99"] = queueBuf;
+
+        I2Caddress address = 0, slowest = 0;                                    // module with the worst p99 of any message type
+        uint32_t   slowestP99 = 0;
+        for (int slot = 0; DataEvaluation->latencyBySlot(slot, address, h); slot++)
+            for (int t = 0; t < LAT_TYPES; t++)
+                if (h[t].percentile(99) > slowestP99) {
+                    slowestP99 = h[t].percentile(99);
+                    slowest    = address;
+                }
+        if (slowest != 0) {
+            snprintf(queueBuf, sizeof(queueBuf), "0x%02X p99 %lu µs", slowest, (unsigned long)slowestP99);
+            doc["I2C slowest module"] = queueBuf;
+        }
+    }
 
-    server.sendContent(
-        "<!DOCTYPE html><html><head><meta charset='UTF-8'>"
-        "<title>FLAP Task Status</title>"
-        "<style>body{font-family:monospace; background:#f5f5f5; white-space:pre;}</style>"
-        "</head><body>\n");
+    // shared ARE_YOU_READY scheduler
+    if (ReadyPoll) {
+        snprintf(queueBuf, sizeof(queueBuf), "%lu (ready %lu, timeout %lu)", (unsigned long)ReadyPoll->probes(), (unsigned long)ReadyPoll->readyCount(),
+                 (unsigned long)ReadyPoll->timeouts());
+        doc["AYR probes"] = queueBuf;
+        snprintf(queueBuf, sizeof(queueBuf), "%lu ms", (unsigned long)ReadyPoll->maxLateMs());
+        doc["AYR max. late"] = queueBuf;
+    }
 
-    char line[128];
-    bool headerPrinted = false;
+    // push channel /events
+    if (Push) {
+        snprintf(queueBuf, sizeof(queueBuf), "%lu (events %lu, dropped %lu)", (unsigned long)Push->subscribers(), (unsigned long)Push->messages(),
+                 (unsigned long)Push->dropped());
+        doc["Push subscribers"] = queueBuf;
+    }
 
-    for (JsonPair kv : doc.as<JsonObject>()) {
-        const char* key   = kv.key().c_str();
-        const char* value = kv.value().as<const char*>();
-
-        if (strcmp(key, "report") == 0) {
-            snprintf(line, sizeof(line), "%s\n=======================\n", value);
-            server.sendContent(line);
-            headerPrinted = true;
-        } else {
-            snprintf(line, sizeof(line), "%-24s %s\n", key, value);
-            server.sendContent(line);
-        }
+    // web requests (handler time in the AsyncTCP task)
+    {
+        LatencyHistogram web;
+        g_webLatency.copyTo(web);
+        snprintf(queueBuf, sizeof(queueBuf), "%lu/%lu/%lu µs (%lu)", (unsigned long)web.percentile(50), (unsigned long)web.percentile(95),
+                 (unsigned long)web.percentile(99), (unsigned long)web.count);
+        doc["Web p50/p95/p99"] = queueBuf;
     }
 
-    if (!headerPrinted)
-        server.sendContent("=======================\n");
+    // asynchronous trace
+    snprintf(queueBuf, sizeof(queueBuf), "%lu (dropped %lu)", (unsigned long)traceWritten(), (unsigned long)traceDropped());
+    doc["Trace lines"] = queueBuf;
+
+    // in-memory status documents
+    snprintf(queueBuf, sizeof(queueBuf), "v%lu (%lu/%lu 304) / v%lu (%lu 304)", (unsigned long)TaskStatusDoc.version(),
+             (unsigned long)TaskStatusDoc.served(), (unsigned long)TaskStatusDoc.notModified(), (unsigned long)PollStatusDoc.version(),
+             (unsigned long)PollStatusDoc.notModified());
+    doc["Status task/poll"] = queueBuf;
 
-    server.sendContent("</body></html>");
-    server.sendContent("");
+    JsonDocument finalDoc;
+    Store->composeFile("/TaskStatus.json", doc, finalDoc);
+    TaskStatusDoc.publish(finalDoc);                                            // /1 and /status are served from RAM
+    Store->writeFile("/TaskStatus.json", finalDoc);                             // persistence only
 }
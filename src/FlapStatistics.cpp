@@ -42,10 +42,12 @@ FlapStatistics::FlapStatistics() {
         #endif
     }
 
-    _busAccessCounter  = 0;                                                     // init statistic counter
-    _busDataCounter    = 0;                                                     // init statistic counter
-    _busReadCounter    = 0;                                                     // init statistic counter
-    _busTimeoutCounter = 0;                                                     // init statistic counter
+    for (int c = 0; c < STAT_SHARDS; c++) {
+        _shard[c].access.store(0);                                              // init statistic counter
+        _shard[c].sentData.store(0);                                            // init statistic counter
+        _shard[c].readData.store(0);                                            // init statistic counter
+        _shard[c].timeOut.store(0);                                             // init statistic counter
+    }
     for (int h = 0; h < HISTORY_SIZE; h++) {
         _accessHistory[h]  = 0;                                                 // init statistic counter
         _dataHistory[h]    = 0;                                                 // init statistic counter
@@ -54,46 +56,93 @@ FlapStatistics::FlapStatistics() {
     }
 
     _historyIndex = 0;                                                          // init statistic index
+
+    for (int a = 0; a < LATENCY_ADDRESSES; a++) {
+        _latencyAddress[a].store(0);
+        for (int t = 0; t < LAT_TYPES; t++)
+            _latency[a][t].clear();
+    }
+    _mutexWait.clear();
 };
 
 // -------------------------------------------------------------------------
 
 /**
- * @brief every data collect cycle transfer statisic counter to histery and switch histery index
+ * @brief every data collect cycle sum up the shards into history and switch history index
  *
  */
 void FlapStatistics::makeHistory() {
+    uint32_t access, sentData, readData, timeOut;
     xSemaphoreTake(_statsMutex, portMAX_DELAY);
+    sumShards(access, sentData, readData, timeOut, true);                       // take and reset counters of all cores
 
     #ifdef STATISTICVERBOSE
-        TraceScope trace;                                                       // use semaphore to protect this block
         {
-        masterPrint("I²C statistic cycle - access: ");
-        Serial.print(_busAccessCounter);
-        Serial.print(" send: ");
-        Serial.print(_busDataCounter);
-        Serial.print(" read: ");
-        Serial.println(_busReadCounter);
+        TraceScope trace;                                                       // use semaphore to protect this block
+        masterPrintln("I²C statistic cycle - access: %u send: %u read: %u", (unsigned)access, (unsigned)sentData,
+                      (unsigned)readData);
         }
     #endif
 
-    _accessHistory[_historyIndex]  = _busAccessCounter;                         // transfer counter to history
-    _dataHistory[_historyIndex]    = _busDataCounter;                           // transfer counter to history
-    _readHistory[_historyIndex]    = _busReadCounter;                           // transfer counter to history
-    _timeoutHistory[_historyIndex] = _busTimeoutCounter;                        // transfer counter to history
-    _busAccessCounter              = 0;                                         // reset counter for counting in next cycle
-    _busDataCounter                = 0;                                         // reset counter for counting in next cycle
-    _busReadCounter                = 0;                                         // reset counter for counting in next cycle
-    _busTimeoutCounter             = 0;                                         // reset counter for counting in next cycle
+    _accessHistory[_historyIndex]  = access;                                    // transfer counter to history
+    _dataHistory[_historyIndex]    = sentData;                                  // transfer counter to history
+    _readHistory[_historyIndex]    = readData;                                  // transfer counter to history
+    _timeoutHistory[_historyIndex] = timeOut;                                   // transfer counter to history
 
-    _historyIndex = (_historyIndex + 1) % HISTORY_SIZE;                         // round robin for history index
+    _historyIndex                  = (_historyIndex + 1) % HISTORY_SIZE;        // round robin for history index
+    _accessHistory[_historyIndex]  = 0;                                         // next cycle starts empty
+    _dataHistory[_historyIndex]    = 0;                                         // next cycle starts empty
+    _readHistory[_historyIndex]    = 0;                                         // next cycle starts empty
+    _timeoutHistory[_historyIndex] = 0;                                         // next cycle starts empty
+    xSemaphoreGive(_statsMutex);
+}
+
+// ----------------------------
+
+/**
+ * @brief show counters of the running cycle in history (for reporting, counters are not reset)
+ *
+ */
+void FlapStatistics::updateCurrentCycle() {
+    uint32_t access, sentData, readData, timeOut;
+    xSemaphoreTake(_statsMutex, portMAX_DELAY);
+    sumShards(access, sentData, readData, timeOut, false);
+    _accessHistory[_historyIndex]  = access;                                    // actualize history of current cycle
+    _dataHistory[_historyIndex]    = sentData;                                  // actualize history of current cycle
+    _readHistory[_historyIndex]    = readData;                                  // actualize history of current cycle
+    _timeoutHistory[_historyIndex] = timeOut;                                   // actualize history of current cycle
     xSemaphoreGive(_statsMutex);
 }
 
 // ----------------------------
 
 /**
- * @brief Helper to actualize statistics protected by semaphores
+ * @brief sum up counters of all cores
+ *
+ * @param reset true = take counters for a new cycle (exchange with 0)
+ */
+void FlapStatistics::sumShards(uint32_t& access, uint32_t& sentData, uint32_t& readData, uint32_t& timeOut, bool reset) {
+    access = sentData = readData = timeOut = 0;
+    for (int c = 0; c < STAT_SHARDS; c++) {
+        StatShard& shard = _shard[c];
+        if (reset) {
+            access += shard.access.exchange(0, std::memory_order_relaxed);
+            sentData += shard.sentData.exchange(0, std::memory_order_relaxed);
+            readData += shard.readData.exchange(0, std::memory_order_relaxed);
+            timeOut += shard.timeOut.exchange(0, std::memory_order_relaxed);
+        } else {
+            access += shard.access.load(std::memory_order_relaxed);
+            sentData += shard.sentData.load(std::memory_order_relaxed);
+            readData += shard.readData.load(std::memory_order_relaxed);
+            timeOut += shard.timeOut.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+// ----------------------------
+
+/**
+ * @brief count I2C usage on the shard of the calling core, no semaphore
  *
  * @param access couter for i2c accesses
  * @param sentData number of byte send by master via i2c
@@ -101,26 +150,214 @@ void FlapStatistics::makeHistory() {
  * @param timeOut number of timeouts
  */
 void FlapStatistics::increment(uint32_t access, uint32_t sentData, uint32_t readData, uint32_t timeOut) {
-    xSemaphoreTake(_statsMutex, portMAX_DELAY);
-    _busAccessCounter += access;                                                // count
-    _busDataCounter += sentData;                                                // count
-    _busReadCounter += readData;                                                // count
-    _busTimeoutCounter += timeOut;                                              // count
-    _accessHistory[_historyIndex]  = _busAccessCounter;                         // actualize history of current cycle
-    _dataHistory[_historyIndex]    = _busDataCounter;                           // actualize history of current cycle
-    _readHistory[_historyIndex]    = _busReadCounter;                           // actualize history of current cycle
-    _timeoutHistory[_historyIndex] = _busTimeoutCounter;                        // actualize history of current cycle
-    xSemaphoreGive(_statsMutex);
+    StatShard& shard = _shard[xPortGetCoreID() % STAT_SHARDS];
+    if (access)
+        shard.access.fetch_add(access, std::memory_order_relaxed);              // count
+    if (sentData)
+        shard.sentData.fetch_add(sentData, std::memory_order_relaxed);          // count
+    if (readData)
+        shard.readData.fetch_add(readData, std::memory_order_relaxed);          // count
+    if (timeOut)
+        shard.timeOut.fetch_add(timeOut, std::memory_order_relaxed);            // count
 
     #ifdef STATISTICVERBOSE
-        TraceScope trace;                                                       // use semaphore to protect this block
         {
-        masterPrint("I²C statistic increment - access: ");
-        Serial.print(_busAccessCounter);
-        Serial.print(" send: ");
-        Serial.print(_busDataCounter);
-        Serial.print(" read: ");
-        Serial.println(_busReadCounter);
+        TraceScope trace;                                                       // use semaphore to protect this block
+        masterPrintln("I²C statistic increment - access: %u send: %u read: %u", (unsigned)access, (unsigned)sentData,
+                      (unsigned)readData);
         }
     #endif
 }
+
+// ----------------------------
+
+/**
+ * @brief count bus time of one I2C transaction
+ *
+ * The first LATENCY_ADDRESSES addresses get an own slot, further addresses are not recorded.
+ * A slot is claimed once with compare-exchange, afterwards only its twin writes to it.
+ *
+ * @param address slave address
+ * @param type kind of message
+ * @param us time of i2c_master_cmd_begin in µs
+ */
+void FlapStatistics::recordLatency(I2Caddress address, I2CLatencyType type, uint32_t us) {
+    if (type >= LAT_TYPES || address == 0)
+        return;
+    for (int a = 0; a < LATENCY_ADDRESSES; a++) {
+        uint32_t slotAddress = _latencyAddress[a].load(std::memory_order_acquire);
+        if (slotAddress == 0) {
+            uint32_t expected = 0;                                              // first transaction of this address
+            _latencyAddress[a].compare_exchange_strong(expected, address, std::memory_order_acq_rel);
+            slotAddress = _latencyAddress[a].load(std::memory_order_acquire);   // own address or the one of a faster task
+        }
+        if (slotAddress == address) {
+            _latency[a][type].add(us);
+            break;
+        }
+    }
+}
+
+// ----------------------------
+
+/**
+ * @brief count wait time for g_i2c_mutex
+ *
+ * @param us time until the semaphore was taken (or given up) in µs
+ */
+void FlapStatistics::recordMutexWait(uint32_t us) {
+    _mutexWait.add(us);
+}
+
+// ----------------------------
+
+/**
+ * @brief copy histograms of one address slot
+ *
+ * @param slot 0..LATENCY_ADDRESSES-1
+ * @param address address of slot
+ * @param out histograms per message type
+ * @return true slot is used
+ */
+bool FlapStatistics::latencyBySlot(int slot, I2Caddress& address, LatencyHistogram out[LAT_TYPES]) {
+    if (slot < 0 || slot >= LATENCY_ADDRESSES)
+        return false;
+    address = (I2Caddress)_latencyAddress[slot].load(std::memory_order_acquire);
+    for (int t = 0; t < LAT_TYPES; t++)
+        _latency[slot][t].copyTo(out[t]);
+    return address != 0;
+}
+
+// ----------------------------
+
+/**
+ * @brief copy histograms per message type, all addresses merged
+ *
+ * @param out histograms per message type
+ */
+void FlapStatistics::latencyByType(LatencyHistogram out[LAT_TYPES]) {
+    for (int t = 0; t < LAT_TYPES; t++)
+        out[t].clear();
+    LatencyHistogram h;
+    for (int a = 0; a < LATENCY_ADDRESSES && _latencyAddress[a].load(std::memory_order_acquire) != 0; a++)
+        for (int t = 0; t < LAT_TYPES; t++) {
+            _latency[a][t].copyTo(h);
+            out[t].merge(h);
+        }
+}
+
+// ----------------------------
+
+void FlapStatistics::mutexWait(LatencyHistogram& out) {
+    _mutexWait.copyTo(out);
+}
+
+// -------------------------------------------------------------------------
+// LatencyHistogram
+
+void LatencyHistogram::clear() {
+    for (int b = 0; b < LATENCY_BUCKETS; b++)
+        bucket[b] = 0;
+    count = 0;
+    maxUs = 0;
+}
+
+/**
+ * @brief count one value into its log2 bucket
+ *
+ * @param us latency in µs
+ */
+void LatencyHistogram::add(uint32_t us) {
+    bucket[bucketOf(us)]++;
+    count++;
+    if (us > maxUs)
+        maxUs = us;
+}
+
+/**
+ * @brief log2 bucket of a latency
+ *
+ * @param us latency in µs
+ * @return uint8_t 0..LATENCY_BUCKETS-1
+ */
+uint8_t LatencyHistogram::bucketOf(uint32_t us) {
+    if (us < LATENCY_FIRST_BUCKET_US)
+        return 0;
+    int b = (31 - __builtin_clz(us)) - 6;                                       // 128..255 µs -> 1, 256..511 µs -> 2, ...
+    return (b >= LATENCY_BUCKETS) ? LATENCY_BUCKETS - 1 : b;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (int b = 0; b < LATENCY_BUCKETS; b++)
+        bucket[b] += other.bucket[b];
+    count += other.count;
+    if (other.maxUs > maxUs)
+        maxUs = other.maxUs;
+}
+
+/**
+ * @brief estimate percentile, linear inside the bucket
+ *
+ * @param p percentile 1..100
+ * @return uint32_t latency in µs, 0 if empty
+ */
+uint32_t LatencyHistogram::percentile(uint8_t p) const {
+    if (count == 0)
+        return 0;
+    const uint32_t rank = (uint32_t)(((uint64_t)count * p + 99) / 100);        // 1-based rank of percentile
+    uint32_t       seen = 0;
+    for (int b = 0; b < LATENCY_BUCKETS; b++) {
+        if (bucket[b] == 0)
+            continue;
+        if (seen + bucket[b] >= rank) {
+            const uint32_t lo = (b == 0) ? 0 : (LATENCY_FIRST_BUCKET_US << (b - 1));
+            uint32_t       hi = (b == LATENCY_BUCKETS - 1) ? maxUs : (LATENCY_FIRST_BUCKET_US << b);
+            if (hi > maxUs)
+                hi = maxUs;                                                     // never above the slowest value seen
+            if (hi < lo)
+                return hi;
+            return lo + (uint32_t)((uint64_t)(hi - lo) * (rank - seen) / bucket[b]);
+        }
+        seen += bucket[b];
+    }
+    return maxUs;
+}
+
+// -------------------------------------------------------------------------
+// AtomicLatencyHistogram
+
+void AtomicLatencyHistogram::clear() {
+    for (int b = 0; b < LATENCY_BUCKETS; b++)
+        bucket[b].store(0);
+    maxUs.store(0);
+}
+
+/**
+ * @brief count one value into its log2 bucket, no semaphore
+ *
+ * @param us latency in µs
+ */
+void AtomicLatencyHistogram::add(uint32_t us) {
+    bucket[LatencyHistogram::bucketOf(us)].fetch_add(1, std::memory_order_relaxed);
+    uint32_t seen = maxUs.load(std::memory_order_relaxed);
+    while (us > seen && !maxUs.compare_exchange_weak(seen, us, std::memory_order_relaxed)) {
+    }                                                                           // seen is reloaded on failure
+}
+
+/**
+ * @brief copy for reporting
+ *
+ * Not a snapshot, transactions may be counted during the copy. count is the sum of the
+ * copied buckets, so percentile() never looks for a rank that is not in the buckets.
+ *
+ * @param out plain histogram
+ */
+void AtomicLatencyHistogram::copyTo(LatencyHistogram& out) const {
+    uint32_t sum = 0;
+    for (int b = 0; b < LATENCY_BUCKETS; b++) {
+        out.bucket[b] = bucket[b].load(std::memory_order_relaxed);
+        sum += out.bucket[b];
+    }
+    out.count = sum;                                                            // count that matches the copied buckets
+    out.maxUs = maxUs.load(std::memory_order_relaxed);
+}
@@ -23,9 +23,12 @@
 #include "FlapTasks.h"
 #include "FlapRegistry.h"
 #include "MasterPrint.h"
+#include "ReadyScheduler.h"
+#include "LivePush.h"
 
 // Global WEb Server
-WebServer server(80);                                                           // ESP32 Web Server at Port 80
+AsyncWebServer         server(80);                                              // ESP32 Web Server at Port 80, served by AsyncTCP
+AtomicLatencyHistogram g_webLatency;                                            // zero initialized as global
 
 // Global defines for RTOS task handles
 TaskHandle_t g_remoteControlHandle = nullptr;                                   // Task handlers https://www.freertos.org/a00019.html#xTaskHandle
@@ -37,6 +40,10 @@ TaskHandle_t g_availCheckHandle    = nullptr;
 TaskHandle_t g_reportHandle        = nullptr;
 TaskHandle_t g_statisticHandle     = nullptr;
 TaskHandle_t g_twinHandle[numberOfTwins];
+TaskHandle_t g_readyPollHandle = nullptr;
+TaskHandle_t g_traceLogHandle  = nullptr;
+TaskHandle_t g_livePushHandle  = nullptr;
+TaskHandle_t g_frameHandle     = nullptr;
 
 // Global defines for RTOS Queue handles
 QueueHandle_t g_reportQueue = nullptr;
@@ -50,6 +57,8 @@ FlapRegistry*   Register       = nullptr;
 FlapStatistics* DataEvaluation = nullptr;                                       // Object for Statistics Task
 FlapFile*       Store          = nullptr;                                       // Object for FlapFile
 FlapTask*       Master         = nullptr;
+ReadyScheduler* ReadyPoll      = nullptr;                                       // shared ARE_YOU_READY scheduler
+LivePush*       Push           = nullptr;                                       // push channel /events (SSE)
 
 // Global Timer-Handles
 TimerHandle_t regiScanTimer   = nullptr;
@@ -69,8 +78,7 @@ scanModes g_scanMode = NO_SCAN;
 void FlapTask::systemHalt(const char* reason, int blinkCode) {
     masterPrintln("===================================");
     masterPrintln("🛑 SYSTEM HALTED!");
-    masterPrint("reason: ");
-    Serial.println(reason);
+    masterPrintln("reason: %s", reason);
     masterPrintln("===================================");
 
     #ifdef LED_BUILTIN
@@ -94,8 +102,7 @@ void FlapTask::systemHalt(const char* reason, int blinkCode) {
         #endif
         TraceScope trace;                                                       // use semaphore to protect
         {
-            masterPrint("System halt reason: ");                                // regelmäßige Konsolenmeldung
-            Serial.println(reason);
+            masterPrintln("System halt reason: %s", reason);                    // regelmäßige Konsolenmeldung
         }
         vTaskDelay(pdMS_TO_TICKS(5000));                                        // Delay for 5s
     }
@@ -123,14 +130,8 @@ void regiScanCallback(TimerHandle_t xTimer) {
     #ifdef REGISTRYVERBOSE
         {
         TraceScope trace;
-        Register->registerPrint("========== Registry I²C Scan = ");
-        if (g_scanMode == SCAN_SHORT)
-        Serial.print("SHORT");
-        if (g_scanMode == SCAN_LONG)
-        Serial.print("LONG");
-        if (g_scanMode == SCAN_FAST)
-        Serial.print("FAST");
-        Serial.println(" ===========");
+        const char* mode = (g_scanMode == SCAN_SHORT) ? "SHORT" : (g_scanMode == SCAN_LONG) ? "LONG" : (g_scanMode == SCAN_FAST) ? "FAST" : "";
+        Register->registerPrintln("========== Registry I²C Scan = %s ===========", mode);
         }
     #endif
     Register->registerDevice();
@@ -200,3 +201,21 @@ void availCheckTask(void* pvParameters) {
         }
     }
 }
+
+// ----------------------------
+
+/**
+ * @brief Frame worker task. Triggered by FlapRegistry::postFrame via task notification, it runs the
+ * display frame with all its ready waits, so the Parser returns at once and keeps reading keys.
+ * A frame posted while one is running replaces any waiting frame and runs next.
+ *
+ * @param pvParameters Unused (FreeRTOS task prototype requirement).
+ */
+void frameTask(void* pvParameters) {
+    std::vector<FlapFrameEntry> frame;
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);                                // wait for a frame from postFrame
+        while (Register->takeFrame(frame))
+            Register->showFrame(frame);
+    }
+}
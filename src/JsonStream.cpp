@@ -0,0 +1,373 @@
+// #################################################################################################################
+//
+//       ██ ███████  ██████  ███    ██     ███████ ████████ ██████  ███████  █████  ███    ███
+//       ██ ██      ██    ██ ████   ██     ██         ██    ██   ██ ██      ██   ██ ████  ████
+//       ██ ███████ ██    ██ ██ ██  ██     ███████    ██    ██████  █████   ███████ ██ ████ ██
+//  ██   ██      ██ ██    ██ ██  ██ ██          ██    ██    ██   ██ ██      ██   ██ ██  ██  ██
+//   █████  ███████  ██████  ██   ████     ███████    ██    ██   ██ ███████ ██   ██ ██      ██
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Json%20Stream
+//
+/*
+
+    Incremental JSON parser for chunked HTTP bodies (openLigaDB)
+
+    One character at a time through a small state machine; a stack of JSON_STREAM_MAX_DEPTH
+    levels remembers the current member name or array index of every open object/array.
+
+*/
+#include "JsonStream.h"
+
+// ----------------------------
+
+/**
+ * @brief reset parser for a new HTTP body
+ *
+ * @param handler called for every value and every begin/end of object and array
+ * @param context passed through to handler
+ */
+void JsonStream::begin(JsonStreamHandler handler, void* context) {
+    _handler   = handler;
+    _context   = context;
+    _state     = VALUE;
+    _depth     = 0;
+    _len       = 0;
+    _bytes     = 0;
+    _isKey     = false;
+    _isString  = false;
+    _truncated = false;
+    _surrogate = 0;
+    _value[0]  = '\0';
+}
+
+// ----------------------------
+
+/**
+ * @brief parse next chunk of body
+ *
+ * @param data chunk, need not end at a token boundary
+ * @param len length of chunk
+ * @return true chunk accepted
+ * @return false syntax error (now or before), further chunks are ignored
+ */
+bool JsonStream::feed(const char* data, size_t len) {
+    if (_state == ERROR)
+        return false;
+    for (size_t i = 0; i < len; i++) {
+        _bytes++;
+        if (!parse(data[i])) {
+            _state = ERROR;
+            return false;
+        }
+    }
+    return true;
+}
+
+// ----------------------------
+
+/**
+ * @brief end of body
+ *
+ * a number as root value has no terminating character, so it is reported here
+ *
+ * @return true exactly one complete JSON value was parsed
+ */
+bool JsonStream::finish() {
+    if (_state == LITERAL && _depth == 0)
+        valueDone();
+    return _state == DONE;
+}
+
+// ----------------------------
+bool JsonStream::parse(char c) {
+    switch (_state) {
+        case STRING:
+            if (c == '"') {
+                if (_isKey) {
+                    _isKey = false;
+                    _state = COLON;
+                } else {
+                    _isString = true;
+                    valueDone();
+                }
+            } else if (c == '\\') {
+                _state = ESCAPE;
+            } else {
+                append(c);
+            }
+            return true;
+
+        case ESCAPE:
+            _state = STRING;
+            switch (c) {
+                case 'n':
+                    append('\n');
+                    break;
+                case 't':
+                    append('\t');
+                    break;
+                case 'r':
+                    append('\r');
+                    break;
+                case 'b':
+                    append('\b');
+                    break;
+                case 'f':
+                    append('\f');
+                    break;
+                case 'u':
+                    _hex      = 0;
+                    _hexCount = 0;
+                    _state    = UNICODE;
+                    break;
+                default:
+                    append(c);                                                  // \" \\ \/
+                    break;
+            }
+            return true;
+
+        case UNICODE:
+            if (!isxdigit((unsigned char)c))
+                return false;
+            _hex = (uint16_t)((_hex << 4) | (isdigit((unsigned char)c) ? c - '0' : (tolower((unsigned char)c) - 'a' + 10)));
+            if (++_hexCount == 4) {
+                appendCodepoint(_hex);
+                _state = STRING;
+            }
+            return true;
+
+        case LITERAL:
+            if (isalnum((unsigned char)c) || c == '.' || c == '-' || c == '+') {
+                append(c);
+                return true;
+            }
+            valueDone();                                                        // literal ends with next token
+            return parse(c);
+
+        default:
+            break;
+    }
+
+    if (c == ' ' || c == '\t' || c == '\r' || c == '\n')
+        return true;                                                            // whitespace between tokens
+
+    switch (_state) {
+        case FIRST_VALUE:
+            if (c == ']')
+                return close(true);                                             // empty array
+            // fall through
+        case VALUE:
+            if (c == '{' || c == '[')
+                return open(c == '[');
+            _len       = 0;
+            _truncated = false;
+            _value[0]  = '\0';
+            if (c == '"') {
+                _isKey = false;
+                _state = STRING;
+                return true;
+            }
+            if (isalnum((unsigned char)c) || c == '-') {
+                _isString = false;
+                _state    = LITERAL;
+                append(c);
+                return true;
+            }
+            return false;
+
+        case FIRST_KEY:
+            if (c == '}')
+                return close(false);                                            // empty object
+            // fall through
+        case KEY:
+            if (c != '"')
+                return false;
+            _isKey                       = true;
+            _len                         = 0;
+            _levels[_depth - 1].key[0]   = '\0';
+            _levels[_depth - 1].hash     = jsonPathStep(_levels[_depth - 1].base, '.');
+            _state                       = STRING;
+            return true;
+
+        case COLON:
+            if (c != ':')
+                return false;
+            _state = VALUE;
+            return true;
+
+        case NEXT:
+            if (c == ',') {
+                Level& level = _levels[_depth - 1];
+                if (level.isArray) {
+                    level.index++;
+                    _state = VALUE;
+                } else {
+                    _state = KEY;
+                }
+                return true;
+            }
+            if (c == '}' || c == ']')
+                return close(c == ']');
+            return false;
+
+        default:
+            return false;                                                       // DONE: data behind root value
+    }
+}
+
+// ----------------------------
+bool JsonStream::open(bool isArray) {
+    if (_depth >= JSON_STREAM_MAX_DEPTH)
+        return false;                                                           // nested too deep for openLigaDB data
+    if (_handler)
+        _handler(*this, isArray ? JSON_ARRAY_BEGIN : JSON_OBJECT_BEGIN, _context);
+    const uint32_t parent = pathHash();                                         // position of this container
+    Level&         level  = _levels[_depth++];
+    level.isArray         = isArray;
+    level.index           = 0;
+    level.base            = parent;
+    level.hash            = isArray ? jsonPathStep(jsonPathStep(parent, '['), ']') : parent;
+    level.key[0]          = '\0';
+    _state        = isArray ? FIRST_VALUE : FIRST_KEY;
+    return true;
+}
+
+// ----------------------------
+bool JsonStream::close(bool isArray) {
+    if (_depth == 0 || _levels[_depth - 1].isArray != isArray)
+        return false;                                                           // ']' for object or '}' for array
+    _depth--;
+    if (_handler)
+        _handler(*this, isArray ? JSON_ARRAY_END : JSON_OBJECT_END, _context);
+    _state = _depth ? NEXT : DONE;
+    return true;
+}
+
+// ----------------------------
+void JsonStream::valueDone() {
+    if (_handler)
+        _handler(*this, JSON_VALUE, _context);
+    _state = _depth ? NEXT : DONE;
+}
+
+// ----------------------------
+void JsonStream::append(char c) {
+    if (_isKey)
+        _levels[_depth - 1].hash = jsonPathStep(_levels[_depth - 1].hash, c);   // also for truncated keys
+    char*  target = _isKey ? _levels[_depth - 1].key : _value;
+    size_t size   = _isKey ? JSON_STREAM_KEY_LEN : JSON_STREAM_VALUE_LEN;
+    if (_len + 1 < size) {
+        target[_len++] = c;
+        target[_len]   = '\0';
+    } else {
+        _truncated = true;                                                      // keep first part only
+    }
+}
+
+// ----------------------------
+void JsonStream::appendCodepoint(uint32_t cp) {
+    if (cp >= 0xD800 && cp < 0xDC00) {                                         // high surrogate, wait for low one
+        _surrogate = (uint16_t)cp;
+        return;
+    }
+    if (cp >= 0xDC00 && cp < 0xE000 && _surrogate) {
+        cp         = 0x10000 + (((uint32_t)_surrogate - 0xD800) << 10) + (cp - 0xDC00);
+        _surrogate = 0;
+    }
+    if (cp < 0x80) {
+        append((char)cp);
+    } else if (cp < 0x800) {
+        append((char)(0xC0 | (cp >> 6)));
+        append((char)(0x80 | (cp & 0x3F)));
+    } else if (cp < 0x10000) {
+        append((char)(0xE0 | (cp >> 12)));
+        append((char)(0x80 | ((cp >> 6) & 0x3F)));
+        append((char)(0x80 | (cp & 0x3F)));
+    } else {
+        append((char)(0xF0 | (cp >> 18)));
+        append((char)(0x80 | ((cp >> 12) & 0x3F)));
+        append((char)(0x80 | ((cp >> 6) & 0x3F)));
+        append((char)(0x80 | (cp & 0x3F)));
+    }
+}
+
+// ----------------------------
+
+/**
+ * @brief compare path of current event
+ *
+ * @param path e.g. "[].team1.teamName", "[]" matches every array index
+ * @return true path matches completely
+ */
+bool JsonStream::at(const char* path) const {
+    const char* p = path;
+    for (uint8_t l = 0; l < _depth; l++) {
+        const Level& level = _levels[l];
+        if (level.isArray) {
+            if (p[0] != '[' || p[1] != ']')
+                return false;
+            p += 2;
+        } else {
+            if (*p == '.')
+                p++;
+            size_t n = strcspn(p, ".[");
+            if (strncmp(p, level.key, n) != 0 || level.key[n] != '\0')
+                return false;
+            p += n;
+        }
+    }
+    return *p == '\0';
+}
+
+// ----------------------------
+int JsonStream::index(uint8_t level) const {
+    return (level < _depth && _levels[level].isArray) ? _levels[level].index : -1;
+}
+
+// ----------------------------
+const char* JsonStream::key() const {
+    return (_depth && !_levels[_depth - 1].isArray) ? _levels[_depth - 1].key : "";
+}
+
+// ----------------------------
+void JsonStream::copyTo(char* target, size_t size) const {
+    if (!size)
+        return;
+    strncpy(target, isNull() ? "" : _value, size - 1);
+    target[size - 1] = '\0';
+}
+
+// ----------------------------
+
+/**
+ * @brief store current value into the member described by field
+ *
+ * @param json parser at a JSON_VALUE event
+ * @param field entry of a decoder table
+ * @param record base address of struct that holds the member
+ * @return true stored
+ */
+bool jsonStore(const JsonStream& json, const JsonField& field, void* record) {
+    uint8_t* member = (uint8_t*)record + field.offset;
+    switch (field.type) {
+        case JSON_FIELD_TEXT:
+            json.copyTo((char*)member, field.size);
+            return true;
+        case JSON_FIELD_BOOL:
+            *(bool*)member = json.asBool();
+            return true;
+        case JSON_FIELD_INT: {
+            const long value = json.asLong();
+            if (field.size == 1)
+                *member = (uint8_t)value;
+            else if (field.size == 2)
+                *(uint16_t*)member = (uint16_t)value;
+            else
+                *(uint32_t*)member = (uint32_t)value;
+            return true;
+        }
+    }
+    return false;
+}
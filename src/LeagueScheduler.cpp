@@ -0,0 +1,260 @@
+// #################################################################################################################
+//
+//  ██      ███████  █████   ██████  ██    ██ ███████     ███████  ██████ ██   ██ ███████ ██████  ██    ██ ██      ███████ ██████
+//  ██      ██      ██   ██ ██       ██    ██ ██          ██      ██      ██   ██ ██      ██   ██ ██    ██ ██      ██      ██   ██
+//  ██      █████   ███████ ██   ███ ██    ██ █████       ███████ ██      ███████ █████   ██   ██ ██    ██ ██      █████   ██████
+//  ██      ██      ██   ██ ██    ██ ██    ██ ██               ██ ██      ██   ██ ██      ██   ██ ██    ██ ██      ██      ██   ██
+//  ███████ ███████ ██   ██  ██████   ██████  ███████     ███████  ██████ ██   ██ ███████ ██████   ██████  ███████ ███████ ██   ██
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=League%20Scheduler
+//
+//
+/*
+
+    Tracking of all leagues at once in the Liga task, see LeagueScheduler.h
+
+*/
+#include <Arduino.h>
+#include <utility>
+#include "Liga.h"
+#include "LigaSession.h"
+#include "LeagueScheduler.h"
+
+LeagueScheduler ligaLeagues;                                                    // leagues of the Liga task
+
+static inline League leagueAt(uint8_t index) {
+    return (League)(index + 1);
+}
+
+// ----------------------------
+
+/**
+ * @brief cold state of a league: nothing known yet, bootstrap scopes due now
+ *
+ * @param lg league
+ */
+void LeagueState::clear(League lg) {
+    maxTeams           = (lg == League::BL3) ? LIGA3_MAX_TEAMS : (lg == League::BL2) ? LIGA2_MAX_TEAMS : LIGA1_MAX_TEAMS;
+    season             = 0;
+    matchday           = 0;
+    liveMatchID        = 0;
+    lastScan[0]        = '\0';
+    currentLastChange  = "";
+    previousLastChange = "";
+    matchdayChanged    = false;
+    currentNextKickoff = previousNextKickoff = 0;
+    nextKickoffChanged = false;
+    nextKickoffFarAway = true;                                                  // assume far away
+    connectionRefused  = false;
+    matchIsLive        = false;
+    someThingNew       = false;
+    for (uint8_t i = 0; i < MAX_MATCHES_PER_MATCHDAY; ++i) {
+        liveMatches[i].clear();
+        nextMatches[i].clear();
+        planMatches[i].clear();
+    }
+    liveMatchCount = finiMatchCount = liveMatchIndex = nextMatchCount = planMatchCount = 0;
+    for (uint8_t i = 0; i < MAX_GOALS_PER_MATCHDAY; ++i)
+        goals[i].clear();
+    goalCount               = 0;
+    lastGoalID              = 0;
+    goalStore               = LiveGoalStore();
+    secondsUntilKickoff     = 0;
+    nextKickoffString       = "";
+    pollScope               = CHECK_FOR_CHANGES;
+    pollMode                = POLL_MODE_ONCE;                                   // label until the bootstrap cycle ran
+    nextPollMode            = POLL_MODE_NONE;
+    polls.reset();                                                              // bootstrap scopes due now
+    dynamicWait             = 0;
+    startOfWaiting          = 0;
+    matchdayModel.clear();                                                      // matches of the matchday fetched at once
+    nextMatchdayModel.clear();
+}
+
+// ----------------------------
+
+/**
+ * @brief Construct the scheduler, all leagues tracked (LIGA_TRACKED_LEAGUES)
+ */
+LeagueScheduler::LeagueScheduler()
+    : _tracked(LIGA_TRACKED_LEAGUES), _requestsAtStart(0), _cycleLeague(League::BL1), _postponed(0),
+      _viewMutex(nullptr), _viewHeld(false) {
+    for (uint8_t i = 0; i < LEAGUE_COUNT; ++i)
+        _due[i] = _cycles[i] = _requests[i] = 0;
+}
+
+/**
+ * @brief start of the Liga task: every league cold and due now, shown league loaded
+ */
+void LeagueScheduler::begin() {
+    if (!_viewMutex)
+        _viewMutex = xSemaphoreCreateMutex();
+    const uint32_t now = millis();
+    for (uint8_t i = 0; i < LEAGUE_COUNT; ++i) {
+        _state[i].clear(leagueAt(i));
+        _due[i] = now;
+    }
+    swapState(_state[leagueIndex(ligaLeague)]);                                 // cold state of the loaded league into the globals
+    load(activeLeague);
+}
+
+/**
+ * @brief swap the Liga globals with a stored league state
+ *
+ * std::swap moves strings and match lists, nothing is copied character by character.
+ */
+void LeagueScheduler::swapState(LeagueState& s) {
+    std::swap(ligaMaxTeams, s.maxTeams);
+    std::swap(ligaSeason, s.season);
+    std::swap(ligaMatchday, s.matchday);
+    std::swap(liveMatchID, s.liveMatchID);
+    std::swap(lastScanTimestamp, s.lastScan);
+    std::swap(currentLastChangeOfMatchday, s.currentLastChange);
+    std::swap(previousLastChangeOfMatchday, s.previousLastChange);
+    std::swap(currentMatchdayChanged, s.matchdayChanged);
+    std::swap(currentNextKickoffTime, s.currentNextKickoff);
+    std::swap(previousNextKickoffTime, s.previousNextKickoff);
+    std::swap(nextKickoffChanged, s.nextKickoffChanged);
+    std::swap(nextKickoffFarAway, s.nextKickoffFarAway);
+    std::swap(ligaConnectionRefused, s.connectionRefused);
+    std::swap(matchIsLive, s.matchIsLive);
+    std::swap(isSomeThingNew, s.someThingNew);
+    std::swap(liveMatches, s.liveMatches);
+    std::swap(ligaLiveMatchCount, s.liveMatchCount);
+    std::swap(ligaFiniMatchCount, s.finiMatchCount);
+    std::swap(ligaLiveMatchIndex, s.liveMatchIndex);
+    std::swap(nextMatches, s.nextMatches);
+    std::swap(ligaNextMatchCount, s.nextMatchCount);
+    std::swap(planMatches, s.planMatches);
+    std::swap(ligaPlanMatchCount, s.planMatchCount);
+    std::swap(goalsInfos, s.goals);
+    std::swap(liveGoalCount, s.goalCount);
+    std::swap(lastGoalID, s.lastGoalID);
+    std::swap(liveGoals, s.goalStore);
+    std::swap(diffSecondsUntilKickoff, s.secondsUntilKickoff);
+    std::swap(nextKickoffString, s.nextKickoffString);
+    std::swap(currentPollScope, s.pollScope);
+    std::swap(currentPollMode, s.pollMode);
+    std::swap(nextPollMode, s.nextPollMode);
+    std::swap(ligaPolls, s.polls);
+    std::swap(pollManagerDynamicWait, s.dynamicWait);
+    std::swap(pollManagerStartOfWaiting, s.startOfWaiting);
+    std::swap(ligaMatchdayModel, s.matchdayModel);
+    std::swap(ligaNextMatchdayModel, s.nextMatchdayModel);
+}
+
+/**
+ * @brief load the state of a league into the Liga globals (Liga task only)
+ *
+ * A league that is not shown is loaded under the view lock, so the Report task
+ * never prints its globals as the shown league.
+ *
+ * @param lg league to poll or show
+ */
+void LeagueScheduler::load(League lg) {
+    const bool shown = (lg == activeLeague);
+    if (!shown && !_viewHeld && _viewMutex) {
+        xSemaphoreTake(_viewMutex, portMAX_DELAY);                              // wait for a running report
+        _viewHeld = true;
+    }
+    if (lg != ligaLeague) {
+        swapState(_state[leagueIndex(ligaLeague)]);                             // loaded league back into its slot
+        swapState(_state[leagueIndex(lg)]);                                     // state of lg into the globals
+        ligaLeague = lg;
+        openLigaDB.setCacheGroup(leagueIndex(lg));                              // ETags and body hashes per league
+    }
+    if (shown && _viewHeld) {
+        _viewHeld = false;
+        xSemaphoreGive(_viewMutex);
+    }
+}
+
+/**
+ * @brief league to poll now
+ *
+ * Earliest due time first, the shown league wins a tie. A league that is not shown
+ * and due while the pacer holds less than LIGA_SHOWN_RESERVE requests moves to the
+ * time the reserve is refilled.
+ *
+ * @param waitMs 0 if the league is due, else time until the first league is due
+ * @return League league of the next cycle
+ */
+League LeagueScheduler::next(uint32_t& waitMs) {
+    const uint32_t now = millis();
+
+    int8_t  best    = -1;
+    int32_t bestDue = 0;
+    for (uint8_t i = 0; i < LEAGUE_COUNT; ++i) {
+        const bool shown = (leagueAt(i) == activeLeague);
+        if (!shown && !(_tracked & (1 << i)))
+            continue;                                                           // shown league is always polled
+        int32_t due = (int32_t)(_due[i] - now);
+        if (!shown && due <= 0) {
+            const uint32_t refillMs = openLigaDB.pacer().msUntil(LIGA_SHOWN_RESERVE);
+            if (refillMs > 0) {
+                _due[i] = now + refillMs;                                       // budget low: after the reserve is back
+                due     = (int32_t)refillMs;
+                _postponed++;
+            }
+        }
+        if (best < 0 || due < bestDue || (due == bestDue && shown)) {
+            best    = i;
+            bestDue = due;
+        }
+    }
+    waitMs = (bestDue > 0) ? (uint32_t)bestDue : 0;
+    return leagueAt(best);
+}
+
+/**
+ * @brief load a league for its poll cycle
+ */
+void LeagueScheduler::beginCycle(League lg) {
+    load(lg);
+    _cycleLeague     = lg;
+    _requestsAtStart = openLigaDB.requests();
+}
+
+/**
+ * @brief poll cycle of the loaded league done, it is due again after delayMs
+ *
+ * @param delayMs poll delay of its new poll mode
+ */
+void LeagueScheduler::endCycle(uint32_t delayMs) {
+    const uint8_t  i    = leagueIndex(_cycleLeague);
+    const uint32_t used = openLigaDB.requests() - _requestsAtStart;
+    _requests[i] += used;
+    _cycles[i]++;
+    _due[i] = millis() + delayMs;
+}
+
+/**
+ * @brief current poll mode of a league, also while it is not loaded
+ */
+PollMode LeagueScheduler::pollMode(League lg) const {
+    return (lg == ligaLeague) ? currentPollMode : _state[leagueIndex(lg)].pollMode;
+}
+
+/**
+ * @brief time until the next cycle of a league, < 0 if it is overdue
+ */
+int32_t LeagueScheduler::dueInMs(League lg) const {
+    return (int32_t)(_due[leagueIndex(lg)] - millis());
+}
+
+// ----------------------------
+
+/**
+ * @brief try to take the view lock without waiting
+ */
+LeagueViewLock::LeagueViewLock() : _owned(true) {
+    if (ligaLeagues._viewMutex)
+        _owned = xSemaphoreTake(ligaLeagues._viewMutex, 0) == pdTRUE;
+}
+
+LeagueViewLock::~LeagueViewLock() {
+    if (ligaLeagues._viewMutex && _owned)
+        xSemaphoreGive(ligaLeagues._viewMutex);
+}
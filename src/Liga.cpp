@@ -22,20 +22,24 @@
 #include <HTTPClient.h>
 #include <stdio.h>
 #include <string.h>
-#include "ArduinoJson.h"
+#include "JsonStream.h"
 #include "secret.h"
 #include "Liga.h"
 #include "esp_http_client.h"
+#include "LigaSession.h"
 #include "FlapTasks.h"
+#include "LivePush.h"
+#include "TeamIndex.h"
+#include "MatchdayModel.h"
+#include "PollScheduler.h"
 
 #define WIFI_SSID "DEIN_SSID"
 #define WIFI_PASS "DEIN_PASS"
 
 // initialize global variables
-char   jsonBuffer[32 * 1024];                                                   // buffer for deserialization in event-handlers
-size_t jsonBufferPos                = 0;                                        // write position in json buffer
-bool   jsonBufferPrepared           = false;                                    // bupper not preparted
-int    realJsonBufferSize           = 0;                                        // cunked buffers size cummulated
+JsonStream ligaJson;                                                            // incremental parser for openLigaDB bodies (no body buffer)
+
+bool   jsonStreamPrepared           = false;                                    // parser not prepared
 String currentLastChangeOfMatchday  = "";                                       // openLigaDB Matchday change state
 String previousLastChangeOfMatchday = "";                                       // openLigaDB Matchday change state
 char   lastScanTimestamp[32]        = {0};
@@ -69,6 +73,7 @@ int       ligaPlanMatchCount                    = 0;
 LiveMatchGoalInfo goalsInfos[MAX_GOALS_PER_MATCHDAY] = {};                      // max. 50 live goals
 int               liveGoalCount                      = 0;
 int               lastGoalID                         = 0;                       // last goal ID to detect new goals
+LiveGoalStore     liveGoals;                                                    // index of goalsInfos[], seen goal IDs
 
 double      diffSecondsUntilKickoff = 0;
 std::string nextKickoffString;
@@ -76,16 +81,109 @@ std::string nextKickoffString;
 PollScope        currentPollScope          = CHECK_FOR_CHANGES;                 // current
 PollMode         currentPollMode           = POLL_MODE_NONE;                    // global poll mode of poll mananger
 PollMode         nextPollMode              = POLL_MODE_NONE;
-const PollScope* activeCycle               = nullptr;
-size_t           activeCycleLength         = 0;
-uint32_t         pollManagerDynamicWait    = 0;                                 // wait time according to current poll mode
+uint32_t         pollManagerDynamicWait    = 0;                                 // wait time until the earliest poll deadline
 uint32_t         pollManagerStartOfWaiting = 0;                                 // time_t when entering waiting
 
-LigaSnapshot snap[2];                                                           // actual and previous table
-uint8_t      snapshotIndex = 0;                                                 // 0 or 1
+uint32_t         pollCacheHits[POLL_SCOPE_COUNT]   = {};                        // unchanged payloads per PollScope
+uint32_t         pollCacheMisses[POLL_SCOPE_COUNT] = {};                        // processed payloads per PollScope
+
+League            ligaLeague = League::BL1;                                     // league loaded in the Liga task
+LigaSnapshotStore ligaSnapshotStores[LEAGUE_COUNT];                             // current and previous table per league
+static LiveTable  liveTables[LEAGUE_COUNT];                                     // live table per league (CALC_LIVE_TABLE)
+
+/**
+ * @brief Construct the snapshot store: three empty slots, version 0
+ */
+LigaSnapshotStore::LigaSnapshotStore() : _current(0), _previous(1), _back(2), _version(0), _retries(0) {
+    memset(_slot, 0, sizeof(_slot));
+    for (uint8_t s = 0; s < 3; ++s) {
+        _sequence[s].store(0);
+        _slotVersion[s] = 0;
+    }
+}
+
+void LigaSnapshotStore::beginWrite(uint8_t slot) {
+    _sequence[slot].fetch_add(1, std::memory_order_relaxed);                    // odd
+    std::atomic_thread_fence(std::memory_order_release);                        // before any data store of the slot
+}
+
+void LigaSnapshotStore::endWrite(uint8_t slot) {
+    _sequence[slot].fetch_add(1, std::memory_order_release);                    // even, data stores before
+}
+
+/**
+ * @brief start the next table in the back slot (writer, LigaSnapshotLock held)
+ *
+ * @return LigaSnapshot& cleared back slot, publish() makes it current
+ */
+LigaSnapshot& LigaSnapshotStore::build() {
+    beginWrite(_back);                                                          // a reader two publications behind may still copy it
+    _slot[_back].clear();
+    return _slot[_back];
+}
+
+/**
+ * @brief publish the built slot with one atomic store (writer, LigaSnapshotLock held)
+ */
+void LigaSnapshotStore::publish() {
+    const uint8_t built = _back;
+    _slotVersion[built] = _version.load(std::memory_order_relaxed) + 1;
+    endWrite(built);
+    _back     = _previous;                                                      // oldest slot is filled next time
+    _previous = _current.load(std::memory_order_relaxed);
+    _current.store(built, std::memory_order_release);
+    _version.fetch_add(1, std::memory_order_release);
+}
+
+/**
+ * @brief table unchanged: previous = current, so the change detectors see no change
+ */
+void LigaSnapshotStore::keep() {
+    beginWrite(_previous);
+    memcpy(&_slot[_previous], &_slot[_current.load(std::memory_order_relaxed)], sizeof(LigaSnapshot));
+    endWrite(_previous);
+}
+
+/**
+ * @brief forget current and previous table (league changed), readers get an empty table
+ */
+void LigaSnapshotStore::clear() {
+    const uint32_t version = _version.load(std::memory_order_relaxed) + 1;
+    for (uint8_t s = 0; s < 3; ++s) {
+        beginWrite(s);
+        _slot[s].clear();
+        _slotVersion[s] = version;
+        endWrite(s);
+    }
+    _version.store(version, std::memory_order_release);
+}
+
+/**
+ * @brief consistent copy of the current table, never blocks the writer
+ *
+ * @param out copy of the current slot
+ * @return uint32_t version of the copied table (0 = nothing published yet)
+ */
+uint32_t LigaSnapshotStore::read(LigaSnapshot& out) const {
+    while (true) {
+        const uint8_t  s     = _current.load(std::memory_order_acquire);
+        const uint32_t begin = _sequence[s].load(std::memory_order_acquire);
+        if (begin & 1) {                                                        // writer reuses this slot right now
+            _retries.fetch_add(1, std::memory_order_relaxed);
+            vTaskDelay(1);                                                      // let the writer finish (also on the same core)
+            continue;
+        }
+        memcpy(&out, &_slot[s], sizeof(LigaSnapshot));
+        const uint32_t version = _slotVersion[s];
+        std::atomic_thread_fence(std::memory_order_acquire);                    // copy before the second sequence load
+        if (_sequence[s].load(std::memory_order_relaxed) == begin)
+            return version;
+        _retries.fetch_add(1, std::memory_order_relaxed);                       // slot was reused during the copy
+    }
+}
 
 /**
- * @brief mutex protecting snap[]/snapshotIndex against concurrent task access
+ * @brief writer mutex of the table stores (Liga task), readers do not take it
  */
 SemaphoreHandle_t g_ligaSnapshotMutex = nullptr;
 
@@ -104,12 +202,190 @@ uint8_t prevScoreTeam2 = 0;
 
 // ===== Routines ==========================================
 
-std::map<uint32_t, LiveMatchGoalInfo*> getLatestGoalsPerMatch() {
-    std::map<uint32_t, LiveMatchGoalInfo*> latest;
-    for (auto& goal : goalsInfos) {
-        latest[goal.matchID] = &goal;                                           // Zeiger auf Original!
+// ----------------------------
+// live goal store, see Liga.h
+
+// Fibonacci hashing (high bits of the product), matchIDs and goalIDs are consecutive numbers
+static inline uint32_t goalHash(uint32_t id, uint32_t slots) {
+    return (id * 2654435761u) >> (32 - __builtin_ctz(slots));                   // slots is a power of 2
+}
+
+/**
+ * @brief Construct an empty goal store, cycle 1
+ */
+LiveGoalStore::LiveGoalStore() : _cycle(1), _duplicates(0) {
+    memset(_seen, 0, sizeof(_seen));
+    clearMatches();
+}
+
+//
+void LiveGoalStore::clearMatches() {
+    for (uint8_t i = 0; i < GOAL_MATCH_SLOTS; ++i) {
+        _match[i].matchID = 0;
+        _match[i].goal    = -1;
+    }
+}
+
+/**
+ * @brief start the next live cycle: goalsInfos[] and the per-match index empty, seen goal IDs stay
+ */
+void LiveGoalStore::beginCycle() {
+    for (int i = 0; i < liveGoalCount && i < MAX_GOALS_PER_MATCHDAY; ++i)
+        goalsInfos[i].clear();
+    liveGoalCount = 0;
+    clearMatches();
+    _cycle++;
+}
+
+/**
+ * @brief slot of a match in the per-match index
+ *
+ * @param matchID openLigaDB matchID, not 0
+ * @return int slot of the match or the empty slot it would take, -1 if the index is full
+ */
+int LiveGoalStore::slotOf(uint32_t matchID) const {
+    uint32_t i = goalHash(matchID, GOAL_MATCH_SLOTS);
+    for (uint8_t n = 0; n < GOAL_MATCH_SLOTS; ++n, i = (i + 1) & (GOAL_MATCH_SLOTS - 1))
+        if (_match[i].matchID == matchID || _match[i].matchID == 0)
+            return (int)i;
+    return -1;
+}
+
+/**
+ * @brief classify a streamed goal and mark it as seen in this cycle
+ *
+ * Goal IDs that were not streamed for GOAL_SEEN_KEEP_CYCLES cycles (annulled goal, match over)
+ * are stale; their slots are reused, so the set never runs full.
+ *
+ * @param goalID openLigaDB goalID, 0 (missing) is stored but never announced
+ * @return GoalAdmit new, known from an earlier cycle or duplicate in this cycle
+ */
+GoalAdmit LiveGoalStore::admit(uint32_t goalID) {
+    if (goalID == 0)
+        return GOAL_KNOWN;
+    uint32_t i    = goalHash(goalID, GOAL_SEEN_SLOTS);
+    int      free = -1;
+    for (uint16_t n = 0; n < GOAL_SEEN_SLOTS; ++n, i = (i + 1) & (GOAL_SEEN_SLOTS - 1)) {
+        SeenSlot& s = _seen[i];
+        if (s.goalID == goalID) {
+            if (s.cycle == _cycle) {
+                _duplicates++;
+                return GOAL_DUPLICATE;
+            }
+            s.cycle = _cycle;
+            return GOAL_KNOWN;
+        }
+        if (s.goalID == 0) {                                                    // end of probe chain: goal unknown
+            if (free < 0)
+                free = i;
+            break;
+        }
+        if (free < 0 && _cycle - s.cycle > GOAL_SEEN_KEEP_CYCLES)
+            free = i;                                                           // stale, reusable (chain stays intact)
+    }
+    if (free < 0) {                                                             // only fresh goals and no empty slot
+        if (!evictOldest())
+            return GOAL_NEW;                                                    // more goals in this cycle than slots, not stored
+        for (free = goalHash(goalID, GOAL_SEEN_SLOTS); _seen[free].goalID != 0; free = (free + 1) & (GOAL_SEEN_SLOTS - 1)) {
+        }
+    }
+    _seen[free].goalID = goalID;
+    _seen[free].cycle  = _cycle;
+    return GOAL_NEW;
+}
+
+/**
+ * @brief make room in a seen set without empty or stale slot
+ *
+ * Drops the goals streamed longest ago: the age limit halves from GOAL_SEEN_KEEP_CYCLES / 2
+ * until some goal is older. Goals streamed in this cycle always stay, so no goal that is still
+ * streamed is announced again.
+ *
+ * @return true at least one slot is empty now
+ */
+bool LiveGoalStore::evictOldest() {
+    for (uint32_t limit = GOAL_SEEN_KEEP_CYCLES / 2;; limit /= 2) {
+        bool evicted = false;
+        for (uint32_t i = 0; i < GOAL_SEEN_SLOTS; ++i)
+            while (_seen[i].goalID != 0 && _cycle - _seen[i].cycle > limit) {
+                erase(i);                                                       // may shift the next goal into i
+                evicted = true;
+            }
+        if (evicted)
+            return true;
+        if (limit == 0)
+            return false;
+    }
+}
+
+/**
+ * @brief empty a slot of the seen set and close the gap (backward shift), no probe chain breaks
+ *
+ * @param i slot to empty
+ */
+void LiveGoalStore::erase(uint32_t i) {
+    const uint32_t mask = GOAL_SEEN_SLOTS - 1;
+    uint32_t       j    = i;
+    for (uint16_t n = 1; n < GOAL_SEEN_SLOTS; ++n) {
+        j = (j + 1) & mask;
+        if (_seen[j].goalID == 0)
+            break;
+        const uint32_t home = goalHash(_seen[j].goalID, GOAL_SEEN_SLOTS);
+        if (((j - home) & mask) >= ((j - i) & mask)) {                          // home not between i and j: may move to i
+            _seen[i] = _seen[j];
+            i        = j;
+        }
+    }
+    _seen[i].goalID = 0;
+    _seen[i].cycle  = 0;
+}
+
+/**
+ * @brief next entry of goalsInfos[] for a match, becomes the latest goal of this match
+ *
+ * @param matchID match the goal belongs to
+ * @return LiveMatchGoalInfo* cleared entry, nullptr if goalsInfos[] or the index is full
+ */
+LiveMatchGoalInfo* LiveGoalStore::add(uint32_t matchID) {
+    const int slot = matchID ? slotOf(matchID) : -1;
+    if (liveGoalCount >= MAX_GOALS_PER_MATCHDAY || slot < 0)
+        return nullptr;
+    LiveMatchGoalInfo& goal = goalsInfos[liveGoalCount];
+    goal.clear();
+    goal.matchID         = matchID;
+    _match[slot].matchID = matchID;
+    _match[slot].goal    = (int8_t)liveGoalCount++;
+    return &goal;
+}
+
+/**
+ * @brief current score of a match
+ *
+ * @param matchID match
+ * @return const LiveMatchGoalInfo* latest entry, nullptr if the match has none in this cycle
+ */
+const LiveMatchGoalInfo* LiveGoalStore::latest(uint32_t matchID) const {
+    const int slot = matchID ? slotOf(matchID) : -1;
+    return (slot >= 0 && _match[slot].matchID == matchID) ? &goalsInfos[_match[slot].goal] : nullptr;
+}
+
+/**
+ * @brief drop the entries of an incomplete body and index the remaining ones again
+ *
+ * @param firstGoal first entry of the body in goalsInfos[]
+ */
+void LiveGoalStore::rollback(int firstGoal) {
+    for (int g = firstGoal; g < liveGoalCount; g++)
+        goalsInfos[g].clear();
+    liveGoalCount = firstGoal;
+    clearMatches();
+    for (int g = 0; g < liveGoalCount; ++g) {                                   // rare: index the rest again
+        const int slot = slotOf(goalsInfos[g].matchID);
+        if (slot >= 0) {
+            _match[slot].matchID = goalsInfos[g].matchID;
+            _match[slot].goal    = (int8_t)g;
+        }
     }
-    return latest;
 }
 
 /**
@@ -281,12 +557,14 @@ const char* pollScopeToString(PollScope scope) {
             return "FETCH_CURRENT_MATCHDAY";
         case CALC_CURRENT_SEASON:
             return "CALC_CURRENT_SEASON";
-        case FETCH_NEXT_KICKOFF:
-            return "FETCH_NEXT_KICKOFF";
-        case FETCH_NEXT_MATCH_LIST:
-            return "FETCH_NEXT_MATCH_LIST";
-        case FETCH_LIVE_MATCHES:
-            return "FETCH_LIVE_MATCHES";
+        case CALC_NEXT_KICKOFF:
+            return "CALC_NEXT_KICKOFF";
+        case CALC_NEXT_MATCH_LIST:
+            return "CALC_NEXT_MATCH_LIST";
+        case FETCH_MATCHES:
+            return "FETCH_MATCHES";
+        case CALC_LIVE_MATCHES:
+            return "CALC_LIVE_MATCHES";
         case FETCH_LIVE_GOALS:
             return "FETCH_LIVE_GOALS";
         case SHOW_NEXT_KICKOFF:
@@ -324,49 +602,6 @@ String pollCycleToString(const PollScope* cycle, size_t length) {
     return result;
 }
 
-/**
- * @brief Selects the appropriate polling cycle based on the given PollMode.
- *
- * Sets the global activeCycle and activeCycleLength variables accordingly.
- * Also prints the selected cycle for diagnostic purposes.
- *
- * @param mode The PollMode to use for selecting the cycle.
- */
-void selectPollCycle(PollMode mode) {
-    switch (mode) {
-        case POLL_MODE_LIVE:
-            activeCycle       = liveCycle;
-            activeCycleLength = sizeof(liveCycle) / sizeof(PollScope);
-            break;
-        case POLL_MODE_REACTIVE:
-            activeCycle       = reactiveCycle;
-            activeCycleLength = sizeof(reactiveCycle) / sizeof(PollScope);
-            break;
-        case POLL_MODE_PRELIVE:
-            activeCycle       = preLiveCycle;
-            activeCycleLength = sizeof(preLiveCycle) / sizeof(PollScope);
-            break;
-        case POLL_MODE_RELAXED:
-            activeCycle       = relaxedCycle;
-            activeCycleLength = sizeof(relaxedCycle) / sizeof(PollScope);
-            break;
-        case POLL_MODE_ONCE:
-            activeCycle       = onceCycle;
-            activeCycleLength = sizeof(onceCycle) / sizeof(PollScope);
-            break;
-        case POLL_MODE_NONE:
-            activeCycle       = noCycle;
-            activeCycleLength = sizeof(noCycle) / sizeof(PollScope);
-            break;
-        default:
-            activeCycle       = relaxedCycle;                                   ///< Default fallback cycle
-            activeCycleLength = sizeof(relaxedCycle) / sizeof(PollScope);
-            break;
-    }
-
-    // Log the selected polling cycle for debugging
-    Liga->ligaPrintln("%s = %s", pollModeToString(currentPollMode), pollCycleToString(activeCycle, activeCycleLength).c_str());
-}
 /**
  * @brief Determines the appropriate PollMode based on the next scheduled kickoff time.
  *
@@ -408,59 +643,6 @@ bool checkForMatchdayChanges() {
     return currentMatchdayChanged;
 }
 
-/**
- * @brief Returns the polling delay in milliseconds based on the current PollMode.
- *
- * Also logs the selected mode and delay in human-readable format.
- *
- * @param mode The polling mode to evaluate.
- * @return uint32_t The delay in milliseconds before the next poll.
- */
-uint32_t getPollDelay(PollMode mode) {
-    uint32_t pollWaitTime = 0;
-
-    switch (mode) {
-        case POLL_MODE_NONE:
-            pollWaitTime = POLL_WAIT;                                           ///< Stopp polling for POLL_WAIT minutes
-            break;
-        case POLL_MODE_ONCE:
-            pollWaitTime = POLL_NOWAIT;                                         ///< Immediate polling
-            break;
-        case POLL_MODE_LIVE:
-            pollWaitTime = POLL_DURING_GAME;                                    ///< Frequent polling during live match
-            break;
-        case POLL_MODE_REACTIVE:
-            pollWaitTime = POLL_GET_ALL_CHANGES;                                ///< Polling for all changes
-            break;
-        case POLL_MODE_PRELIVE:
-            pollWaitTime = POLL_10MIN_BEFORE_KICKOFF;                           ///< Polling shortly before kickoff
-            break;
-        case POLL_MODE_RELAXED:
-            /*
-                if (diffSecondsUntilKickoff && diffSecondsUntilKickoff <= 1 * 60 * 60) {
-                    // kickoff nears within next 1h → relaxed polling but quicker
-                    pollWaitTime = diffSecondsUntilKickoff / 3;                 ///< quicker relaxed polling interval
-                } else {
-                    // Case 4: no immediate kickoff and no game in progress → relaxed polling
-                    pollWaitTime = POLL_NORMAL;                                 ///< Default relaxed polling interval
-                }
-     */
-            pollWaitTime = POLL_NORMAL;                                         ///< Default relaxed polling interval
-            break;
-        default:
-            pollWaitTime = POLL_NORMAL;                                         ///< Fallback to relaxed interval
-            break;
-    }
-
-    int totalseconds = pollWaitTime / 1000;
-    int min          = totalseconds / 60;
-    int sec          = totalseconds % 60;
-
-    // Log the current polling mode and delay in minutes and seconds
-    Liga->ligaPrintln("PollManager is in mode %s and will wait for %d minutes %02d seconds", pollModeToString(currentPollMode), min, sec);
-    return pollWaitTime;
-}
-
 /**
  * @brief Sends an HTTP GET request to the specified URL and stores the response.
  *
@@ -520,215 +702,236 @@ bool waitForTime(uint32_t maxMs, bool report) {
     return false;
 }
 
+// ---- compact match data collected while streaming getmatchdata (MatchdayModel) ----
+struct StreamMatch {
+    uint32_t matchID;
+    bool     finished;
+    char     kickoff[24];                                                       // "2025-08-22T20:30:00"
+    char     team1[MAX_TEAMNAME_LENGTH];
+    char     team2[MAX_TEAMNAME_LENGTH];
+};
+static StreamMatch streamMatches[MAX_MATCHES_PER_MATCHDAY];                     // matches of one matchday
+static int         streamMatchCount = 0;                                        // filled entries in streamMatches
+
+// decoder for getmatchdata/<league>/<season>/<matchday>, one record per match
+struct MatchListDecoder {
+    typedef StreamMatch        Record;
+    static constexpr uint32_t  record   = jsonPath("[]");
+    static constexpr JsonField fields[] = {
+        JSON_FIELD("[].matchID", StreamMatch, matchID),
+        JSON_FIELD("[].matchDateTime", StreamMatch, kickoff),
+        JSON_FIELD("[].matchIsFinished", StreamMatch, finished),
+        JSON_FIELD("[].team1.teamName", StreamMatch, team1),
+        JSON_FIELD("[].team2.teamName", StreamMatch, team2),
+    };
+};
+
 /**
- * @brief HTTP event handler for polling the next match list from OpenLigaDB.
+ * @brief JSON stream handler for getmatchdata/<league>/<season>/<matchday>
  *
- * Handles incoming HTTP data, deserializes the JSON response, and extracts upcoming matches.
- * Matches are categorized into "next" (soonest) and "planned" (later) based on kickoff time.
- *
- * @param evt Pointer to the HTTP client event structure.
- * @return esp_err_t ESP_OK on success, or error code on failure.
+ * collects matchID, matchDateTime, matchIsFinished and team names of every match
+ * into streamMatches[], all other fields are skipped while streaming.
  */
-esp_err_t _http_event_handler_pollForNextMatchList(esp_http_client_event_t* evt) {
-    int matchdayOffset = 0;
-    if (evt->user_data != nullptr) {
-        matchdayOffset = *((int*)evt->user_data);                               // get matchdayOffset
+static void streamMatchList(JsonStream& json, JsonStreamEvent event, void*) {
+    if (event == JSON_ARRAY_BEGIN && json.pathHash() == JSON_PATH_ROOT) {
+        streamMatchCount = 0;                                                   // new body
+        return;
+    }
+
+    const int i = json.index(0);
+    if (i < 0 || i >= MAX_MATCHES_PER_MATCHDAY)
+        return;                                                                 // more matches than tracked
+
+    if (event == JSON_OBJECT_BEGIN && json.pathHash() == MatchListDecoder::record) {
+        memset(&streamMatches[i], 0, sizeof(StreamMatch));
+        streamMatchCount = i + 1;
+        return;
     }
+    if (event == JSON_VALUE)
+        jsonDecode<MatchListDecoder>(json, streamMatches[i]);
+}
+
+/**
+ * @brief streamed match list into a MatchdayModel, replaces its matches
+ */
+static void storeMatchday(MatchdayModel& model, int matchday) {
+    model.begin(matchday);
+    for (int m = 0; m < streamMatchCount; m++) {
+        const StreamMatch& match = streamMatches[m];
+        model.add(match.matchID, match.kickoff, match.finished, match.team1, match.team2);
+    }
+    model.end();
+    Liga->ligaPrintln("matchday %d: %u matches, %u finished", matchday, model.count(), model.finishedCount());
+}
+
+/**
+ * @brief HTTP events of getmatchdata/<league>/<season>/<matchday> for one MatchdayModel
+ *
+ * An unchanged body keeps the model, a complete new body replaces it. Live matches,
+ * next matches and next kickoff are derived from the model by their CALC scopes.
+ */
+static esp_err_t handleMatchdayEvent(esp_http_client_event_t* evt, MatchdayModel& model) {
+    const int matchday = (evt->user_data != nullptr) ? *((int*)evt->user_data) : ligaMatchday; // matchday of the request
 
     switch (evt->event_id) {
         case HTTP_EVENT_ON_DATA: {
-            if (readHttpResult(evt)) {
+            if (readHttpResult(evt, streamMatchList)) {
                 vTaskDelay(1);                                                  // feed watch dog
             } else {
-                Liga->ligaPrintln("(_http_event_handler_pollForNextMatchList) JSON-Buffer error");
+                Liga->ligaPrintln("(handleMatchdayEvent) JSON-Stream error");
             }
             break;
         }
         case HTTP_EVENT_ON_FINISH: {
-            #pragma GCC diagnostic push
-            #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-            StaticJsonDocument<512> filter;
-            #pragma GCC diagnostic pop
-
-            filter[0]["matchID"]       = true;
-            filter[0]["matchDateTime"] = true;
-
-            // Team-Namen hinzufügen
-            filter[0]["team1"]["teamName"] = true;
-            filter[0]["team2"]["teamName"] = true;
-
-            #pragma GCC diagnostic push
-            #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-            DynamicJsonDocument doc(realJsonBufferSize * 1.2);
-            #pragma GCC diagnostic pop
-            if (!deserializeHttpResult(doc, DeserializationOption::Filter(filter))) {
-                Liga->ligaPrintln("(_http_event_handler_pollForNextMatchList) JSON-Buffer not deserialized");
-                jsonBufferPrepared = false;
-                break;
-            }
-
-            JsonArray matches = doc.as<JsonArray>();
-            time_t    now     = time(nullptr);
-            time_t    minDiff = INT32_MAX;
-
-            // First pass: find the smallest time difference to current time
-            for (JsonObject match : matches) {
-                const char* kickoffStr = match["matchDateTime"] | "";
-                if (strlen(kickoffStr) == 0)
-                    continue;
+            if (unchangedHttpResult())
+                break;                                                          // matches of the model still valid
 
-                struct tm tm = {};
-                strptime(kickoffStr, "%Y-%m-%dT%H:%M:%S", &tm);
-                tm.tm_isdst    = -1;                                            ///< Let system determine daylight saving
-                time_t kickoff = mktime(&tm);
-                time_t diff    = kickoff > now ? kickoff - now : INT32_MAX;
-
-                if (diff < minDiff) {
-                    minDiff = diff;                                             ///< Update minimum time difference
-                }
-            }
-
-            // Second pass: collect matches with minimal time difference
-            for (int i = 0; i < MAX_MATCHES_PER_MATCHDAY; i++) {
-                nextMatches[i].clear();                                         ///< Clear next matches array
-                planMatches[i].clear();                                         ///< Clear planned matches array
-            }
-
-            ligaNextMatchCount = 0;
-            ligaPlanMatchCount = 0;
-
-            for (JsonObject match : matches) {
-                const char* kickoffStr = match["matchDateTime"] | "";
-                uint32_t    matchID    = match["matchID"] | 0;
-                if (strlen(kickoffStr) == 0 || matchID == 0)
-                    continue;
-
-                struct tm tm = {};
-                strptime(kickoffStr, "%Y-%m-%dT%H:%M:%S", &tm);
-                tm.tm_isdst    = -1;
-                time_t kickoff = mktime(&tm);
-                time_t diff    = kickoff > now ? kickoff - now : INT32_MAX;
-
-                if (kickoff <= now)
-                    continue;                                                   ///< Ignore matches in the past
-
-                if (diff == minDiff && ligaNextMatchCount < MAX_MATCHES_PER_MATCHDAY) {
-                    // Store match as "next" match
-                    nextMatches[ligaNextMatchCount].matchID = matchID;
-                    nextMatches[ligaNextMatchCount].kickoff = kickoff;
-
-                    const char* team1                     = match["team1"]["teamName"] | "Team A";
-                    const char* team2                     = match["team2"]["teamName"] | "Team B";
-                    nextMatches[ligaNextMatchCount].team1 = team1;
-                    nextMatches[ligaNextMatchCount].team2 = team2;
-
-                    Liga->ligaPrintln("next Match %u: Kickoff %s | %s vs %s", matchID, kickoffStr, team1, team2);
-                    ligaNextMatchCount++;
-                } else if (ligaPlanMatchCount < MAX_MATCHES_PER_MATCHDAY) {
-                    // Store match as "planned" match
-                    planMatches[ligaPlanMatchCount].matchID = matchID;
-
-                    const char* kickoffStr = match["matchDateTime"] | "";
-                    struct tm   tm         = {};
-                    strptime(kickoffStr, "%Y-%m-%dT%H:%M", &tm);
-                    tm.tm_isdst                             = -1;
-                    time_t kickoff                          = mktime(&tm);
-                    planMatches[ligaPlanMatchCount].kickoff = kickoff;
-
-                    const char* team1                     = match["team1"]["teamName"] | "Team A";
-                    const char* team2                     = match["team2"]["teamName"] | "Team B";
-                    planMatches[ligaPlanMatchCount].team1 = team1;
-                    planMatches[ligaPlanMatchCount].team2 = team2;
-
-                    Liga->ligaPrintln("plan Match %u: Kickoff %s | %s vs %s", matchID, kickoffStr, team1, team2);
-                    ligaPlanMatchCount++;
-                }
+            if (!finishHttpResult()) {
+                Liga->ligaPrintln("(handleMatchdayEvent) JSON-Stream not parsed");
+                jsonStreamPrepared = false;
+                break;
             }
-
-            // Log summary of matches found
-            Liga->ligaPrintln("found next matches: %d for matchday: %d", ligaNextMatchCount, ligaMatchday + matchdayOffset);
-            Liga->ligaPrintln("found planned matches: %d for matchday: %d", ligaPlanMatchCount, ligaMatchday + matchdayOffset);
-
-            jsonBufferPrepared = false;
-            realJsonBufferSize = 0;
+            storeMatchday(model, matchday);
+            jsonStreamPrepared = false;
             break;
         }
 
-        case HTTP_EVENT_DISCONNECTED: {
-            jsonBufferPrepared = false;
-            realJsonBufferSize = 0;
+        case HTTP_EVENT_DISCONNECTED:
+            jsonStreamPrepared = false;
             break;
-        }
+
         case HTTP_EVENT_ERROR: {
-            Liga->ligaPrintln("error while looking for next matches");          ///< Log HTTP error
-            jsonBufferPrepared = false;
-            realJsonBufferSize = 0;
+            Liga->ligaPrintln("error while fetching matches of matchday %d", matchday);
+            jsonStreamPrepared = false;
             break;
         }
+
+        default:
+            break;
     }
     return ESP_OK;
 }
 
+// Event-Handler of the current matchday (own cache slot)
+esp_err_t _http_event_handler_pollForMatches(esp_http_client_event_t* evt) {
+    return handleMatchdayEvent(evt, ligaMatchdayModel);
+}
+
+// Event-Handler of the following matchday (own cache slot)
+esp_err_t _http_event_handler_pollForNextMatchday(esp_http_client_event_t* evt) {
+    return handleMatchdayEvent(evt, ligaNextMatchdayModel);
+}
+
 /**
- * @brief Builds a list of upcoming matches for the current matchday, optionally offset by ONE to check next Matchday.
- * Constructs the appropriate OpenLigaDB API URL and performs an HTTPS request to retrieve match data.
- * Validates the matchday range and logs diagnostics if verbose mode is enabled.
+ * @brief Fetches all matches of the current matchday, or with offset ONE of the following matchday,
+ * into their MatchdayModel. One conditional GET replaces the former requests for live matches,
+ * next match list and next kickoff.
  *
- * @param matchdayOffset Offset from the current matchday (can be positive or negative).
- * @return true If the request was successful and match data was retrieved.
+ * @param matchdayOffset 0: current matchday (ligaMatchdayModel), 1: following matchday (ligaNextMatchdayModel)
+ * @return true If the request was successful.
  * @return false If the matchday is invalid or the HTTP request failed.
  */
-bool LigaTable::pollForNextMatchList(int matchdayOffset) {
-    int offset = matchdayOffset;                                                // to be transfered to event handler
+bool LigaTable::pollForMatches(int matchdayOffset) {
+    int matchday = ligaMatchday + matchdayOffset;                               // to be transfered to event handler
     // Validate matchday range (1..ligaMaxMatchday inclusive); matchdays = (teams - 1) * 2 -> BL1/BL2: 34, BL3: 38
     int ligaMaxMatchday = (ligaMaxTeams - 1) * 2;
-    if (ligaMatchday + matchdayOffset > ligaMaxMatchday || ligaMatchday + matchdayOffset < 1) {
-        Liga->ligaPrintln("pollForNextMatchList: invalide %d (current matchday %d, max %d)", ligaMatchday + matchdayOffset, ligaMatchday,
-                          ligaMaxMatchday);
+    if (matchday > ligaMaxMatchday || matchday < 1) {
+        ligaPrintln("pollForMatches: invalide %d (current matchday %d, max %d)", matchday, ligaMatchday, ligaMaxMatchday);
         return false;
     }
 
     // Construct API URL for match data
-    String url = "https://api.openligadb.de/getmatchdata/" + String(leagueShortcut(activeLeague)) + "/" + String(ligaSeason) + "/" +
-                 String(ligaMatchday + matchdayOffset);
-
-    // Configure HTTP client for secure request
-    esp_http_client_config_t config = {};
-    config.url                      = url.c_str();
-    config.host                     = "api.openligadb.de";
-    config.user_agent               = flapUserAgent;
-    config.use_global_ca_store      = false;
-    config.event_handler            = _http_event_handler_pollForNextMatchList;
-    config.cert_pem                 = OPENLIGA_CA;
-    config.buffer_size              = 2048;
-    config.timeout_ms               = 5000;
-    config.user_data                = (void*)&offset;                           // matchday offset
+    String url =
+        "https://api.openligadb.de/getmatchdata/" + String(leagueShortcut(ligaLeague)) + "/" + String(ligaSeason) + "/" + String(matchday);
 
     #ifdef LIGAVERBOSE
         {
         TraceScope trace;
-        ligaPrintln("get next match list for %s: season = %d, matchday = %d", leagueName(activeLeague), ligaSeason,
-        ligaMatchday + matchdayOffset);                                         ///< Log request details
+        ligaPrintln("get matches for %s: season = %d, matchday = %d", leagueName(ligaLeague), ligaSeason, matchday);
         }
     #endif
 
-    // Initialize HTTP client
-    esp_http_client_handle_t client = esp_http_client_init(&config);
-    if (!client)
-        return false;
-
-    // Perform HTTPS request
-    esp_err_t err = esp_http_client_perform(client);
-    esp_http_client_close(client);
-    esp_http_client_cleanup(client);
-    client = nullptr;
+    // Perform HTTPS request on persistent session, every model has its own cache slot
+    MatchdayModel&       model   = matchdayOffset ? ligaNextMatchdayModel : ligaMatchdayModel;
+    http_event_handle_cb handler = matchdayOffset ? _http_event_handler_pollForNextMatchday : _http_event_handler_pollForMatches;
+    bool                 reuse   = model.matchday() == matchday;                // model holds this matchday
+    esp_err_t            err     = openLigaDB.getIfChanged(url.c_str(), handler, (void*)&matchday, reuse);
 
     if (err != ESP_OK) {
-        ligaPrintln("poll next match list HTTP-Fehler: %s", esp_err_to_name(err)); ///< Log error
+        ligaPrintln("poll matches HTTP-Fehler: %s", esp_err_to_name(err));
         return false;
     }
+    return true;
+}
 
-    return err == ESP_OK;                                                       ///< Return true if request succeeded
+// model with the next kickoffs: current matchday, after its last kickoff the following one
+static const MatchdayModel& upcomingMatchday(time_t now) {
+    if (ligaMatchdayModel.nextKickoff(now) == MATCHDAY_NEVER && ligaNextMatchdayModel.matchday() == ligaMatchday + 1)
+        return ligaNextMatchdayModel;
+    return ligaMatchdayModel;
+}
+
+/**
+ * @brief live matches of the matchday from the MatchdayModel (CALC_LIVE_MATCHES)
+ */
+static void updateLiveMatches() {
+    for (int i = 0; i < MAX_MATCHES_PER_MATCHDAY; ++i)                          // reset live matches
+        liveMatches[i].clear();
+
+    ligaLiveMatchCount = ligaMatchdayModel.liveMatches(time(nullptr), liveMatches);
+    for (int i = 0; i < ligaLiveMatchCount; ++i)
+        Liga->ligaPrintln("LIVE: %s vs %s", liveMatches[i].team1.c_str(), liveMatches[i].team2.c_str());
+
+    matchIsLive = (ligaLiveMatchCount > 0);                                     // actualize live match flag
+    if (!matchIsLive)
+        Liga->ligaPrintln("no Live-Match detected");
+}
+
+/**
+ * @brief next (nearest kickoff) and planned matches from the MatchdayModel (CALC_NEXT_MATCH_LIST)
+ */
+static void updateNextMatchList() {
+    const time_t         now   = time(nullptr);
+    const MatchdayModel& model = upcomingMatchday(now);
+
+    for (int i = 0; i < MAX_MATCHES_PER_MATCHDAY; i++) {
+        nextMatches[i].clear();                                                 ///< Clear next matches array
+        planMatches[i].clear();                                                 ///< Clear planned matches array
+    }
+    uint8_t planCount  = 0;
+    ligaNextMatchCount = model.nextMatches(now, nextMatches, planMatches, planCount);
+    ligaPlanMatchCount = planCount;
+
+    for (int i = 0; i < ligaNextMatchCount; i++)
+        Liga->ligaPrintln("next Match %u: %s vs %s", nextMatches[i].matchID, nextMatches[i].team1.c_str(), nextMatches[i].team2.c_str());
+    Liga->ligaPrintln("found next matches: %d for matchday: %d", ligaNextMatchCount, model.matchday());
+    Liga->ligaPrintln("found planned matches: %d for matchday: %d", ligaPlanMatchCount, model.matchday());
+}
+
+/**
+ * @brief next kickoff of the league from the MatchdayModel (CALC_NEXT_KICKOFF)
+ */
+static void updateNextKickoff() {
+    const time_t now     = time(nullptr);
+    const time_t kickoff = upcomingMatchday(now).nextKickoff(now);
+    if (kickoff == MATCHDAY_NEVER) {
+        // At season end (last matchday reached) the league has no next match. Keep relaxed polling via nextKickoffFarAway.
+        if (ligaMatchday >= (ligaMaxTeams - 1) * 2)
+            Liga->ligaPrintln("no next kickoff: season has ended (matchday %d is the last)", ligaMatchday);
+        nextKickoffChanged = false;
+        nextKickoffFarAway = true;                                              // no upcoming match -> stay in relaxed polling
+        return;
+    }
+
+    char      buf[24];
+    struct tm tmKickoff;
+    localtime_r(&kickoff, &tmKickoff);
+    strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%S", &tmKickoff);                // same format as openLigaDB
+    nextKickoffString       = buf;
+    currentNextKickoffTime  = kickoff;                                          // save next Kickoff time
+    nextKickoffChanged      = (currentNextKickoffTime != previousNextKickoffTime);
+    previousNextKickoffTime = currentNextKickoffTime;
+    showNextKickoff();
 }
 /*
 //
@@ -758,15 +961,15 @@ void calculateDeltasForMatch(uint32_t matchID) {
 */
 
 // ============================================================================
-// @brief Safely append incoming HTTP data chunks to a fixed-size char buffer.
+// @brief Feed incoming HTTP data chunks into the JSON stream parser.
 // @param evt                Pointer to the ESP HTTP client event structure.
+// @param handler            Receives the values of this endpoint while streaming.
+// @param context            Passed through to handler.
 // ============================================================================
-bool readHttpResult(esp_http_client_event_t* evt) {
-    if (!jsonBufferPrepared) {
-        jsonBufferPos      = 0;
-        realJsonBufferSize = 0;
-        jsonBufferPrepared = true;
-        memset(jsonBuffer, 0, sizeof(jsonBuffer));                              // clear buffer
+bool readHttpResult(esp_http_client_event_t* evt, JsonStreamHandler handler, void* context) {
+    if (!jsonStreamPrepared) {
+        ligaJson.begin(handler, context);                                       // first chunk of a new body
+        jsonStreamPrepared = true;
     }
 
     if (evt->data_len == 0 || evt->data == nullptr) {
@@ -774,61 +977,215 @@ bool readHttpResult(esp_http_client_event_t* evt) {
         return false;
     }
 
-    size_t copyLen = evt->data_len;
-    if (jsonBufferPos + copyLen >= sizeof(jsonBuffer)) {                        // prevent buffer overflow
-        copyLen = sizeof(jsonBuffer) - jsonBufferPos - 1;
-        Serial.printf("[read HTTP result] JSON buffer overflow (%u bytes truncated)\n", evt->data_len - copyLen);
+    if (!ligaJson.feed((const char*)evt->data, evt->data_len)) {                // parse chunk, nothing is copied
+        Serial.printf("[read HTTP result] JSON syntax error near byte %u\n", (unsigned)ligaJson.bytes());
+        return false;
     }
-
-    memcpy(&jsonBuffer[jsonBufferPos], evt->data, copyLen);                     // copy http result to jsonBuffer
-    jsonBufferPos += copyLen;
-    realJsonBufferSize += copyLen;
-
     return true;
 }
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 
-// --- Variante 1: ohne Filter ---
-bool deserializeHttpResult(DynamicJsonDocument& doc) {
-    if (!jsonBufferPrepared || realJsonBufferSize == 0) {
-        Serial.println("[deserializeHttpResult] Buffer not prepared or empty");
+// ============================================================================
+// @brief End of HTTP body: check that the streamed JSON was complete.
+// @return true if one complete JSON value was parsed
+// ============================================================================
+bool finishHttpResult() {
+    if (!jsonStreamPrepared || ligaJson.bytes() == 0) {
+        Serial.println("[finishHttpResult] Stream not prepared or empty");
+        jsonStreamPrepared = false;                                             // next body starts a new stream
+        openLigaDB.forget();                                                    // body not used -> next request is a full one
         return false;
     }
 
-    Liga->ligaPrintln("JSON-Buffer used size vs real size: %d : %d", realJsonBufferSize, sizeof(jsonBuffer));
-    DeserializationError error = deserializeJson(doc, jsonBuffer);
-    if (error) {
-        Serial.printf("[deserializeHttpResult] JSON error: %s\n", error.c_str());
+    Liga->ligaPrintln("JSON-Stream parsed size vs parser size: %u : %u", (unsigned)ligaJson.bytes(), (unsigned)JsonStream::footprint());
+    if (!ligaJson.finish()) {
+        Serial.println("[finishHttpResult] JSON incomplete or invalid");
+        jsonStreamPrepared = false;
+        openLigaDB.forget();
         return false;
     }
     return true;
 }
 
-// --- Variante 2: mit Filter ---
-template <typename TFilter>
-bool deserializeHttpResult(DynamicJsonDocument& doc, const TFilter& filter) {
-    if (!jsonBufferPrepared || realJsonBufferSize == 0) {
-        Serial.println("[deserializeHttpResult] Buffer not prepared or empty");
+// ============================================================================
+// @brief Conditional GET: is the body the same the handler processed last time?
+//        Counts hit/miss of the current PollScope. Call before finishHttpResult(),
+//        a 304 has no body to finish.
+// @return true if the handler keeps its data (no rebuild, no snapshot swap, no redraw)
+// ============================================================================
+bool unchangedHttpResult() {
+    const int scope = (int)currentPollScope;
+    if (!openLigaDB.unchanged()) {
+        if (scope < POLL_SCOPE_COUNT)
+            pollCacheMisses[scope]++;
         return false;
     }
 
-    Liga->ligaPrintln("JSON-Buffer used size vs real size: %d : %d", realJsonBufferSize, sizeof(jsonBuffer));
-    DeserializationError error = deserializeJson(doc, jsonBuffer, DeserializationOption::Filter(filter));
-    if (error) {
-        Serial.printf("[deserializeHttpResult] JSON (filtered) error: %s\n", error.c_str());
-        return false;
-    }
+    if (scope < POLL_SCOPE_COUNT)
+        pollCacheHits[scope]++;
+    jsonStreamPrepared = false;                                                 // streamed body (if any) is not used
+
+    #ifdef LIGAVERBOSE
+        {
+        TraceScope trace;
+        Liga->ligaPrintln("%s: payload unchanged -> keep data", pollScopeToString(currentPollScope));
+        }
+    #endif
     return true;
 }
 
-#pragma GCC diagnostic pop
+// ---- state of one getmatchdata/<matchID> body while its goals are streamed ----
+struct StreamGoal {
+    uint32_t goalID;
+    uint8_t  minute;
+    uint8_t  scoreTeam1;
+    uint8_t  scoreTeam2;
+    bool     isPenalty;
+    bool     isOwnGoal;
+    bool     isOvertime;
+    char     scorer[48];                                                        // goalGetterName
+};
+static StreamGoal  streamGoal;                                                  // goal that is streamed right now
+static StreamMatch streamGoalMatch;                                             // matchID and matchIsFinished of body
+static int         streamMatchIndex = -1;                                       // index in liveMatches[] of requested match
+static int         streamFirstGoal  = 0;                                        // first entry in goalsInfos[] of this match
+
+// decoder for the match object of getmatchdata/<matchID>
+struct GoalMatchDecoder {
+    typedef StreamMatch        Record;
+    static constexpr JsonField fields[] = {
+        JSON_FIELD("matchID", StreamMatch, matchID),
+        JSON_FIELD("matchIsFinished", StreamMatch, finished),
+    };
+};
+
+// decoder for goals[] of getmatchdata/<matchID>, one record per goal
+struct GoalDecoder {
+    typedef StreamGoal         Record;
+    static constexpr uint32_t  record   = jsonPath("goals[]");
+    static constexpr JsonField fields[] = {
+        JSON_FIELD("goals[].goalID", StreamGoal, goalID),
+        JSON_FIELD("goals[].matchMinute", StreamGoal, minute),
+        JSON_FIELD("goals[].scoreTeam1", StreamGoal, scoreTeam1),
+        JSON_FIELD("goals[].scoreTeam2", StreamGoal, scoreTeam2),
+        JSON_FIELD("goals[].goalGetterName", StreamGoal, scorer),
+        JSON_FIELD("goals[].isPenalty", StreamGoal, isPenalty),
+        JSON_FIELD("goals[].isOwnGoal", StreamGoal, isOwnGoal),
+        JSON_FIELD("goals[].isOvertime", StreamGoal, isOvertime),
+    };
+};
+
+/**
+ * @brief store one streamed goal in goalsInfos[] and log it
+ */
+static void storeStreamGoal() {
+    const MatchInfo& match   = liveMatches[streamMatchIndex];
+    const uint32_t   matchID = streamGoalMatch.matchID ? streamGoalMatch.matchID : (uint32_t)liveMatchID; // matchID precedes goals
+    const GoalAdmit  admit   = liveGoals.admit(streamGoal.goalID);              // O(1), no scan over goalsInfos[]
+    if (admit == GOAL_DUPLICATE) {
+        Liga->ligaPrintln("goal %lu of matchID = %lu streamed twice - ignored", (unsigned long)streamGoal.goalID, (unsigned long)matchID);
+        return;
+    }
+
+    // determine scoring team from the score before this goal
+    const LiveMatchGoalInfo* before = liveGoals.latest(matchID);
+    prevScoreTeam1                  = before ? before->scoreTeam1 : 0;
+    prevScoreTeam2                  = before ? before->scoreTeam2 : 0;
+
+    currScoreTeam1          = streamGoal.scoreTeam1;
+    currScoreTeam2          = streamGoal.scoreTeam2;
+    std::string scoringTeam = "";
+
+    // Team 1 scored
+    if (currScoreTeam1 > prevScoreTeam1 && match.team1.length() > 0) {
+        scoringTeam = match.team1;
+    }
+    // Team 2 scored
+    else if (currScoreTeam2 > prevScoreTeam2 && match.team2.length() > 0) {
+        scoringTeam = match.team2;
+    }
+
+    if (admit == GOAL_NEW)                                                      // goals of earlier cycles are stored silently
+        Liga->ligaPrintln("Goal in matchID = %d for %s in minute %u' scored by %s: %s - %s", liveMatchID, scoringTeam.c_str(), streamGoal.minute,
+                          streamGoal.scorer, match.team1.c_str(), match.team2.c_str());
+
+    /// @brief Optionally store goal data if within matchday limit.
+    if (LiveMatchGoalInfo* stored = liveGoals.add(matchID)) {                   // becomes the latest goal of this match
+        auto& liveGoal         = *stored;
+        liveGoal.goalID        = streamGoal.goalID;
+        liveGoal.goalMinute    = streamGoal.minute;
+        liveGoal.scoreTeam1    = streamGoal.scoreTeam1;
+        liveGoal.scoreTeam2    = streamGoal.scoreTeam2;
+        liveGoal.result        = String(streamGoal.scoreTeam1) + ":" + String(streamGoal.scoreTeam2);
+        liveGoal.scoringPlayer = streamGoal.scorer;
+        liveGoal.scoringTeam   = scoringTeam.c_str();
+        liveGoal.isOwnGoal     = streamGoal.isOwnGoal;
+        liveGoal.isPenalty     = streamGoal.isPenalty;
+        liveGoal.isOvertime    = streamGoal.isOvertime;
+
+        if (admit == GOAL_NEW) {
+            lastGoalID = streamGoal.goalID;                                     ///< Update last processed goal ID.
+            if (Push && ligaLeague == activeLeague)
+                Push->goal(liveGoal);                                           // subscribers of the shown league get it in milliseconds
+        }
+    }
+}
+
+/**
+ * @brief remove goals of an incomplete or foreign body from goalsInfos[]
+ */
+static void rollbackStreamGoals() {
+    if (streamMatchIndex < 0)
+        return;                                                                 // nothing stored for this body
+    liveGoals.rollback(streamFirstGoal);
+    streamMatchIndex = -1;
+}
+
+/**
+ * @brief JSON stream handler for getmatchdata/<matchID>
+ *
+ * goals are stored in goalsInfos[] as soon as each goal object is complete,
+ * a 0:0 entry is reserved in front of them.
+ */
+static void streamLiveGoals(JsonStream& json, JsonStreamEvent event, void*) {
+    if (event == JSON_OBJECT_BEGIN && json.pathHash() == JSON_PATH_ROOT) {      // begin of match object
+        streamMatchIndex = -1;
+        for (int i = 0; i < ligaLiveMatchCount; i++) {                          // search matchIndex in liveMatches[i]
+            if (liveMatches[i].matchID == (uint32_t)liveMatchID) {
+                streamMatchIndex = i;
+            }
+        }
+        memset(&streamGoalMatch, 0, sizeof(streamGoalMatch));
+        streamFirstGoal = liveGoalCount;
+
+        if (streamMatchIndex >= 0) {                                            // Dummy-Eintrag 0:0 (mit Bounds-Check)
+            if (LiveMatchGoalInfo* kickoff = liveGoals.add(liveMatchID))
+                kickoff->result = "0:0";
+        }
+        return;
+    }
+    if (streamMatchIndex < 0)
+        return;                                                                 // match is not live, ignore body
+
+    if (json.pathHash() == GoalDecoder::record) {
+        if (event == JSON_OBJECT_BEGIN)
+            memset(&streamGoal, 0, sizeof(streamGoal));
+        else if (event == JSON_OBJECT_END)
+            storeStreamGoal();                                                  // goal complete
+        return;
+    }
+    if (event != JSON_VALUE)
+        return;
+
+    if (!jsonDecode<GoalDecoder>(json, streamGoal))
+        jsonDecode<GoalMatchDecoder>(json, streamGoalMatch);
+}
+
 /**
  * @brief HTTP event handler for polling goals in live matches.
  *
  * This function processes HTTP events received during a request to fetch goal data
- * for live football matches. It handles incoming data, parses JSON, and extracts
- * goal-related information for further processing and display.
+ * for live football matches. Goals are extracted from the JSON stream while the
+ * data arrives; on finish the match is checked and the live state is updated.
  *
  * @param evt Pointer to the HTTP client event structure.
  * @return esp_err_t ESP_OK on success.
@@ -837,138 +1194,46 @@ esp_err_t _http_event_handler_pollForGoalsInLiveMatches(esp_http_client_event_t*
     int matchIndex = -1;
     switch (evt->event_id) {
         case HTTP_EVENT_ON_DATA: {
-            if (readHttpResult(evt)) {
+            if (readHttpResult(evt, streamLiveGoals)) {
                 vTaskDelay(1);                                                  // feed watch dog
             } else {
-                Liga->ligaPrintln("(_http_event_handler_pollForGoalsInLiveMatches) JSON-Buffer error");
+                Liga->ligaPrintln("(_http_event_handler_pollForGoalsInLiveMatches) JSON-Stream error");
             }
             break;
         }
         case HTTP_EVENT_ON_FINISH: {
             for (int i = 0; i < ligaLiveMatchCount; i++) {                      // search matchIndex in liveMatches[i]
-                if (liveMatches[i].matchID == liveMatchID) {
+                if (liveMatches[i].matchID == (uint32_t)liveMatchID) {
                     matchIndex = i;
                 }
             }
             if (matchIndex < 0) {                                               // liveMatchID nicht in liveMatches[] -> sonst liveMatches[-1]
                 Liga->ligaPrintln("(pollForGoals) matchID %d nicht in liveMatches[] - uebersprungen", liveMatchID);
+                rollbackStreamGoals();
+                jsonStreamPrepared = false;                                     // keep-alive: next body needs a fresh parser
                 break;
             }
 
-            #pragma GCC diagnostic push
-            #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-            DynamicJsonDocument doc(realJsonBufferSize * 1.2);
-            #pragma GCC diagnostic pop
-            if (!deserializeHttpResult(doc)) {
-                Liga->ligaPrintln("(_http_event_handler_pollForGoalsInLiveMatches) JSON-Buffer not deserialized");
-                jsonBufferPrepared = false;
+            if (!finishHttpResult()) {
+                Liga->ligaPrintln("(_http_event_handler_pollForGoalsInLiveMatches) JSON-Stream not parsed");
+                rollbackStreamGoals();                                          // drop goals of incomplete body
+                jsonStreamPrepared = false;
                 break;
             }
 
-            /// @brief Extract team names from JSON.
-            String team1Name = doc["team1"]["teamName"] | "";
-            String team2Name = doc["team2"]["teamName"] | "";
-
-            uint32_t matchID = doc["matchID"] | 0;
-            if (matchID != liveMatchID) {                                       ///< is goals matchID same as matchID from requested live match
+            if (streamGoalMatch.matchID != (uint32_t)liveMatchID) {             ///< is goals matchID same as matchID from requested live match
                 // Serial.printf("Live match ID = %d not found\n", liveMatchID);
-                return false;                                                   ///< live match not found.
-            }
-
-            if (doc["matchID"] != 0 && liveGoalCount < MAX_GOALS_PER_MATCHDAY) {  // Dummy-Eintrag 0:0 (mit Bounds-Check)
-                goalsInfos[liveGoalCount].matchID       = doc["matchID"];
-                goalsInfos[liveGoalCount].goalID        = 0;
-                goalsInfos[liveGoalCount].scoreTeam1    = 0;
-                goalsInfos[liveGoalCount].scoreTeam2    = 0;
-                goalsInfos[liveGoalCount].goalMinute    = 0;
-                goalsInfos[liveGoalCount].result        = "0:0";
-                goalsInfos[liveGoalCount].scoringTeam   = "";
-                goalsInfos[liveGoalCount].scoringPlayer = "";
-                goalsInfos[liveGoalCount].isOwnGoal     = false;
-                goalsInfos[liveGoalCount].isOvertime    = false;
-                goalsInfos[liveGoalCount].isPenalty     = false;
-                liveGoalCount++;                                                // next goal
-            }
-
-            prevScoreTeam1 = 0;
-            prevScoreTeam2 = 0;
-
-            JsonArray goals = doc["goals"];
-
-            /// @brief Iterate over all goal entries in the JSON array.
-            for (JsonObject goal : goals) {
-                vTaskDelay(1);                                                  // feed watch dog
-                /// @brief Extract goal details.
-                uint32_t    goalID     = goal["goalID"] | 0;
-                uint8_t     minute     = goal["matchMinute"] | 0;
-                uint8_t     scoreTeam1 = goal["scoreTeam1"] | 0;
-                uint8_t     scoreTeam2 = goal["scoreTeam2"] | 0;
-                uint32_t    scorerID   = goal["goalGetterID"] | 0;
-                const char* scorer     = goal["goalGetterName"] | "";
-                bool        isPenalty  = goal["isPenalty"] | false;
-                bool        isOwnGoal  = goal["isOwnGoal"] | false;
-                bool        isOvertime = goal["isOvertime"] | false;
-                const char* comment    = goal["comment"] | "";
-
-                // determine scoring team
-                currScoreTeam1          = scoreTeam1;
-                currScoreTeam2          = scoreTeam2;
-                std::string scoringTeam = "";
-
-                // Team 1 scored
-                if (currScoreTeam1 > prevScoreTeam1 && liveMatches[matchIndex].team1.length() > 0) {
-                    scoringTeam = liveMatches[matchIndex].team1;
-                }
-                // Team 2 scored
-                else if (currScoreTeam2 > prevScoreTeam2 && liveMatches[matchIndex].team2.length() > 0) {
-                    scoringTeam = liveMatches[matchIndex].team2;
-                }
-
-                Liga->ligaPrintln("Goal in matchID = %d for %s in minute %u' scored by %s: %s - %s", liveMatchID, scoringTeam.c_str(), minute, scorer,
-                                  liveMatches[matchIndex].team1.c_str(), liveMatches[matchIndex].team2.c_str());
-
-                /// @brief Display goal details if it's a new goal.
-                // if (goalID > lastGoalID) {
-                /*
-                                                        Serial.println("⚽ Goal-EVENT");
-                                                        Serial.printf(" → Goal-ID: %u\n", goalID);
-                                                        Serial.printf(" → Minute: %u\n", minute);
-                                                        Serial.printf(" → Score: %u:%u\n", scoreTeam1, scoreTeam2);
-                                                        Serial.printf(" → Scorer: %s (ID: %u)\n", scorer, scorerID);
-                                                        Serial.printf(" → Penalty: %s\n", isPenalty ? "yes" : "no");
-                                                        Serial.printf(" → Own goal: %s\n", isOwnGoal ? "yes" : "no");
-                                                        Serial.printf(" → Overtime: %s\n", isOvertime ? "yes" : "no");
-                                                        if (comment && strlen(comment) > 0) {
-                                                            Serial.printf(" → Comment: %s\n", comment);
-                                                        }
-                                                        Serial.println("-----------------------------");
-                                    */
-                //}
-
-                /// @brief Optionally store goal data if within matchday limit.
-                if (liveGoalCount < MAX_GOALS_PER_MATCHDAY) {
-                    auto& liveGoal         = goalsInfos[liveGoalCount];          // Referenz erst nach dem Bounds-Check bilden
-                    liveGoal.goalID        = goalID;
-                    liveGoal.matchID       = matchID;
-                    liveGoal.goalMinute    = minute;
-                    liveGoal.scoreTeam1    = scoreTeam1;
-                    liveGoal.scoreTeam2    = scoreTeam2;
-                    liveGoal.result        = String(scoreTeam1) + ":" + String(scoreTeam2);
-                    liveGoal.scoringPlayer = scorer;
-                    liveGoal.scoringTeam   = scoringTeam.c_str();
-                    liveGoal.isOwnGoal     = isOwnGoal;
-                    liveGoal.isPenalty     = isPenalty;
-                    liveGoal.isOvertime    = isOvertime;
-
-                    lastGoalID = goalID;                                        ///< Update last processed goal ID.
-                    liveGoalCount++;                                            // next goal
-                }
+                rollbackStreamGoals();
+                jsonStreamPrepared = false;
+                return ESP_OK;                                                  ///< live match not found.
             }
+            streamMatchIndex = -1;                                              // goals of this body are final
 
             /// @brief Check if the match has finished.
-            bool matchFinished = doc["matchIsFinished"] | false;
-            if (matchFinished)
+            if (streamGoalMatch.finished) {
                 ligaFiniMatchCount++;                                           ///< Increment finished match counter.
+                ligaMatchdayModel.matchFinished(liveMatchID);                   // live list and table again, no request
+            }
 
             /// @brief Log if no goals were found during polling.
             matchIsLive = (ligaLiveMatchCount > 0);                             // actualize live match flag
@@ -981,22 +1246,20 @@ esp_err_t _http_event_handler_pollForGoalsInLiveMatches(esp_http_client_event_t*
                 matchIsLive = false;                                            ///< Reset live match flag.
             }
 
-            realJsonBufferSize = 0;
-            jsonBufferPrepared = false;
+            jsonStreamPrepared = false;
             break;
         }
 
         case HTTP_EVENT_DISCONNECTED:
-            jsonBufferPrepared = false;
-            realJsonBufferSize = 0;
+            rollbackStreamGoals();                                              // body was not finished
+            jsonStreamPrepared = false;
             break;
 
         case HTTP_EVENT_ERROR:
             /// @brief Handle HTTP error event.
-            // Liga->ligaPrintln("(_http_event_handler_pollForGoalsInLiveMatches) JSON-Buffer reserved: %d", jsonBuffer.capacity());
             Serial.println("Error while fetching goal data.");
-            jsonBufferPrepared = false;
-            realJsonBufferSize = 0;
+            rollbackStreamGoals();
+            jsonStreamPrepared = false;
             break;
     }
 
@@ -1012,13 +1275,8 @@ esp_err_t _http_event_handler_pollForGoalsInLiveMatches(esp_http_client_event_t*
  *
  */
 void pollForGoalsInLiveMatches() {
-    liveGoalCount      = 0;
-    ligaFiniMatchCount = 0;                                                     ///< Reset counters for goals and finished matches.
-
-    /// @brief Clear all stored goal information from previous polling.
-    for (int i = 0; i < MAX_GOALS_PER_MATCHDAY; ++i) {
-        goalsInfos[i].clear();
-    }
+    ligaFiniMatchCount = 0;                                                     ///< Reset counter for finished matches.
+    liveGoals.beginCycle();                                                     // goals of previous polling cleared, seen goal IDs stay
 
     /// @brief Iterate over all currently live matches.
     for (ligaLiveMatchIndex = 0; ligaLiveMatchIndex < ligaLiveMatchCount; ++ligaLiveMatchIndex) {
@@ -1027,189 +1285,12 @@ void pollForGoalsInLiveMatches() {
         /// @brief Construct the API URL for the current match.
         String url = "https://api.openligadb.de/getmatchdata/" + String(liveMatchID);
 
-        /// @brief Configure the HTTP client for the API request.
-        esp_http_client_config_t config    = {};
-        config.url                         = url.c_str();
-        config.host                        = "api.openligadb.de";
-        config.user_agent                  = flapUserAgent;
-        config.event_handler               = _http_event_handler_pollForGoalsInLiveMatches;
-        config.cert_pem                    = OPENLIGA_CA;
-        config.use_global_ca_store         = false;
-        config.skip_cert_common_name_check = false;
-        config.buffer_size                 = 2048;
-        config.timeout_ms                  = 5000;
-
-        /// @brief Initialize the HTTP client.
-        esp_http_client_handle_t client = esp_http_client_init(&config);
-        if (client == NULL) {
-            Liga->ligaPrintln("HTTP-Client error while initializing");
-            continue;                                                           ///< Skip to next match if client setup fails.
-        }
-
-        /// @brief Perform the HTTP request to fetch match data.
-        esp_err_t err = esp_http_client_perform(client);
-        esp_http_client_close(client);
-        esp_http_client_cleanup(client);
-        client = nullptr;
+        /// @brief Perform the HTTP request to fetch match data on the persistent session (paced, no fixed delay).
+        esp_err_t err = openLigaDB.get(url.c_str(), _http_event_handler_pollForGoalsInLiveMatches);
 
         if (err != ESP_OK) {
             Liga->ligaPrintln("error while request for live goals: %s", esp_err_to_name(err));
         }
-        /// @brief Delay between requests to avoid overloading the API.
-        vTaskDelay(pdMS_TO_TICKS(2000));
-    }
-}
-
-esp_err_t _http_event_handler_pollForLiveMatches(esp_http_client_event_t* evt) {
-    const char* kickoffStr  = "";
-    time_t      kickoffTime = {};
-
-    switch (evt->event_id) {
-        case HTTP_EVENT_ON_DATA: {
-            if (readHttpResult(evt)) {
-                vTaskDelay(1);                                                  // feed watch dog
-            } else {
-                Liga->ligaPrintln("(_http_event_handler_pollForLiveMatches) JSON-Buffer error");
-            }
-            break;
-        }
-
-        case HTTP_EVENT_ON_FINISH: {
-            #pragma GCC diagnostic push
-            #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-            StaticJsonDocument<512> filter;
-            #pragma GCC diagnostic pop
-            filter[0]["matchID"]           = true;
-            filter[0]["matchDateTime"]     = true;
-            filter[0]["matchIsFinished"]   = true;
-            filter[0]["team1"]["teamName"] = true;
-            filter[0]["team2"]["teamName"] = true;
-
-            #pragma GCC diagnostic push
-            #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-            DynamicJsonDocument doc(realJsonBufferSize * 1.2);
-            #pragma GCC diagnostic pop
-            if (!deserializeHttpResult(doc, DeserializationOption::Filter(filter))) {
-                Liga->ligaPrintln("(_http_event_handler_pollForLiveMatches) JSON-Buffer not deserialized");
-                jsonBufferPrepared = false;
-                break;
-            }
-
-            for (int i = 0; i < MAX_MATCHES_PER_MATCHDAY; ++i)                  // reset live matches
-                liveMatches[i].clear();
-
-            ligaLiveMatchCount  = 0;                                            // init count of live matches
-            const time_t now    = time(nullptr);
-            const time_t maxAge = MAX_MATCH_DURATION;
-
-            for (JsonObject match : doc.as<JsonArray>()) {
-                if (match["matchIsFinished"] == true)
-                    continue;                                                   // skipp finished matches
-
-                kickoffStr = match["matchDateTime"];
-                if (!kickoffStr)
-                    continue;                                                   // skip match without kickoff
-
-                struct tm tmKickoff = {};
-                if (!strptime(kickoffStr, "%Y-%m-%dT%H:%M:%S", &tmKickoff)) {
-                    Liga->ligaPrintln("Ungültiges Datum: %s", kickoffStr);
-                    continue;                                                   // skip match with invalide kickoff
-                }
-
-                tmKickoff.tm_isdst = -1;
-                kickoffTime        = mktime(&tmKickoff);
-                double delta       = difftime(now, kickoffTime);
-
-                if (delta >= 0 && delta <= maxAge) {
-                    const char* name1 = match["team1"]["teamName"];
-                    const char* name2 = match["team2"]["teamName"];
-
-                    if (name1 && name2) {
-                        Liga->ligaPrintln("LIVE: %s vs %s", name1, name2);
-                        Liga->ligaPrintln("Kickoff since: %s", kickoffStr);
-                    } else {
-                        Liga->ligaPrintln("LIVE-Match recognized, but TeamName missing");
-                    }
-
-                    liveMatches[ligaLiveMatchCount].matchID = match["matchID"] | 0;
-                    liveMatches[ligaLiveMatchCount].kickoff = kickoffTime;
-                    liveMatches[ligaLiveMatchCount].team1   = name1;
-                    liveMatches[ligaLiveMatchCount].team2   = name2;
-                    ligaLiveMatchCount++;
-                    Liga->ligaPrintln("Recognized Live-Match #: %d", ligaLiveMatchCount);
-                }
-
-                if (currentNextKickoffTime == 0 || kickoffTime < currentNextKickoffTime) {
-                    currentNextKickoffTime = kickoffTime;
-                    nextKickoffString      = kickoffStr;
-                    nextKickoffChanged     = true;
-                    showNextKickoff();
-                }
-            }
-
-            matchIsLive = (ligaLiveMatchCount > 0);                             // actualize live match flag
-            if (!matchIsLive)
-                Liga->ligaPrintln("no Live-Match detected");
-
-            jsonBufferPrepared = false;
-            realJsonBufferSize = 0;
-            break;
-        }
-
-        case HTTP_EVENT_DISCONNECTED:
-            jsonBufferPrepared = false;
-            realJsonBufferSize = 0;
-            break;
-
-        case HTTP_EVENT_ERROR: {
-            jsonBufferPrepared = false;
-            realJsonBufferSize = 0;
-            break;
-        }
-
-        default:
-            break;
-    }
-
-    return ESP_OK;
-}
-/**
- * @brief Fetches live matches of the current matchday and logs them.
- *
- * This method constructs a request URL for the OpenLigaDB API based on the active league,
- * season, and matchday. It initializes an HTTP client, performs the request, and delegates
- * response handling to the live match event handler.
- */
-void LigaTable::pollForLiveMatches() {
-    /// @brief Construct the API URL for the current matchday.
-    String url =
-        "https://api.openligadb.de/getmatchdata/" + String(leagueShortcut(activeLeague)) + "/" + String(ligaSeason) + "/" + String(ligaMatchday);
-
-    /// @brief Configure the HTTP client for the request.
-    esp_http_client_config_t config    = {};
-    config.url                         = url.c_str();
-    config.host                        = "api.openligadb.de";
-    config.user_agent                  = flapUserAgent;
-    config.use_global_ca_store         = false;
-    config.event_handler               = _http_event_handler_pollForLiveMatches;
-    config.cert_pem                    = OPENLIGA_CA;
-    config.use_global_ca_store         = false;
-    config.skip_cert_common_name_check = false;
-    config.buffer_size                 = 2048;
-    config.timeout_ms                  = 5000;
-
-    /// @brief Initialize the HTTP client.
-    esp_http_client_handle_t client = esp_http_client_init(&config);
-    if (client == NULL) {
-        Liga->ligaPrintln("HTTP client could not be initialized");
-        return;
-    }
-
-    /// @brief Perform the HTTP request to fetch live match data.
-    esp_err_t err = esp_http_client_perform(client);
-    esp_http_client_cleanup(client);
-    if (err != ESP_OK) {
-        Liga->ligaPrintln("Error while fetching live matches: %s", esp_err_to_name(err));
     }
 }
 
@@ -1263,134 +1344,44 @@ void showNextKickoff() {
     }
 }
 
-// Event-Handler to get kickoff date of next upcoming match
-esp_err_t _http_event_handler_pollForNextKickoff(esp_http_client_event_t* evt) {
-    switch (evt->event_id) {
-        case HTTP_EVENT_ON_DATA: {
-            if (readHttpResult(evt)) {
-                vTaskDelay(1);                                                  // feed watch dog
-            } else {
-                Liga->ligaPrintln("(_http_event_handler_pollForNextKickoff) JSON-Buffer error");
-            }
-            break;
-        }
-        case HTTP_EVENT_ON_FINISH: {
-            #pragma GCC diagnostic push
-            #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-            DynamicJsonDocument doc(realJsonBufferSize * 1.2);
-            #pragma GCC diagnostic pop
-            if (!deserializeHttpResult(doc)) {
-                Liga->ligaPrintln("(_http_event_handler_pollForNextKickoff) JSON-Buffer not deserialized");
-                break;
-            }
-
-            nextKickoffString = doc["matchDateTime"].as<std::string>();         // time string from request
-            if (!nextKickoffString.empty()) {
-                struct tm tmKickoff = {};
-                strptime(nextKickoffString.c_str(), "%Y-%m-%dT%H:%M:%S", &tmKickoff); //  Umwandlung in time_t
-                tmKickoff.tm_isdst     = -1;                                    // System soll Sommerzeit selbst erkennen
-                currentNextKickoffTime = mktime(&tmKickoff);                    // save next Kickoff time
-                if (currentNextKickoffTime != previousNextKickoffTime)
-                    nextKickoffChanged = true;
-                else
-                    nextKickoffChanged = false;
-
-                previousNextKickoffTime = currentNextKickoffTime;
-                showNextKickoff();
-
-            } else {
-                #ifdef LIGAVERBOSE
-                    {
-                    Liga->ligaPrintln("next Kickoff missing or empty");
-                    }
-                #endif
-            }
-
-            jsonBufferPrepared = false;
-            realJsonBufferSize = 0;
-            break;
-        }
-
-        case HTTP_EVENT_DISCONNECTED: {
-            jsonBufferPrepared = false;
-            realJsonBufferSize = 0;
-            break;
-        }
-        case HTTP_EVENT_ERROR: {
-            Liga->ligaPrintln("(_http_event_handler_pollForNextKickoff) undefined next kickoff");
-            nextKickoffString      = "";                                        // time string undefined
-            struct tm tmKickoff    = {};
-            currentNextKickoffTime = mktime(&tmKickoff);                        // undefined next Kickoff time
-            nextKickoffChanged     = false;
-            jsonBufferPrepared     = false;
-            realJsonBufferSize     = 0;
-            break;
-        }
-
-        default:
-            break;
-    }
-    return ESP_OK;
-}
-
-// Ermittlung des nächsten Anpfiffzeitpunkt
-bool LigaTable::pollForNextKickoff() {
-    String url = "https://api.openligadb.de/getnextmatchbyleagueshortcut/" + String(leagueShortcut(activeLeague));
-
-    esp_http_client_config_t config    = {};
-    config.url                         = url.c_str();
-    config.host                        = "api.openligadb.de";
-    config.user_agent                  = flapUserAgent;
-    config.event_handler               = _http_event_handler_pollForNextKickoff;
-    config.cert_pem                    = OPENLIGA_CA;
-    config.use_global_ca_store         = false;
-    config.skip_cert_common_name_check = false;
-    config.buffer_size                 = 100;
-    config.timeout_ms                  = 5000;
-
-    esp_http_client_handle_t client = esp_http_client_init(&config);
-    if (!client)
-        return false;
+// ---- matchday state from getlastchangedate and getcurrentgroup ----
+struct StreamMatchday {
+    char    lastChange[32];                                                     // "2025-08-22T21:15:37.573"
+    int32_t groupOrderID;                                                       // current matchday
+};
+static StreamMatchday streamMatchday;
+
+// decoder for getlastchangedate/<league>/<season>/<matchday>, body is a JSON string
+struct LastChangeDecoder {
+    typedef StreamMatchday     Record;
+    static constexpr JsonField fields[] = {
+        JSON_FIELD("", StreamMatchday, lastChange),                             // without quotes
+    };
+};
 
-    esp_err_t err = esp_http_client_perform(client);
-    esp_http_client_cleanup(client);
-    if (err != ESP_OK) {
-        #ifdef LIGAVERBOSE
-            {
-            TraceScope trace;
-            ligaPrintln("poll for next kickoff HTTP-Fehler: %s", esp_err_to_name(err));
-            }
-        #endif
-        return false;
-    }
-    if (nextKickoffChanged) {
-        #ifdef LIGAVERBOSE
-            {
-            TraceScope trace;
-            ligaPrintln("kickoff time has changed");
-            }
-        #endif
-    }
-    return true;
+// JSON stream handler for getlastchangedate/<league>/<season>/<matchday>
+static void streamLastChangeDate(JsonStream& json, JsonStreamEvent event, void*) {
+    if (event == JSON_VALUE)
+        jsonDecode<LastChangeDecoder>(json, streamMatchday);
 }
 
 // Event-Handler zur Ermittlung der letzten Änderung des aktuellen Spieltags
 esp_err_t _http_event_handler_pollForChanges(esp_http_client_event_t* evt) {
     switch (evt->event_id) {
         case HTTP_EVENT_ON_DATA: {
-            if (readHttpResult(evt)) {
+            if (readHttpResult(evt, streamLastChangeDate)) {
                 vTaskDelay(1);                                                  // feed watch dog
             } else {
-                Liga->ligaPrintln("(_http_event_handler_pollForTable) JSON-Buffer error");
+                Liga->ligaPrintln("(_http_event_handler_pollForChanges) JSON-Stream error");
             }
             break;
         }
 
         case HTTP_EVENT_ON_FINISH: {
-            Liga->ligaPrintln("JSON-Buffer used size vs real size: %d : %d", realJsonBufferSize, sizeof(jsonBuffer));
-            currentLastChangeOfMatchday = jsonBuffer;
-            currentLastChangeOfMatchday.remove(0, 1);                           // entfernt das erste Zeichen (das Anführungszeichen)
+            finishHttpResult();
+            currentLastChangeOfMatchday = streamMatchday.lastChange;
             currentLastChangeOfMatchday.remove(19);                             // entfernt alles ab Position 19 (also ".573")
+            streamMatchday.lastChange[0] = '\0';                                // consumed
 
             if (previousLastChangeOfMatchday != currentLastChangeOfMatchday) {
                 currentMatchdayChanged = true;
@@ -1429,19 +1420,16 @@ esp_err_t _http_event_handler_pollForChanges(esp_http_client_event_t* evt) {
                 }
             #endif
 
-            jsonBufferPrepared = false;
-            realJsonBufferSize = 0;
+            jsonStreamPrepared = false;
             break;
         }
 
         case HTTP_EVENT_DISCONNECTED: {
-            jsonBufferPrepared = false;
-            realJsonBufferSize = 0;
+            jsonStreamPrepared = false;
             break;                                                              // do same as when HTTP_EVENT_ERROR
         }
         case HTTP_EVENT_ERROR: {
-            jsonBufferPrepared = false;
-            realJsonBufferSize = 0;
+            jsonStreamPrepared = false;
         }
     }
 
@@ -1452,35 +1440,9 @@ esp_err_t _http_event_handler_pollForChanges(esp_http_client_event_t* evt) {
 bool LigaTable::pollForChanges() {
     // ausreichend groß für die komplette URL
     String url =
-        "https://api.openligadb.de/getlastchangedate/" + String(leagueShortcut(activeLeague)) + "/" + String(ligaSeason) + "/" + String(ligaMatchday);
-
-    esp_http_client_config_t config    = {};
-    config.url                         = url.c_str();
-    config.host                        = "api.openligadb.de";
-    config.event_handler               = _http_event_handler_pollForChanges;
-    config.user_agent                  = flapUserAgent;
-    config.cert_pem                    = OPENLIGA_CA;
-    config.use_global_ca_store         = false;
-    config.skip_cert_common_name_check = false;
-    config.buffer_size                 = 100;
-    config.timeout_ms                  = 5000;
-
-    esp_http_client_handle_t client = esp_http_client_init(&config);
-    if (!client) {
-        #ifdef ERRORVERBOSE
-            {
-            TraceScope trace;
-            ligaPrintln("HTTP-Client error");
-            }
-        #endif
-        currentMatchdayChanged = false;                                         // no change detected
-        return false;
-    }
+        "https://api.openligadb.de/getlastchangedate/" + String(leagueShortcut(ligaLeague)) + "/" + String(ligaSeason) + "/" + String(ligaMatchday);
 
-    esp_err_t err = esp_http_client_perform(client);
-    esp_http_client_close(client);
-    esp_http_client_cleanup(client);
-    client = nullptr;
+    esp_err_t err = openLigaDB.get(url.c_str(), _http_event_handler_pollForChanges);
 
     if (err != ESP_OK) {
         if (err == ESP_ERR_HTTP_CONNECT)
@@ -1498,6 +1460,20 @@ bool LigaTable::pollForChanges() {
     return err == ESP_OK;
 }
 
+// decoder for getcurrentgroup/<league>
+struct CurrentMatchdayDecoder {
+    typedef StreamMatchday     Record;
+    static constexpr JsonField fields[] = {
+        JSON_FIELD("groupOrderID", StreamMatchday, groupOrderID),
+    };
+};
+
+// JSON stream handler for getcurrentgroup/<league>
+static void streamCurrentMatchday(JsonStream& json, JsonStreamEvent event, void*) {
+    if (event == JSON_VALUE)
+        jsonDecode<CurrentMatchdayDecoder>(json, streamMatchday);
+}
+
 // zur Ermittlung des aktuellen Spieltags
 esp_err_t _http_event_handler_pollCurrentMatchday(esp_http_client_event_t* evt) {
     switch (evt->event_id) {
@@ -1505,45 +1481,79 @@ esp_err_t _http_event_handler_pollCurrentMatchday(esp_http_client_event_t* evt)
             break;
         }
         case HTTP_EVENT_ON_DATA: {
-            if (readHttpResult(evt)) {
+            if (readHttpResult(evt, streamCurrentMatchday)) {
                 vTaskDelay(1);                                                  // feed watch dog
             } else {
-                Liga->ligaPrintln("(_http_event_handler_pollCurrentMatchday) JSON-Buffer error");
+                Liga->ligaPrintln("(_http_event_handler_pollCurrentMatchday) JSON-Stream error");
             }
             break;
         }
 
         case HTTP_EVENT_ON_FINISH: {
-            #pragma GCC diagnostic push
-            #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-            DynamicJsonDocument doc(realJsonBufferSize * 1.2);
-            #pragma GCC diagnostic pop
-
-            if (!deserializeHttpResult(doc)) {
-                Liga->ligaPrintln("(_http_event_handler_pollCurrentMatchday) JSON-Buffer not deserialized");
+            if (!finishHttpResult()) {
+                Liga->ligaPrintln("(_http_event_handler_pollCurrentMatchday) JSON-Stream not parsed");
+                streamMatchday.groupOrderID = 0;
                 break;
             }
 
-            ligaMatchday = doc["groupOrderID"];                                 // fetch current matchday
+            ligaMatchday                = streamMatchday.groupOrderID;          // fetch current matchday
+            streamMatchday.groupOrderID = 0;                                    // consumed
 
-            jsonBufferPrepared = false;
-            realJsonBufferSize = 0;
+            jsonStreamPrepared = false;
             break;
         }
 
         case HTTP_EVENT_DISCONNECTED: {
-            jsonBufferPrepared = false;
-            realJsonBufferSize = 0;
+            jsonStreamPrepared = false;
             break;
         }
         case HTTP_EVENT_ERROR: {
-            jsonBufferPrepared = false;
-            realJsonBufferSize = 0;
+            jsonStreamPrepared = false;
         }
     }
     return ESP_OK;
 }
 
+static LigaRow streamRows[LIGA3_MAX_TEAMS];                                     // table rows while streaming (~1 KB)
+static uint8_t streamRowCount = 0;                                              // filled rows in streamRows
+
+// decoder for getbltable/<league>/<season>, one LigaRow per team
+struct TableDecoder {
+    typedef LigaRow            Record;
+    static constexpr uint32_t  record   = jsonPath("[]");
+    static constexpr JsonField fields[] = {
+        JSON_FIELD("[].teamName", LigaRow, team),                               // Teamname, "" wenn null
+        JSON_FIELD("[].matches", LigaRow, sp),
+        JSON_FIELD("[].points", LigaRow, pkt),
+        JSON_FIELD("[].won", LigaRow, w),
+        JSON_FIELD("[].lost", LigaRow, l),
+        JSON_FIELD("[].draw", LigaRow, d),
+        JSON_FIELD("[].goals", LigaRow, g),
+        JSON_FIELD("[].opponentGoals", LigaRow, og),
+        JSON_FIELD("[].goalDiff", LigaRow, diff),
+    };
+};
+
+// JSON stream handler for getbltable/<league>/<season>: values go straight into streamRows[]
+static void streamTable(JsonStream& json, JsonStreamEvent event, void*) {
+    if (event == JSON_ARRAY_BEGIN && json.pathHash() == JSON_PATH_ROOT) {
+        streamRowCount = 0;                                                     // new body
+        return;
+    }
+
+    const int i = json.index(0);
+    if (i < 0 || i >= ligaMaxTeams)
+        return;                                                                 // auf gefuellte Zeilen begrenzen (rows[LIGA3_MAX_TEAMS])
+
+    if (event == JSON_OBJECT_BEGIN && json.pathHash() == TableDecoder::record) {
+        memset(&streamRows[i], 0, sizeof(LigaRow));
+        streamRowCount = (uint8_t)(i + 1);
+        return;
+    }
+    if (event == JSON_VALUE)
+        jsonDecode<TableDecoder>(json, streamRows[i]);                          // only direct members of a team
+}
+
 // zur Ermittlung der aktuellen Tabelle
 esp_err_t _http_event_handler_pollForTable(esp_http_client_event_t* evt) {
     switch (evt->event_id) {
@@ -1551,78 +1561,60 @@ esp_err_t _http_event_handler_pollForTable(esp_http_client_event_t* evt) {
             break;
         }
         case HTTP_EVENT_ON_DATA: {
-            if (readHttpResult(evt)) {
+            if (readHttpResult(evt, streamTable)) {
                 vTaskDelay(1);                                                  // feed watch dog
             } else {
-                Liga->ligaPrintln("(_http_event_handler_pollForTable) JSON-Buffer error");
+                Liga->ligaPrintln("(_http_event_handler_pollForTable) JSON-Stream error");
             }
             break;
         }
         case HTTP_EVENT_ON_FINISH: {
-            #pragma GCC diagnostic push
-            #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-            DynamicJsonDocument doc(realJsonBufferSize * 1.2);
-            #pragma GCC diagnostic pop
-            if (!deserializeHttpResult(doc)) {
-                Liga->ligaPrintln("(_http_event_handler_pollForTable) JSON-Buffer not deserialized");
+            if (unchangedHttpResult()) {
+                LigaSnapshotLock _lock;                                         // table unchanged: no fill, no publish
+                ligaSnapshotsOf(ligaLeague).keep();                             // previous = current, detectors see no change
                 break;
             }
 
-            LigaSnapshotLock _lock;                                             // serialize fill+publish against Report/Web readers
-            LigaSnapshot&    snapshot = snap[snapshotIndex];                    // fill the back buffer (the one readers are NOT reading)
-            snapshot.clear();                                                   // Reset back-buffer (flip happens AFTER the fill)
+            if (!finishHttpResult()) {
+                Liga->ligaPrintln("(_http_event_handler_pollForTable) JSON-Stream not parsed");
+                break;
+            }
 
-            JsonArray table    = doc.as<JsonArray>();                           // read JSON-Data into the back buffer
-            snapshot.teamCount = (table.size() > (size_t)ligaMaxTeams)          // auf gefuellte Zeilen begrenzen (rows[LIGA3_MAX_TEAMS])
-                                     ? (uint8_t)ligaMaxTeams
-                                     : (uint8_t)table.size();
+            LigaSnapshotLock _lock;                                             // writer lock, readers are not blocked
+            LigaSnapshot&    snapshot = ligaSnapshotsOf(ligaLeague).build();    // cleared back slot, readers copy the current one
 
+            snapshot.teamCount    = streamRowCount;                             // streamed rows into the back buffer
             snapshot.season       = ligaSeason;
             snapshot.matchday     = ligaMatchday;
             snapshot.fetchedAtUTC = time(nullptr);                              // actual timestamp
             for (uint8_t i = 0; i < snapshot.teamCount && i < ligaMaxTeams; ++i) {
-                JsonObject team = table[i];
-                LigaRow&   row  = snapshot.rows[i];
-
-                row.pos  = i + 1;
-                row.sp   = team["matches"] | 0;
-                row.pkt  = team["points"] | 0;
-                row.w    = team["won"] | 0;
-                row.l    = team["lost"] | 0;
-                row.d    = team["draw"] | 0;
-                row.g    = team["goals"] | 0;
-                row.og   = team["opponentGoals"] | 0;
-                row.diff = team["goalDiff"] | 0;
-
-                const char* name = team["teamName"] | "";                       // liefert "" wenn null
-                strncpy(row.team, name ? name : "", sizeof(row.team) - 1);
-                row.team[sizeof(row.team) - 1] = '\0';                          // Teamname
-
-                row.flap = flapForTeamStrict(row.team);                         // Position auf Flap-Display
-
-                String dfb = dfbCodeForTeamStrict(row.team);                    // liefert "" wenn null
-                strncpy(row.dfb, dfb.c_str(), sizeof(row.dfb) - 1);
+                LigaRow& row = snapshot.rows[i];
+
+                row     = streamRows[i];
+                row.pos = i + 1;
+
+                const int team = teamIndexOf(row.team);                         // one hash lookup for flap and DFB code
+                row.teamIdx    = (int8_t)team;
+                row.flap       = (team != TEAM_NONE) ? teamEntry(team).flap : -1; // Position auf Flap-Display
+                strncpy(row.dfb, (team != TEAM_NONE) ? teamEntry(team).code : "", sizeof(row.dfb) - 1);
                 row.dfb[3] = '\0';                                              // manuell nullterminieren
 
                 // Serial.printf("Platz %d: %s Punkte: %d TD: %d\n", row.pos, row.team, row.pkt, row.diff);
             }
 
-            snapshotIndex ^= 1;                                                // publish: flip only AFTER the back buffer is fully filled
+            ligaSnapshotsOf(ligaLeague).publish();                              // publish: one atomic store AFTER the back slot is fully filled
 
-            jsonBufferPrepared = false;
-            realJsonBufferSize = 0;
+            jsonStreamPrepared = false;
             break;
         }
 
         case HTTP_EVENT_DISCONNECTED: {
-            jsonBufferPrepared = false;
-            realJsonBufferSize = 0;
+            jsonStreamPrepared = false;
             break;
         }
 
         case HTTP_EVENT_ERROR: {
-            jsonBufferPrepared = false;
-            realJsonBufferSize = 0;
+            jsonStreamPrepared = false;
             break;
         }
     }
@@ -1633,16 +1625,7 @@ esp_err_t _http_event_handler_pollForTable(esp_http_client_event_t* evt) {
 // zur Ermittlung der aktuellen Tabelle
 bool LigaTable::pollForTable() {
     char url[128];                                                              // ausreichend groß für die komplette URL
-    sprintf(url, "https://api.openligadb.de/getbltable/%s/%d", leagueShortcut(activeLeague), ligaSeason);
-    esp_http_client_config_t config = {};
-    config.url                      = url;
-    config.host                     = "api.openligadb.de";
-    config.user_agent               = flapUserAgent;
-    config.use_global_ca_store      = false;
-    config.event_handler            = _http_event_handler_pollForTable;
-    config.cert_pem                 = OPENLIGA_CA;
-    config.buffer_size              = 2048;
-    config.timeout_ms               = 5000;
+    sprintf(url, "https://api.openligadb.de/getbltable/%s/%d", leagueShortcut(ligaLeague), ligaSeason);
 /*
     if (matchIsLive) {
         {
@@ -1655,18 +1638,16 @@ bool LigaTable::pollForTable() {
 #ifdef LIGAVERBOSE
     {
     TraceScope trace;
-    ligaPrintln("get actual Liga-Table for %s: season = %d, matchday = %d", leagueName(activeLeague), ligaSeason, ligaMatchday);
+    ligaPrintln("get actual Liga-Table for %s: season = %d, matchday = %d", leagueName(ligaLeague), ligaSeason, ligaMatchday);
     }
 #endif
 
-    esp_http_client_handle_t client = esp_http_client_init(&config);
-    if (!client)
-        return false;
-
-    esp_err_t err = esp_http_client_perform(client);
-    esp_http_client_close(client);
-    esp_http_client_cleanup(client);
-    client = nullptr;
+    bool reuse;                                                                 // published table of this league still there (not cleared)?
+    {
+        LigaSnapshotLock _lock;
+        reuse = ligaSnapshotsOf(ligaLeague).current().teamCount > 0;
+    }
+    esp_err_t err = openLigaDB.getIfChanged(url, _http_event_handler_pollForTable, nullptr, reuse);
 
     if (err != ESP_OK) {
         if (err == ESP_ERR_HTTP_CONNECT) {
@@ -1683,25 +1664,8 @@ bool LigaTable::pollForTable() {
 // zur Ermittlung des aktellen Spieltags
 bool LigaTable::pollForCurrentMatchday() {
     char url[128];                                                              // ausreichend groß für die komplette URL
-    sprintf(url, "https://api.openligadb.de/getcurrentgroup/%s", leagueShortcut(activeLeague));
-    esp_http_client_config_t config = {};
-    config.url                      = url;
-    config.host                     = "api.openligadb.de";
-    config.event_handler            = _http_event_handler_pollCurrentMatchday;
-    config.user_agent               = flapUserAgent;
-    config.use_global_ca_store      = false;
-    config.cert_pem                 = OPENLIGA_CA;
-    config.buffer_size              = 100;
-    config.timeout_ms               = 5000;
-
-    esp_http_client_handle_t client = esp_http_client_init(&config);
-    if (!client)
-        return false;
-
-    esp_err_t err = esp_http_client_perform(client);
-    esp_http_client_close(client);
-    esp_http_client_cleanup(client);
-    client = nullptr;
+    sprintf(url, "https://api.openligadb.de/getcurrentgroup/%s", leagueShortcut(ligaLeague));
+    esp_err_t err = openLigaDB.get(url, _http_event_handler_pollCurrentMatchday);
 
     if (err != ESP_OK) {
         if (err == ESP_ERR_HTTP_CONNECT)
@@ -1879,8 +1843,8 @@ bool LigaTable::detectLeaderChange(const LigaSnapshot& oldSnap, const LigaSnapsh
 /**
  * @brief Look up the DFB code for a given team name (strict).
  *
- * Searches through the team mapping arrays (DFB1 and DFB2) to find a
- * team with a matching key. If a match is found, its DFB code string
+ * Looks the team up in the compile time perfect hash over DFB1, DFB2
+ * and DFB3 (TeamIndex.h). If a match is found, its DFB code string
  * is returned.
  *
  * Strict mode: if no team matches, an empty string is returned.
@@ -1889,24 +1853,17 @@ bool LigaTable::detectLeaderChange(const LigaSnapshot& oldSnap, const LigaSnapsh
  * @return String containing the DFB code, or empty string if not found.
  */
 String dfbCodeForTeamStrict(const String& teamName) {
-    String key = teamName;
-    for (auto& e : DFB1)
-        if (key == e.key)
-            return e.code;
-    for (auto& e : DFB2)
-        if (key == e.key)
-            return e.code;
-    for (auto& e : DFB3)
-        if (key == e.key)
-            return e.code;
+    const int team = teamIndexOf(teamName.c_str());
+    if (team != TEAM_NONE)
+        return teamEntry(team).code;
     return "";                                                                  // strict: no match => return empty string
 }
 
 /**
  * @brief Look up the flap index for a given team name (strict).
  *
- * Searches through the team mapping arrays (DFB1 and DFB2) to find a
- * team with a matching key. If a match is found, its flap index is
+ * Looks the team up in the compile time perfect hash over DFB1, DFB2
+ * and DFB3 (TeamIndex.h). If a match is found, its flap index is
  * returned.
  *
  * Strict mode: if no team matches, -1 is returned.
@@ -1915,16 +1872,9 @@ String dfbCodeForTeamStrict(const String& teamName) {
  * @return Flap index (integer), or -1 if not found.
  */
 int flapForTeamStrict(const String& teamName) {
-    String key = teamName;
-    for (auto& e : DFB1)
-        if (key == e.key)
-            return e.flap;
-    for (auto& e : DFB2)
-        if (key == e.key)
-            return e.flap;
-    for (auto& e : DFB3)
-        if (key == e.key)
-            return e.flap;
+    const int team = teamIndexOf(teamName.c_str());
+    if (team != TEAM_NONE)
+        return teamEntry(team).flap;
     return -1;                                                                  // strict: no match => return -1
 }
 
@@ -2041,6 +1991,8 @@ bool LigaTable::detectRelegationGhostChange(const LigaSnapshot& oldSnap, const L
         *newZoneOut = newZone[0];
 
     auto sameTeam = [](const LigaRow* a, const LigaRow* b) {
+        if (a->teamIdx >= 0 && b->teamIdx >= 0)
+            return a->teamIdx == b->teamIdx;                                    // both known: compare index
         if (a->dfb[0] != '\0' && b->dfb[0] != '\0')
             return strcmp(a->dfb, b->dfb) == 0;
         return strcmp(a->team, b->team) == 0;
@@ -2100,20 +2052,21 @@ void processPollScope(PollScope scope) {
     struct tm* timeinfo = localtime(&now);                                      // convert to local time structure
     strftime(lastScanTimestamp, sizeof(lastScanTimestamp), "%d.%m.%Y %H:%M:%S", timeinfo); // save last scan time as string
 
+    LigaSnapshotStore& snapshots = ligaSnapshotsOf(ligaLeague);                 // tables of the loaded league
+    LivePush*          push      = (ligaLeague == activeLeague) ? Push : nullptr; // only the shown league is pushed
+
+    // no pauses between scopes: every request waits for the budget of openLigaDB.pacer() only
     switch (scope) {
         case CALC_CURRENT_SEASON:
             ligaSeason = calcCurrentSeason();                                   // calculate current season
-            vTaskDelay(pdMS_TO_TICKS(400));
             break;
 
         case FETCH_CURRENT_MATCHDAY:
             Liga->pollForCurrentMatchday();                                     // get current matchday from openLigaDB
-            vTaskDelay(pdMS_TO_TICKS(2000));
             break;
 
         case FETCH_TABLE:
             Liga->pollForTable();                                               // get actual table from openLigaDB
-            vTaskDelay(pdMS_TO_TICKS(2000));
             break;
 
         case CHECK_FOR_CHANGES:
@@ -2121,141 +2074,78 @@ void processPollScope(PollScope scope) {
             isSomeThingNew = checkForMatchdayChanges();
             break;
 
-        case FETCH_LIVE_MATCHES:
-            Liga->pollForLiveMatches();                                         // get actual live matches from openLigaDB
-            vTaskDelay(pdMS_TO_TICKS(1000));
+        case FETCH_MATCHES:
+            Liga->pollForMatches(0);                                            // all matches of the matchday, one request
+            if (ligaMatchdayModel.matchday() == ligaMatchday && ligaMatchdayModel.nextKickoff(now) == MATCHDAY_NEVER &&
+                ligaMatchday + 1 <= (ligaMaxTeams - 1) * 2)
+                Liga->pollForMatches(1);                                        // last kickoff passed: following matchday (not past season end)
             break;
 
-        case FETCH_NEXT_MATCH_LIST:
-            Liga->pollForNextMatchList(0);                                      // fetch actual live matches from openLigaDB current matchday
-            vTaskDelay(pdMS_TO_TICKS(1000));
-            if (ligaNextMatchCount <= 0 && ligaMatchday + 1 <= (ligaMaxTeams - 1) * 2)
-                Liga->pollForNextMatchList(1);                                  // only probe next matchday if it exists (not past season end)
+        case CALC_LIVE_MATCHES:
+            updateLiveMatches();                                                // live matches from the MatchdayModel
             break;
 
-        case FETCH_NEXT_KICKOFF: {
-            if (matchIsLive) {
-                Liga->ligaPrintln("no need to fetch next kickoff if a match is live");
-                break;                                                          // no need to fetch next kickoff if a match is live
-            }
-            // At season end (last matchday reached, no upcoming/planned matches) the league has no next match;
-            // skip the query to avoid a meaningless InvalidInput response. Keep relaxed polling via nextKickoffFarAway.
-            if (ligaMatchday >= (ligaMaxTeams - 1) * 2 && ligaNextMatchCount <= 0 && ligaPlanMatchCount <= 0) {
-                Liga->ligaPrintln("no next kickoff: season has ended (matchday %d is the last)", ligaMatchday);
-                nextKickoffFarAway = true;                                      // no upcoming match -> stay in relaxed polling
-                break;
-            }
-            Liga->pollForNextKickoff();                                         // get next kickoff time from openLigaDB
-            vTaskDelay(pdMS_TO_TICKS(2000));
+        case CALC_NEXT_MATCH_LIST:
+            updateNextMatchList();                                              // next and planned matches from the MatchdayModel
             break;
-        }
+
+        case CALC_NEXT_KICKOFF:
+            updateNextKickoff();                                                // next kickoff from the MatchdayModel
+            break;
+
         case SHOW_NEXT_KICKOFF:
             showNextKickoff();                                                  // get next kickoff time from stored value
             break;
 
         case FETCH_LIVE_GOALS: {                                                // get live goals from live matches
             pollForGoalsInLiveMatches();
-            vTaskDelay(pdMS_TO_TICKS(1000));
             break;
         }
 
         case CALC_LIVE_TABLE: {
-            LigaSnapshot baseTable;
-            LigaSnapshot tempLiveTable;
-            {
-                LigaSnapshotLock _lock;                                         // consistent read against concurrent fill/clear
-                memcpy(&baseTable, &snap[snapshotIndex ^ 1], sizeof(LigaSnapshot));
+            LigaSnapshot   baseTable;
+            LiveTable&     liveTable = liveTables[leagueIndex(ligaLeague)];
+            const uint32_t version   = snapshots.read(baseTable);               // consistent copy without lock
+            if (liveTable.update(baseTable, version)) {                         // apply only changed live scores
+                const LigaSnapshot& table = liveTable.table();
+                for (uint8_t i = 0; i < liveTable.moveCount(); ++i) {
+                    const LiveTableMove& move = liveTable.move(i);
+                    Liga->ligaPrintln("live table: %s %u -> %u", table.rows[move.row].team, move.fromPos, move.row + 1);
+                }
+                printLigaLiveTable(table);                                      // print recalculated live table
             }
-            if (recalcLiveTable(baseTable, tempLiveTable))                      // recalculate table with live goals
-                printLigaLiveTable(tempLiveTable);                              // print recalculated live table
-            vTaskDelay(pdMS_TO_TICKS(1000));
             break;
         }
 
         case CALC_LEADER_CHANGE: {
             const LigaRow*   oldLeaderOut = nullptr;
             const LigaRow*   newLeaderOut = nullptr;
-            LigaSnapshotLock _lock;                                             // consistent read against toggleLeague clear
-            Liga->detectLeaderChange(snap[snapshotIndex], snap[snapshotIndex ^ 1], &oldLeaderOut, &newLeaderOut);
+            LigaSnapshotLock _lock;                                             // consistent read against the writer
+            if (Liga->detectLeaderChange(snapshots.previous(), snapshots.current(), &oldLeaderOut, &newLeaderOut) && push)
+                push->tableChange(PUSH_LEADER, oldLeaderOut, newLeaderOut);     // rows copied under the lock
             break;
         }
 
         case CALC_RELEGATION_GHOST_CHANGE: {
             const LigaRow*   oldRZOut = nullptr;
             const LigaRow*   newRZOut = nullptr;
-            LigaSnapshotLock _lock;                                             // consistent read against toggleLeague clear
-            Liga->detectRelegationGhostChange(snap[snapshotIndex], snap[snapshotIndex ^ 1], &oldRZOut, &newRZOut);
+            LigaSnapshotLock _lock;                                             // consistent read against the writer
+            if (Liga->detectRelegationGhostChange(snapshots.previous(), snapshots.current(), &oldRZOut, &newRZOut) && push)
+                push->tableChange(PUSH_RELEGATION_GHOST, oldRZOut, newRZOut);
             break;
         }
 
         case CALC_RED_LANTERN_CHANGE: {
             const LigaRow*   oldRLOut = nullptr;
             const LigaRow*   newRLOut = nullptr;
-            LigaSnapshotLock _lock;                                             // consistent read against toggleLeague clear
-            Liga->detectRedLanternChange(snap[snapshotIndex], snap[snapshotIndex ^ 1], &oldRLOut, &newRLOut);
+            LigaSnapshotLock _lock;                                             // consistent read against the writer
+            if (Liga->detectRedLanternChange(snapshots.previous(), snapshots.current(), &oldRLOut, &newRLOut) && push)
+                push->tableChange(PUSH_RED_LANTERN, oldRLOut, newRLOut);
             break;
         }
     }
 }
 
-PollMode determineNextPollMode() {
-    // POLL MODE enter conditions
-    if (ligaConnectionRefused) {
-        Liga->ligaPrintln("switch Poll Mode because: openLigaDB prevents connection");
-        ligaConnectionRefused = false;
-        return POLL_MODE_NONE;
-    }
-    if (ligaMatchday == 0 || ligaSeason == 0) {                                 // enter ONCE polling because general data missing
-        Liga->ligaPrintln("switch Poll Mode because: ligaMatchday = 0 or ligaSeason = 0");
-        return POLL_MODE_ONCE;
-    }
-    if (matchIsLive) {                                                          // enter LIVE polling because some game is live
-        Liga->ligaPrintln("switch Poll Mode because: there are live matches");
-        return POLL_MODE_LIVE;
-    }
-
-    if (!nextKickoffFarAway) {                                                  // enter PRELIVE polling because next match is in sight
-        Liga->ligaPrintln("switch Poll Mode because: next Kickoff is near");
-        return POLL_MODE_PRELIVE;
-    }
-
-    if (isSomeThingNew) {                                                       // enter REACTIVE polling because there are changes in OLDB
-        Liga->ligaPrintln("switch Poll Mode because: openLigaDB has changes");
-        return POLL_MODE_REACTIVE;
-    }
-
-    // POLL MODE leave conditions
-    switch (currentPollMode) {
-        case POLL_MODE_LIVE:
-        case POLL_MODE_PRELIVE:
-            if (!matchIsLive && nextKickoffFarAway) {
-                Liga->ligaPrintln("switch Poll Mode because: no live match and next Kickoff is far away");
-                return POLL_MODE_REACTIVE;
-            }
-            break;
-        case POLL_MODE_REACTIVE:
-            if (!matchIsLive && nextKickoffFarAway) {
-                Liga->ligaPrintln("switch Poll Mode because: no live match and next Kickoff is far away");
-                return POLL_MODE_RELAXED;
-            }
-            break;
-        case POLL_MODE_NONE:
-            if (!ligaConnectionRefused) {
-                Liga->ligaPrintln("poll wait time over -> try to continue in once pollmode");
-                return POLL_MODE_ONCE;
-            }
-        case POLL_MODE_ONCE:
-            if (!matchIsLive && nextKickoffFarAway) {
-                Liga->ligaPrintln("switch Poll Mode because: no live match and next Kickoff is far away");
-                return POLL_MODE_RELAXED;
-            }
-            break;
-    }
-
-    Liga->ligaPrintln("no valide condition for next Poll Mode found -> no change of poll mode");
-    return currentPollMode;
-}
-
 // Erkennung von Teams, die Tore erzielt haben
 bool LigaTable::detectScoringTeams(const LigaSnapshot& oldSnap, const LigaSnapshot& newSnap, const LigaRow* scorers[], uint8_t& scorerCount) {
     scorerCount = 0;
@@ -2270,7 +2160,8 @@ bool LigaTable::detectScoringTeams(const LigaSnapshot& oldSnap, const LigaSnapsh
         for (uint8_t j = 0; j < oldSnap.teamCount && j < ligaMaxTeams; ++j) {
             const LigaRow& candidate = oldSnap.rows[j];
 
-            bool sameTeam = (candidate.dfb[0] != '\0' && newRow.dfb[0] != '\0') ? (strcmp(candidate.dfb, newRow.dfb) == 0)
+            bool sameTeam = (candidate.teamIdx >= 0 && newRow.teamIdx >= 0)   ? (candidate.teamIdx == newRow.teamIdx)
+                            : (candidate.dfb[0] != '\0' && newRow.dfb[0] != '\0') ? (strcmp(candidate.dfb, newRow.dfb) == 0)
                                                                                 : (strcmp(candidate.team, newRow.team) == 0);
 
             if (sameTeam) {
@@ -2351,9 +2242,24 @@ void applyMatchResult(LigaRow* row1, LigaRow* row2, int goals1, int goals2) {
         row2->d++;
     }
 }
+// row of every known team in a snapshot, built once per recalculation
+struct TeamRows {
+    int8_t row[TEAM_COUNT];                                                     // row per team index, -1 = not in table
+
+    void build(const LigaSnapshot& snapshot) {
+        memset(row, -1, sizeof(row));
+        for (uint8_t i = 0; i < snapshot.teamCount; ++i)
+            if (snapshot.rows[i].teamIdx >= 0 && snapshot.rows[i].teamIdx < TEAM_COUNT)
+                row[snapshot.rows[i].teamIdx] = (int8_t)i;
+    }
+};
+
 //
-LigaRow* findRow(LigaSnapshot& snapshot, const std::string& teamName) {
-    for (uint8_t i = 0; i < snapshot.teamCount; ++i) {
+LigaRow* findRow(LigaSnapshot& snapshot, const TeamRows& rows, const std::string& teamName) {
+    const int team = teamIndexOf(teamName.c_str());
+    if (team != TEAM_NONE)
+        return (rows.row[team] >= 0) ? &snapshot.rows[rows.row[team]] : nullptr; // O(1): hash + index
+    for (uint8_t i = 0; i < snapshot.teamCount; ++i) {                          // team not in DFB tables: by name
         if (strcmp(snapshot.rows[i].team, teamName.c_str()) == 0) {
             return &snapshot.rows[i];
         }
@@ -2364,24 +2270,19 @@ LigaRow* findRow(LigaSnapshot& snapshot, const std::string& teamName) {
 // recalculate Table
 bool recalcLiveTable(LigaSnapshot& baseTable, LigaSnapshot& tempTable) {
     memcpy(&tempTable, &baseTable, sizeof(LigaSnapshot));                       // actualize Table on a copy
-    bool liveTableChanged = false;
+    bool     liveTableChanged = false;
+    TeamRows rows;
+    rows.build(tempTable);                                                      // rows keep their place until sortSnapshot()
 
     for (uint8_t m = 0; m < ligaLiveMatchCount; ++m) {                          // operate all live matches
         const auto& match = liveMatches[m];
 
-        const LiveMatchGoalInfo* lastGoal = nullptr;
-        for (int g = liveGoalCount - 1; g >= 0; --g) {                          // search last goal for this match (highest goalID)
-
-            if (goalsInfos[g].matchID == match.matchID) {
-                lastGoal = &goalsInfos[g];                                      // pointer to last goal in this match found
-                break;
-            }
-        }
+        const LiveMatchGoalInfo* lastGoal = liveGoals.latest(match.matchID);    // last goal of this match, O(1)
         if (!lastGoal)
             continue;                                                           // unexpected: there is no goal available (also no 0:0) for this live match
 
-        LigaRow* row1 = findRow(tempTable, match.team1);                        // search table row of match partner 1
-        LigaRow* row2 = findRow(tempTable, match.team2);                        // search table row of match partner 2
+        LigaRow* row1 = findRow(tempTable, rows, match.team1);                  // search table row of match partner 1
+        LigaRow* row2 = findRow(tempTable, rows, match.team2);                  // search table row of match partner 2
         if (!row1 || !row2) {
             Liga->ligaPrintln("match partner team %s vs %s not found", match.team1.c_str(), match.team2.c_str());
             continue;
@@ -2397,6 +2298,186 @@ bool recalcLiveTable(LigaSnapshot& baseTable, LigaSnapshot& tempTable) {
     return true;
 }
 
+// ----------------------------
+// incremental live table, see Liga.h
+
+// rank key: points, then goal difference, then goals (pkt << 18 | diff + 512 << 8 | g)
+static inline int32_t rankKey(const LigaRow& row) {
+    return ((int32_t)row.pkt << 18) | ((int32_t)(row.diff + 512) << 8) | row.g;
+}
+
+// same order as sortSnapshot()
+static inline bool ranksBefore(const LigaRow& a, const LigaRow& b) {
+    const int32_t ka = rankKey(a);
+    const int32_t kb = rankKey(b);
+    return (ka != kb) ? (ka > kb) : (strcmp(a.team, b.team) < 0);
+}
+
+/**
+ * @brief Construct an empty live table, the first update() takes over the base table
+ */
+LiveTable::LiveTable() : _baseVersion(0), _valid(false), _appliedCount(0), _touchedLow(0), _touchedHigh(0), _moveCount(0), _rebuilds(0) {
+    memset(&_table, 0, sizeof(_table));
+}
+
+/**
+ * @brief bring the live table up to date with the latest score of every live match
+ *
+ * Only matches with a new score, a first goal or no longer live touch the table; a new
+ * base table (version changed) is copied and ranked completely first.
+ *
+ * @param base published table (ligaSnapshotsOf(ligaLeague).read())
+ * @param baseVersion version returned by read()
+ * @return true if the live table changed, moves() tell the new positions
+ */
+bool LiveTable::update(const LigaSnapshot& base, uint32_t baseVersion) {
+    _moveCount   = 0;
+    _touchedLow  = LIGA3_MAX_TEAMS;
+    _touchedHigh = 0;
+    bool changed = false;
+    if (!_valid || baseVersion != _baseVersion) {
+        rebuild(base, baseVersion);                                             // new table from openLigaDB
+        changed = true;
+    }
+
+    const LiveMatchGoalInfo* score[MAX_MATCHES_PER_MATCHDAY];                   // current score per live match
+    for (uint8_t m = 0; m < ligaLiveMatchCount; ++m)
+        score[m] = liveGoals.latest(liveMatches[m].matchID);
+
+    for (uint8_t a = 0; a < _appliedCount;) {                                   // results of matches no longer live: out
+        uint8_t m = 0;
+        while (m < ligaLiveMatchCount && liveMatches[m].matchID != _applied[a].matchID)
+            ++m;
+        if (m < ligaLiveMatchCount && score[m]) {
+            ++a;
+            continue;
+        }
+        const LiveResult& r = _applied[a];
+        setResult(r.home1, r.score1, r.score2, -1);
+        setResult(r.home2, r.score2, r.score1, -1);
+        _applied[a] = _applied[--_appliedCount];
+        changed     = true;
+    }
+
+    for (uint8_t m = 0; m < ligaLiveMatchCount; ++m) {                          // new and changed scores: old result out, new in
+        if (!score[m])
+            continue;                                                           // no goal info yet (not even 0:0)
+        uint8_t a = 0;
+        while (a < _appliedCount && _applied[a].matchID != liveMatches[m].matchID)
+            ++a;
+        if (a == _appliedCount) {                                               // first score of this match
+            const int8_t home1 = homeOf(liveMatches[m].team1);
+            const int8_t home2 = homeOf(liveMatches[m].team2);
+            if (home1 < 0 || home2 < 0) {
+                Liga->ligaPrintln("match partner team %s vs %s not found", liveMatches[m].team1.c_str(), liveMatches[m].team2.c_str());
+                continue;
+            }
+            _applied[_appliedCount++] = {liveMatches[m].matchID, home1, home2, score[m]->scoreTeam1, score[m]->scoreTeam2};
+            setResult(home1, score[m]->scoreTeam1, score[m]->scoreTeam2, 1);
+            setResult(home2, score[m]->scoreTeam2, score[m]->scoreTeam1, 1);
+            changed = true;
+            continue;
+        }
+        LiveResult& r = _applied[a];
+        if (r.score1 == score[m]->scoreTeam1 && r.score2 == score[m]->scoreTeam2)
+            continue;                                                           // unchanged since last update
+        setResult(r.home1, r.score1, r.score2, -1);
+        setResult(r.home2, r.score2, r.score1, -1);
+        r.score1 = score[m]->scoreTeam1;
+        r.score2 = score[m]->scoreTeam2;
+        setResult(r.home1, r.score1, r.score2, 1);
+        setResult(r.home2, r.score2, r.score1, 1);
+        changed = true;
+    }
+
+    collectMoves();
+    return changed;
+}
+
+/**
+ * @brief take over a new base table: copy, forget applied results, rank all rows once
+ */
+void LiveTable::rebuild(const LigaSnapshot& base, uint32_t baseVersion) {
+    memcpy(&_table, &base, sizeof(LigaSnapshot));
+    _baseVersion  = baseVersion;
+    _valid        = true;
+    _appliedCount = 0;
+    _rebuilds++;
+    for (uint8_t i = 0; i < _table.teamCount; ++i)
+        _slotOf[i] = _homeOf[i] = (int8_t)i;
+    for (uint8_t i = 1; i < _table.teamCount; ++i)                              // insertion sort: base is (almost) in order already
+        for (uint8_t s = i; s > 0 && ranksBefore(_table.rows[s], _table.rows[s - 1]); --s)
+            swapSlots(s, s - 1);
+    if (_table.teamCount) {
+        _touchedLow  = 0;                                                       // positions relative to the base table
+        _touchedHigh = _table.teamCount - 1;
+    }
+}
+
+/**
+ * @brief base row of a team (stable while rows move), -1 if the team is not in the table
+ */
+int8_t LiveTable::homeOf(const std::string& team) const {
+    const int idx = teamIndexOf(team.c_str());
+    for (uint8_t s = 0; s < _table.teamCount; ++s)
+        if ((idx != TEAM_NONE) ? (_table.rows[s].teamIdx == idx) : (strcmp(_table.rows[s].team, team.c_str()) == 0))
+            return _homeOf[s];
+    return -1;
+}
+
+/**
+ * @brief add (sign +1) or remove (sign -1) the result of one team and move its row to its new place
+ *
+ * All other rows are in order, so moving this one row up or down restores the order.
+ */
+void LiveTable::setResult(int8_t home, int own, int other, int sign) {
+    uint8_t   s    = _slotOf[home];
+    LigaRow&  row  = _table.rows[s];
+    const int win  = own > other;                                               // no branches on the outcome
+    const int draw = own == other;
+    const int loss = own < other;
+    row.sp += sign;
+    row.g += sign * own;
+    row.og += sign * other;
+    row.diff = row.g - row.og;
+    row.pkt += sign * (3 * win + draw);
+    row.w += sign * win;
+    row.d += sign * draw;
+    row.l += sign * loss;
+
+    const uint8_t from = s;
+    while (s > 0 && ranksBefore(_table.rows[s], _table.rows[s - 1])) {          // up
+        swapSlots(s, s - 1);
+        --s;
+    }
+    while (s + 1 < _table.teamCount && ranksBefore(_table.rows[s + 1], _table.rows[s])) { // down
+        swapSlots(s, s + 1);
+        ++s;
+    }
+    if (s != from) {
+        _touchedLow  = std::min(_touchedLow, std::min(s, from));
+        _touchedHigh = std::max(_touchedHigh, std::max(s, from));
+    }
+}
+
+//
+void LiveTable::swapSlots(uint8_t a, uint8_t b) {
+    std::swap(_table.rows[a], _table.rows[b]);                                  // pos moves with the row: position before update()
+    std::swap(_homeOf[a], _homeOf[b]);
+    _slotOf[_homeOf[a]] = a;
+    _slotOf[_homeOf[b]] = b;
+}
+
+// pos of a row still tells where it was before update()
+void LiveTable::collectMoves() {
+    for (uint8_t s = _touchedLow; s <= _touchedHigh && s < _table.teamCount; ++s) {
+        if (_table.rows[s].pos != s + 1) {
+            _moves[_moveCount++] = {s, _table.rows[s].pos};
+            _table.rows[s].pos   = s + 1;
+        }
+    }
+}
+
 //
 uint16_t utf8Length(const String& input) {
     uint16_t    count = 0;
@@ -2429,7 +2510,7 @@ String padUtf8ToWidth(const String& input, uint8_t width) {
     return result;
 }
 //
-void printLigaLiveTable(LigaSnapshot& snapshot) {
+void printLigaLiveTable(const LigaSnapshot& snapshot) {
     Serial.println("┌─────┬──────────────────────────┬────┬────┬────┬────┬────┬────┬──────┬─────┐");
     Serial.println("│ Pos │ Mannschaft               │ Sp │  S │  U │  N │  T │ GT │ Diff │ Pkt │");
     Serial.println("├─────┼──────────────────────────┼────┼────┼────┼────┼────┼────┼──────┼─────┤");
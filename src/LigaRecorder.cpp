@@ -0,0 +1,107 @@
+// #################################################################################################################
+//
+//  ██      ██  ██████   █████      ██████  ███████  ██████  ██████  ██████  ██████  ███████ ██████
+//  ██      ██ ██       ██   ██     ██   ██ ██      ██      ██    ██ ██   ██ ██   ██ ██      ██   ██
+//  ██      ██ ██   ███ ███████     ██████  █████   ██      ██    ██ ██████  ██   ██ █████   ██████
+//  ██      ██ ██    ██ ██   ██     ██   ██ ██      ██      ██    ██ ██   ██ ██   ██ ██      ██   ██
+//  ███████ ██  ██████  ██   ██     ██   ██ ███████  ██████  ██████  ██   ██ ██████  ███████ ██   ██
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Liga%20Recorder
+//
+/*
+
+    Recorder of all openLigaDB responses, see LigaRecorder.h for the file format
+
+*/
+#ifdef LIGARECORD
+
+#include <FlapGlobal.h>
+#include <SPIFFS.h>
+#include <ctime>
+#include "LigaRecorder.h"
+
+LigaRecorder ligaRecorder;                                                      // recorder of LigaSession
+
+/**
+ * @brief open a new block for the response of url
+ *
+ * @param status HTTP status code of the response
+ * @param url complete url of the request
+ */
+void LigaRecorder::begin(int status, const char* url) {
+    if (_file || _full)
+        return;
+    if (!_sized) {
+        File existing = SPIFFS.open(LIGA_RECORD_FILE, FILE_READ);
+        _bytes        = existing ? existing.size() : 0;                         // continue recording after reboot
+        _sized        = true;
+    }
+    if (_bytes >= LIGA_RECORD_MAX_BYTES) {
+        _full = true;
+        #ifdef ERRORVERBOSE
+            {
+            TraceScope trace;
+            Serial.printf("[FLAP  -  HTTP  ] recording stopped, %s has %u bytes\n", LIGA_RECORD_FILE, (unsigned)_bytes);
+            }
+        #endif
+        return;
+    }
+
+    _file = SPIFFS.open(LIGA_RECORD_FILE, FILE_APPEND);
+    if (!_file)
+        return;
+    char head[300];
+    int  n = snprintf(head, sizeof(head), "@%ld %d %s\n", (long)time(nullptr), status, url);
+    _bytes += _file.write((const uint8_t*)head, n);
+}
+
+/**
+ * @brief append one chunk of the body
+ */
+void LigaRecorder::chunk(const void* data, size_t len) {
+    if (!_file || !data || len == 0)
+        return;
+    char head[16];
+    int  n = snprintf(head, sizeof(head), "+%u\n", (unsigned)len);
+    _bytes += _file.write((const uint8_t*)head, n);
+    _bytes += _file.write((const uint8_t*)data, len);
+}
+
+/**
+ * @brief write end line and close the file
+ */
+void LigaRecorder::end() {
+    if (!_file)
+        return;
+    _bytes += _file.write((const uint8_t*)".\n", 2);
+    _file.close();
+    _responses++;
+}
+
+/**
+ * @brief close the file without end line, the replay skips the block
+ */
+void LigaRecorder::abort() {
+    if (!_file)
+        return;
+    _file.write('\n');
+    _bytes++;
+    _file.close();
+}
+
+/**
+ * @brief delete the recording, the next response starts a new one
+ */
+void LigaRecorder::clear() {
+    if (_file)
+        _file.close();
+    SPIFFS.remove(LIGA_RECORD_FILE);
+    _bytes     = 0;
+    _sized     = true;
+    _full      = false;
+    _responses = 0;
+}
+
+#endif // LIGARECORD
@@ -0,0 +1,468 @@
+// #################################################################################################################
+//
+//  ██      ██  ██████   █████      ███████ ███████ ███████ ███████ ██  ██████  ███    ██
+//  ██      ██ ██       ██   ██     ██      ██      ██      ██      ██ ██    ██ ████   ██
+//  ██      ██ ██   ███ ███████     ███████ █████   ███████ ███████ ██ ██    ██ ██ ██  ██
+//  ██      ██ ██    ██ ██   ██          ██ ██           ██      ██ ██ ██    ██ ██  ██ ██
+//  ███████ ██  ██████  ██   ██     ███████ ███████ ███████ ███████ ██  ██████  ██   ████
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Liga%20Session
+//
+/*
+
+    Persistent HTTPS session to api.openligadb.de
+
+    One esp_http_client per host lives as long as the connection works. Its event
+    handler is the dispatcher below, which forwards every event to the handler of the
+    endpoint that is requested right now, with that request's user_data.
+    For conditional requests the dispatcher also fingerprints the response (status,
+    ETag, Last-Modified, FNV-1a of the body) before the endpoint sees HTTP_EVENT_ON_FINISH.
+    Every get() takes its budget from the LigaPacer of the session first.
+
+*/
+#include <FlapGlobal.h>
+#include <algorithm>
+#include "LigaSession.h"
+#include "Liga.h"
+#include "cert.all"
+#ifdef LIGARECORD
+#include "LigaRecorder.h"
+#endif
+
+LigaSession openLigaDB("api.openligadb.de");                                    // session used by all Liga polls
+
+#define FNV_OFFSET 2166136261u                                                  // FNV-1a 32 bit, same as JSON path hash
+#define FNV_PRIME 16777619u
+
+static uint32_t fnv1a(uint32_t hash, const void* data, size_t len) {
+    const uint8_t* p = (const uint8_t*)data;
+    for (size_t i = 0; i < len; ++i)
+        hash = (hash ^ p[i]) * FNV_PRIME;
+    return hash;
+}
+
+// ----------------------------
+// request budget
+
+/**
+ * @brief Construct a pacer with a full budget
+ *
+ * @param intervalMs average distance of requests
+ * @param burst requests back-to-back from a full budget
+ */
+LigaPacer::LigaPacer(uint32_t intervalMs, uint8_t burst) : _refillMs(0) {
+    configure(intervalMs, burst);
+}
+
+/**
+ * @brief pace while the server accepts every request, the budget is full again
+ */
+void LigaPacer::configure(uint32_t intervalMs, uint8_t burst) {
+    _baseInterval = intervalMs ? intervalMs : 1;
+    _baseBurst    = burst ? burst : 1;
+    _interval     = _baseInterval;
+    _burst        = _baseBurst;
+    _credit       = _interval * _burst;
+    _answered     = 0;
+}
+
+void LigaPacer::refill() {
+    const uint32_t now      = millis();
+    const uint32_t capacity = _interval * _burst;
+    const uint32_t elapsed  = now - _refillMs;
+    _refillMs               = now;
+    _credit                 = (_credit >= capacity || elapsed >= capacity - _credit) ? capacity : _credit + elapsed;
+}
+
+/**
+ * @brief take the budget of one request
+ *
+ * Returns at once while the bucket has credit for a request, else the Liga task sleeps
+ * until the missing credit has been refilled.
+ *
+ * @return uint32_t waited milliseconds, 0 if the request may go out at once
+ */
+uint32_t LigaPacer::acquire() {
+    refill();
+    if (_credit >= _interval) {
+        _credit -= _interval;
+        return 0;
+    }
+
+    const uint32_t wait = _interval - _credit;
+    _throttled++;
+    _waitedMs += wait;
+    vTaskDelay(pdMS_TO_TICKS(wait));
+    refill();
+    _credit = (_credit >= _interval) ? _credit - _interval : 0;
+    return wait;
+}
+
+/**
+ * @brief time until the budget holds a number of requests (at most the current burst)
+ *
+ * @param requests requests that should go out without waiting
+ * @return uint32_t milliseconds, 0 if the budget holds them now
+ */
+uint32_t LigaPacer::msUntil(uint8_t requests) {
+    refill();
+    const uint32_t need = std::min(requests, _burst) * _interval;
+    return (_credit >= need) ? 0 : need - _credit;
+}
+
+/**
+ * @brief the server answered, a shrunk budget grows back step by step
+ */
+void LigaPacer::answered() {
+    if (_interval == _baseInterval && _burst == _baseBurst)
+        return;
+    if (++_answered < LIGA_PACE_RECOVER)
+        return;
+    _answered = 0;
+    _interval = std::max(_baseInterval, _interval / 2);
+    if (_interval == _baseInterval)
+        _burst = _baseBurst;                                                    // bursts only at the configured pace
+}
+
+/**
+ * @brief connection refused or server refusal (429, 503): double the interval, no bursts
+ */
+void LigaPacer::refused() {
+    _refusals++;
+    _answered = 0;
+    _interval = std::min((uint32_t)LIGA_PACE_MAX_INTERVAL_MS, _interval * 2);
+    _burst    = 1;
+    _credit   = 0;                                                              // next request waits a full interval
+    _refillMs = millis();                                                       // time of the failed request is no credit
+}
+
+// ----------------------------
+// Constructor
+
+/**
+ * @brief Construct a new Liga Session object, no connection is opened before the first get()
+ *
+ * @param host server of all requests of this session
+ */
+LigaSession::LigaSession(const char* host) : _host(host) {}
+
+// ----------------------------
+
+/**
+ * @brief send GET request on the persistent connection
+ *
+ * The connection of the previous request is reused. If that connection was closed by the
+ * server while idle, the request is repeated once on a new connection. After a transport
+ * error the client is dropped and the next get() connects again.
+ *
+ * @param url complete url of the request
+ * @param handler event handler of the endpoint (HTTP_EVENT_ON_DATA, HTTP_EVENT_ON_FINISH ...)
+ * @param userData passed to handler as evt->user_data
+ * @return esp_err_t result of esp_http_client_perform()
+ */
+esp_err_t LigaSession::get(const char* url, http_event_handle_cb handler, void* userData) {
+    _pacer.acquire();                                                           // waits only while the request budget is empty
+    _handler  = handler;
+    _userData = userData;
+    _url      = url;
+    _requests++;
+
+    const uint32_t start  = millis();
+    const bool     reused = (_client != nullptr);                               // connection of an earlier request
+    esp_err_t      err    = perform(url);
+
+    if (err != ESP_OK && reused && !_fresh && err != ESP_ERR_HTTP_CONNECT) {
+        #ifdef LIGAVERBOSE
+            {
+            TraceScope trace;
+            sessionPrintln("idle connection closed by server (%s), reconnect", esp_err_to_name(err));
+            }
+        #endif
+        reset();                                                                // server dropped idle connection
+        err = perform(url);                                                     // one retry on new connection
+    }
+
+    const int status = (err == ESP_OK && _client) ? esp_http_client_get_status_code(_client) : 0;
+    if (err == ESP_ERR_HTTP_CONNECT || status == 429 || status == 503)
+        _pacer.refused();                                                       // server refuses: slower pace, no burst
+    else if (err == ESP_OK)
+        _pacer.answered();
+
+    if (err != ESP_OK) {
+        _errors++;
+        reset();                                                                // reconnect with next request
+    }
+
+    _lastRequestMs = millis() - start;
+    if (_lastRequestMs > _maxRequestMs)
+        _maxRequestMs = _lastRequestMs;
+
+    #ifdef LIGAVERBOSE
+        {
+        TraceScope trace;
+        sessionPrintln("GET %s -> %s in %u ms (requests %u, handshakes %u)", url, esp_err_to_name(err), _lastRequestMs, _requests, _handshakes);
+        }
+    #endif
+
+    _handler  = nullptr;                                                        // late events (cleanup) go nowhere
+    _userData = nullptr;
+    _url      = nullptr;
+    return err;
+}
+
+/**
+ * @brief conditional GET, the handler learns with unchanged() if it can keep its data
+ *
+ * The slot of handler remembers url, validators and body hash of the body the handler
+ * processed last. If url is the same, the validators are sent; 304 or an equal body hash
+ * make unchanged() true while the handler gets HTTP_EVENT_ON_FINISH.
+ *
+ * @param url complete url of the request
+ * @param handler event handler of the endpoint, owner of a cache slot
+ * @param userData passed to handler as evt->user_data
+ * @param reuse false if the data the handler derived from the last body is outdated (sends no validators)
+ * @return esp_err_t result of esp_http_client_perform()
+ */
+esp_err_t LigaSession::getIfChanged(const char* url, http_event_handle_cb handler, void* userData, bool reuse) {
+    _slot    = slotFor(handler);
+    _urlHash = fnv1a(FNV_OFFSET, url, strlen(url));
+    _reuse   = reuse && _slot && _slot->urlHash == _urlHash && _slot->bodyHash != 0;
+
+    esp_err_t err = get(url, handler, userData);
+
+    _slot = nullptr;
+    return err;
+}
+
+/**
+ * @brief the handler could not use the body of the running request, next request is a full one
+ */
+void LigaSession::forget() {
+    if (!_slot)
+        return;
+    _slot->bodyHash        = 0;
+    _slot->etag[0]         = '\0';
+    _slot->lastModified[0] = '\0';
+    _unchanged             = false;
+}
+
+/**
+ * @brief close connection and free client, next get() connects again
+ */
+void LigaSession::reset() {
+    if (!_client)
+        return;
+    esp_http_client_close(_client);
+    esp_http_client_cleanup(_client);
+    _client = nullptr;
+}
+
+// ----------------------------
+
+/**
+ * @brief create the long-lived client for host
+ *
+ * @return true client is ready, connection is opened by the first perform
+ */
+bool LigaSession::connect() {
+    esp_http_client_config_t config    = {};
+    config.host                        = _host;
+    config.path                        = "/";
+    config.user_agent                  = flapUserAgent;
+    config.event_handler               = dispatch;
+    config.user_data                   = this;                                  // dispatcher finds session
+    config.cert_pem                    = OPENLIGA_CA;
+    config.use_global_ca_store         = false;
+    config.skip_cert_common_name_check = false;
+    config.transport_type              = HTTP_TRANSPORT_OVER_SSL;
+    config.keep_alive_enable           = true;                                  // TCP keep-alive on idle connection between polls
+    config.buffer_size                 = LIGA_SESSION_BUFFER;
+    config.timeout_ms                  = LIGA_SESSION_TIMEOUT_MS;
+
+    _client = esp_http_client_init(&config);
+    if (!_client) {
+        #ifdef ERRORVERBOSE
+            {
+            TraceScope trace;
+            sessionPrintln("HTTP-Client error while initializing");
+            }
+        #endif
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief one request on the current client, creates the client if needed
+ *
+ * @param url complete url of the request
+ * @return esp_err_t result of esp_http_client_perform()
+ */
+esp_err_t LigaSession::perform(const char* url) {
+    if (!_client && !connect())
+        return ESP_FAIL;
+
+    _fresh           = false;                                                   // set by HTTP_EVENT_ON_CONNECTED
+    _unchanged       = false;
+    _bodyHash        = FNV_OFFSET;
+    _etag[0]         = '\0';
+    _lastModified[0] = '\0';
+    sendValidators();
+
+    esp_err_t err = esp_http_client_set_url(_client, url);
+    if (err != ESP_OK)
+        return err;
+    return esp_http_client_perform(_client);
+}
+
+/**
+ * @brief event handler of the long-lived client
+ *
+ * counts new connections and forwards the event to the handler of the running request
+ *
+ * @param evt event of esp_http_client, user_data is the session
+ * @return esp_err_t result of endpoint handler
+ */
+esp_err_t LigaSession::dispatch(esp_http_client_event_t* evt) {
+    LigaSession* session = (LigaSession*)evt->user_data;
+    if (!session)
+        return ESP_OK;
+
+    if (evt->event_id == HTTP_EVENT_ON_CONNECTED) {
+        session->_handshakes++;                                                 // new TCP/TLS connection
+        session->_fresh = true;
+    }
+
+    if (!session->_handler)
+        return ESP_OK;                                                          // no request running
+
+    if (session->_slot)
+        session->track(evt);                                                    // before handler sees ON_FINISH
+
+    #ifdef LIGARECORD
+        session->record(evt);
+    #endif
+
+    esp_http_client_event_t forward = *evt;
+    forward.user_data               = session->_userData;                       // user_data of the endpoint
+    return session->_handler(&forward);
+}
+
+// ----------------------------
+// conditional GET
+
+/**
+ * @brief cache slot of an endpoint handler in the current cache group, a new pair takes a free slot
+ *
+ * @param handler event handler of the endpoint
+ * @return LigaCacheSlot* or nullptr if all slots are taken (request is not conditional)
+ */
+LigaCacheSlot* LigaSession::slotFor(http_event_handle_cb handler) {
+    for (LigaCacheSlot& slot : _slots)
+        if (slot.handler == handler && slot.group == _group)
+            return &slot;
+    for (LigaCacheSlot& slot : _slots)
+        if (slot.handler == nullptr) {
+            slot.handler = handler;
+            slot.group   = _group;
+            return &slot;
+        }
+    #ifdef ERRORVERBOSE
+        {
+        TraceScope trace;
+        sessionPrintln("no free cache slot, increase LIGA_CACHE_SLOTS");
+        }
+    #endif
+    return nullptr;
+}
+
+/**
+ * @brief set or remove the conditional headers on the long-lived client
+ */
+void LigaSession::sendValidators() {
+    const bool conditional = _slot && _reuse;
+
+    if (conditional && _slot->etag[0])
+        esp_http_client_set_header(_client, "If-None-Match", _slot->etag);
+    else
+        esp_http_client_delete_header(_client, "If-None-Match");
+
+    if (conditional && _slot->lastModified[0])
+        esp_http_client_set_header(_client, "If-Modified-Since", _slot->lastModified);
+    else
+        esp_http_client_delete_header(_client, "If-Modified-Since");
+}
+
+/**
+ * @brief fingerprint the response of a conditional request
+ *
+ * @param evt event of esp_http_client
+ */
+void LigaSession::track(esp_http_client_event_t* evt) {
+    switch (evt->event_id) {
+        case HTTP_EVENT_ON_HEADER:
+            if (!evt->header_key || !evt->header_value)
+                break;
+            if (strcasecmp(evt->header_key, "ETag") == 0)
+                snprintf(_etag, sizeof(_etag), "%s", evt->header_value);
+            else if (strcasecmp(evt->header_key, "Last-Modified") == 0)
+                snprintf(_lastModified, sizeof(_lastModified), "%s", evt->header_value);
+            break;
+
+        case HTTP_EVENT_ON_DATA:
+            if (evt->data && evt->data_len > 0)
+                _bodyHash = fnv1a(_bodyHash, evt->data, evt->data_len);         // rolling hash while streaming
+            break;
+
+        case HTTP_EVENT_ON_FINISH: {
+            const int status = esp_http_client_get_status_code(evt->client);
+            if (status == 304) {                                                // server honoured validators
+                _notModified++;
+                _unchanged = _reuse;
+                break;
+            }
+            if (status != 200)
+                break;                                                          // keep fingerprint of last good body
+
+            _unchanged      = _reuse && _slot->bodyHash == _bodyHash;           // fallback without validators
+            _slot->urlHash  = _urlHash;
+            _slot->bodyHash = _bodyHash;
+            snprintf(_slot->etag, sizeof(_slot->etag), "%s", _etag);
+            snprintf(_slot->lastModified, sizeof(_slot->lastModified), "%s", _lastModified);
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+#ifdef LIGARECORD
+/**
+ * @brief append the response of the running request to the recording for replays
+ *
+ * @param evt event of esp_http_client
+ */
+void LigaSession::record(esp_http_client_event_t* evt) {
+    switch (evt->event_id) {
+        case HTTP_EVENT_ON_DATA:
+            if (!ligaRecorder.active())
+                ligaRecorder.begin(esp_http_client_get_status_code(evt->client), _url);
+            ligaRecorder.chunk(evt->data, evt->data_len);
+            break;
+        case HTTP_EVENT_ON_FINISH:
+            if (!ligaRecorder.active())
+                ligaRecorder.begin(esp_http_client_get_status_code(evt->client), _url); // e.g. 304 without body
+            ligaRecorder.end();
+            break;
+        case HTTP_EVENT_ERROR:
+        case HTTP_EVENT_DISCONNECTED:
+            ligaRecorder.abort();                                               // response incomplete
+            break;
+        default:
+            break;
+    }
+}
+#endif
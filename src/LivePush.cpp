@@ -0,0 +1,282 @@
+// #################################################################################################################
+//
+//  ██      ██ ██    ██ ███████     ██████  ██    ██ ███████ ██   ██
+//  ██      ██ ██    ██ ██          ██   ██ ██    ██ ██      ██   ██
+//  ██      ██ ██    ██ █████       ██████  ██    ██ ███████ ███████
+//  ██      ██  ██  ██  ██          ██      ██    ██      ██ ██   ██
+//  ███████ ██   ████   ███████     ██       ██████  ███████ ██   ██
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Live%20Push
+//
+
+#include "LivePush.h"
+#include "Liga.h"
+
+static const char* const pushTableName[PUSH_TABLE_KINDS] = {"leader", "ghost", "lantern"};
+
+/**
+ * @brief append text as JSON string content (quotes, backslash and control characters escaped)
+ *
+ * @param out target
+ * @param text UTF-8 text
+ */
+static void appendJsonText(String& out, const char* text) {
+    for (const char* p = text; *p; ++p) {
+        const char c = *p;
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if ((uint8_t)c < 0x20) {
+            out += ' ';                                                         // no control characters in names
+        } else {
+            out += c;
+        }
+    }
+}
+
+// ----------------------------
+
+/**
+ * @brief Construct a new Live Push channel, nothing pending
+ *
+ */
+LivePush::LivePush() : _events("/events"), _task(nullptr), _eventId(0), _subscribers(0), _messages(0), _dropped(0) {
+    memset(&_pending, 0, sizeof(_pending));
+    memset(&_burst, 0, sizeof(_burst));
+    _lock       = xSemaphoreCreateMutex();
+    _clientLock = xSemaphoreCreateRecursiveMutex();
+}
+
+// ----------------------------
+
+/**
+ * @brief register /events at the web server
+ *
+ * A new subscriber gets "hello" with the id of the last event, it fetches /1 and /2 once
+ * and applies the pushed deltas from then on.
+ *
+ * @param server web server, not yet started
+ */
+void LivePush::attach(AsyncWebServer& server) {
+    _events.onConnect([this](AsyncEventSourceClient* client) {                  // AsyncTCP task
+        xSemaphoreTakeRecursive(_clientLock, portMAX_DELAY);
+        _clients.push_back(client);
+        _subscribers = _clients.size();
+        xSemaphoreGiveRecursive(_clientLock);
+
+        char hello[32];
+        snprintf(hello, sizeof(hello), "{\"id\":%lu}", (unsigned long)_eventId);
+        client->send(hello, "hello", _eventId, PUSH_RECONNECT_MS);
+    });
+    _events.onDisconnect([this](AsyncEventSourceClient* client) {               // AsyncTCP task or close() in send()
+        xSemaphoreTakeRecursive(_clientLock, portMAX_DELAY);
+        removeClient(client);
+        xSemaphoreGiveRecursive(_clientLock);
+    });
+    server.addHandler(&_events);
+}
+
+/**
+ * @brief forget a subscriber, _clientLock must be held
+ *
+ * A client closed in send() is removed at once, so it is not closed and counted again if
+ * AsyncTCP reports its disconnect only after the next send(); onDisconnect finds it gone.
+ *
+ * @param client subscriber
+ */
+void LivePush::removeClient(AsyncEventSourceClient* client) {
+    for (size_t i = 0; i < _clients.size(); ++i) {
+        if (_clients[i] == client) {
+            _clients.erase(_clients.begin() + i);
+            break;
+        }
+    }
+    _subscribers = _clients.size();
+}
+
+// ----------------------------
+
+/**
+ * @brief note a new goal
+ *
+ * @param goal entry of goalsInfos[]
+ */
+void LivePush::goal(const LiveMatchGoalInfo& goal) {
+    xSemaphoreTake(_lock, portMAX_DELAY);
+    if (_pending.goalCount < PUSH_GOAL_QUEUE) {
+        Goal& g   = _pending.goals[_pending.goalCount++];
+        g.matchID = goal.matchID;
+        g.goalID  = goal.goalID;
+        g.minute  = goal.goalMinute;
+        g.score1  = goal.scoreTeam1;
+        g.score2  = goal.scoreTeam2;
+        g.flags   = (goal.isOwnGoal ? 1 : 0) | (goal.isPenalty ? 2 : 0) | (goal.isOvertime ? 4 : 0);
+        snprintf(g.team, sizeof(g.team), "%s", goal.scoringTeam.c_str());
+        snprintf(g.player, sizeof(g.player), "%s", goal.scoringPlayer.c_str());
+    } else {
+        _pending.goalOverflow = true;                                           // clients fetch /2
+    }
+    xSemaphoreGive(_lock);
+    wake();
+}
+
+// ----------------------------
+
+/**
+ * @brief note a change of leader, relegation ghost or red lantern
+ *
+ * Several changes of one position in a burst are sent as one: first old, last new team.
+ *
+ * @param kind table position
+ * @param oldRow row before, may be nullptr
+ * @param newRow row after, may be nullptr
+ */
+void LivePush::tableChange(PushTable kind, const LigaRow* oldRow, const LigaRow* newRow) {
+    if (kind >= PUSH_TABLE_KINDS)
+        return;
+    xSemaphoreTake(_lock, portMAX_DELAY);
+    Table& t = _pending.table[kind];
+    if (!t.changed)
+        snprintf(t.oldTeam, sizeof(t.oldTeam), "%s", oldRow ? oldRow->dfb : "");
+    snprintf(t.newTeam, sizeof(t.newTeam), "%s", newRow ? newRow->dfb : "");
+    t.changed = true;
+    xSemaphoreGive(_lock);
+    wake();
+}
+
+// ----------------------------
+
+/**
+ * @brief note the flap shown by a module after a move, later moves of a burst replace it
+ *
+ * @param address I2C address of the module
+ * @param flap flap number shown
+ */
+void LivePush::moduleMoved(uint8_t address, uint8_t flap) {
+    if (address >= PUSH_MODULES)
+        return;
+    xSemaphoreTake(_lock, portMAX_DELAY);
+    _pending.moduleDirty[address / 32] |= 1UL << (address % 32);
+    _pending.moduleFlap[address] = flap;
+    xSemaphoreGive(_lock);
+    wake();
+}
+
+// ----------------------------
+
+/**
+ * @brief wake the push task, the first change of a burst starts the coalescing window
+ *
+ */
+void LivePush::wake() {
+    if (_task != nullptr)
+        xTaskNotifyGive(_task);
+}
+
+// ----------------------------
+
+/**
+ * @brief push task loop: sleep until a change, wait PUSH_COALESCE_MS, send the burst
+ *
+ */
+void LivePush::run() {
+    _task = xTaskGetCurrentTaskHandle();
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);                                // idle: no traffic at all
+        vTaskDelay(pdMS_TO_TICKS(PUSH_COALESCE_MS));                            // let the burst complete
+        ulTaskNotifyTake(pdTRUE, 0);                                            // changes of the window are in this flush
+        flush();
+    }
+}
+
+// ----------------------------
+
+/**
+ * @brief send the changes of one burst: goals, table, modules
+ *
+ */
+void LivePush::flush() {
+    xSemaphoreTake(_lock, portMAX_DELAY);
+    memcpy(&_burst, &_pending, sizeof(_burst));
+    _pending.goalCount    = 0;
+    _pending.goalOverflow = false;
+    for (auto& t : _pending.table)
+        t.changed = false;
+    memset(_pending.moduleDirty, 0, sizeof(_pending.moduleDirty));
+    xSemaphoreGive(_lock);
+
+    if (_subscribers == 0)
+        return;                                                                 // nobody listens, /1 and /2 have the state
+
+    String data;
+    data.reserve(256);
+
+    for (uint8_t i = 0; i < _burst.goalCount; ++i) {
+        const Goal& g = _burst.goals[i];
+        char        head[96];
+        snprintf(head, sizeof(head), "{\"match\":%lu,\"goal\":%lu,\"minute\":%u,\"score\":\"%u:%u\",\"flags\":%u,\"team\":\"", (unsigned long)g.matchID,
+                 (unsigned long)g.goalID, g.minute, g.score1, g.score2, g.flags);
+        data = head;
+        appendJsonText(data, g.team);
+        data += "\",\"player\":\"";
+        appendJsonText(data, g.player);
+        data += "\"}";
+        send("goal", data.c_str());
+    }
+    if (_burst.goalOverflow)
+        send("resync", "{\"reason\":\"goals\"}");
+
+    data = "";
+    for (uint8_t k = 0; k < PUSH_TABLE_KINDS; ++k) {
+        const Table& t = _burst.table[k];
+        if (!t.changed)
+            continue;
+        char item[48];
+        snprintf(item, sizeof(item), "%s\"%s\":[\"%s\",\"%s\"]", data.length() ? "," : "{", pushTableName[k], t.oldTeam, t.newTeam);
+        data += item;
+    }
+    if (data.length()) {
+        data += "}";
+        send("table", data.c_str());
+    }
+
+    data = "";
+    for (uint16_t a = 0; a < PUSH_MODULES; ++a) {
+        if (!(_burst.moduleDirty[a / 32] & (1UL << (a % 32))))
+            continue;
+        char item[16];
+        snprintf(item, sizeof(item), "%s[%u,%u]", data.length() ? "," : "[", a, _burst.moduleFlap[a]);
+        data += item;
+    }
+    if (data.length()) {
+        data += "]";
+        send("modules", data.c_str());
+    }
+}
+
+// ----------------------------
+
+/**
+ * @brief broadcast one event, then close subscribers that do not keep up
+ *
+ * @param event SSE event name
+ * @param data JSON
+ */
+void LivePush::send(const char* event, const char* data) {
+    _events.send(data, event, ++_eventId);
+    _messages++;
+
+    xSemaphoreTakeRecursive(_clientLock, portMAX_DELAY);                        // clients are removed in onDisconnect, not deleted before
+    std::vector<AsyncEventSourceClient*> slow;
+    for (AsyncEventSourceClient* client : _clients)
+        if (client->packetsWaiting() > PUSH_MAX_BACKLOG)
+            slow.push_back(client);
+    for (AsyncEventSourceClient* client : slow) {
+        removeClient(client);                                                   // AsyncTCP may report the disconnect later
+        client->close();                                                        // browser reconnects and starts with hello
+        _dropped++;
+    }
+    xSemaphoreGiveRecursive(_clientLock);
+}
@@ -25,6 +25,8 @@
 #include "RtosTasks.h"
 #include "FlapStatistics.h"
 #include "MasterSetup.h"
+#include "ReadyScheduler.h"
+#include "LivePush.h"
 
 /**
  * @brief Print out Header of Master
@@ -82,10 +84,8 @@ void masterAddressPool() {
         #ifdef MASTERVERBOSE
             {
             TraceScope trace;                                                   // use semaphore to protect this block
-            masterPrint("I2C Address Pool generated 0x");
-            Serial.print(g_slaveAddressPool[0], HEX);
-            Serial.print(" - 0x");
-            Serial.println(g_slaveAddressPool[numberOfTwins - 1], HEX);
+            masterPrintln("I2C Address Pool generated 0x%02X - 0x%02X", (unsigned)g_slaveAddressPool[0],
+                          (unsigned)g_slaveAddressPool[numberOfTwins - 1]);
             }
         #endif
     }
@@ -151,6 +151,8 @@ void masterSlaveControlObject() {
     for (int m = 0; m < numberOfTwins; m++) {
         Twin[m] = new SlaveTwin(g_slaveAddressPool[m]);                         // create twins
     }
+    ReadyPoll = new ReadyScheduler();                                           // shared ARE_YOU_READY probes of all twins
+    Push      = new LivePush();                                                 // live events before twins and Liga produce them
 }
 
 // ---------------------------
@@ -160,11 +162,16 @@ void masterSlaveControlObject() {
  *
  */
 void masterStartRtosTasks() {
+    #ifndef TRACESYNC
+        createTraceLogTask();                                                   // trace lines through ring, before the tasks trace
+    #endif
     createStatisticTask();                                                      // create statistics task
     createReportTask();                                                         // Create report tasks
+    createReadyPollTask();                                                      // Create ARE_YOU_READY scheduler before the twins use it
     createTwinTasks();                                                          // Create twin tasks
     createRemoteControlTask();                                                  // Create remote control
     createParserTask();                                                         // create parser task
+    createLivePushTask();                                                       // push task before the web server attaches /events
     createWebServerTask();                                                      // create web server task
     createLigaTask();                                                           // create liga task
     createRegisterTwinsTask();                                                  // Create Register Twins task
@@ -205,13 +212,11 @@ void createTwinTasks() {
         char taskName[16];
         snprintf(taskName, sizeof(taskName), "SlaveTwin-%02d", i + 1);
         #ifdef MEMORYVERBOSE
+            uint32_t heepBefore = ESP.getFreeHeap();
             {
             TraceScope trace;                                                   // use semaphore to protect this block
-            masterPrint("starting freeRTOS task: ");
-            Serial.println(taskName);
-            uint32_t heepBefore = ESP.getFreeHeap();
-            masterPrint("free heap before start of task: ");
-            Serial.println(heepBefore);
+            masterPrintln("starting freeRTOS task: %s", taskName);
+            masterPrintln("free heap before start of task: %u", (unsigned)heepBefore);
             }
         #endif
         xTaskCreate(slaveTwinTask, taskName, STACK_TWIN, &twinNumber[i], PRIO_TWIN, &g_twinHandle[i]);
@@ -220,10 +225,8 @@ void createTwinTasks() {
             {
             TraceScope trace;                                                   // use semaphore to protect this block
             uint32_t   heepAfter = ESP.getFreeHeap();
-            masterPrint("free heap after start of task: ");
-            Serial.println(heepAfter);
-            masterPrint("used heap by task (in bytes): ");
-            Serial.println(heepBefore - heepAfter);
+            masterPrintln("free heap after start of task: %u", (unsigned)heepAfter);
+            masterPrintln("used heap by task (in bytes): %d", (int)(heepBefore - heepAfter));
             }
         #endif
     }
@@ -231,6 +234,23 @@ void createTwinTasks() {
 
 // ---------------------------
 
+/**
+ * @brief Create the ARE_YOU_READY scheduler task: one timer wheel probes the slaves of all twins
+ *
+ */
+void createReadyPollTask() {
+    #ifdef MASTERVERBOSE
+        {
+        TraceScope trace;                                                       // use semaphore to protect this block
+        masterPrintln("start freeRTOS task: ReadyPoll");
+        }
+    #endif
+    xTaskCreate(readyPollTask, "ReadyPoll", STACK_READY_POLL, NULL, PRIO_READY_POLL, &g_readyPollHandle);
+    ReadyPoll->attach(g_readyPollHandle);                                       // before any booking wakes it
+}
+
+// ---------------------------
+
 /**
  * @brief Create a Remote Control Task object and start freeRTOS task: remote control receiver for Key21 control
  *
@@ -247,6 +267,22 @@ void createRemoteControlTask() {
 
 // ---------------------------
 
+/**
+ * @brief Create the TraceLog task: writes the trace ring to Serial with low priority
+ *
+ */
+void createTraceLogTask() {
+    #ifdef MASTERVERBOSE
+        {
+        TraceScope trace;                                                       // use semaphore to protect this block
+        masterPrintln("start freeRTOS task: TraceLog");
+        }
+    #endif
+    xTaskCreate(traceLogTask, "TraceLog", STACK_TRACE, NULL, PRIO_TRACE, &g_traceLogHandle);
+}
+
+// ---------------------------
+
 /**
  * @brief Create a Statistic Task object and start freeRTOS task: StatisticTask
  *
@@ -340,4 +376,20 @@ void createWebServerTask() {
     #endif
 
     xTaskCreate(flapServerTask, "Flap Server", STACK_WEB_SERVER, NULL, PRIO_WEB_SERVER, &g_webServerHandle);
+}
+
+// ---------------------------
+
+/**
+ * @brief Create the LivePush task: sends goals, table changes and module moves to /events subscribers
+ *
+ */
+void createLivePushTask() {
+    #ifdef MASTERVERBOSE
+        {
+        TraceScope trace;                                                       // use semaphore to protect this block
+        masterPrintln("start freeRTOS task: LivePush");
+        }
+    #endif
+    xTaskCreate(livePushTask, "LivePush", STACK_PUSH, NULL, PRIO_PUSH, &g_livePushHandle);
 }
\ No newline at end of file
@@ -0,0 +1,176 @@
+// #################################################################################################################
+//
+//  ███    ███  █████  ████████  ██████ ██   ██ ██████   █████  ██    ██     ███    ███  ██████  ██████  ███████ ██
+//  ████  ████ ██   ██    ██    ██      ██   ██ ██   ██ ██   ██  ██  ██      ████  ████ ██    ██ ██   ██ ██      ██
+//  ██ ████ ██ ███████    ██    ██      ███████ ██   ██ ███████   ████       ██ ████ ██ ██    ██ ██   ██ █████   ██
+//  ██  ██  ██ ██   ██    ██    ██      ██   ██ ██   ██ ██   ██    ██        ██  ██  ██ ██    ██ ██   ██ ██      ██
+//  ██      ██ ██   ██    ██     ██████ ██   ██ ██████  ██   ██    ██        ██      ██  ██████  ██████  ███████ ███████
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Matchday%20Model
+//
+//
+/*
+
+    Matches of one matchday from one request, see MatchdayModel.h
+
+*/
+#include <Arduino.h>
+#include <algorithm>
+#include "Liga.h"
+#include "MatchdayModel.h"
+
+MatchdayModel ligaMatchdayModel;                                                // current matchday of the loaded league
+MatchdayModel ligaNextMatchdayModel;                                            // following matchday of the loaded league
+
+MatchdayModel::MatchdayModel() : _count(0), _matchday(0), _version(0) {}
+
+void MatchdayModel::clear() {
+    _count    = 0;
+    _matchday = 0;
+    _version++;
+}
+
+// ----------------------------
+// body of getmatchdata/<league>/<season>/<matchday>
+
+void MatchdayModel::begin(int matchday) {
+    _count    = 0;
+    _matchday = matchday;
+}
+
+/**
+ * @brief one match of the body, the kickoff string is converted once here
+ */
+void MatchdayModel::add(uint32_t matchID, const char* kickoff, bool finished, const char* team1, const char* team2) {
+    if (matchID == 0 || _count >= MAX_MATCHES_PER_MATCHDAY)
+        return;
+    MatchdayMatch& match = _matches[_count++];
+    match.matchID        = matchID;
+    match.finished       = finished;
+    match.kickoff        = 0;
+    struct tm tmKickoff  = {};
+    if (kickoff[0] && strptime(kickoff, "%Y-%m-%dT%H:%M:%S", &tmKickoff)) {
+        tmKickoff.tm_isdst = -1;                                                // Let system determine daylight saving
+        match.kickoff      = mktime(&tmKickoff);
+    }
+    snprintf(match.team1, sizeof(match.team1), "%s", team1);
+    snprintf(match.team2, sizeof(match.team2), "%s", team2);
+}
+
+void MatchdayModel::end() {
+    _version++;
+}
+
+/**
+ * @brief final whistle seen in getmatchdata/<matchID>, the matchday body is not fetched again
+ *
+ * @return true if the match was live in this model
+ */
+bool MatchdayModel::matchFinished(uint32_t matchID) {
+    for (uint8_t i = 0; i < _count; ++i) {
+        MatchdayMatch& match = _matches[i];
+        if (match.matchID != matchID || match.finished)
+            continue;
+        match.finished = true;
+        _version++;
+        return true;
+    }
+    return false;
+}
+
+uint8_t MatchdayModel::finishedCount() const {
+    uint8_t finished = 0;
+    for (uint8_t i = 0; i < _count; ++i)
+        if (_matches[i].finished)
+            finished++;
+    return finished;
+}
+
+// ----------------------------
+// views
+
+/**
+ * @brief matches kicked off at most MAX_MATCH_DURATION ago and not finished
+ *
+ * @param now current time
+ * @param live MAX_MATCHES_PER_MATCHDAY entries, filled from the front
+ * @return uint8_t number of live matches
+ */
+uint8_t MatchdayModel::liveMatches(time_t now, MatchInfo* live) const {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < _count; ++i) {
+        const MatchdayMatch& match = _matches[i];
+        if (match.finished || match.kickoff == 0)
+            continue;
+        if (now < match.kickoff || now - match.kickoff > MAX_MATCH_DURATION)
+            continue;
+        live[n].matchID = match.matchID;
+        live[n].kickoff = match.kickoff;
+        live[n].team1   = match.team1;
+        live[n].team2   = match.team2;
+        n++;
+    }
+    return n;
+}
+
+/**
+ * @brief matches ahead: nearest kickoff into next[], later kickoffs into plan[]
+ *
+ * @param now current time
+ * @param next MAX_MATCHES_PER_MATCHDAY entries
+ * @param plan MAX_MATCHES_PER_MATCHDAY entries
+ * @param planCount number of planned matches
+ * @return uint8_t number of next matches
+ */
+uint8_t MatchdayModel::nextMatches(time_t now, MatchInfo* next, MatchInfo* plan, uint8_t& planCount) const {
+    const time_t first     = nextKickoff(now);
+    uint8_t      nextCount = 0;
+    planCount              = 0;
+    for (uint8_t i = 0; i < _count; ++i) {
+        const MatchdayMatch& match = _matches[i];
+        if (match.finished || match.kickoff <= now)
+            continue;                                                           // ignore matches in the past
+        MatchInfo& info = (match.kickoff == first) ? next[nextCount++] : plan[planCount++];
+        info.matchID    = match.matchID;
+        info.kickoff    = match.kickoff;
+        info.team1      = match.team1[0] ? match.team1 : "Team A";
+        info.team2      = match.team2[0] ? match.team2 : "Team B";
+    }
+    return nextCount;
+}
+
+time_t MatchdayModel::nextKickoff(time_t now) const {
+    time_t kickoff = MATCHDAY_NEVER;
+    for (uint8_t i = 0; i < _count; ++i)
+        if (!_matches[i].finished && _matches[i].kickoff > now)
+            kickoff = std::min(kickoff, _matches[i].kickoff);
+    return kickoff;
+}
+
+/**
+ * @brief next moment after t the live matches change by the clock alone
+ *
+ * @return time_t a kickoff or the end of a live window, MATCHDAY_NEVER if none
+ */
+time_t MatchdayModel::liveChangeAfter(time_t t) const {
+    time_t at = MATCHDAY_NEVER;
+    for (uint8_t i = 0; i < _count; ++i) {
+        const MatchdayMatch& match = _matches[i];
+        if (match.finished || match.kickoff == 0)
+            continue;
+        if (match.kickoff > t)
+            at = std::min(at, match.kickoff);                                   // match gets live
+        else if (match.kickoff + MAX_MATCH_DURATION > t)
+            at = std::min(at, (time_t)(match.kickoff + MAX_MATCH_DURATION));    // no final whistle seen: drop it
+    }
+    return at;
+}
+
+bool MatchdayModel::pending(time_t now) const {
+    for (uint8_t i = 0; i < _count; ++i)
+        if (!_matches[i].finished && _matches[i].kickoff + MAX_MATCH_DURATION > now)
+            return true;
+    return false;
+}
@@ -0,0 +1,223 @@
+// #################################################################################################################
+//
+//  ███    ███  ██████  ██    ██ ███████     ███    ███  ██████  ██████  ███████ ██
+//  ████  ████ ██    ██ ██    ██ ██          ████  ████ ██    ██ ██   ██ ██      ██
+//  ██ ████ ██ ██    ██ ██    ██ █████       ██ ████ ██ ██    ██ ██   ██ █████   ██
+//  ██  ██  ██ ██    ██  ██  ██  ██          ██  ██  ██ ██    ██ ██   ██ ██      ██
+//  ██      ██  ██████    ████   ███████     ██      ██  ██████  ██████  ███████ ███████
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Move%20Model
+//
+
+#include <FlapGlobal.h>
+#include <SPIFFS.h>
+#include "TracePrint.h"
+#include "MoveModel.h"
+
+// ----------------------------
+
+/**
+ * @brief Construct a new Move Model, nothing learned
+ *
+ */
+MoveModel::MoveModel() : _dirty(false), _savedMs(0) {
+    _data.version      = MOVE_MODEL_VERSION;
+    _data.serialnumber = 0;
+    for (int i = 0; i < MOVE_MODEL_COMMANDS; ++i) {
+        _data.scale[i]   = 1.0f;
+        _data.samples[i] = 0;
+    }
+    _lock = xSemaphoreCreateMutex();
+}
+
+// ----------------------------
+
+/**
+ * @brief learned ETA of a LONG command
+ *
+ * @param longCmd command
+ * @param staticEtaMs ETA of the static formulas
+ * @return uint32_t learned ETA in ms, 0 if the command has not enough samples
+ */
+uint32_t MoveModel::predict(uint8_t longCmd, uint32_t staticEtaMs) const {
+    const int s = slot(longCmd);
+    if (s < 0 || _lock == nullptr)
+        return 0;
+    xSemaphoreTake(_lock, portMAX_DELAY);
+    const bool  learned = _data.samples[s] >= MOVE_MODEL_MIN_SAMPLES;
+    const float scale   = _data.scale[s];
+    xSemaphoreGive(_lock);
+    if (!learned)
+        return 0;
+    return (uint32_t)(staticEtaMs * scale + 0.5f);
+}
+
+// ----------------------------
+
+/**
+ * @brief fit factor with the answers of one ready wait
+ *
+ * @param longCmd command
+ * @param staticEtaMs ETA of the static formulas
+ * @param lastBusyMs time of last BUSY answer after the command, 0 if the first probe was READY
+ * @param readyMs time of the READY answer after the command
+ */
+void MoveModel::learn(uint8_t longCmd, uint32_t staticEtaMs, uint32_t lastBusyMs, uint32_t readyMs) {
+    const int s = slot(longCmd);
+    if (s < 0 || _lock == nullptr || staticEtaMs == 0)
+        return;
+
+    xSemaphoreTake(_lock, portMAX_DELAY);
+    float scale = _data.scale[s];
+    if (lastBusyMs > 0) {                                                       // end of move lies between both probes
+        const float observed = (lastBusyMs + (readyMs - lastBusyMs) * 0.75f) / staticEtaMs; // rather late: a BUSY probe costs more than a short gap
+        const float alpha    = (_data.samples[s] < 5) ? 1.0f / (_data.samples[s] + 1) : MOVE_MODEL_ALPHA; // mean first, then EWMA
+        scale += alpha * (observed - scale);
+    } else {                                                                    // only an upper bound is known
+        const float bound = (float)readyMs / staticEtaMs;
+        if (bound < scale)
+            scale = bound;
+        scale *= (1.0f - MOVE_MODEL_SHRINK);                                    // probe a little earlier next time
+    }
+    if (scale < MOVE_MODEL_MIN_SCALE)
+        scale = MOVE_MODEL_MIN_SCALE;
+    else if (scale > MOVE_MODEL_MAX_SCALE)
+        scale = MOVE_MODEL_MAX_SCALE;
+
+    _data.scale[s] = scale;
+    if (_data.samples[s] < UINT16_MAX)
+        _data.samples[s]++;
+    _dirty = true;
+    xSemaphoreGive(_lock);
+}
+
+// ----------------------------
+
+/**
+ * @brief bind model to module and persist it
+ *
+ * A new serial number loads the stored model of that module. A changed model is written
+ * at most every MOVE_MODEL_SAVE_MS to spare the flash.
+ *
+ * @param serialnumber serial number of the module behind the twin, 0 = unknown
+ */
+void MoveModel::sync(uint32_t serialnumber) {
+    if (serialnumber == 0 || _lock == nullptr)
+        return;
+    if (serialnumber != _data.serialnumber) {
+        load(serialnumber);
+        return;
+    }
+    if (_dirty && (_savedMs == 0 || millis() - _savedMs >= MOVE_MODEL_SAVE_MS))
+        save();
+}
+
+// ----------------------------
+
+float MoveModel::scale(uint8_t longCmd) const {
+    const int s = slot(longCmd);
+    return (s < 0) ? 1.0f : _data.scale[s];
+}
+
+uint16_t MoveModel::samples(uint8_t longCmd) const {
+    const int s = slot(longCmd);
+    return (s < 0) ? 0 : _data.samples[s];
+}
+
+// ----------------------------
+
+int MoveModel::slot(uint8_t longCmd) const {
+    switch (longCmd) {
+        case MOVE:
+            return 0;
+        case CALIBRATE:
+            return 1;
+        case SPEED_MEASURE:
+            return 2;
+        case STEP_MEASURE:
+            return 3;
+        case SENSOR_CHECK:
+            return 4;
+        default:
+            return -1;
+    }
+}
+
+void MoveModel::fileName(char* buf, size_t size, uint32_t serialnumber) const {
+    snprintf(buf, size, "/ayr_%08lx.bin", (unsigned long)serialnumber);
+}
+
+// ----------------------------
+
+/**
+ * @brief load stored model of a module, unknown module starts with static ETA
+ *
+ * @param serialnumber serial number of module
+ * @return true model found
+ */
+bool MoveModel::load(uint32_t serialnumber) {
+    char name[24];
+    fileName(name, sizeof(name), serialnumber);
+    Stored stored;
+    bool   found = false;
+    File   file  = SPIFFS.open(name, FILE_READ);
+    if (file) {
+        found = file.readBytes((char*)&stored, sizeof(stored)) == sizeof(stored) && stored.version == MOVE_MODEL_VERSION &&
+                stored.serialnumber == serialnumber;
+        file.close();
+    }
+
+    xSemaphoreTake(_lock, portMAX_DELAY);
+    if (found) {
+        _data = stored;
+    } else {
+        _data.serialnumber = serialnumber;                                      // other module behind this twin, learn from scratch
+        for (int i = 0; i < MOVE_MODEL_COMMANDS; ++i) {
+            _data.scale[i]   = 1.0f;
+            _data.samples[i] = 0;
+        }
+    }
+    _dirty = false;
+    xSemaphoreGive(_lock);
+
+    #ifdef AYRVERBOSE
+        {
+        TraceScope trace;
+        tracePrintln("[AYR MOVE MODEL  ] ", "%s %s", found ? "loaded" : "new", name);
+        }
+    #endif
+    return found;
+}
+
+// ----------------------------
+
+/**
+ * @brief write model to SPIFFS
+ *
+ * @return true written
+ */
+bool MoveModel::save() {
+    xSemaphoreTake(_lock, portMAX_DELAY);
+    const Stored snapshot = _data;
+    _dirty                = false;
+    xSemaphoreGive(_lock);
+
+    char name[24];
+    fileName(name, sizeof(name), snapshot.serialnumber);
+    File file = SPIFFS.open(name, FILE_WRITE);
+    if (!file) {
+        #ifdef ERRORVERBOSE
+            {
+            TraceScope trace;
+            tracePrintln("[AYR MOVE MODEL  ] ", "could not write %s", name);
+            }
+        #endif
+        return false;
+    }
+    const bool ok = file.write((const uint8_t*)&snapshot, sizeof(snapshot)) == sizeof(snapshot);
+    file.close();
+    _savedMs = millis();
+    return ok;
+}
@@ -47,8 +47,7 @@ void ParserClass::dispatchToOther() {
     #ifdef PARSERVERBOSE
         {
         TraceScope trace;
-        parserPrint("send mapping key21 to reporting: ");
-        Serial.println(Control->key21ToString(_receivedEvent.key));
+        parserPrintln("send mapping key21 to reporting: %s", Control->key21ToString(_receivedEvent.key));
         }
     #endif
     _mappedReport = mapEvent2Report(_receivedEvent);                            // map ClickEvent to ReportCommand
@@ -82,10 +81,7 @@ void ParserClass::dispatchToTwins() {
     #ifdef PARSERVERBOSE
         {
         TraceScope trace;
-        parserPrint("mapping key21: ");
-        Serial.print(Control->key21ToString(_receivedEvent.key));
-        Serial.print(" to twinCommand: ");
-        Serial.println(twinCommandToString(_mappedCommand.twinCommand));
+        parserPrintln("mapping key21: %s to twinCommand: %s", Control->key21ToString(_receivedEvent.key), twinCommandToString(_mappedCommand.twinCommand));
         }
     #endif
 
@@ -116,6 +112,15 @@ void ParserClass::dispatchToTwins() {
     }
 
     // BROADCAST
+    if (_mappedCommand.twinCommand == TWIN_SHOW_FLAP) {                         // all flaps move in one bus round
+        std::vector<FlapFrameEntry> frame;
+        Register->forEachRegisteredIdx([&](int idx, I2Caddress addr) {
+            frame.push_back({addr, _mappedCommand.twinParameter});
+        });
+        if (!Register->postFrame(frame))                                        // Frame task runs it, Parser does not wait
+            Register->sendToAll(_mappedCommand);                                // no Frame task: twin queues
+        return;
+    }
     Register->sendToAll(_mappedCommand);                                        // send to all registered devices
 }
 
@@ -364,8 +369,7 @@ TwinCommand ParserClass::mapEvent2Command(ClickEvent event) {
             #ifdef ERRORVERBOSE
                 {
                 TraceScope trace;
-                parserPrint("Unknown key21: ");
-                Serial.println(static_cast<int>(event.key));
+                parserPrintln("Unknown key21: %d", static_cast<int>(event.key));
                 }
             #endif
             cmd.twinCommand = TWIN_NO_COMMAND;
@@ -488,8 +492,7 @@ ReportCommand ParserClass::mapEvent2Report(ClickEvent event) {
             #ifdef ERRORVERBOSE
                 {
                 TraceScope trace;
-                parserPrint("Unknown key21: ");
-                Serial.println(static_cast<int>(event.key));
+                parserPrintln("Unknown key21: %d", static_cast<int>(event.key));
                 }
             #endif
             cmd.repCommand = REPORT_NO_COMMAND;
@@ -524,8 +527,7 @@ void ParserClass::mapEvent2Parser(ClickEvent event) {
             #ifdef ERRORVERBOSE
                 {
                 TraceScope trace;
-                parserPrint("Unknown key21: ");
-                Serial.println(static_cast<int>(event.key));
+                parserPrintln("Unknown key21: %d", static_cast<int>(event.key));
                 }
             #endif
             break;
@@ -536,20 +538,19 @@ void ParserClass::mapEvent2Parser(ClickEvent event) {
 // -----------------------------
 
 /**
- * @brief toggle league BL1 / BL2
+ * @brief toggle league BL1 / BL2 / BL3
  *
+ * All leagues are tracked by the Liga task (LeagueScheduler), the shown league
+ * changes at once without a cold restart of the poll cycles.
  */
 void ParserClass::toggleLeague() {
     const char* fromLeague = leagueName(activeLeague);                          // Ausgangsliga merken (vor dem Umschalten)
     if (activeLeague == League::BL1) {
         activeLeague = League::BL2;
-        ligaMaxTeams = LIGA2_MAX_TEAMS;
     } else if (activeLeague == League::BL2) {
         activeLeague = League::BL3;
-        ligaMaxTeams = LIGA3_MAX_TEAMS;
     } else if (activeLeague == League::BL3) {
         activeLeague = League::BL1;
-        ligaMaxTeams = LIGA1_MAX_TEAMS;
     }
 
     {
@@ -557,26 +558,7 @@ void ParserClass::toggleLeague() {
         parserPrintln("Liga gewechselt: %s -> %s", fromLeague, leagueName(activeLeague));
     }
 
-    {
-        LigaSnapshotLock _lock;                                                 // protect snapshot reset against Liga/Report/Web tasks
-        snap[snapshotIndex].clear();                                            // clear actual snapshot
-        snap[snapshotIndex ^ 1].clear();                                        // clear other snapshot
-    }
-    ligaSeason                   = 0;                                           // reset actual Season
-    ligaMatchday                 = 0;                                           // reset actual Matchday
-    currentLastChangeOfMatchday  = "";                                          // openLigaDB Matchday change state
-    previousLastChangeOfMatchday = "";                                          // openLigaDB Matchday change state
-    currentMatchdayChanged       = false;                                       // no chances
-    nextKickoffChanged           = false;                                       // no chances
-    nextKickoffFarAway           = true;                                        // assume far away
-    currentNextKickoffTime       = 0;                                           // reset
-    previousNextKickoffTime      = 0;                                           // reset
-    diffSecondsUntilKickoff      = 0;                                           // reset
-    nextKickoffString            = "";                                          // reset
-    matchIsLive                  = false;                                       // reset live match detection
-    ligaConnectionRefused        = false;                                       // reset connection refused
-    currentPollMode              = PollMode::POLL_MODE_ONCE;                    // start with NONE cycle
-    xTaskNotifyGive(g_ligaHandle);                                              // wake ligaTask to perform liga changes emmediately
+    xTaskNotifyGive(g_ligaHandle);                                              // wake ligaTask, it loads the warm state of the new league
 };
 
 // -----------------------------
@@ -595,10 +577,7 @@ void ParserClass::toggleBroadcastMode() {
         #ifdef MASTERVERBOSE
             {
             TraceScope trace;
-            parserPrint("switched to MODE_UNICAST, send to Twin[n]  n= ");
-            Serial.print(_ds.currentIndex);
-            Serial.print(" with address 0x");
-            Serial.println(g_slaveAddressPool[_ds.currentIndex], HEX);
+            parserPrintln("switched to MODE_UNICAST, send to Twin[n]  n= %d with address 0x%02X", _ds.currentIndex, g_slaveAddressPool[_ds.currentIndex]);
             }
         #endif
     } else {
@@ -622,8 +601,7 @@ void ParserClass::selectNextTwin() {
     #ifdef MASTERVERBOSE
         {
         TraceScope trace;
-        parserPrint("selected Twin index: ");
-        Serial.println(_ds.currentIndex);
+        parserPrintln("selected Twin index: %d", _ds.currentIndex);
         }
     #endif
 }
@@ -639,8 +617,7 @@ void ParserClass::selectPrevTwin() {
     #ifdef MASTERVERBOSE
         {
         TraceScope trace;
-        parserPrint("selected Twin index: ");
-        Serial.println(_ds.currentIndex);
+        parserPrintln("selected Twin index: %d", _ds.currentIndex);
         }
     #endif
 }
@@ -0,0 +1,373 @@
+// #################################################################################################################
+//
+//  ██████   ██████  ██      ██          ███████  ██████ ██   ██ ███████ ██████  ██    ██ ██      ███████ ██████
+//  ██   ██ ██    ██ ██      ██          ██      ██      ██   ██ ██      ██   ██ ██    ██ ██      ██      ██   ██
+//  ██████  ██    ██ ██      ██          ███████ ██      ███████ █████   ██   ██ ██    ██ ██      █████   ██████
+//  ██      ██    ██ ██      ██               ██ ██      ██   ██ ██      ██   ██ ██    ██ ██      ██      ██   ██
+//  ██       ██████  ███████ ███████     ███████  ██████ ██   ██ ███████ ██████   ██████  ███████ ███████ ██   ██
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Poll%20Scheduler
+//
+//
+/*
+
+    Deadline-driven poll scheduler of the Liga task, see PollScheduler.h
+
+*/
+#include <Arduino.h>
+#include <algorithm>
+#include "Liga.h"
+#include "PollScheduler.h"
+
+PollScheduler ligaPolls;                                                        // scheduler of the loaded league
+
+// position in a poll cycle per PollScope: matchday before its views, goals before table, detectors last
+static const uint8_t scopeOrder[POLL_SCOPE_COUNT] = {
+    2,                                                                          // CHECK_FOR_CHANGES
+    8,                                                                          // FETCH_TABLE
+    1,                                                                          // FETCH_CURRENT_MATCHDAY
+    0,                                                                          // CALC_CURRENT_SEASON
+    6,                                                                          // CALC_NEXT_KICKOFF
+    3,                                                                          // FETCH_MATCHES
+    4,                                                                          // CALC_LIVE_MATCHES
+    7,                                                                          // FETCH_LIVE_GOALS
+    5,                                                                          // CALC_NEXT_MATCH_LIST
+    10,                                                                         // SHOW_NEXT_KICKOFF
+    9,                                                                          // CALC_LIVE_TABLE
+    11,                                                                         // CALC_LEADER_CHANGE
+    12,                                                                         // CALC_RELEGATION_GHOST_CHANGE
+    13,                                                                         // CALC_RED_LANTERN_CHANGE
+    14                                                                          // CALC_GOALS
+};
+
+static inline uint32_t scopeBit(PollScope scope) {
+    return 1u << scope;
+}
+
+// scopes that request openLigaDB
+static const uint32_t FETCH_SCOPES =
+    scopeBit(CHECK_FOR_CHANGES) | scopeBit(FETCH_TABLE) | scopeBit(FETCH_CURRENT_MATCHDAY) | scopeBit(FETCH_MATCHES) | scopeBit(FETCH_LIVE_GOALS);
+
+// ----------------------------
+
+PollScheduler::PollScheduler() {
+    reset();
+}
+
+/**
+ * @brief forget everything: season, matchday, table and schedule are fetched at once
+ */
+void PollScheduler::reset() {
+    for (uint8_t s = 0; s < POLL_SCOPE_COUNT; ++s) {
+        _deadline[s] = POLL_NEVER;
+        _last[s]     = 0;
+        _runs[s]     = 0;
+        _pos[s]      = -1;
+    }
+    _heapSize      = 0;
+    _wanted        = 0;
+    _ranMask       = 0;
+    _backoffUntil  = 0;
+    _tableRecheck  = 0;
+    _matchday           = 0;
+    _lastGoalID         = 0;
+    _matchesVersion     = 0;
+    _nextMatchesVersion = 0;
+    _finishedCount      = 0;
+
+    want(CALC_CURRENT_SEASON);
+    want(FETCH_CURRENT_MATCHDAY);
+    want(CHECK_FOR_CHANGES);
+    want(FETCH_MATCHES);
+    want(FETCH_TABLE);
+    plan(0);
+}
+
+// ----------------------------
+// indexed binary min-heap over the scopes
+
+bool PollScheduler::before(uint8_t a, uint8_t b) const {
+    if (_deadline[a] != _deadline[b])
+        return _deadline[a] < _deadline[b];
+    return scopeOrder[a] < scopeOrder[b];
+}
+
+void PollScheduler::place(uint8_t i, uint8_t scope) {
+    _heap[i]    = scope;
+    _pos[scope] = i;
+}
+
+void PollScheduler::siftUp(uint8_t i) {
+    const uint8_t scope = _heap[i];
+    while (i > 0) {
+        const uint8_t parent = (i - 1) / 2;
+        if (!before(scope, _heap[parent]))
+            break;
+        place(i, _heap[parent]);
+        i = parent;
+    }
+    place(i, scope);
+}
+
+void PollScheduler::siftDown(uint8_t i) {
+    const uint8_t scope = _heap[i];
+    while (true) {
+        uint8_t child = 2 * i + 1;
+        if (child >= _heapSize)
+            break;
+        if (child + 1 < _heapSize && before(_heap[child + 1], _heap[child]))
+            child++;
+        if (!before(_heap[child], scope))
+            break;
+        place(i, _heap[child]);
+        i = child;
+    }
+    place(i, scope);
+}
+
+/**
+ * @brief insert a scope or move it to its new deadline
+ */
+void PollScheduler::queue(uint8_t scope, time_t at) {
+    _deadline[scope] = at;
+    if (_pos[scope] < 0) {
+        place(_heapSize++, scope);
+        siftUp(_heapSize - 1);
+        return;
+    }
+    siftUp(_pos[scope]);
+    siftDown(_pos[scope]);
+}
+
+void PollScheduler::unqueue(uint8_t scope) {
+    const int8_t i = _pos[scope];
+    if (i < 0)
+        return;
+    _deadline[scope] = POLL_NEVER;
+    _pos[scope]      = -1;
+    if (i == --_heapSize)
+        return;
+    const uint8_t moved = _heap[_heapSize];                                     // last entry fills the gap
+    place(i, moved);
+    siftUp(i);
+    siftDown(_pos[moved]);
+}
+
+// ----------------------------
+
+/**
+ * @brief deadline of a scope from the state of the league, events not included
+ *
+ * @return time_t epoch of the next run, POLL_NEVER if the scope has nothing to do
+ */
+time_t PollScheduler::rule(PollScope scope, time_t now) const {
+    const time_t last = _last[scope];
+    switch (scope) {
+        case CALC_CURRENT_SEASON:
+            return ligaSeason ? last + POLL_SEASON_S : now;
+
+        case FETCH_CURRENT_MATCHDAY:
+            if (!ligaMatchday)
+                return last ? last + POLL_RETRY_S : now;
+            if (ligaMatchdayModel.pending(now))
+                return POLL_NEVER;                                              // matchday moves on after its last match
+            return last + POLL_IDLE_S;
+
+        case CHECK_FOR_CHANGES: {
+            if (!ligaMatchday || ligaLiveMatchCount > 0)
+                return POLL_NEVER;                                              // live: goal polls see every change
+            time_t       at      = last + POLL_IDLE_S;
+            const time_t kickoff = ligaMatchdayModel.nextKickoff(now);
+            if (kickoff != POLL_NEVER && last < kickoff - POLL_PRELIVE_CHECK_S)
+                at = std::min(at, kickoff - POLL_PRELIVE_CHECK_S);              // postponed match? last look before kickoff
+            return at;
+        }
+
+        case FETCH_MATCHES:
+            if (!ligaMatchday || !ligaSeason)
+                return POLL_NEVER;
+            if (ligaMatchdayModel.matchday() != ligaMatchday)
+                return last ? last + POLL_RETRY_S : now;                        // no body of this matchday yet
+            if (ligaMatchdayModel.pending(now))
+                return POLL_NEVER;                                              // changes come with CHECK_FOR_CHANGES
+            return last + POLL_IDLE_S;                                          // matchday over: kickoffs of the following one
+
+        case CALC_LIVE_MATCHES:
+            return ligaMatchdayModel.liveChangeAfter(last);                     // match gets live or its live window ends
+
+        case CALC_NEXT_MATCH_LIST:
+        case CALC_NEXT_KICKOFF:
+            return ligaMatchdayModel.nextKickoff(last);                         // next / planned lists shift at a kickoff
+
+        case FETCH_LIVE_GOALS:
+            return (ligaLiveMatchCount > 0) ? last + POLL_GOALS_S : POLL_NEVER;
+
+        case FETCH_TABLE:
+            if (_tableRecheck > last)
+                return _tableRecheck;                                           // late table update after a goal
+            if (ligaSeason && ligaSnapshotsOf(ligaLeague).version() == 0)
+                return last + POLL_RETRY_S;                                     // no table yet
+            return POLL_NEVER;
+
+        default:
+            return POLL_NEVER;                                                  // SHOW_* and CALC_* follow events only
+    }
+}
+
+/**
+ * @brief deadlines of all scopes: events due now, the others by rule, nothing before a back-off
+ */
+void PollScheduler::plan(time_t now) {
+    for (uint8_t s = 0; s < POLL_SCOPE_COUNT; ++s) {
+        time_t at = (_wanted & (1u << s)) ? now : rule((PollScope)s, now);
+        if (at == POLL_NEVER) {
+            unqueue(s);
+            continue;
+        }
+        if (at < _backoffUntil)
+            at = _backoffUntil;
+        queue(s, at);
+    }
+}
+
+/**
+ * @brief take the earliest scope that is due and did not run in this cycle
+ *
+ * @param now current time
+ * @param scope scope to run
+ * @return true scope is due, false: cycle is over
+ */
+bool PollScheduler::pop(time_t now, PollScope& scope) {
+    if (_heapSize == 0)
+        return false;
+    const uint8_t top = _heap[0];
+    if (_deadline[top] > now || (_ranMask & (1u << top)))
+        return false;                                                           // a second run waits for the next cycle
+    unqueue(top);
+    _ranMask |= 1u << top;
+    scope = (PollScope)top;
+    return true;
+}
+
+/**
+ * @brief a scope ran: turn its results into events and plan all deadlines again
+ *
+ * @param scope scope that ran
+ * @param now start of the run, periodic scopes keep their cadence
+ */
+void PollScheduler::done(PollScope scope, time_t now) {
+    _last[scope] = now;
+    _wanted &= ~scopeBit(scope);
+    _runs[scope]++;
+
+    switch (scope) {
+        case FETCH_CURRENT_MATCHDAY:
+            if (ligaMatchday && ligaMatchday != _matchday) {                    // new matchday: matches and table again
+                _matchday            = ligaMatchday;
+                _finishedCount       = 0;
+                _last[FETCH_MATCHES] = 0;
+                want(CHECK_FOR_CHANGES);
+                want(FETCH_MATCHES);
+                want(FETCH_TABLE);
+            }
+            break;
+
+        case CHECK_FOR_CHANGES:
+            if (ligaConnectionRefused) {                                        // back off, then try again
+                ligaConnectionRefused = false;
+                _backoffUntil         = now + POLL_BACKOFF_S;
+                want(CHECK_FOR_CHANGES);
+                break;
+            }
+            if (currentMatchdayChanged) {                                       // openLigaDB has news for this matchday
+                want(FETCH_MATCHES);
+                want(FETCH_TABLE);
+            }
+            break;
+
+        case FETCH_MATCHES:
+            matchesChanged();
+            break;
+
+        case CALC_NEXT_KICKOFF:
+            if (nextKickoffChanged)
+                want(SHOW_NEXT_KICKOFF);
+            break;
+
+        case FETCH_LIVE_GOALS:
+            matchesChanged();                                                   // final whistles marked in the model
+            want(CALC_LIVE_TABLE);
+            if (lastGoalID != _lastGoalID) {                                    // new goal: table has changed
+                _lastGoalID   = lastGoalID;
+                _tableRecheck = now + POLL_TABLE_SETTLE_S;
+                want(FETCH_TABLE);
+            }
+            break;
+
+        case FETCH_TABLE:
+            want(CALC_LEADER_CHANGE);                                           // detectors once per fetched table
+            want(CALC_RELEGATION_GHOST_CHANGE);
+            want(CALC_RED_LANTERN_CHANGE);
+            break;
+
+        default:
+            break;
+    }
+    plan(now);
+}
+
+/**
+ * @brief time until the earliest deadline, at most POLL_NORMAL
+ */
+uint32_t PollScheduler::waitMs(time_t now) const {
+    if (_heapSize == 0)
+        return POLL_NORMAL;
+    const time_t at = _deadline[_heap[0]];
+    if (at <= now)
+        return 0;
+    return (uint32_t)std::min((time_t)(POLL_NORMAL / 1000), at - now) * 1000;
+}
+
+/**
+ * @brief poll mode as label of the state (reports, log, LeagueScheduler)
+ */
+PollMode PollScheduler::mode(time_t now) const {
+    if (now < _backoffUntil)
+        return POLL_MODE_NONE;
+    if (!ligaSeason || !ligaMatchday)
+        return POLL_MODE_ONCE;
+    if (ligaLiveMatchCount > 0)
+        return POLL_MODE_LIVE;
+    const time_t kickoff = ligaMatchdayModel.nextKickoff(now);
+    if (kickoff != POLL_NEVER && kickoff - now <= SIXTY_MINUTES_BEFORE_MATCH)
+        return POLL_MODE_PRELIVE;
+    if (_wanted & FETCH_SCOPES)
+        return POLL_MODE_REACTIVE;
+    return POLL_MODE_RELAXED;
+}
+
+// ----------------------------
+
+/**
+ * @brief new MatchdayModel or final whistle: derive the views again, final results in the table
+ */
+void PollScheduler::matchesChanged() {
+    if (ligaNextMatchdayModel.version() != _nextMatchesVersion) {
+        _nextMatchesVersion = ligaNextMatchdayModel.version();
+        want(CALC_NEXT_MATCH_LIST);                                             // lists and kickoff after the last kickoff
+        want(CALC_NEXT_KICKOFF);
+    }
+    if (ligaMatchdayModel.version() == _matchesVersion)
+        return;
+    _matchesVersion = ligaMatchdayModel.version();
+    want(CALC_LIVE_MATCHES);
+    want(CALC_NEXT_MATCH_LIST);
+    want(CALC_NEXT_KICKOFF);
+
+    const uint8_t finished = ligaMatchdayModel.finishedCount();
+    if (finished > _finishedCount)
+        want(FETCH_TABLE);                                                      // final result in the table
+    _finishedCount = finished;
+}
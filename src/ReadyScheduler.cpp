@@ -0,0 +1,277 @@
+// #################################################################################################################
+//
+//  ██████  ███████  █████  ██████  ██    ██     ███████  ██████ ██   ██ ███████ ██████  ██    ██ ██      ███████ ██████
+//  ██   ██ ██      ██   ██ ██   ██  ██  ██      ██      ██      ██   ██ ██      ██   ██ ██    ██ ██      ██      ██   ██
+//  ██████  █████   ███████ ██   ██   ████       ███████ ██      ███████ █████   ██   ██ ██    ██ ██      █████   ██████
+//  ██   ██ ██      ██   ██ ██   ██    ██             ██ ██      ██   ██ ██      ██   ██ ██    ██ ██      ██      ██   ██
+//  ██   ██ ███████ ██   ██ ██████     ██        ███████  ██████ ██   ██ ███████ ██████   ██████  ███████ ███████ ██   ██
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Ready%20Scheduler
+//
+
+#include "ReadyScheduler.h"
+#include "SlaveTwin.h"
+
+// ----------------------------
+
+/**
+ * @brief Construct a new Ready Scheduler, empty wheel
+ *
+ */
+ReadyScheduler::ReadyScheduler()
+    : _free(0), _cursor(0), _wheelMs(0), _pending(0), _task(nullptr), _probes(0), _ready(0), _timeouts(0), _maxLateMs(0) {
+    for (int i = 0; i < READY_WHEEL_SLOTS; ++i)
+        _slots[i] = -1;
+    for (int i = 0; i < READY_WHEEL_ENTRIES; ++i)
+        _entries[i].next = (i + 1 < READY_WHEEL_ENTRIES) ? (int16_t)(i + 1) : (int16_t)-1; // chain free list
+    _lock        = xSemaphoreCreateMutex();
+    _serviceLock = xSemaphoreCreateMutex();
+}
+
+// ----------------------------
+
+/**
+ * @brief book a ready wait for a twin
+ *
+ * The calling task is the waiter, it is notified when the ticket is done.
+ *
+ * @param twin twin whose slave is probed
+ * @param ticket result, must live until done
+ * @param firstPollMs first ARE_YOU_READY after now
+ * @param timeoutMs give up after now
+ * @return true booked, false wheel is full
+ */
+bool ReadyScheduler::book(SlaveTwin* twin, ReadyTicket& ticket, uint32_t firstPollMs, uint32_t timeoutMs) {
+    if (_lock == nullptr || _serviceLock == nullptr)
+        return false;
+    ticket.done.store(false);
+    ticket.ready  = false;
+    ticket.polls      = 0;
+    ticket.lastBusyMs = 0;
+    ticket.readyMs    = 0;
+    ticket.waiter     = xTaskGetCurrentTaskHandle();
+
+    xSemaphoreTake(_lock, portMAX_DELAY);
+    if (_free < 0) {
+        xSemaphoreGive(_lock);
+        #ifdef ERRORVERBOSE
+            {
+            TraceScope trace;
+            readyPrintln("wheel full - twin polls on its own");
+            }
+        #endif
+        return false;
+    }
+    const int16_t e = _free;
+    _free           = _entries[e].next;
+
+    const uint32_t now = millis();
+    const bool     idle = (_pending == 0);
+    ticket.startMs      = now;
+    if (idle)
+        _wheelMs = now;                                                         // wheel stood still, restart at now
+    Entry& en      = _entries[e];
+    en.twin        = twin;
+    en.ticket      = &ticket;
+    en.dueMs       = now + firstPollMs;
+    en.windowEndMs = en.dueMs + READY_WINDOW_MS;
+    en.timeoutMs   = now + timeoutMs;
+    insert(e);
+    _pending++;
+    xSemaphoreGive(_lock);
+
+    const TaskHandle_t task = _task.load();
+    if (idle && task != nullptr)
+        xTaskNotifyGive(task);                                                  // scheduler sleeps without timeout
+    return true;
+}
+
+// ----------------------------
+
+/**
+ * @brief sleep until the scheduler finished the ticket
+ *
+ * Before readyPollTask runs the caller drives the wheel itself.
+ *
+ * @param ticket booked ticket
+ * @return true READY observed
+ */
+bool ReadyScheduler::await(ReadyTicket& ticket) {
+    while (!ticket.done.load()) {
+        if (_task.load() == nullptr) {
+            const uint32_t ms = service();
+            if (ticket.done.load())
+                break;
+            TickType_t ticks = pdMS_TO_TICKS(ms < READY_WHEEL_TICK_MS ? ms : READY_WHEEL_TICK_MS);
+            vTaskDelay(ticks ? ticks : 1);
+        } else {
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(5 * READY_WHEEL_TICK_MS));   // timeout only guards a lost notification
+        }
+    }
+    return ticket.ready;
+}
+
+// ----------------------------
+
+/**
+ * @brief hand over the scheduler task, called by the start path right after xTaskCreate
+ *
+ * Until then book() wakes nobody and await() drives the wheel itself, so the task may already
+ * run service() before its handle is known.
+ *
+ * @param task handle of readyPollTask
+ */
+void ReadyScheduler::attach(TaskHandle_t task) {
+    _task.store(task);
+}
+
+// ----------------------------
+
+/**
+ * @brief scheduler loop, runs forever in readyPollTask
+ *
+ */
+void ReadyScheduler::run() {
+    while (true) {
+        const uint32_t ms = service();
+        if (ms == UINT32_MAX) {
+            for (int i = 0; i < numberOfTwins; ++i)                             // idle: load / persist learned durations
+                if (Twin[i])
+                    Twin[i]->syncMoveModel();
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(READY_MODEL_SYNC_MS));       // empty wheel, wait for book()
+        } else {
+            const TickType_t ticks = pdMS_TO_TICKS(ms);
+            ulTaskNotifyTake(pdTRUE, ticks ? ticks : 1);                        // sleep until next slot
+        }
+    }
+}
+
+// ----------------------------
+
+/**
+ * @brief advance the wheel to now and probe all due entries in the order of their plan
+ *
+ * @return uint32_t ms until the next slot, UINT32_MAX if the wheel is empty
+ */
+uint32_t ReadyScheduler::service() {
+    if (xSemaphoreTake(_serviceLock, 0) != pdTRUE)
+        return READY_WHEEL_TICK_MS;                                             // somebody else drives the wheel
+
+    int16_t due[READY_WHEEL_ENTRIES];
+    int     dueCount = 0;
+
+    xSemaphoreTake(_lock, portMAX_DELAY);
+    const uint32_t now = millis();
+    while (_pending > 0 && (int32_t)(now - (_wheelMs + READY_WHEEL_TICK_MS)) >= 0) {
+        _wheelMs += READY_WHEEL_TICK_MS;                                        // next slot
+        _cursor       = (_cursor + 1) % READY_WHEEL_SLOTS;
+        int16_t* link = &_slots[_cursor];
+        while (*link >= 0) {
+            Entry& en = _entries[*link];
+            if (en.rounds > 0) {                                                // due in a later revolution
+                en.rounds--;
+                link = &en.next;
+                continue;
+            }
+            due[dueCount++] = *link;                                            // unlink, entry stays pending
+            *link           = en.next;
+        }
+    }
+    xSemaphoreGive(_lock);
+
+    for (int i = 1; i < dueCount; ++i) {                                        // planned order, few entries -> insertion sort
+        const int16_t e = due[i];
+        int           j = i - 1;
+        while (j >= 0 && (int32_t)(_entries[due[j]].dueMs - _entries[e].dueMs) > 0) {
+            due[j + 1] = due[j];
+            j--;
+        }
+        due[j + 1] = e;
+    }
+
+    for (int i = 0; i < dueCount; ++i) {                                        // one probe after the other, never two on the bus
+        const int16_t e    = due[i];
+        Entry&        en   = _entries[e];
+        const int32_t late = (int32_t)(millis() - en.dueMs);
+        if (late > 0 && (uint32_t)late > _maxLateMs)
+            _maxLateMs = (uint32_t)late;
+
+        const bool ready = en.twin->isSlaveReady();                             // AYR probe
+        _probes++;
+        en.ticket->polls++;
+
+        xSemaphoreTake(_lock, portMAX_DELAY);
+        const uint32_t t = millis();
+        if (ready) {
+            en.ticket->readyMs = t - en.ticket->startMs;
+            finish(e, true);
+        } else if ((int32_t)(t - en.timeoutMs) >= 0) {
+            finish(e, false);                                                   // BUSY at the deadline
+        } else {
+            en.ticket->lastBusyMs   = t - en.ticket->startMs;
+            const uint32_t interval = ((int32_t)(t - en.windowEndMs) < 0) ? READY_POLL_MS : READY_FOLLOW_UP_MS;
+            en.dueMs                = t + interval;
+            if ((int32_t)(en.dueMs - en.timeoutMs) > 0)
+                en.dueMs = en.timeoutMs;                                        // last probe exactly at the deadline
+            insert(e);
+        }
+        xSemaphoreGive(_lock);
+    }
+
+    xSemaphoreTake(_lock, portMAX_DELAY);
+    uint32_t next = UINT32_MAX;
+    if (_pending > 0) {
+        const int32_t ms = (int32_t)(_wheelMs + READY_WHEEL_TICK_MS - millis());
+        next             = (ms > 0) ? (uint32_t)ms : 0;
+    }
+    xSemaphoreGive(_lock);
+    xSemaphoreGive(_serviceLock);
+    return next;
+}
+
+// ----------------------------
+
+/**
+ * @brief put entry into the first slot at or after its due time, _lock must be held
+ *
+ * @param e entry index
+ */
+void ReadyScheduler::insert(int16_t e) {
+    Entry&        en    = _entries[e];
+    const int32_t delta = (int32_t)(en.dueMs - _wheelMs);
+    uint32_t      ticks = (delta <= 0) ? 1 : ((uint32_t)delta + READY_WHEEL_TICK_MS - 1) / READY_WHEEL_TICK_MS;
+    if (ticks == 0)
+        ticks = 1;
+    const uint16_t slot = (_cursor + ticks) % READY_WHEEL_SLOTS;
+    en.rounds           = (uint16_t)((ticks - 1) / READY_WHEEL_SLOTS);
+    en.next             = _slots[slot];
+    _slots[slot]        = e;
+}
+
+// ----------------------------
+
+/**
+ * @brief finish ticket, wake its waiter and free the entry, _lock must be held
+ *
+ * @param e entry index
+ * @param ready READY observed
+ */
+void ReadyScheduler::finish(int16_t e, bool ready) {
+    Entry&       en     = _entries[e];
+    ReadyTicket* ticket = en.ticket;
+    TaskHandle_t waiter = ticket->waiter;                                       // ticket may be gone once done is set
+    if (ready)
+        _ready++;
+    else
+        _timeouts++;
+    en.next = _free;
+    _free   = e;
+    _pending--;
+
+    ticket->ready = ready;
+    ticket->done.store(true);
+    if (_task.load() != nullptr && waiter != nullptr)
+        xTaskNotifyGive(waiter);
+}
@@ -62,8 +62,7 @@ void RemoteControl::getRemote() {
 #ifdef IRVERBOSE
         {
             TraceScope trace;
-            controlPrint("IR code received ");
-            Serial.println(_lastGetKeyCode);  // trace all raw data
+            controlPrintln("IR code received %llu", _lastGetKeyCode);  // trace all raw data
         }
 #endif
         _lastGetKeyCode = 0;
@@ -116,12 +115,7 @@ Key21 RemoteControl::ircodeToKey21(uint64_t ircode) {
 #ifdef IRVERBOSE
         {
             TraceScope trace;  // use semaphore to protect this block
-            controlPrint("RemoteControl::key recognized: ");
-            Serial.print((int)key);
-            Serial.print(" (0x");
-            Serial.print(ircode, HEX);
-            Serial.print(") - ");
-            Serial.println(Control->key21ToString(key));  // make it visable
+            controlPrintln("RemoteControl::key recognized: %d (0x%llX) - %s", (int)key, ircode, Control->key21ToString(key));  // make it visable
         }
 #endif
         _lastTime = now;
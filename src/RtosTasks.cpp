@@ -16,7 +16,7 @@
 #include <freertos/task.h>
 #include <FlapGlobal.h>
 #include <cstdio>
-#include <WebServer.h>
+#include <ESPAsyncWebServer.h>
 #include <SPIFFS.h>
 #include <WiFi.h>
 #include "SlaveTwin.h"
@@ -29,6 +29,15 @@
 #include "Parser.h"
 #include "RemoteControl.h"
 #include "RtosTasks.h"
+#include "ReadyScheduler.h"
+#include "TracePrint.h"
+#include "StatusModel.h"
+#include "LivePush.h"
+#include "LeagueScheduler.h"
+#include "PollScheduler.h"
+#ifdef LIGARECORD
+#include "LigaRecorder.h"
+#endif
 // ----------------------------
 //     __      __   _    ___
 //     \ \    / /__| |__/ __| ___ _ ___ _____ _ _
@@ -37,7 +46,36 @@
 //
 // Banner created:
 // https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=Small&t=WebServer
-/*
+/**
+ * @brief measures the handler time of one web request for the task status
+ *
+ */
+struct WebRequestTimer {
+    uint32_t start = micros();
+    ~WebRequestTimer() { g_webLatency.add(micros() - start); }
+};
+
+/**
+ * @brief send status JSON from RAM (304 if unchanged), 500 if there is no status yet
+ *
+ * @param request web request
+ * @param status in-memory status document
+ */
+static void sendStatus(AsyncWebServerRequest* request, StatusDocument& status) {
+    if (status.send(request, false))
+        return;
+    AsyncWebServerResponse* response = request->beginResponse(500, "application/json", "{\"error\":\"Datei nicht gefunden\"}");
+    response->addHeader("Access-Control-Allow-Origin", "*");
+    request->send(response);
+}
+
+/**
+ * @brief freeRTOS Task Flap Server: WiFi, time and web server endpoints
+ *
+ * The endpoints are served event driven by the AsyncTCP task of ESPAsyncWebServer,
+ * several connections at the same time. This task only keeps the time in sync.
+ *
+ * @param pvParameters
  */
 void flapServerTask(void* pvParameters) {
     if (!Store->available())                                                    // check if file system is available
@@ -51,49 +89,54 @@ void flapServerTask(void* pvParameters) {
     Serial.println("[FLAP - SERVER  ] Web Client opened");
 
     // ---- Root endpoint ----
-    server.on("/", []() {
-        server.send(200,                                                        // HTTP Status 200 OK
-                    "text/html; charset=UTF-8",                                 // MIME-Typ
-                    "<html><body><h1>Hallo Achim!</h1><p>Deine ESP32-Webseite läuft.</p></body></html>");
+    server.on("/", HTTP_GET, [](AsyncWebServerRequest* request) {
+        WebRequestTimer timer;
+        request->send(200,                                                      // HTTP Status 200 OK
+                      "text/html; charset=UTF-8",                               // MIME-Typ
+                      "<html><body><h1>Hallo Achim!</h1><p>Deine ESP32-Webseite läuft.</p></body></html>");
     });
 
     // ---- Status endpoint ----
-    server.on("/status", []() {
+    server.on("/status", HTTP_GET, [](AsyncWebServerRequest* request) {
+        WebRequestTimer timer;
         Serial.println("[FLAP - SERVER  ] Flap Display Task Status requested");
-        sendStatusHtmlStream("/TaskStatus.json");
+        if (!TaskStatusDoc.send(request, true))
+            request->send(500, "text/plain", "status not available");
     });
 
     // ---- Raw JSON endpoint for Task Status ----
-    server.on("/1", []() {
-        File file = SPIFFS.open("/TaskStatus.json", FILE_READ);
-        if (!file) {
-            server.sendHeader("Access-Control-Allow-Origin", "*");
-            server.send(500, "application/json", "{\"error\":\"Datei nicht gefunden\"}");
-            return;
-        }
-        String jsonString = file.readString();
-        file.close();
-
-        server.sendHeader("Access-Control-Allow-Origin", "*");
-        server.send(200, "application/json; charset=UTF-8", jsonString);
+    server.on("/1", HTTP_GET, [](AsyncWebServerRequest* request) {
+        WebRequestTimer timer;
+        sendStatus(request, TaskStatusDoc);
     });
 
     // ---- Raw JSON endpoint for Poll Status ----
-    server.on("/2", []() {
-        File file = SPIFFS.open("/PollStatus.json", FILE_READ);
-        if (!file) {
-            server.sendHeader("Access-Control-Allow-Origin", "*");
-            server.send(500, "application/json", "{\"error\":\"Datei nicht gefunden\"}");
-            return;
-        }
-        String jsonString = file.readString();
-        file.close();
-
-        server.sendHeader("Access-Control-Allow-Origin", "*");
-        server.send(200, "application/json; charset=UTF-8", jsonString);
+    server.on("/2", HTTP_GET, [](AsyncWebServerRequest* request) {
+        WebRequestTimer timer;
+        sendStatus(request, PollStatusDoc);
     });
 
-    server.begin();
+    #ifdef LIGARECORD
+        // ---- recorded openLigaDB responses, input of native replay ----
+        server.on("/record", HTTP_GET, [](AsyncWebServerRequest* request) {
+            if (!SPIFFS.exists(LIGA_RECORD_FILE)) {
+                request->send(404, "text/plain", "no recording");
+                return;
+            }
+            request->send(SPIFFS, LIGA_RECORD_FILE, "application/octet-stream"); // streamed by AsyncTCP, recording is larger than heap
+        });
+
+        server.on("/record/clear", HTTP_GET, [](AsyncWebServerRequest* request) {
+            ligaRecorder.clear();
+            request->send(200, "text/plain", "recording cleared");
+        });
+    #endif
+
+    // ---- push channel: goals, table changes and module moves as Server-Sent Events ----
+    if (Push)
+        Push->attach(server);
+
+    server.begin();                                                             // requests are served by the AsyncTCP task from now on
     Serial.print("[FLAP - SERVER  ] Flap Liga Display WebServer address: ");
     Serial.println(WiFi.localIP());
 
@@ -101,7 +144,6 @@ void flapServerTask(void* pvParameters) {
     TickType_t       lastSync = xTaskGetTickCount();
 
     while (true) {
-        server.handleClient();                                                  // poll web client for requests
         if (xTaskGetTickCount() - lastSync > oneDay) {
             struct tm timeinfo;
             if (getLocalTime(&timeinfo)) {
@@ -110,7 +152,7 @@ void flapServerTask(void* pvParameters) {
             lastSync = xTaskGetTickCount();
         }
 
-        vTaskDelay(pdMS_TO_TICKS(1000));                                        // relaxed sleep/poll mode
+        vTaskDelay(pdMS_TO_TICKS(WEB_TIME_SYNC_CHECK_MS));                      // nothing to poll, only time-sync check
     }
 }
 
@@ -136,22 +178,20 @@ void flapServerTask(void* pvParameters) {
  *
  * Design:
  *  - Uses a one-shot FreeRTOS timer (`ligaScanTimer`) to keep a precise schedule.
- *  - Period between polls is dynamically adjusted via LigaTable::decidePollMs().
+ *  - PollScheduler (ligaPolls) runs each PollScope at its deadline from the kickoff schedule.
  *  - All network interactions are routed through LigaTable helpers.
+ *  - Tracked leagues share the task, LeagueScheduler (ligaLeagues) picks the league due next.
  *
  * @param pvParameters Unused (FreeRTOS task prototype requirement).
  */
 
 void ligaTask(void* pvParameters) {
-    activeLeague   = League::BL1;
-    ligaSeason     = 0;
-    ligaMatchday   = 0;
-    isSomeThingNew = false;
+    activeLeague = League::BL1;
 
     {
-        LigaSnapshotLock _lock;                                                 // protect snapshot reset against Report/Web readers
-        snap[snapshotIndex].clear();
-        snap[snapshotIndex ^ 1].clear();
+        LigaSnapshotLock _lock;                                                 // serialize snapshot reset against readers
+        for (uint8_t i = 0; i < LEAGUE_COUNT; ++i)
+            ligaSnapshotStores[i].clear();
     }
 
     if (!initLigaTask()) {
@@ -174,32 +214,49 @@ void ligaTask(void* pvParameters) {
         }
     #endif
 
-    currentPollMode = POLL_MODE_ONCE;                                           // we start with ONCE cycle
+    ligaLeagues.begin();                                                        // every league starts with its bootstrap scopes
 
     while (true) {
-        selectPollCycle(currentPollMode);                                       // setzt activeCycle + activeCycleLength
+        uint32_t waitMs = 0;
+        League   league = ligaLeagues.next(waitMs);
+        if (waitMs > 0) {
+            ligaLeagues.load(activeLeague);                                     // between cycles the shown league is loaded
+            uint32_t notified = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs));
+            if (notified > 0) {
+                Liga->ligaPrintln("LigaTask woken up by notification");
+            }
+            continue;
+        }
+
+        ligaLeagues.beginCycle(league);
+        ligaPolls.beginCycle();
 
-        for (size_t i = 0; i < activeCycleLength; ++i) {
-            currentPollScope = activeCycle[i];
+        PollScope ran[POLL_SCOPE_COUNT];                                        // every scope once per cycle at most
+        size_t    ranCount = 0;
+        time_t    started;
+        while (ligaPolls.pop(started = time(nullptr), currentPollScope)) {      // due scopes, earliest deadline first
             processPollScope(currentPollScope);
+            ligaPolls.done(currentPollScope, started);                          // cadence from the start, events -> new deadlines
+            ran[ranCount++] = currentPollScope;
         }
+        Liga->ligaPrintln("%s = %s", pollModeToString(currentPollMode), pollCycleToString(ran, ranCount).c_str());
 
-        nextPollMode = determineNextPollMode();
+        nextPollMode = ligaPolls.mode(time(nullptr));
 
         if (currentPollMode != nextPollMode) {
-            Liga->ligaPrintln("PollMode changed from %s to %s", pollModeToString(currentPollMode), pollModeToString(nextPollMode));
+            Liga->ligaPrintln("%s: PollMode changed from %s to %s", leagueShortcut(ligaLeague), pollModeToString(currentPollMode),
+                              pollModeToString(nextPollMode));
         }
 
         currentPollMode = nextPollMode;
         isSomeThingNew  = false;
 
-        pollManagerDynamicWait    = getPollDelay(currentPollMode);
+        pollManagerDynamicWait    = ligaPolls.waitMs(time(nullptr));            // until the earliest deadline
         pollManagerStartOfWaiting = millis();
-
-        uint32_t notified = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(pollManagerDynamicWait));
-        if (notified > 0) {
-            Liga->ligaPrintln("LigaTask woken up by notification");
-        }
+        Liga->ligaPrintln("PollManager is in mode %s, next %s in %lu minutes %02lu seconds", pollModeToString(currentPollMode),
+                          pollScopeToString(ligaPolls.nextScope()), (unsigned long)(pollManagerDynamicWait / 60000),
+                          (unsigned long)(pollManagerDynamicWait / 1000 % 60));
+        ligaLeagues.endCycle(pollManagerDynamicWait);
     }
 }
 
@@ -289,6 +346,7 @@ void twinRegister(void* pvParameters) {
 
     // worker task that runs the (blocking) availability check off the timer daemon; must exist before availCheckTimer fires
     xTaskCreate(availCheckTask, "AvailCheck", STACK_REGISTRY, NULL, PRIO_REGISTRY, &g_availCheckHandle);
+    xTaskCreate(frameTask, "Frame", STACK_FRAME, NULL, PRIO_FRAME, &g_frameHandle); // display frames of the Parser
 
     Register->registerDevice();                                                 // initial full scan for known devices
     vTaskDelay(pdMS_TO_TICKS(200));                                             // short grace period
@@ -376,6 +434,40 @@ void slaveTwinTask(void* pvParameters) {
     }
 }
 
+// ----------------------------
+/**
+ * @brief freeRTOS Task of the shared ARE_YOU_READY scheduler
+ *
+ * @param pvParameters
+ */
+void readyPollTask(void* pvParameters) {
+    ReadyPoll->run();                                                           // never returns
+}
+
+// ----------------------------
+/**
+ * @brief freeRTOS Task LivePush: sends the coalesced live events to the /events subscribers
+ *
+ * @param pvParameters
+ */
+void livePushTask(void* pvParameters) {
+    Push->run();                                                                // never returns
+}
+
+// ----------------------------
+/**
+ * @brief freeRTOS Task TraceLog: formats the queued trace lines and writes them to Serial
+ *
+ * @param pvParameters
+ */
+void traceLogTask(void* pvParameters) {
+    traceStart();                                                               // tracePrint* uses the ring from now on
+    while (true) {
+        if (traceDrain() == 0)
+            vTaskDelay(pdMS_TO_TICKS(TRACE_DRAIN_IDLE_MS));                     // nothing to write
+    }
+}
+
 // ----------------------------
 //      ___ _        _   _    _   _
 //     / __| |_ __ _| |_(_)__| |_(_)__
@@ -395,17 +487,7 @@ void statisticTask(void* param) {
     DataEvaluation          = new FlapStatistics();                             // create Object for statistic task
     while (true) {
         vTaskDelayUntil(&lastWakeTime, pdMS_TO_TICKS(60000));                   // every 1 Minute
-        {
-            TraceScope trace;                                                   // use semaphore to protect this block
-            if (DataEvaluation != nullptr) {
-                DataEvaluation->increment();                                    // increment statistic counter
-                #ifdef STATISTICVERBOSE
-                    masterPrintln("I²C statistic cycle - access: ", DataEvaluation->_busAccessCounter, " data write: ", DataEvaluation->_busDataCounter,
-                    " data read: ", DataEvaluation->_busReadCounter);
-                #endif
-            }
-        }
-        DataEvaluation->makeHistory();                                          // transfer counter to next history cycle
+        DataEvaluation->makeHistory();                                          // sum up per-core counters, next history cycle
     }
 }
 
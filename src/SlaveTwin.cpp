@@ -37,6 +37,7 @@
 #include "i2cMaster.h"
 #include "SlaveTwin.h"
 #include "FlapTasks.h"
+#include "LivePush.h"
 
 // ----------------------------
 /**
@@ -45,6 +46,13 @@
  */
 SlaveTwin* Twin[numberOfTwins];
 
+/**
+ * @brief show-flap and manual moves: superseded or repeated by the user, they may be dropped
+ */
+static bool isMoveCommand(TwinCommands cmd) {
+    return cmd == TWIN_SHOW_FLAP || cmd == TWIN_NEXT_FLAP || cmd == TWIN_PREV_FLAP || cmd == TWIN_NEXT_STEP || cmd == TWIN_PREV_STEP;
+}
+
 // ---------------------------------
 
 /**
@@ -68,37 +76,40 @@ SlaveTwin::SlaveTwin(int add) {
     _slaveReady.ready        = false;
     _slaveReady.sensorStatus = false;
     _slaveReady.taskCode     = NO_COMMAND;
-    _twinQueue               = nullptr;
 
     #ifdef TWINVERBOSE
-        {
-        TraceScope trace;                                                       // use semaphore to protect this block
         twinPrintln("Twin Object created 0x%02x", _slaveAddress);
-        }
     #endif
 }
 
 // ----------------------------
 
 /**
- * @brief read from entry queue
+ * @brief wait for next command in entry queue and run it
  *
  */
 void SlaveTwin::readQueue() {
-    TwinCommand twinCmd;
-    if (_twinQueue != nullptr) {                                                // if queue exists
-        if (xQueueReceive(_twinQueue, &twinCmd, portMAX_DELAY)) {
-            #ifdef TWINVERBOSE
-                {
-                TraceScope trace;                                               // use semaphore to protect this block
-                twinPrintln("Twin-Command received: %s", Parser->twinCommandToString(twinCmd.twinCommand));
-                }
-            #endif
-            if (twinCmd.twinCommand != TWIN_NO_COMMAND) {
-                twinControl(twinCmd);                                           // send corresponding Flap-Command to device
-            }
-        }
-    }
+    if (_cmdReady == nullptr)                                                   // queue not created
+        return;
+    if (xSemaphoreTake(_cmdReady, portMAX_DELAY) != pdTRUE)
+        return;
+
+    xSemaphoreTake(_runLock, portMAX_DELAY);                                    // pop after a running display frame, it may supersede the command
+    xSemaphoreTake(_cmdLock, portMAX_DELAY);
+    TwinCommand twinCmd = _cmdRing[_cmdHead];                                   // oldest command
+    _cmdHead            = (_cmdHead + 1) % TWIN_QUEUE_DEPTH;
+    _cmdCount--;
+    if (isMoveCommand(twinCmd.twinCommand))
+        _cmdMoves--;
+    xSemaphoreGive(_cmdLock);
+    xSemaphoreGive(_cmdSpace);                                                  // slot is free again
+
+    #ifdef TWINVERBOSE
+        twinPrintln("Twin-Command received: %s", Parser->twinCommandToString(twinCmd.twinCommand));
+    #endif
+    if (twinCmd.twinCommand != TWIN_NO_COMMAND)
+        twinControl(twinCmd);                                                   // send corresponding Flap-Command to device
+    xSemaphoreGive(_runLock);
 }
 
 // ----------------------------
@@ -108,13 +119,16 @@ void SlaveTwin::readQueue() {
  *
  */
 void SlaveTwin::createQueue() {
-    _twinQueue = xQueueCreate(1, sizeof(TwinCommand));                          // Create twin Queue
-    if (_twinQueue == nullptr) {
-        #ifdef TWINVERBOSE
-            {
-            TraceScope trace;                                                   // use semaphore to protect this block
-            twinPrintln("crearing of Twin--Entry-Queue failed");
-            }
+    if (_cmdLock != nullptr)                                                    // already created
+        return;
+    _cmdLock  = xSemaphoreCreateMutex();
+    _cmdReady = xSemaphoreCreateCounting(TWIN_QUEUE_DEPTH, 0);                  // no command waiting
+    _cmdSpace = xSemaphoreCreateCounting(TWIN_QUEUE_DEPTH, TWIN_QUEUE_DEPTH);   // all slots free
+    _runLock  = xSemaphoreCreateMutex();
+    if (_cmdLock == nullptr || _cmdReady == nullptr || _cmdSpace == nullptr || _runLock == nullptr) {
+        _cmdLock = nullptr;                                                     // sendQueue() reports missing queue
+        #ifdef ERRORVERBOSE
+            twinPrintln("creating of Twin-Entry-Queue failed");
         #endif
     }
 }
@@ -124,27 +138,115 @@ void SlaveTwin::createQueue() {
 /**
  * @brief send into entry queue
  *
+ * TWIN_SHOW_FLAP is merged into a queued TWIN_SHOW_FLAP where possible and waits up to
+ * TWIN_QUEUE_SEND_TIMEOUT_MS for a slot, manual moves are dropped on a full queue. Both never
+ * take the TWIN_QUEUE_RESERVED slots, so all other commands (calibration, availability ...)
+ * find a slot or wait without timeout until the twin task frees one, they are never dropped.
+ *
  * @param twinCmd
- * @return true success
+ * @return true success (queued or merged)
  * @return false no entry to queue
  */
 bool SlaveTwin::sendQueue(TwinCommand twinCmd) {
-    if (_twinQueue != nullptr) {
-        if (xQueueOverwrite(_twinQueue, &twinCmd) == pdPASS) {
-            return true;                                                        // success
-        } else {
-            #ifdef ERRORVERBOSE
-                twinPrintln("xQueueOverwrite failed");
-            #endif
-            return false;                                                       // error while writing to queue
-        }
-    } else {
-        TraceScope trace;
+    if (_cmdLock == nullptr) {
         #ifdef ERRORVERBOSE
             twinPrintln("no slaveTwin available");
         #endif
         return false;                                                           // Queue does not exist
     }
+
+    xSemaphoreTake(_cmdLock, portMAX_DELAY);
+    bool merged = coalesceCommand(twinCmd);
+    xSemaphoreGive(_cmdLock);
+    if (merged)
+        return true;
+
+    const TwinCommands cmd  = twinCmd.twinCommand;
+    const bool         move = isMoveCommand(cmd);
+    const TickType_t   wait = !move ? portMAX_DELAY : (cmd == TWIN_SHOW_FLAP) ? pdMS_TO_TICKS(TWIN_QUEUE_SEND_TIMEOUT_MS) : 0;
+
+    bool dropped = (xSemaphoreTake(_cmdSpace, wait) != pdTRUE);                 // queue full (moves only)
+    bool slot    = !dropped;
+
+    xSemaphoreTake(_cmdLock, portMAX_DELAY);
+    if (slot) {
+        merged = coalesceCommand(twinCmd);                                      // tail may have changed while waiting
+        if (!merged && move && _cmdMoves >= TWIN_QUEUE_DEPTH - TWIN_QUEUE_RESERVED)
+            dropped = true;                                                     // only reserved slots left
+        else if (!merged)
+            appendCommand(twinCmd);
+    }
+    if (dropped)
+        _cmdDropped++;
+    xSemaphoreGive(_cmdLock);
+
+    if (slot && (merged || dropped))
+        xSemaphoreGive(_cmdSpace);                                              // slot not needed
+    else if (slot)
+        xSemaphoreGive(_cmdReady);                                              // wake twin task
+
+    if (dropped) {
+        #ifdef ERRORVERBOSE
+            twinPrintln("Twin-Queue full, %s dropped", Parser->twinCommandToString(cmd));
+        #endif
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief merge TWIN_SHOW_FLAP into the ring, _cmdLock must be held
+ *
+ * The last queued command is replaced if it is a TWIN_SHOW_FLAP too. If no slot is left for
+ * a move (full ring or only reserved slots free) the oldest TWIN_SHOW_FLAP is removed and the new one appended, so the order against other
+ * commands stays and the final flap is always the last requested one.
+ *
+ * @param twinCmd command to be queued
+ * @return true command is in ring, no new slot used
+ */
+bool SlaveTwin::coalesceCommand(const TwinCommand& twinCmd) {
+    if (twinCmd.twinCommand != TWIN_SHOW_FLAP || _cmdCount == 0)
+        return false;
+
+    const uint8_t tail = (_cmdHead + _cmdCount - 1) % TWIN_QUEUE_DEPTH;
+    if (_cmdRing[tail].twinCommand == TWIN_SHOW_FLAP) {
+        _cmdRing[tail] = twinCmd;                                               // collapse to last target
+        _cmdCoalesced++;
+        #ifdef TWINVERBOSE
+            twinPrintln("Twin-Queue: show flap merged, new target %d", twinCmd.twinParameter);
+        #endif
+        return true;
+    }
+
+    if (_cmdCount < TWIN_QUEUE_DEPTH && _cmdMoves < TWIN_QUEUE_DEPTH - TWIN_QUEUE_RESERVED)
+        return false;                                                           // free slot for a move, keep all commands
+
+    for (uint8_t i = 0; i < _cmdCount; ++i) {
+        const uint8_t idx = (_cmdHead + i) % TWIN_QUEUE_DEPTH;
+        if (_cmdRing[idx].twinCommand != TWIN_SHOW_FLAP)
+            continue;
+        for (uint8_t j = i; j + 1 < _cmdCount; ++j)                             // close gap of superseded target
+            _cmdRing[(_cmdHead + j) % TWIN_QUEUE_DEPTH] = _cmdRing[(_cmdHead + j + 1) % TWIN_QUEUE_DEPTH];
+        _cmdRing[tail] = twinCmd;
+        _cmdCoalesced++;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief put command at the end of the ring, _cmdLock must be held and a slot taken
+ *
+ * @param twinCmd command to be queued
+ */
+void SlaveTwin::appendCommand(const TwinCommand& twinCmd) {
+    _cmdRing[(_cmdHead + _cmdCount) % TWIN_QUEUE_DEPTH] = twinCmd;
+    _cmdCount++;
+    _cmdQueued++;
+    if (isMoveCommand(twinCmd.twinCommand))
+        _cmdMoves++;
+    if (_cmdCount > _cmdMaxDepth)
+        _cmdMaxDepth = _cmdCount;
 }
 
 // --------------------------------------
@@ -206,11 +308,7 @@ void SlaveTwin::twinControl(TwinCommand twinCmd) {
 
         default: {
             #ifdef ERRORVERBOSE
-                {
-                TraceScope trace;
-                twinPrint("Unknown Twin-Command: ");
-                Serial.println(static_cast<int>(cmd));
-                }
+                twinPrintln("Unknown Twin-Command: %d", static_cast<int>(cmd));
             #endif
             break;
         }
@@ -226,10 +324,7 @@ void SlaveTwin::twinControl(TwinCommand twinCmd) {
  */
 void SlaveTwin::logAndRun(const char* message, std::function<void()> action) {
     #ifdef TWINVERBOSE
-        {
-        TraceScope trace;
         twinPrintln(message);
-        }
     #endif
     action();
 }
@@ -247,23 +342,14 @@ void SlaveTwin::showFlap(int digit) {
     _targetFlapNumber = digit;                                                  // remember requested target flap
     if (_targetFlapNumber < 0 || _targetFlapNumber >= _parameter.flaps) {       // validate range (flaps are 0..flaps-1)
     #ifdef ERRORVERBOSE
-        {
-        TraceScope trace;
-        twinPrint("Flap unknown ...");
-        Serial.println(digit);
-        }
+        twinPrintln("Flap unknown ... %d", digit);
     #endif
         return;                                                                 // ignore invalid request
     }
 
     #ifdef TWINVERBOSE
-        {
-        TraceScope trace;
-        twinPrint("showFlap: digit ");
-        Serial.println(digit);
-        twinPrint("showFlap: targetFlapNumber ");
-        Serial.println(_targetFlapNumber);
-        }
+        twinPrintln("showFlap: digit %d", digit);
+        twinPrintln("showFlap: targetFlapNumber %d", _targetFlapNumber);
     #endif
 
     const int steps_i = countStepsToMove(_flapNumber, _targetFlapNumber);       // signed delta (can be <= 0)
@@ -281,24 +367,118 @@ void SlaveTwin::showFlap(int digit) {
     if (!waitUntilYouAreReady(MOVE, steps, timeout_ms)) {                       // quiet-until-AYR, then fast-poll ARE_YOU_READY
         {
             #ifdef ERRORVERBOSE
-                {
-                TraceScope trace;
                 twinPrintln("showFlap failed or timed out on slave 0x%02X", _slaveAddress);
-                }
             #endif
         }
         return;                                                                 // no registry sync on failure
     }
 
     #ifdef TWINVERBOSE
-        {
-        TraceScope trace;
         twinPrintln("request result of showFlap");
-        }
     #endif
     getFullStateOfSlave();                                                      // get result of move
                             //    synchSlaveRegistry();                                                       // update registry with confirmed state
     Register->updateRegistry(_slaveAddress, _parameter);                        // register slave
+    if (Push)
+        Push->moduleMoved(_slaveAddress, _flapNumber);                          // coalesced with the other moves of this burst
+}
+
+// --------------------------------------------
+// --------- DISPLAY FRAME --------------------
+// --------------------------------------------
+
+/**
+ * @brief reserve twin for a display frame, the twin task does not run a command meanwhile
+ *
+ * @param wait ticks to wait for a running command to finish
+ * @return true twin reserved, release with unlockCommands()
+ */
+bool SlaveTwin::tryLockCommands(TickType_t wait) {
+    return _runLock != nullptr && xSemaphoreTake(_runLock, wait) == pdTRUE;
+}
+
+void SlaveTwin::unlockCommands() {
+    xSemaphoreGive(_runLock);
+}
+
+/**
+ * @brief queued TWIN_SHOW_FLAP commands are superseded by a display frame
+ *
+ * they stay in the ring as TWIN_NO_COMMAND, so queue and semaphores stay consistent
+ */
+void SlaveTwin::dropQueuedShowFlap() {
+    if (_cmdLock == nullptr)
+        return;
+    xSemaphoreTake(_cmdLock, portMAX_DELAY);
+    for (uint8_t i = 0; i < _cmdCount; ++i) {
+        TwinCommand& queued = _cmdRing[(_cmdHead + i) % TWIN_QUEUE_DEPTH];
+        if (queued.twinCommand == TWIN_SHOW_FLAP) {
+            queued.twinCommand = TWIN_NO_COMMAND;
+            _cmdCoalesced++;
+            _cmdMoves--;                                                        // empty entry, no longer a move
+        }
+    }
+    xSemaphoreGive(_cmdLock);
+}
+
+/**
+ * @brief steps to move for a display frame
+ *
+ * @param flapnumber flap to be shown
+ * @return uint16_t steps of MOVE, 0 if flap is unknown or already shown
+ */
+uint16_t SlaveTwin::planFrameMove(int flapnumber) {
+    if (flapnumber < 0 || flapnumber >= _parameter.flaps) {                     // validate range (flaps are 0..flaps-1)
+        #ifdef ERRORVERBOSE
+            twinPrintln("Flap unknown ... %d", flapnumber);
+        #endif
+        return 0;
+    }
+    _targetFlapNumber = flapnumber;
+    const int steps_i = countStepsToMove(_flapNumber, _targetFlapNumber);
+    if (steps_i <= 0)
+        return 0;                                                               // nothing to do
+    return (steps_i > 0xFFFF) ? 0xFFFF : static_cast<uint16_t>(steps_i);
+}
+
+/**
+ * @brief send MOVE of a display frame, caller holds the I2C semaphore
+ *
+ * @param steps steps from planFrameMove()
+ * @param firstPollMs time after sending when the first ARE_YOU_READY is due
+ * @param timeoutMs time after sending when the move counts as failed
+ * @return true slave acknowledged the MOVE
+ */
+bool SlaveTwin::sendFrameMove(uint16_t steps, uint32_t& firstPollMs, uint32_t& timeoutMs) {
+    if (i2cLongTransfer(i2cCommandParameter(MOVE, steps)) != ESP_OK)
+        return false;
+    _flapNumber = _targetFlapNumber;                                            // optimistic local update like showFlap()
+
+    const uint32_t eta_ms = computeEtaWithGuards(MOVE, steps);                  // same plan as waitUntilYouAreReady()
+    _frameEtaMs           = eta_ms;
+    firstPollMs           = planFirstPollAt(eta_ms, MOVE);
+    timeoutMs             = withSafety(estimateAYRdurationMs(MOVE, steps), MOVE);
+    stretchTimeoutForFirstWindow(firstPollMs, timeoutMs);
+    return true;
+}
+
+/**
+ * @brief end of a display frame move
+ *
+ * @param ticket ready wait of the move, nullptr if the MOVE was not sent or not booked
+ */
+void SlaveTwin::finishFrameMove(const ReadyTicket* ticket) {
+    if (ticket == nullptr || !ticket->ready) {
+        #ifdef ERRORVERBOSE
+            twinPrintln("showFrame failed or timed out on slave 0x%02X", _slaveAddress);
+        #endif
+        return;                                                                 // no registry sync on failure
+    }
+    _moveModel.learn(MOVE, _frameEtaMs, ticket->lastBusyMs, ticket->readyMs);
+    getFullStateOfSlave();                                                      // get result of move
+    Register->updateRegistry(_slaveAddress, _parameter);
+    if (Push)
+        Push->moduleMoved(_slaveAddress, _flapNumber);                          // whole frame goes out as one "modules" event
 }
 
 // --------------------------------------------
@@ -321,30 +501,16 @@ void SlaveTwin::calibration() {
 
     #ifdef AYRVERBOSE
         {
-        TraceScope     trace;
         const uint32_t rev_ms = (_parameter.speed ? _parameter.speed : 1);
         const uint32_t sps    = (_parameter.steps * 1000u) / rev_ms;
-        twinPrint("CALIBRATE spr=");
-        Serial.print(steps_to_use);
-        twinPrint(" off_norm=");
-        Serial.print(off_norm);
-        twinPrint(" steps_to_est=");
-        Serial.print(steps_to_est);
-        twinPrint(" sps≈");
-        Serial.print(sps);
-        twinPrint(" eta_ms=");
-        Serial.print(eta_ms);
-        twinPrint(" timeout_ms=");
-        Serial.println(timeout_ms);
+        twinPrintln("CALIBRATE spr=%d off_norm=%d steps_to_est=%d sps≈%u eta_ms=%u timeout_ms=%u", steps_to_use, off_norm, steps_to_est, sps,
+                    eta_ms, timeout_ms);
         }
     #endif
 
     if (!waitUntilYouAreReady(CALIBRATE, steps_to_est, timeout_ms)) {
         #ifdef ERRORVERBOSE
-            {
-            TraceScope trace;
             twinPrintln("Calibration failed or timed out on slave 0x%02X", _slaveAddress);
-            }
         #endif
         return;
     }
@@ -377,10 +543,7 @@ void SlaveTwin::stepMeasurement() {
         {
             {
                 #ifdef ERRORVERBOSE
-                    {
-                    TraceScope trace;
                     twinPrintln("Step measurement failed or timed out on slave 0x%02X", _slaveAddress);
-                    }
                 #endif
                 return;
             }
@@ -414,10 +577,7 @@ void SlaveTwin::speedMeasurement() {
 
     if (!waitUntilYouAreReady(SPEED_MEASURE, steps_to_use, timeout_ms)) {
         #ifdef ERRORVERBOSE
-            {
-            TraceScope trace;
             twinPrintln("Speed measurement failed or timed out on slave 0x%02X", _slaveAddress);
-            }
         #endif
         return;
     }
@@ -447,10 +607,7 @@ void SlaveTwin::sensorCheck() {
     if (!waitUntilYouAreReady(SENSOR_CHECK, stepsToCheck, timeout_ms)) {
         {
             #ifdef ERRORVERBOSE
-                {
-                TraceScope trace;
                 twinPrintln("Sensor check failed or timed out on slave 0x%02X", _slaveAddress);
-                }
             #endif
             return;
         }
@@ -486,10 +643,7 @@ void SlaveTwin::nextFlap() {
             if (!waitUntilYouAreReady(MOVE, steps, timeout_ms)) {               // quiet-until-AYR, then fast-poll ARE_YOU_READY
                 {
                     #ifdef ERRORVERBOSE
-                        {
-                        TraceScope trace;
                         twinPrintln("nextFlap failed or timed out on slave 0x%02X", _slaveAddress);
-                        }
                     #endif
                     return;                                                     // no registry sync on failure
                 }
@@ -532,10 +686,7 @@ void SlaveTwin::prevFlap() {
             if (!waitUntilYouAreReady(MOVE, steps, timeout_ms)) {               // quiet-until-AYR, then fast-poll ARE_YOU_READY
                 {
                     #ifdef ERRORVERBOSE
-                        {
-                        TraceScope trace;
                         twinPrintln("prevFlap failed or timed out on slave 0x%02X", _slaveAddress);
-                        }
                     #endif
                     return;                                                     // no registry sync on failure
                 }
@@ -570,10 +721,7 @@ void SlaveTwin::nextSteps() {
         if (!waitUntilYouAreReady(MOVE, ADJUSTMENT_STEPS, timeout_ms)) {        // quiet-until-AYR, then fast-poll ARE_YOU_READY
             {
                 #ifdef ERRORVERBOSE
-                    {
-                    TraceScope trace;
                     twinPrintln("adjustment failed or timed out on slave 0x%02X", _slaveAddress);
-                    }
                 #endif
                 return;                                                         // no registry sync on failure
             }
@@ -630,10 +778,7 @@ void SlaveTwin::setOffset() {
     if (!waitUntilYouAreReady(SET_OFFSET, ADJUSTMENT_STEPS, timeout_ms)) {      // quiet-until-AYR, then fast-poll ARE_YOU_READY
         {
             #ifdef ERRORVERBOSE
-                {
-                TraceScope trace;
                 twinPrintln("save parameter failed or timed out on slave 0x%02X", _slaveAddress);
-                }
             #endif
             return;                                                             // no registry sync on failure
         }
@@ -653,8 +798,7 @@ void SlaveTwin::setOffset() {
  *
  */
 void SlaveTwin::reset() {
-    twinPrint("send reset to 0x:  ");
-    Serial.println(_slaveAddress, HEX);
+    twinPrintln("send reset to 0x:  %02X", _slaveAddress);
     Register->deRegisterDevice(_slaveAddress);                                  // delete slave from registry, this address is free now
     i2cLongCommand(i2cCommandParameter(RESET, 0));                              // send reset to slave
 }
@@ -695,24 +839,30 @@ int SlaveTwin::countStepsToMove(int from, int to) {
  * @param mess message to be send (3byte structure: 1byte command, 2byte parameter)
  */
 void SlaveTwin::i2cLongCommand(LongMessage mess) {
-    uint8_t data[sizeof(LongMessage)];
-    prepareI2Cdata(mess, data);
-    esp_err_t error = ESP_FAIL;
-
     if (!takeI2CSemaphore()) {                                                  // bus busy -> do NOT access unsynchronized and do NOT give a mutex we never took
         if (DataEvaluation)
             DataEvaluation->increment(0, 0, 0, 1);                              // count as I2C error
         return;
     }
+    i2cLongTransfer(mess);
+    giveI2CSemaphore();                                                         // give semaphore
+}
+
+/**
+ * @brief send long command to slave, caller holds the I2C semaphore
+ *
+ * increment i2c statistics
+ *
+ * @param mess message to be send (3byte structure: 1byte command, 2byte parameter)
+ * @return esp_err_t result of i2c_master_cmd_begin
+ */
+esp_err_t SlaveTwin::i2cLongTransfer(LongMessage mess) {
+    uint8_t data[sizeof(LongMessage)];
+    prepareI2Cdata(mess, data);
+    esp_err_t error = ESP_FAIL;
 
     #ifdef I2CMASTERVERBOSE
-        {
-        TraceScope trace;                                                       // use semaphore to protect this block
-        twinPrint("send LongCommand (i2cLongCommand): 0x");
-        Serial.print(data[0], HEX);
-        Serial.print(" - ");
-        Serial.println(getCommandName(data[0]));
-        }
+        twinPrintln("send LongCommand (i2cLongCommand): 0x%02X - %s", data[0], getCommandName(data[0]));
     #endif
 
     // construct command chain
@@ -721,36 +871,28 @@ void SlaveTwin::i2cLongCommand(LongMessage mess) {
     i2c_master_write_byte(cmd, (_slaveAddress << 1) | I2C_MASTER_WRITE, true);  // set i2c address of flap module
     i2c_master_write(cmd, data, sizeof(LongMessage), true);                     // send buffer to slave
     i2c_master_stop(cmd);                                                       // set i2c stop condition
+    const uint32_t start = micros();
     error = i2c_master_cmd_begin(I2C_NUM_0, cmd, pdMS_TO_TICKS(30));            // send command chain (was 1ms: too tight, slave clock-stretch caused spurious timeouts)
+    const uint32_t busUs = micros() - start;
     i2c_cmd_link_delete(cmd);                                                   // delete command chain
 
-    giveI2CSemaphore();                                                         // give semaphore
-
-    if (DataEvaluation)
+    if (DataEvaluation) {
         DataEvaluation->increment(1, sizeof(LongMessage));                      // count I2C usage, 1 Access, 3 byte data
+        DataEvaluation->recordLatency(_slaveAddress, LAT_LONG, busUs);
+    }
 
     if (error == ESP_OK) {
         #ifdef I2CMASTERVERBOSE
-            {
-            TraceScope trace;                                                   // use semaphore to protect this block
-            twinPrint("ACK from Slave 0x");
-            Serial.print(_slaveAddress, HEX);
-            Serial.println(" received.");
-            }
+            twinPrintln("ACK from Slave 0x%02X received.", _slaveAddress);
         #endif
     } else {
         #ifdef I2CMASTERVERBOSE
-            {
-            TraceScope trace;                                                   // use semaphore to protect this block
-            twinPrint("Error while sending to 0x");
-            Serial.print(_slaveAddress, HEX);
-            Serial.print(". Errorcode: ");
-            Serial.println(esp_err_to_name(error));
-            }
+            twinPrintln("Error while sending to 0x%02X. Errorcode: %s", _slaveAddress, esp_err_to_name(error));
         #endif
         if (DataEvaluation)
             DataEvaluation->increment(0, 0, 0, 1);                              // count I2C usage, 1 timeout
     }
+    return error;
 }
 // ----------------------------
 
@@ -797,12 +939,16 @@ esp_err_t SlaveTwin::i2cShortCommand(ShortMessage shortCmd, uint8_t* answer, int
             DataEvaluation->increment(0, 0, 0, 1);                              // count as I2C error
         return ESP_ERR_TIMEOUT;
     }
-    ret = i2c_master_cmd_begin(I2C_NUM_0, cmd, pdMS_TO_TICKS(30));
+    const uint32_t start = micros();
+    ret                  = i2c_master_cmd_begin(I2C_NUM_0, cmd, pdMS_TO_TICKS(30));
+    const uint32_t busUs = micros() - start;
     giveI2CSemaphore();
     i2c_cmd_link_delete(cmd);
 
-    if (DataEvaluation)
+    if (DataEvaluation) {
         DataEvaluation->increment(2, 1, 0);                                     // 2 accesses, 1 byte sent
+        DataEvaluation->recordLatency(_slaveAddress, (shortCmd == CMD_ARE_YOU_READY) ? LAT_PROBE : LAT_SHORT, busUs);
+    }
 
     if (ret == ESP_OK) {
         logShortResponse(answer, size);
@@ -846,6 +992,25 @@ i2c_cmd_handle_t SlaveTwin::buildShortCommand(ShortMessage shortCmd, uint8_t* an
 
 // ---------------------------
 
+/**
+ * @brief answer bytes " [i] = 0xNN" as text, so a response is one trace line
+ *
+ * @param line text buffer
+ * @param size size of line
+ * @param answer received bytes
+ * @param count number of bytes
+ */
+#ifdef I2CMASTERVERBOSE
+static void formatAnswer(char* line, size_t size, const uint8_t* answer, int count) {
+    size_t used = 0;
+    line[0]     = 0;
+    for (int i = 0; i < count && used < size; i++)
+        used += snprintf(line + used, size - used, " [%d] = 0x%X", i, answer[i]);
+}
+#endif
+
+// ---------------------------
+
 /**
  * @brief helper to log sending short command
  *
@@ -853,13 +1018,7 @@ i2c_cmd_handle_t SlaveTwin::buildShortCommand(ShortMessage shortCmd, uint8_t* an
  */
 void SlaveTwin::logShortRequest(ShortMessage cmd) {
     #ifdef I2CMASTERVERBOSE
-        TraceScope trace;
-        twinPrint("Send shortCommand: 0x");
-        Serial.print(cmd, HEX);
-        Serial.print(" - ");
-        Serial.print(getCommandName(cmd));
-        Serial.print(" to slave 0x");
-        Serial.println(_slaveAddress, HEX);
+        twinPrintln("Send shortCommand: 0x%02X - %s to slave 0x%02X", cmd, getCommandName(cmd), _slaveAddress);
     #endif
 }
 
@@ -873,15 +1032,9 @@ void SlaveTwin::logShortRequest(ShortMessage cmd) {
  */
 void SlaveTwin::logShortResponse(uint8_t* answer, int size) {
     #ifdef I2CMASTERVERBOSE
-        TraceScope trace;
-        twinPrint("Got answer for shortCommand from slave:");
-        for (int i = 0; i < size; i++) {
-        Serial.print(" [");
-        Serial.print(i);
-        Serial.print("] = 0x");
-        Serial.print(answer[i], HEX);
-        }
-        Serial.println();
+        char line[TRACE_TEXT_BYTES];                                            // answer bytes of one trace line
+        formatAnswer(line, sizeof(line), answer, size);
+        twinPrintln("Got answer for shortCommand from slave:%s", line);
     #endif
 }
 
@@ -895,13 +1048,8 @@ void SlaveTwin::logShortResponse(uint8_t* answer, int size) {
  */
 void SlaveTwin::logShortError(ShortMessage cmd, esp_err_t err) {
     #ifdef ERRORVERBOSE
-        TraceScope trace;
-        twinPrint("No answer to shortCommand: 0x");
-        Serial.print(cmd, HEX);
-        Serial.print(" - ");
-        Serial.println(getCommandName(cmd));
-        twinPrint("ESP ERROR: ");
-        Serial.println(esp_err_to_name(err));
+        twinPrintln("No answer to shortCommand: 0x%02X - %s", cmd, getCommandName(cmd));
+        twinPrintln("ESP ERROR: %s", esp_err_to_name(err));
         twinPrintln("Slave is not connected, ignore command.");
     #endif
 }
@@ -934,11 +1082,15 @@ esp_err_t SlaveTwin::i2cMidCommand(MidMessage midCmd, I2Caddress slaveaddress, u
             DataEvaluation->increment(0, 0, 0, 1);                              // count as I2C error
         return ESP_ERR_TIMEOUT;
     }
-    ret = i2c_master_cmd_begin(I2C_NUM_0, cmd, pdMS_TO_TICKS(200));
+    const uint32_t start = micros();
+    ret                  = i2c_master_cmd_begin(I2C_NUM_0, cmd, pdMS_TO_TICKS(200));
+    const uint32_t busUs = micros() - start;
     giveI2CSemaphore();
     i2c_cmd_link_delete(cmd);
-    if (DataEvaluation)
+    if (DataEvaluation) {
         DataEvaluation->increment(2, 1, 0);                                     // 2 accesses, 1 byte sent
+        DataEvaluation->recordLatency(slaveaddress, LAT_MID, busUs);
+    }
 
     if (ret == ESP_OK) {
         logMidResponse(answer, size);
@@ -995,13 +1147,7 @@ i2c_cmd_handle_t SlaveTwin::buildMidCommand(MidMessage midCmd, I2Caddress slaveA
  */
 void SlaveTwin::logMidRequest(MidMessage cmd, I2Caddress slaveAddress) {
     #ifdef I2CMASTERVERBOSE
-        TraceScope trace;
-        twinPrint("Send midCommand: 0x");
-        Serial.print(cmd.command, HEX);
-        Serial.print(" - ");
-        Serial.print(getCommandName(cmd.command));
-        Serial.print(" to slave 0x");
-        Serial.println(slaveAddress, HEX);
+        twinPrintln("Send midCommand: 0x%02X - %s to slave 0x%02X", cmd.command, getCommandName(cmd.command), slaveAddress);
     #endif
 }
 
@@ -1015,15 +1161,9 @@ void SlaveTwin::logMidRequest(MidMessage cmd, I2Caddress slaveAddress) {
  */
 void SlaveTwin::logMidResponse(uint8_t* answer, int size) {
     #ifdef I2CMASTERVERBOSE
-        TraceScope trace;
-        twinPrint("Got answer for midCommand from slave:");
-        for (int i = 0; i < size; i++) {
-        Serial.print(" [");
-        Serial.print(i);
-        Serial.print("] = 0x");
-        Serial.print(answer[i], HEX);
-        }
-        Serial.println();
+        char line[TRACE_TEXT_BYTES];                                            // answer bytes of one trace line
+        formatAnswer(line, sizeof(line), answer, size);
+        twinPrintln("Got answer for midCommand from slave:%s", line);
     #endif
 }
 
@@ -1037,13 +1177,8 @@ void SlaveTwin::logMidResponse(uint8_t* answer, int size) {
  */
 void SlaveTwin::logMidError(MidMessage cmd, esp_err_t err) {
     #ifdef TWINVERBOSE
-        TraceScope trace;
-        twinPrint("No answer to midCommand: 0x");
-        Serial.print(cmd.command, HEX);
-        Serial.print(" - ");
-        Serial.println(getCommandName(cmd.command));
-        twinPrint("ESP ERROR: ");
-        Serial.println(esp_err_to_name(err));
+        twinPrintln("No answer to midCommand: 0x%02X - %s", cmd.command, getCommandName(cmd.command));
+        twinPrintln("ESP ERROR: %s", esp_err_to_name(err));
         twinPrintln("Slave is not connected, ignore command.");
     #endif
 }
@@ -1061,11 +1196,7 @@ void SlaveTwin::setNewAddress(int address) {
     esp_err_t       ret = i2c_probe_device(I2C_BASE_ADDRESS);                   // send ping to unregistered device/slave
     if (ret != ESP_OK) {
         #ifdef REGISTRYVERBOSE
-            {
-            TraceScope trace;
-            twinPrint("no slave available with base address 0x");
-            Serial.println(I2C_BASE_ADDRESS, HEX);
-            }
+            twinPrintln("no slave available with base address 0x%02X", I2C_BASE_ADDRESS);
         #endif
 
         return;
@@ -1079,11 +1210,8 @@ void SlaveTwin::setNewAddress(int address) {
     sn = ((uint32_t)answer[0]) | ((uint32_t)answer[1] << 8) | ((uint32_t)answer[2] << 16) | ((uint32_t)answer[3] << 24);
 
     #ifdef SCANVERBOSE
-        TraceScope trace;
-        twinPrint("new address 0x");
-        Serial.println(address, HEX);
-        twinPrint("was received by device with serial number: ");
-        Serial.println(formatSerialNumber(sn));
+        twinPrintln("new address 0x%02X", address);
+        twinPrintln("was received by device with serial number: %s", formatSerialNumber(sn));
         //        twinPrintln("we are waiting for him to come back");
     #endif
 }
@@ -1099,22 +1227,14 @@ void SlaveTwin::performAvailability() {
     esp_err_t ret = i2c_probe_device(_slaveAddress);                            // send ping to device/slave
     if (ret != ESP_OK) {
         #ifdef AVAILABILITYVERBOSE
-            {
-            TraceScope trace;
-            twinPrint("I²C-Slave is not available -> will deregister it 0x");
-            Serial.println(_slaveAddress, HEX);
-            }
+            twinPrintln("I²C-Slave is not available -> will deregister it 0x%02X", _slaveAddress);
         #endif
         Register->deRegisterDevice(_slaveAddress);                              // delete slave from registry
         return;
     }
 
     #ifdef AVAILABILITYVERBOSE
-        {
-        TraceScope trace;
-        twinPrint("I2C-Slave is available: 0x");
-        Serial.println(_slaveAddress, HEX);
-        }
+        twinPrintln("I2C-Slave is available: 0x%02X", _slaveAddress);
     #endif
 
     bootRelease();                                                              // release bootFlag and calibrate
@@ -1133,21 +1253,13 @@ void SlaveTwin::bootRelease() {
         if (_slaveReady.bootFlag) {                                             // check if bootFlag of slave is set
             {
                 #if defined(AVAILABILITYVERBOSE) || defined(SCANVERBOSE)
-                    {
-                    TraceScope trace;
-                    twinPrint("reset bootFlag on rebooted Slave 0x");
-                    Serial.println(_slaveAddress, HEX);
-                    }
+                    twinPrintln("reset bootFlag on rebooted Slave 0x%02X", _slaveAddress);
                 #endif
             }
             if (i2cShortCommand(CMD_RESET_BOOT, &ans, sizeof(ans)) == ESP_OK) { // send reset bootFlag to slave
                 {
                     #if defined(AVAILABILITYVERBOSE) || defined(SCANVERBOSE)
-                        {
-                        TraceScope trace;
-                        twinPrint("slave has rebooted; calibrating now Slave 0x");
-                        Serial.println(_slaveAddress, HEX);
-                        }
+                        twinPrintln("slave has rebooted; calibrating now Slave 0x%02X", _slaveAddress);
                     #endif
                 }
                 calibration();                                                  // calibrate device
@@ -1167,7 +1279,6 @@ void SlaveTwin::performRegister() {
     esp_err_t ret = i2c_probe_device(_slaveAddress);                            // send ping to device/slave
     if (ret != ESP_OK) {
         #ifdef TWINVERBOSE
-            TraceScope trace;
             twinPrintln("(performRegister) slave not ready");
         #endif
         return;
@@ -1176,7 +1287,6 @@ void SlaveTwin::performRegister() {
     else if (!getFullStateOfSlave()) {                                          // get all status of device
         {
             #ifdef TWINVERBOSE
-                TraceScope trace;
                 twinPrintln("(performRegister) did not get fullState from slave");
             #endif
         }
@@ -1184,7 +1294,6 @@ void SlaveTwin::performRegister() {
     } else if (!askSlaveAboutParameter(_parameter)) {                           // get all parameter of device
         {
             #ifdef TWINVERBOSE
-                TraceScope trace;
                 twinPrintln("(performRegister) did not get paramerter from slave");
             #endif
         }
@@ -1211,13 +1320,12 @@ void SlaveTwin::performRegister() {
  */
 void SlaveTwin::logHexBytes(const char* prefix, const uint8_t* buf, size_t n) {
     #ifdef TWINVERBOSE
-        TraceScope trace;
-        twinPrint(prefix);
-        for (size_t i = 0; i < n; ++i) {
-        Serial.print(i ? " 0x" : "0x");
-        Serial.print(buf[i], HEX);
-        }
-        Serial.println();
+        char   line[TRACE_TEXT_BYTES];                                          // bytes of one trace line
+        size_t used = 0;
+        line[0]     = 0;
+        for (size_t i = 0; i < n && used < sizeof(line); ++i)
+            used += snprintf(line + used, sizeof(line) - used, i ? " 0x%X" : "0x%X", buf[i]);
+        twinPrintln("%s%s", prefix, line);
     #endif
 }
 
@@ -1229,9 +1337,7 @@ void SlaveTwin::logHexBytes(const char* prefix, const uint8_t* buf, size_t n) {
  */
 void SlaveTwin::logInfo(const char* prefix, const String& value) {
     #ifdef TWINVERBOSE
-        TraceScope trace;
-        twinPrint(prefix);
-        Serial.println(value);
+        twinPrintln("%s%s", prefix, value.c_str());
     #endif
 }
 
@@ -1243,9 +1349,7 @@ void SlaveTwin::logInfo(const char* prefix, const String& value) {
  */
 void SlaveTwin::logInfoU32(const char* prefix, uint32_t v) {
     #ifdef TWINVERBOSE
-        TraceScope trace;
-        twinPrint(prefix);
-        Serial.println(v);
+        twinPrintln("%s%u", prefix, v);
     #endif
 }
 
@@ -1257,9 +1361,7 @@ void SlaveTwin::logInfoU32(const char* prefix, uint32_t v) {
  */
 void SlaveTwin::logInfoU16(const char* prefix, uint16_t v) {
     #ifdef TWINVERBOSE
-        TraceScope trace;
-        twinPrint(prefix);
-        Serial.println(v);
+        twinPrintln("%s%u", prefix, v);
     #endif
 }
 
@@ -1271,9 +1373,7 @@ void SlaveTwin::logInfoU16(const char* prefix, uint16_t v) {
  */
 void SlaveTwin::logInfoU8(const char* prefix, uint8_t v) {
     #ifdef TWINVERBOSE
-        TraceScope trace;
-        twinPrint(prefix);
-        Serial.println(v);
+        twinPrintln("%s%u", prefix, v);
     #endif
 }
 
@@ -1285,7 +1385,6 @@ void SlaveTwin::logInfoU8(const char* prefix, uint8_t v) {
  */
 void SlaveTwin::logErr(const char* msg) {
     #ifdef ERRORVERBOSE
-        TraceScope trace;
         twinPrintln(msg);
     #endif
 }
@@ -1493,15 +1592,7 @@ Key21 SlaveTwin::ir2Key21(uint64_t ircode) {
 
     if (key != Key21::UNKNOWN && key != Key21::NONE) {
         #ifdef IRVERBOSE
-            {
-            TraceScope trace;                                                   // use semaphore to protect this block
-            twinPrint("key recognized: ");
-            Serial.print((int)key);
-            Serial.print(" (0x");
-            Serial.print(ircode, HEX);
-            Serial.print(") - ");
-            Serial.println(Control->key21ToString(key));                        // make it visable
-            }
+            twinPrintln("key recognized: %d (0x%llX) - %s", (int)key, ircode, Control->key21ToString(key)); // make it visable
         #endif
         _lastTwinTime = now;
         _lastTwinCode = ircode;
@@ -1525,21 +1616,13 @@ Key21 SlaveTwin::ir2Key21(uint64_t ircode) {
 bool SlaveTwin::isSlaveReady() {
     uint8_t data[1] = {0};                                                      // to receive answer
     #ifdef READYBUSYVERBOSE
-        {
-        TraceScope trace;                                                       // use semaphore to protect this block
-        twinPrint("readyness/busyness check of slave 0x");
-        Serial.println(_slaveAddress, HEX);
-        }
+        twinPrintln("readyness/busyness check of slave 0x%02X", _slaveAddress);
     #endif
 
     if (i2cShortCommand(CMD_ARE_YOU_READY, data, sizeof(data)) != ESP_OK) {     // send  request to Slave
         {
             #ifdef ERRORVERBOSE
-                {
-                TraceScope trace;                                               // use semaphore to protect this block
-                twinPrint("(isSlaveReady) shortCommand STATE failed to: 0x");
-                Serial.println(_slaveAddress, HEX);
-                }
+                twinPrintln("(isSlaveReady) shortCommand STATE failed to: 0x%02X", _slaveAddress);
             #endif
         }
         return false;                                                           // twin not connected
@@ -1547,13 +1630,7 @@ bool SlaveTwin::isSlaveReady() {
 
     _slaveReady.ready = data[0];                                                // update slaveReady structure
     #ifdef READYBUSYVERBOSE
-        {
-        TraceScope trace;                                                       // use semaphore to protect this block
-        twinPrint("(isSlaveReady) shortCommand STATE answer from slave 0x");
-        Serial.print(_slaveAddress, HEX);
-        Serial.print(" = ");
-        Serial.println(_slaveReady.ready ? "READY" : "BUSY");
-        }
+        twinPrintln("(isSlaveReady) shortCommand STATE answer from slave 0x%02X = %s", _slaveAddress, _slaveReady.ready ? "READY" : "BUSY");
     #endif
     return _slaveReady.ready;                                                   // return ready/busy state of slave
 }
@@ -1573,20 +1650,12 @@ bool SlaveTwin::isSlaveReady() {
 bool SlaveTwin::getFullStateOfSlave() {
     uint8_t data[6] = {0, 0, 0, 0, 0, 0};                                       // structure to receive answer for STATE
     #ifdef READYBUSYVERBOSE
-        {
-        TraceScope trace;                                                       // use semaphore to protect this block
-        twinPrint("get full STATE of slave 0x");
-        Serial.println(_slaveAddress, HEX);
-        }
+        twinPrintln("get full STATE of slave 0x%02X", _slaveAddress);
     #endif
 
     if (i2cShortCommand(CMD_GET_STATE, data, sizeof(data)) != ESP_OK) {         // send  request to Slave
     #ifdef ERRORVERBOSE
-        {
-        TraceScope trace;                                                       // use semaphore to protect this block
-        twinPrint("(getFullStateOfSlave) shortCommand GET_STATE failed to: 0x");
-        Serial.println(_slaveAddress, HEX);
-        }
+        twinPrintln("(getFullStateOfSlave) shortCommand GET_STATE failed to: 0x%02X", _slaveAddress);
     #endif
         return false;                                                           // twin not connected
     }
@@ -1622,28 +1691,13 @@ void SlaveTwin::updateSlaveReadyInfo(uint8_t* data) {
  */
 void SlaveTwin::printSlaveReadyInfo() {
     #ifdef READYBUSYVERBOSE
-        {
-        TraceScope trace;                                                       // use semaphore to protect this block
-        twinPrint("_slaveReady.ready = ");
-        Serial.println(_slaveReady.ready ? "TRUE" : "FALSE");
-        //
-        twinPrint("_slaveReady.taskCode 0x");
-        Serial.print(_slaveReady.taskCode, HEX);
-        Serial.print(_slaveReady.ready ? " - ready with " : " - busy with ");
-        Serial.println(getCommandName(_slaveReady.taskCode));
-        //
-        twinPrint("_slaveReady.bootFlag = ");
-        Serial.println(_slaveReady.bootFlag ? "TRUE" : "FALSE");
-        //
-        twinPrint("_slaveReady.sensorStatus = ");
-        Serial.println(_slaveReady.sensorStatus ? "WORKING" : "BROKEN");
-        //
-        twinPrint("_slaveReady.position = ");
-        Serial.println(_slaveReady.position);
-        //
-        twinPrint("");
-        Serial.println(_slaveReady.ready ? "Slave is ready" : "Slave is busy and ignored your command");
-        }
+        twinPrintln("_slaveReady.ready = %s", _slaveReady.ready ? "TRUE" : "FALSE");
+        twinPrintln("_slaveReady.taskCode 0x%02X%s%s", _slaveReady.taskCode, _slaveReady.ready ? " - ready with " : " - busy with ",
+                    getCommandName(_slaveReady.taskCode));
+        twinPrintln("_slaveReady.bootFlag = %s", _slaveReady.bootFlag ? "TRUE" : "FALSE");
+        twinPrintln("_slaveReady.sensorStatus = %s", _slaveReady.sensorStatus ? "WORKING" : "BROKEN");
+        twinPrintln("_slaveReady.position = %u", _slaveReady.position);
+        twinPrintln(_slaveReady.ready ? "Slave is ready" : "Slave is busy and ignored your command");
     #endif
 }
 
@@ -1663,35 +1717,29 @@ void SlaveTwin::synchSlaveRegistry() {
         if (device->position != _slaveReady.position) {
             device->position = _slaveReady.position;                            // update Flap position
             #ifdef TWINVERBOSE
-                {
-                TraceScope trace;
-                twinPrint("Device position in registry updated of slave 0x%02X to: ", _slaveAddress);
-                Serial.println(_slaveReady.position);
-                }
+                twinPrintln("Device position in registry updated of slave 0x%02X to: %u", _slaveAddress, _slaveReady.position);
             #endif
         }
         if (device->parameter.steps != _parameter.steps) {
             device->parameter.steps = _parameter.steps;                         // update steps per revolution
             #ifdef TWINVERBOSE
-                {
-                TraceScope trace;
-                twinPrint("Device steps per revolution in registry updated of slave 0x%02X to:", _slaveAddress);
-                Serial.println(_parameter.steps);
-                }
+                twinPrintln("Device steps per revolution in registry updated of slave 0x%02X to:%d", _slaveAddress, _parameter.steps);
             #endif
 
             calculateStepsPerFlap();                                            // steps per rev. has changed recalculate stepsPerFlap
 
             #ifdef TWINVERBOSE
                 {
-                TraceScope trace;
-                twinPrint("Steps by Flap are: ");
+                char   line[TRACE_TEXT_BYTES];                                  // steps of one trace line
+                size_t used = 0;
                 for (int i = 0; i < _parameter.flaps; ++i) {
-                Serial.print(stepsByFlap[i]);
-                if (i < _parameter.flaps - 1)
-                Serial.print(", ");
+                    if ((i % 10) == 0)                                          // 10 steps per line like the registry
+                        used = 0;
+                    if (used < sizeof(line))
+                        used += snprintf(line + used, sizeof(line) - used, (i % 10) ? ", %d" : "%d", stepsByFlap[i]);
+                    if ((i % 10) == 9 || i == _parameter.flaps - 1)
+                        twinPrintln("Steps by Flap are: %s", line);
                 }
-                Serial.println();
                 }
             #endif
         }
@@ -1699,40 +1747,27 @@ void SlaveTwin::synchSlaveRegistry() {
         if (device->parameter.speed != _parameter.speed) {
             device->parameter.speed = _parameter.speed;                         // update speed (time per revolution)
             #ifdef TWINVERBOSE
-                {
-                TraceScope trace;
                 twinPrintln("Device speed in registry updated of slave 0x%02X to: %d", _slaveAddress, _parameter.speed);
-                }
             #endif
         }
 
         if (device->parameter.offset != _parameter.offset) {
             device->parameter.offset = _parameter.offset;                       // update offset
             #ifdef TWINVERBOSE
-                {
-                TraceScope trace;
                 twinPrintln("Device offset in registry updated of slave 0x%02X to: %d", _slaveAddress, _parameter.offset);
-                }
             #endif
         }
 
         if (device->parameter.sensorworking != _slaveReady.sensorStatus) {
             device->parameter.sensorworking = _slaveReady.sensorStatus;         // update Sensor status
             #ifdef TWINVERBOSE
-                {
-                TraceScope trace;
                 twinPrintln("Device sensor status in registry updated of slave 0x%02X to: %d", _slaveAddress, _slaveReady.sensorStatus);
-                }
             #endif
         }
         if (device->bootFlag != _slaveReady.bootFlag) {
             device->bootFlag = _slaveReady.bootFlag;                            // update bootFlag
             #ifdef TWINVERBOSE
-                {
-                TraceScope trace;
-                twinPrint("Device bootFlag in registry updated of slave 0x%02X to: ", _slaveAddress);
-                Serial.println(_slaveReady.bootFlag);
-                }
+                twinPrintln("Device bootFlag in registry updated of slave 0x%02X to: %d", _slaveAddress, _slaveReady.bootFlag);
             #endif
         }
     }
@@ -1748,8 +1783,7 @@ void SlaveTwin::synchSlaveRegistry() {
 void SlaveTwin::systemHalt(const char* reason, int blinkCode) {
     twinPrintln("===================================");
     twinPrintln("🛑 SYSTEM HALTED!");
-    twinPrint("reason: ");
-    Serial.println(reason);
+    twinPrintln("reason: %s", reason);
     twinPrintln("===================================");
 
     #ifdef LED_BUILTIN
@@ -1771,12 +1805,7 @@ void SlaveTwin::systemHalt(const char* reason, int blinkCode) {
             vTaskDelay(pdMS_TO_TICKS(5000));
             }
         #endif
-        {
-            TraceScope trace;                                                   // use semaphore to protect
-            twinPrint("System halt reason: ");                                  // regelmäßige
-                                                // Konsolenmeldung
-            Serial.println(reason);
-        }
+        twinPrintln("System halt reason: %s", reason);                          // regelmäßige Konsolenmeldung
         vTaskDelay(pdMS_TO_TICKS(5000));                                        // Delay for 5s
     }
 }
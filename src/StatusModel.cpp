@@ -0,0 +1,187 @@
+// #################################################################################################################
+//
+//  ███████ ████████  █████  ████████ ██    ██ ███████     ███    ███  ██████  ██████  ███████ ██
+//  ██         ██    ██   ██    ██    ██    ██ ██          ████  ████ ██    ██ ██   ██ ██      ██
+//  ███████    ██    ███████    ██    ██    ██ ███████     ██ ████ ██ ██    ██ ██   ██ █████   ██
+//       ██    ██    ██   ██    ██    ██    ██      ██     ██  ██  ██ ██    ██ ██   ██ ██      ██
+//  ███████    ██    ██   ██    ██     ██████  ███████     ██      ██  ██████  ██████  ███████ ███████
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Status%20Model
+//
+/*
+
+    In-memory status documents for the web server, see StatusModel.h
+
+*/
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <SPIFFS.h>
+#include <ESPAsyncWebServer.h>
+#include "StatusModel.h"
+
+StatusDocument TaskStatusDoc("/TaskStatus.json", true);
+StatusDocument PollStatusDoc("/PollStatus.json", false);
+
+/**
+ * @brief FNV-1a of a body, used as ETag
+ *
+ * @param text body
+ * @return uint32_t hash
+ */
+static uint32_t statusHash(const String& text) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < text.length(); i++)
+        hash = (hash ^ (uint8_t)text[i]) * 16777619u;
+    return hash;
+}
+
+// ----------------------------
+
+StatusDocument::StatusDocument(const char* filename, bool withHtml) : _filename(filename), _withHtml(withHtml) {}
+
+/**
+ * @brief render new version of the document
+ *
+ * Called by the report task; the web server keeps sending older bodies until their
+ * responses are finished.
+ *
+ * @param doc status incl. _meta
+ */
+void StatusDocument::publish(JsonDocument& doc) {
+    std::shared_ptr<StatusBody> body = std::make_shared<StatusBody>();
+    body->version                    = _version.load() + 1;
+    serializeJson(doc, body->json);
+    if (_withHtml)
+        body->html = renderHtml(doc);
+    const uint32_t hash = statusHash(body->json);
+    snprintf(body->etag, sizeof(body->etag), "\"%08lx\"", (unsigned long)hash);
+    snprintf(body->htmlEtag, sizeof(body->htmlEtag), "\"%08lxh\"", (unsigned long)hash);
+
+    std::atomic_store(&_body, std::shared_ptr<const StatusBody>(body));
+    _version.store(body->version);
+    _restored.store(true);                                                      // SPIFFS copy is older than this
+}
+
+// ----------------------------
+
+/**
+ * @brief answer request from RAM, 304 if the client has this version
+ *
+ * @param request web request
+ * @param html true: /status page, false: JSON
+ * @return true request answered
+ * @return false no status yet (neither published nor persisted)
+ */
+bool StatusDocument::send(AsyncWebServerRequest* request, bool html) {
+    std::shared_ptr<const StatusBody> body = std::atomic_load(&_body);
+    if (!body) {
+        restore();
+        body = std::atomic_load(&_body);
+        if (!body)
+            return false;
+    }
+    if (html && !_withHtml)
+        return false;
+
+    const char* etag = html ? body->htmlEtag : body->etag;
+    if (request->hasHeader("If-None-Match") && request->getHeader("If-None-Match")->value() == etag) {
+        AsyncWebServerResponse* response = request->beginResponse(304);
+        response->addHeader("ETag", etag);
+        response->addHeader("Cache-Control", "no-cache");
+        request->send(response);
+        _notModified++;
+        return true;
+    }
+
+    const String& text = html ? body->html : body->json;
+    AsyncWebServerResponse* response =
+        request->beginResponse(html ? "text/html; charset=UTF-8" : "application/json; charset=UTF-8", text.length(),
+                               [body, html](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+                                   const String& out = html ? body->html : body->json; // body lives as long as the response
+                                   if (index >= out.length())
+                                       return 0;
+                                   const size_t n = std::min(maxLen, (size_t)(out.length() - index));
+                                   memcpy(buffer, out.c_str() + index, n);
+                                   return n;
+                               });
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", "no-cache");                           // revalidate, 304 keeps it cheap
+    if (!html)
+        response->addHeader("Access-Control-Allow-Origin", "*");
+    request->send(response);
+    _served++;
+    return true;
+}
+
+// ----------------------------
+
+/**
+ * @brief load status of the last run from SPIFFS, only until the first publish()
+ *
+ */
+void StatusDocument::restore() {
+    if (_restored.exchange(true))
+        return;                                                                 // already tried or published
+    File file = SPIFFS.open(_filename, FILE_READ);
+    if (!file)
+        return;
+    JsonDocument         doc;
+    DeserializationError err = deserializeJson(doc, file);
+    file.close();
+    if (err)
+        return;
+
+    std::shared_ptr<StatusBody> body = std::make_shared<StatusBody>();
+    body->version                    = 0;
+    serializeJson(doc, body->json);
+    if (_withHtml)
+        body->html = renderHtml(doc);
+    const uint32_t hash = statusHash(body->json);
+    snprintf(body->etag, sizeof(body->etag), "\"%08lx\"", (unsigned long)hash);
+    snprintf(body->htmlEtag, sizeof(body->htmlEtag), "\"%08lxh\"", (unsigned long)hash);
+    std::shared_ptr<const StatusBody> none;
+    std::atomic_compare_exchange_strong(&_body, &none, std::shared_ptr<const StatusBody>(body)); // publish() may have been faster
+}
+
+// ----------------------------
+
+/**
+ * @brief render flat JSON document as html (without _meta)
+ *
+ * @param doc flat status document
+ * @return String html page
+ */
+String StatusDocument::renderHtml(JsonDocument& doc) const {
+    String html;
+    html.reserve(3072);                                                         // task status page, avoids regrowing
+    html += "<!DOCTYPE html><html><head><meta charset='UTF-8'>"
+            "<title>FLAP Task Status</title>"
+            "<style>body{font-family:monospace; background:#f5f5f5; white-space:pre;}</style>"
+            "</head><body>\n";
+
+    char line[128];
+    bool headerPrinted = false;
+
+    for (JsonPair kv : doc.as<JsonObject>()) {
+        const char* key = kv.key().c_str();
+        if (strcmp(key, "_meta") == 0)
+            continue;
+        String value = kv.value().as<String>();
+
+        if (strcmp(key, "report") == 0) {
+            snprintf(line, sizeof(line), "%s\n=======================\n", value.c_str());
+            headerPrinted = true;
+        } else {
+            snprintf(line, sizeof(line), "%-24s %s\n", key, value.c_str());
+        }
+        html += line;
+    }
+
+    if (!headerPrinted)
+        html += "=======================\n";
+
+    html += "</body></html>";
+    return html;
+}
@@ -0,0 +1,90 @@
+
+/*
+
+    Team name -> dense team index, see TeamIndex.h
+
+*/
+#include "TeamIndex.h"
+
+static_assert(TEAM_COUNT < 127, "team index must fit into LigaRow::teamIdx");
+static_assert((TEAM_HASH_SLOTS & (TEAM_HASH_SLOTS - 1)) == 0, "TEAM_HASH_SLOTS must be a power of 2");
+
+// ----------------------------
+// compile time part
+
+constexpr int DFB1_COUNT = sizeof(DFB1) / sizeof(DFB1[0]);
+constexpr int DFB2_COUNT = sizeof(DFB2) / sizeof(DFB2[0]);
+
+constexpr const DfbMap& teamAt(int index) {
+    return (index < DFB1_COUNT) ? DFB1[index] : (index < DFB1_COUNT + DFB2_COUNT) ? DFB2[index - DFB1_COUNT] : DFB3[index - DFB1_COUNT - DFB2_COUNT];
+}
+
+// FNV-1a over the UTF-8 bytes, seeded basis, final mix for the low bits
+constexpr uint32_t teamHash(const char* name, uint32_t seed) {
+    uint32_t h = 2166136261u ^ (seed * 0x9E3779B9u);
+    for (; *name; ++name) {
+        h ^= (uint8_t)*name;
+        h *= 16777619u;
+    }
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    return h;
+}
+
+struct TeamHashTable {
+    uint32_t seed;                                                              // 0 = no perfect seed found
+    uint8_t  slot[TEAM_HASH_SLOTS];                                             // team index + 1, 0 = empty
+};
+
+constexpr TeamHashTable buildTeamHash() {
+    TeamHashTable table{};
+    for (uint32_t seed = 1; seed < 100000; ++seed) {
+        for (int s = 0; s < TEAM_HASH_SLOTS; ++s)
+            table.slot[s] = 0;
+        bool perfect = true;
+        for (int t = 0; t < TEAM_COUNT && perfect; ++t) {
+            const uint32_t s = teamHash(teamAt(t).key, seed) & (TEAM_HASH_SLOTS - 1);
+            if (table.slot[s] != 0)
+                perfect = false;                                                // collision: next seed
+            else
+                table.slot[s] = (uint8_t)(t + 1);
+        }
+        if (perfect) {
+            table.seed = seed;
+            return table;
+        }
+    }
+    return table;
+}
+
+static constexpr TeamHashTable teamTable = buildTeamHash();
+static_assert(teamTable.seed != 0, "no perfect hash seed for the DFB team names, double TEAM_HASH_SLOTS");
+
+// ----------------------------
+
+/**
+ * @brief dense index of a team name
+ *
+ * @param teamName team name as provided by OpenLigaDB
+ * @return int 0..TEAM_COUNT-1, TEAM_NONE if the name is not in DFB1/DFB2/DFB3
+ */
+int teamIndexOf(const char* teamName) {
+    if (teamName == nullptr || *teamName == '\0')
+        return TEAM_NONE;
+    const uint8_t entry = teamTable.slot[teamHash(teamName, teamTable.seed) & (TEAM_HASH_SLOTS - 1)];
+    if (entry == 0)
+        return TEAM_NONE;
+    const int index = entry - 1;
+    return (strcmp(teamAt(index).key, teamName) == 0) ? index : TEAM_NONE;     // strict: other names may share the slot
+}
+
+/**
+ * @brief DFB entry of a team index
+ *
+ * @param index valid index from teamIndexOf()
+ * @return const DfbMap& name, DFB code and flap
+ */
+const DfbMap& teamEntry(int index) {
+    return teamAt(index);
+}
@@ -0,0 +1,408 @@
+// #################################################################################################################
+//
+//  ████████ ██████   █████   ██████ ███████     ██████  ██████  ██ ███    ██ ████████
+//     ██    ██   ██ ██   ██ ██      ██          ██   ██ ██   ██ ██ ████   ██    ██
+//     ██    ██████  ███████ ██      █████       ██████  ██████  ██ ██ ██  ██    ██
+//     ██    ██   ██ ██   ██ ██      ██          ██      ██   ██ ██ ██  ██ ██    ██
+//     ██    ██   ██ ██   ██  ██████ ███████     ██      ██   ██ ██ ██   ████    ██
+//
+// ################################################################################################## by Achim ####
+// Banner created:
+// https://patorjk.com/software/taag/#p=display&c=c%2B%2B&f=ANSI%20Regular&t=Trace%20Print
+//
+/*
+
+    Asynchronous trace, see TracePrint.h
+
+    The ring is the bounded queue of Dmitry Vyukov: every slot carries a sequence number,
+    producers claim a slot by compare-exchange of the head, TraceLog is the only consumer.
+
+*/
+#include <Arduino.h>
+#include <FlapGlobal.h>
+#include <cstring>
+#include "TracePrint.h"
+
+static_assert((TRACE_RING_SLOTS & (TRACE_RING_SLOTS - 1)) == 0, "TRACE_RING_SLOTS must be a power of 2");
+
+// ring slot, sequence == position: free for producer, sequence == position + 1: filled for TraceLog
+struct TraceSlot {
+    std::atomic<uint32_t> sequence;
+    TraceRecord           record{TRACE_PRINT};
+};
+
+static TraceSlot             g_traceRing[TRACE_RING_SLOTS];
+static std::atomic<uint32_t> g_traceHead{0};                                    // next position for producers
+static uint32_t              g_traceTail = 0;                                   // next position for TraceLog
+static std::atomic<bool>     g_traceRunning{false};                             // false: write at once
+static std::atomic<uint32_t> g_traceWritten{0};                                 // lines written by TraceLog
+static std::atomic<uint32_t> g_traceDropped{0};                                 // lines lost, ring was full
+static uint32_t              g_traceDropsShown = 0;                             // drops already reported on Serial
+
+// one decoded argument
+struct TraceValue {
+    uint8_t     tag = TRACE_INT;
+    int64_t     i   = 0;
+    double      d   = 0;
+    const char* s   = "";
+
+    long long asInt() const {
+        return (tag == TRACE_DOUBLE) ? (long long)d : (tag == TRACE_STR) ? 0 : (long long)i;
+    }
+    double asDouble() const {
+        return (tag == TRACE_DOUBLE) ? d : (tag == TRACE_UINT) ? (double)(uint64_t)i : (tag == TRACE_STR) ? 0.0 : (double)i;
+    }
+};
+
+// reads a record in the order it was written
+class TraceReader {
+   public:
+    explicit TraceReader(const TraceRecord& record) : _record(record) {}
+
+    const char* str() {
+        if (_pos >= _record.length)
+            return "";
+        const char* s = (const char*)_record.data + _pos;
+        _pos += strnlen(s, _record.length - _pos) + 1;
+        return s;
+    }
+
+    bool next(TraceValue& value) {
+        if (_pos >= _record.length)
+            return false;
+        value.tag = _record.data[_pos++];
+        if (value.tag == TRACE_STR) {
+            if (_pos >= _record.length)
+                return false;                                                   // tag without string, record was cut
+            value.s = str();
+            return true;
+        }
+        if (_pos + 8 > _record.length)
+            return false;
+        if (value.tag == TRACE_DOUBLE)
+            memcpy(&value.d, _record.data + _pos, 8);
+        else
+            memcpy(&value.i, _record.data + _pos, 8);                           // TRACE_UINT keeps its bits in i
+        _pos += 8;
+        return true;
+    }
+
+   private:
+    const TraceRecord& _record;
+    uint16_t           _pos = 0;
+};
+
+// -------------------------------------------------------------------------
+// TraceRecord
+
+/**
+ * @brief copy string with terminating 0, cut if record is full
+ *
+ * @param s string
+ */
+void TraceRecord::putStr(const char* s) {
+    if (s == nullptr)
+        s = "";
+    const size_t room = TRACE_RECORD_BYTES - length;
+    if (room == 0) {
+        truncated = 1;
+        return;
+    }
+    size_t n = strlen(s);
+    if (n + 1 > room) {
+        n         = room - 1;
+        truncated = 1;
+    }
+    memcpy(data + length, s, n);
+    data[length + n] = 0;
+    length += n + 1;
+}
+
+/**
+ * @brief append tag and binary value, nothing more after the first value that does not fit
+ *
+ * @param tag TraceTag
+ * @param value binary value (nullptr for TRACE_STR, string follows with putStr)
+ * @param size bytes of value
+ */
+void TraceRecord::putValue(TraceTag tag, const void* value, uint8_t size) {
+    if (truncated || length + 1 + size > TRACE_RECORD_BYTES) {
+        truncated = 1;
+        return;
+    }
+    data[length++] = tag;
+    if (size)
+        memcpy(data + length, value, size);
+    length += size;
+}
+
+// -------------------------------------------------------------------------
+// formatting (TraceLog, or caller as long as TraceLog does not run)
+
+/**
+ * @brief format one argument like Serial.print would have done at the call
+ *
+ * @param out free part of the line buffer
+ * @param size bytes left in out
+ * @param value argument
+ * @return int length snprintf wanted to write
+ */
+static int tracePrintValue(char* out, size_t size, const TraceValue& value) {
+    switch (value.tag) {
+        case TRACE_CHAR:
+            return snprintf(out, size, "%c", (char)value.i);
+        case TRACE_UINT:
+            return snprintf(out, size, "%llu", (unsigned long long)value.i);
+        case TRACE_DOUBLE:
+            return snprintf(out, size, "%.2f", value.d);                        // Serial.print(double) has 2 digits
+        case TRACE_STR:
+            return snprintf(out, size, "%s", value.s);
+        default:
+            return snprintf(out, size, "%lld", (long long)value.i);
+    }
+}
+
+/**
+ * @brief printf with recorded arguments
+ *
+ * Each conversion is formatted on its own, the length modifier comes from the recorded
+ * type (ll or double), so the format of the call site needs no change.
+ *
+ * @param out line buffer
+ * @param size size of out
+ * @param fmt printf format of the call
+ * @param in recorded arguments
+ */
+static void traceFormat(char* out, size_t size, const char* fmt, TraceReader& in) {
+    size_t used = 0;
+    out[0]      = 0;
+    while (*fmt && used + 1 < size) {
+        if (*fmt != '%' || fmt[1] == '%') {                                     // literal text
+            const char c = *fmt;
+            fmt += (c == '%') ? 2 : 1;
+            out[used++] = c;
+            out[used]   = 0;
+            continue;
+        }
+
+        char   spec[32];                                                        // %[flags][width][.precision] + ll + conversion
+        size_t n  = 0;
+        spec[n++] = *fmt++;
+        while (*fmt && strchr("-+ #0", *fmt) && n < 8)
+            spec[n++] = *fmt++;
+        TraceValue star;
+        if (*fmt == '*') {                                                      // width as argument
+            n += snprintf(spec + n, 8, "%d", in.next(star) ? (int)star.asInt() : 0);
+            fmt++;
+        }
+        while (*fmt >= '0' && *fmt <= '9' && n < 16)
+            spec[n++] = *fmt++;
+        if (*fmt == '.') {
+            spec[n++] = *fmt++;
+            if (*fmt == '*') {                                                  // precision as argument
+                n += snprintf(spec + n, 8, "%d", in.next(star) ? (int)star.asInt() : 0);
+                fmt++;
+            }
+            while (*fmt >= '0' && *fmt <= '9' && n < 24)
+                spec[n++] = *fmt++;
+        }
+        while (*fmt && strchr("hlLjztq", *fmt))                                 // length of call site is not needed
+            fmt++;
+        const char conv = *fmt;
+        if (conv == 0)
+            break;
+        fmt++;
+
+        TraceValue value;
+        if (!in.next(value))
+            break;                                                              // less arguments than conversions
+        char*  dst  = out + used;
+        size_t left = size - used;
+        int    len  = 0;
+        switch (conv) {
+            case 'd':
+            case 'i':
+                strcpy(spec + n, "lld");
+                len = snprintf(dst, left, spec, value.asInt());
+                break;
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X': {
+                const char suffix[] = {'l', 'l', conv, 0};
+                strcpy(spec + n, suffix);
+                len = snprintf(dst, left, spec, (unsigned long long)value.asInt());
+                break;
+            }
+            case 'c':
+                strcpy(spec + n, "c");
+                len = snprintf(dst, left, spec, (int)value.asInt());
+                break;
+            case 's': {
+                char        number[24];
+                const char* s = value.s;
+                if (value.tag != TRACE_STR) {
+                    snprintf(number, sizeof(number), "%lld", value.asInt());
+                    s = number;
+                }
+                strcpy(spec + n, "s");
+                len = snprintf(dst, left, spec, s);
+                break;
+            }
+            case 'p':
+                strcpy(spec + n, "p");
+                len = snprintf(dst, left, spec, (void*)(uintptr_t)value.i);
+                break;
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A': {
+                const char suffix[] = {conv, 0};
+                strcpy(spec + n, suffix);
+                len = snprintf(dst, left, spec, value.asDouble());
+                break;
+            }
+            default:                                                            // unknown conversion, argument is skipped
+                break;
+        }
+        if (len > 0)
+            used += ((size_t)len < left) ? (size_t)len : left - 1;
+    }
+}
+
+/**
+ * @brief write one record to Serial
+ *
+ * The whole line is formatted first and goes out with one Serial.write, so output of other
+ * tasks can not end up in the middle of it and TraceLog needs no trace semaphore.
+ *
+ * @param record trace line
+ */
+static void traceEmit(const TraceRecord& record) {
+    TraceReader  in(record);
+    char         line[TRACE_LINE_BUFFER];
+    const size_t room = sizeof(line) - 6;                                       // keep space for "..." and "\r\n"
+    size_t       used = 0;
+    auto         take = [&](int len) {
+        if (len > 0)
+            used += ((size_t)len < room - used) ? (size_t)len : room - used - 1;
+    };
+    take(snprintf(line, room, "%s", in.str()));                                 // prefix
+    if (record.kind == TRACE_PRINT || record.kind == TRACE_PRINTLN) {
+        TraceValue value;
+        while (in.next(value) && used + 1 < room)
+            take(tracePrintValue(line + used, room - used, value));
+    } else {
+        const char* fmt = in.str();
+        char        buf[TRACE_FORMAT_BUFFER];
+        traceFormat(buf, sizeof(buf), fmt, in);
+        take(snprintf(line + used, room - used, "%s", buf));
+    }
+    if (record.truncated) {
+        memcpy(line + used, "...", 3);
+        used += 3;
+    }
+    if (record.kind == TRACE_PRINTLN || record.kind == TRACE_PRINTFLN) {
+        memcpy(line + used, "\r\n", 2);                                         // like Serial.println
+        used += 2;
+    }
+    Serial.write((const uint8_t*)line, used);
+}
+
+// -------------------------------------------------------------------------
+// ring
+
+/**
+ * @brief put record into ring, without TraceLog write it at once
+ *
+ * Never waits: if the ring is full the line is counted in traceDropped().
+ *
+ * @param record encoded trace line
+ */
+void traceSubmit(const TraceRecord& record) {
+    #ifndef TRACESYNC
+        if (g_traceRunning.load(std::memory_order_acquire)) {
+            uint32_t   pos = g_traceHead.load(std::memory_order_relaxed);
+            TraceSlot* slot;
+            while (true) {
+                slot                = &g_traceRing[pos & (TRACE_RING_SLOTS - 1)];
+                const uint32_t seq  = slot->sequence.load(std::memory_order_acquire);
+                const int32_t  diff = (int32_t)(seq - pos);
+                if (diff == 0) {
+                    if (g_traceHead.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;                                                  // slot is ours
+                } else if (diff < 0) {
+                    g_traceDropped.fetch_add(1, std::memory_order_relaxed);     // ring full, TraceLog is behind
+                    return;
+                } else {
+                    pos = g_traceHead.load(std::memory_order_relaxed);          // another producer was faster
+                }
+            }
+            slot->record.kind      = record.kind;
+            slot->record.truncated = record.truncated;
+            slot->record.length    = record.length;
+            memcpy(slot->record.data, record.data, record.length);
+            slot->sequence.store(pos + 1, std::memory_order_release);           // hand over to TraceLog
+            return;
+        }
+    #endif
+    traceEmit(record);                                                          // one Serial.write, no TraceScope needed
+}
+
+/**
+ * @brief switch trace output to the ring, called by TraceLog
+ *
+ */
+void traceStart() {
+    for (uint32_t i = 0; i < TRACE_RING_SLOTS; i++)
+        g_traceRing[i].sequence.store(i, std::memory_order_relaxed);
+    g_traceHead.store(0, std::memory_order_relaxed);
+    g_traceTail = 0;
+    g_traceRunning.store(true, std::memory_order_release);
+}
+
+/**
+ * @brief write all queued records to Serial (only TraceLog)
+ *
+ * @return uint32_t number of written records
+ */
+uint32_t traceDrain() {
+    uint32_t written = 0;
+    while (true) {
+        TraceSlot& slot = g_traceRing[g_traceTail & (TRACE_RING_SLOTS - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != g_traceTail + 1)
+            break;                                                              // ring empty
+        TraceRecord record(TRACE_PRINT);
+        record.kind      = slot.record.kind;
+        record.truncated = slot.record.truncated;
+        record.length    = slot.record.length;
+        memcpy(record.data, slot.record.data, record.length);
+        slot.sequence.store(g_traceTail + TRACE_RING_SLOTS, std::memory_order_release); // free slot before the slow Serial
+        g_traceTail++;
+        traceEmit(record);                                                      // one write per line, no TraceScope
+        written++;
+    }
+    g_traceWritten.fetch_add(written, std::memory_order_relaxed);
+
+    const uint32_t dropped = g_traceDropped.load(std::memory_order_relaxed);
+    if (dropped != g_traceDropsShown) {
+        char line[64];
+        int  len = snprintf(line, sizeof(line), "[FLAP  -  TRACE ] ring full, lines dropped: %u\r\n",
+                            (unsigned)(dropped - g_traceDropsShown));
+        Serial.write((const uint8_t*)line, (size_t)len);
+        g_traceDropsShown = dropped;
+    }
+    return written;
+}
+
+uint32_t traceWritten() {
+    return g_traceWritten.load(std::memory_order_relaxed);
+}
+
+uint32_t traceDropped() {
+    return g_traceDropped.load(std::memory_order_relaxed);
+}
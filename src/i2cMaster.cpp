@@ -59,8 +59,7 @@ void i2csetup() {
     if (err != ESP_OK) {
         {
             TraceScope trace;                                                   // use semaphore to protect this block
-            masterPrint("FATAL ERROR: i2c configuration failed: ");
-            Serial.println(esp_err_to_name(err));
+            masterPrintln("FATAL ERROR: i2c configuration failed: %s", esp_err_to_name(err));
             Master->systemHalt("FATAL ERROR: i2c configuration failed.", 2);
         }
     }
@@ -69,8 +68,7 @@ void i2csetup() {
     if (err != ESP_OK) {
         {
             TraceScope trace;                                                   // use semaphore to protect this block
-            masterPrint("FATAL ERROR: i2c_driver_install failed: ");
-            Serial.println(esp_err_to_name(err));
+            masterPrintln("FATAL ERROR: i2c_driver_install failed: %s", esp_err_to_name(err));
             Master->systemHalt("FATAL ERROR: Driver install failed.", 4);
         }
     }
@@ -122,25 +120,19 @@ void printSlaveReadyInfo(SlaveTwin* twin) {
     #ifdef MASTERVERBOSE
         {
         TraceScope trace;                                                       // use semaphore to protect this block
-        masterPrint("_slaveReady.ready = ");
-        Serial.println(twin->_slaveReady.ready ? "TRUE" : "FALSE");
+        masterPrintln("_slaveReady.ready = %s", twin->_slaveReady.ready ? "TRUE" : "FALSE");
         //
-        masterPrint("_slaveReady.taskCode 0x");
-        Serial.print(twin->_slaveReady.taskCode, HEX);
-        Serial.print(twin->_slaveReady.ready ? " - ready with " : " - busy with ");
-        Serial.println(getCommandName(twin->_slaveReady.taskCode));
+        masterPrintln("_slaveReady.taskCode 0x%X%s%s", (unsigned)twin->_slaveReady.taskCode,
+                      twin->_slaveReady.ready ? " - ready with " : " - busy with ",
+                      getCommandName(twin->_slaveReady.taskCode));
         //
-        masterPrint("_slaveReady.bootFlag = ");
-        Serial.println(twin->_slaveReady.bootFlag ? "TRUE" : "FALSE");
+        masterPrintln("_slaveReady.bootFlag = %s", twin->_slaveReady.bootFlag ? "TRUE" : "FALSE");
         //
-        masterPrint("_slaveReady.sensorStatus = ");
-        Serial.println(twin->_slaveReady.sensorStatus ? "WORKING" : "BROKEN");
+        masterPrintln("_slaveReady.sensorStatus = %s", twin->_slaveReady.sensorStatus ? "WORKING" : "BROKEN");
         //
-        masterPrint("_slaveReady.position = ");
-        Serial.println(twin->_slaveReady.position);
+        masterPrintln("_slaveReady.position = %d", (int)twin->_slaveReady.position);
         //
-        masterPrint("");
-        Serial.println(twin->_slaveReady.ready ? "Slave is ready" : "Slave is busy, ignore command");
+        masterPrintln("%s", twin->_slaveReady.ready ? "Slave is ready" : "Slave is busy, ignore command");
         }
     #endif
 }
@@ -180,7 +172,11 @@ esp_err_t i2c_probe_device(I2Caddress address) {
  * @return false
  */
 bool takeI2CSemaphore() {
-    if (xSemaphoreTake(g_i2c_mutex, pdMS_TO_TICKS(50))) {
+    const uint32_t start = micros();
+    const bool     taken = xSemaphoreTake(g_i2c_mutex, pdMS_TO_TICKS(50));
+    if (DataEvaluation)
+        DataEvaluation->recordMutexWait(micros() - start);                      // contention on the bus semaphore
+    if (taken) {
         #ifdef SEMAPHOREVERBOSE
             {
             TraceScope trace;                                                   // use semaphore to protect this block
@@ -251,18 +247,14 @@ esp_err_t pingI2Cslave(I2Caddress address) {
         #ifdef PINGVERBOSE
             {
             TraceScope trace;                                                   // use semaphore to protect this block
-            masterPrint("ping successful (pingI2Cslave) with 0x");
-            Serial.println(address, HEX);
+            masterPrintln("ping successful (pingI2Cslave) with 0x%02X", (unsigned)address);
             }
         #endif
     } else {
         #ifdef PINGVERBOSE
             {
             TraceScope trace;                                                   // use semaphore to protect this block
-            masterPrint("ping failed (pingI2Cslave) with 0x");
-            Serial.print(address, HEX);
-            Serial.print(" esp-error = ");
-            Serial.println(esp_err_to_name(ret));
+            masterPrintln("ping failed (pingI2Cslave) with 0x%02X esp-error = %s", (unsigned)address, esp_err_to_name(ret));
             }
             if (DataEvaluation && address != I2C_BASE_ADDRESS)
             DataEvaluation->increment(0, 0, 0, 1);                              // count I2C usage, 1 timeout
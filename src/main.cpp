@@ -41,7 +41,7 @@ void ligaSnapshotMutexInit();
 void setup() {
     traceSemaphore = xSemaphoreCreateMutex();                                   // Semaphore for trace messages
     flapRegistryMutexInit();                                                    // protect g_slaveRegistry before any task starts
-    ligaSnapshotMutexInit();                                                    // protect snap[]/snapshotIndex before any task starts
+    ligaSnapshotMutexInit();                                                    // writer lock of ligaSnapshotStores before any task starts
     g_masterBooted = true;                                                      // true, until first scan_i2c_bus
 
     masterIntroduction();                                                       // Wellcome to the world
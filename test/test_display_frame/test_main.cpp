@@ -0,0 +1,154 @@
+// Display frame (FlapRegistry::showFrame): all MOVE commands in one bus round, one ready schedule
+// for all moving modules, result written to the registry
+//
+//   pio test -e native -f test_display_frame
+#include <Arduino.h>
+#include <unity.h>
+#include <FlapGlobal.h>
+#include <vector>
+#include "VirtualFlap.h"
+#include "SlaveTwin.h"
+#include "FlapRegistry.h"
+#include "FlapTasks.h"
+#include "Parser.h"
+#include "i2cMaster.h"
+#include "ReadyScheduler.h"
+
+#define MODULES 4
+#define SPR 4096                                                                // steps per revolution
+#define MSPR 400                                                                // ms per revolution
+#define FLAPS 40
+
+void flapRegistryMutexInit();                                                   // defined in FlapRegistry.cpp
+
+static VirtualFlapFleet* fleet = nullptr;
+static VirtualFlapModule* modules[MODULES];
+
+static I2Caddress addressOf(int i) {
+    return I2Caddress(I2C_MINADR + i);
+}
+
+void setUp() {
+    if (traceSemaphore == nullptr) {
+        traceSemaphore = xSemaphoreCreateMutex();                               // what setup() provides
+        flapRegistryMutexInit();
+        initAddressPool();
+        i2csetup();                                                             // I2C mutex
+        Parser    = new ParserClass();
+        Register  = new FlapRegistry();
+        ReadyPoll = new ReadyScheduler();                                       // no readyPollTask: the waiting caller drives the wheel
+    }
+    fleet = new VirtualFlapFleet();
+    for (int i = 0; i < MODULES; ++i) {
+        VirtualFlapConfig c;
+        c.serialnumber = 0x56460101 + i;
+        c.stepsPerRev  = SPR;
+        c.msPerRev     = MSPR;
+        c.flaps        = FLAPS;
+        c.speedJitter  = 0;                                                     // exact motion times
+        modules[i]     = fleet->addModule(addressOf(i), c);
+
+        SlaveTwin* twin = new SlaveTwin(addressOf(i));
+        Twin[i]         = twin;
+        twin->askSlaveAboutParameter(twin->_parameter);
+        twin->_parameter.steps = SPR;                                           // what step and speed measurement store
+        twin->_parameter.speed = MSPR;
+        twin->_numberOfFlaps = twin->_parameter.flaps;
+        twin->calculateStepsPerFlap();
+        twin->createQueue();                                                    // no twin task: queued commands stay queued
+    }
+    for (int i = 0; i < MODULES; ++i)
+        Register->updateRegistry(addressOf(i), Twin[i]->_parameter);
+    fleet->resetCounters();
+}
+
+void tearDown() {
+    for (int i = 0; i < MODULES; ++i) {
+        delete g_slaveRegistry[addressOf(i)];
+        delete Twin[i];
+        Twin[i] = nullptr;
+    }
+    g_slaveRegistry.clear();
+    delete fleet;
+    fleet = nullptr;
+}
+
+static std::vector<FlapFrameEntry> frameOf(const int* targets) {
+    std::vector<FlapFrameEntry> frame;
+    for (int i = 0; i < MODULES; ++i)
+        frame.push_back({addressOf(i), targets[i]});
+    return frame;
+}
+
+// all flaps move at once: the frame takes about as long as one move, not the sum of all moves
+void test_frame_moves_all_flaps() {
+    uint32_t start = millis();
+    Twin[0]->showFlap(FLAPS / 2);                                               // classic path as reference
+    const uint32_t single = millis() - start;
+    fleet->resetCounters();
+
+    const int targets[MODULES] = {0, FLAPS / 4, FLAPS / 2, 3};
+    start                      = millis();
+    TEST_ASSERT_EQUAL(MODULES, Register->showFrame(frameOf(targets)));
+    const uint32_t elapsed = millis() - start;
+
+    TEST_ASSERT_EQUAL_UINT32(MODULES, fleet->commandCount(MOVE));
+    TEST_ASSERT_LESS_THAN(2 * single, elapsed);                                 // one after the other: MODULES * single
+    for (int i = 0; i < MODULES; ++i) {
+        TEST_ASSERT_EQUAL(targets[i], Twin[i]->_flapNumber);
+        TEST_ASSERT_EQUAL(modules[i]->position(), Twin[i]->_slaveReady.position);
+        TEST_ASSERT_EQUAL(modules[i]->position(), g_slaveRegistry[addressOf(i)]->position);
+    }
+}
+
+// flaps already shown and unknown addresses are left out, no MOVE is sent for them
+void test_frame_skips_shown_and_unknown() {
+    const int targets[MODULES] = {0, 5, 0, 0};
+    std::vector<FlapFrameEntry> frame = frameOf(targets);
+    frame.push_back({addressOf(MODULES), 7});                                   // no twin registered
+    TEST_ASSERT_EQUAL(1, Register->showFrame(frame));
+    TEST_ASSERT_EQUAL_UINT32(1, fleet->commandCount(MOVE));
+    TEST_ASSERT_EQUAL(5, Twin[1]->_flapNumber);
+}
+
+// a busy twin gets its entry through the queue, a queued show-flap is superseded by the frame
+void test_frame_busy_twin_and_superseded_queue() {
+    TEST_ASSERT_TRUE(Twin[0]->sendQueue(TwinCommand{TWIN_SHOW_FLAP, 9, nullptr}));
+    TEST_ASSERT_TRUE(Twin[1]->tryLockCommands(0));                              // twin 1 runs a command
+    const int targets[MODULES] = {2, 6, 0, 0};
+    TEST_ASSERT_EQUAL(1, Register->showFrame(frameOf(targets)));
+    Twin[1]->unlockCommands();
+
+    TEST_ASSERT_EQUAL_UINT32(1, Twin[0]->queueCoalesced());                     // flap 9 would undo the frame
+    TEST_ASSERT_EQUAL(2, Twin[0]->_flapNumber);
+    TEST_ASSERT_EQUAL_UINT8(1, Twin[1]->queueDepth());                          // caught up by the twin task
+    TEST_ASSERT_EQUAL(0, Twin[1]->_flapNumber);
+}
+
+// the Parser only posts the frame, a frame that has not started yet is replaced by the newer one
+void test_post_frame_keeps_newest() {
+    const int first[MODULES]  = {1, 2, 3, 4};
+    const int second[MODULES] = {5, 6, 7, 8};
+    TEST_ASSERT_FALSE(Register->postFrame(frameOf(first)));                     // no Frame task: Parser uses the queues
+
+    g_frameHandle = xTaskGetCurrentTaskHandle();                                // this task plays the Frame task
+    TEST_ASSERT_TRUE(Register->postFrame(frameOf(first)));
+    TEST_ASSERT_TRUE(Register->postFrame(frameOf(second)));
+    TEST_ASSERT_EQUAL_UINT32(2, ulTaskNotifyTake(pdTRUE, 0));
+    std::vector<FlapFrameEntry> frame;
+    TEST_ASSERT_TRUE(Register->takeFrame(frame));
+    TEST_ASSERT_EQUAL(MODULES, frame.size());
+    TEST_ASSERT_EQUAL(6, frame[1].targetFlap);
+    TEST_ASSERT_FALSE(Register->takeFrame(frame));                              // one frame for both wakeups
+    TEST_ASSERT_EQUAL_UINT32(0, fleet->commandCount(MOVE));                     // nothing moved by posting
+    g_frameHandle = nullptr;
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_frame_moves_all_flaps);
+    RUN_TEST(test_frame_skips_shown_and_unknown);
+    RUN_TEST(test_frame_busy_twin_and_superseded_queue);
+    RUN_TEST(test_post_frame_keeps_newest);
+    return UNITY_END();
+}
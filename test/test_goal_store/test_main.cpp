@@ -0,0 +1,134 @@
+// LiveGoalStore (Liga.h): goal IDs announced once per goal, per-match index of goalsInfos[]
+//
+//   pio test -e native -f test_goal_store
+#include <Arduino.h>
+#include <unity.h>
+#include "Liga.h"
+
+static LiveGoalStore store;
+
+void setUp() {
+    store = LiveGoalStore();
+    store.beginCycle();
+}
+
+void tearDown() {
+    store.beginCycle();                                                         // goalsInfos[] empty for the next test
+}
+
+// a goal is new in the cycle it appears, known in every later one
+void test_goal_new_once() {
+    TEST_ASSERT_EQUAL(GOAL_NEW, store.admit(7001));
+    store.beginCycle();
+    TEST_ASSERT_EQUAL(GOAL_KNOWN, store.admit(7001));
+    TEST_ASSERT_EQUAL(GOAL_NEW, store.admit(7002));
+    store.beginCycle();
+    TEST_ASSERT_EQUAL(GOAL_KNOWN, store.admit(7001));
+    TEST_ASSERT_EQUAL(GOAL_KNOWN, store.admit(7002));
+    TEST_ASSERT_EQUAL_UINT32(0, store.duplicates());
+}
+
+// the same goal twice in one body is a duplicate
+void test_goal_duplicate_in_cycle() {
+    TEST_ASSERT_EQUAL(GOAL_NEW, store.admit(7001));
+    TEST_ASSERT_EQUAL(GOAL_DUPLICATE, store.admit(7001));
+    store.beginCycle();
+    TEST_ASSERT_EQUAL(GOAL_KNOWN, store.admit(7001));
+    TEST_ASSERT_EQUAL(GOAL_DUPLICATE, store.admit(7001));
+    TEST_ASSERT_EQUAL_UINT32(2, store.duplicates());
+}
+
+// goalID 0 (missing in the body) is never announced
+void test_goal_without_id() {
+    TEST_ASSERT_EQUAL(GOAL_KNOWN, store.admit(0));
+    TEST_ASSERT_EQUAL(GOAL_KNOWN, store.admit(0));
+    TEST_ASSERT_EQUAL_UINT32(0, store.duplicates());
+}
+
+// latest() points to the last entry of a match, add() fills goalsInfos[] in order
+void test_latest_per_match() {
+    LiveMatchGoalInfo* a = store.add(1101);
+    LiveMatchGoalInfo* b = store.add(1102);
+    LiveMatchGoalInfo* c = store.add(1101);
+    TEST_ASSERT_EQUAL_PTR(&goalsInfos[0], a);
+    TEST_ASSERT_EQUAL_PTR(&goalsInfos[1], b);
+    TEST_ASSERT_EQUAL_PTR(&goalsInfos[2], c);
+    TEST_ASSERT_EQUAL(3, liveGoalCount);
+    TEST_ASSERT_EQUAL_PTR(c, store.latest(1101));
+    TEST_ASSERT_EQUAL_PTR(b, store.latest(1102));
+    TEST_ASSERT_NULL(store.latest(1103));
+    TEST_ASSERT_NULL(store.add(0));
+
+    store.beginCycle();                                                         // index is per cycle
+    TEST_ASSERT_EQUAL(0, liveGoalCount);
+    TEST_ASSERT_NULL(store.latest(1101));
+}
+
+// add() stops at MAX_GOALS_PER_MATCHDAY
+void test_add_full() {
+    for (int g = 0; g < MAX_GOALS_PER_MATCHDAY; ++g)
+        TEST_ASSERT_NOT_NULL(store.add(1101 + g % 9));
+    TEST_ASSERT_NULL(store.add(1101));
+    TEST_ASSERT_EQUAL(MAX_GOALS_PER_MATCHDAY, liveGoalCount);
+}
+
+// an incomplete body is rolled back, the index shows the entries before it again
+void test_rollback() {
+    store.add(1101);
+    LiveMatchGoalInfo* kept = store.add(1102);
+    store.add(1102);
+    store.add(1103);
+    store.rollback(2);
+    TEST_ASSERT_EQUAL(2, liveGoalCount);
+    TEST_ASSERT_EQUAL_PTR(kept, store.latest(1102));
+    TEST_ASSERT_NULL(store.latest(1103));
+    TEST_ASSERT_EQUAL_UINT32(0, goalsInfos[2].matchID);
+
+    store.rollback(0);
+    TEST_ASSERT_EQUAL(0, liveGoalCount);
+    TEST_ASSERT_NULL(store.latest(1101));
+}
+
+// a long live phase: slots of goals no longer streamed are reused, goals still streamed stay known
+void test_seen_set_reuses_stale_slots() {
+    uint32_t next = 8000;
+    TEST_ASSERT_EQUAL(GOAL_NEW, store.admit(7001));
+    for (int cycle = 0; cycle < 200; ++cycle) {
+        store.beginCycle();
+        TEST_ASSERT_EQUAL(GOAL_KNOWN, store.admit(7001));                       // streamed in every cycle
+        for (int g = 0; g < 3; ++g)
+            TEST_ASSERT_EQUAL(GOAL_NEW, store.admit(next++));                   // far more IDs than GOAL_SEEN_SLOTS
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, store.duplicates());
+}
+
+// a full set of fresh goals drops the goals streamed longest ago, goals still streamed stay known
+void test_seen_set_full() {
+    for (uint32_t id = 1000; id < 1000 + GOAL_SEEN_SLOTS - 28; ++id)
+        TEST_ASSERT_EQUAL(GOAL_NEW, store.admit(id));                           // earlier match, no longer streamed
+    store.beginCycle();
+    for (uint32_t id = 2000; id < 2028; ++id)
+        TEST_ASSERT_EQUAL(GOAL_NEW, store.admit(id));                           // set is full now
+    store.beginCycle();
+    TEST_ASSERT_EQUAL(GOAL_NEW, store.admit(3000));                             // no empty, no stale slot
+    for (int cycle = 0; cycle < 3; ++cycle) {
+        for (uint32_t id = 2000; id < 2028; ++id)
+            TEST_ASSERT_EQUAL(GOAL_KNOWN, store.admit(id));                     // not announced again
+        TEST_ASSERT_EQUAL(cycle ? GOAL_KNOWN : GOAL_DUPLICATE, store.admit(3000));
+        store.beginCycle();
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, store.duplicates());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_goal_new_once);
+    RUN_TEST(test_goal_duplicate_in_cycle);
+    RUN_TEST(test_goal_without_id);
+    RUN_TEST(test_latest_per_match);
+    RUN_TEST(test_add_full);
+    RUN_TEST(test_rollback);
+    RUN_TEST(test_seen_set_reuses_stale_slots);
+    RUN_TEST(test_seen_set_full);
+    return UNITY_END();
+}
@@ -0,0 +1,133 @@
+// Typed decoding (JsonStream.h): path hashes of the field tables and jsonDecode() into plain structs
+//
+//   pio test -e native -f test_json_decode
+#include <Arduino.h>
+#include <unity.h>
+#include <string.h>
+#include "JsonStream.h"
+
+struct Row {
+    uint8_t  place;                                                             // 1 byte member
+    uint16_t points;                                                            // 2 byte member
+    int32_t  goalDiff;                                                          // 4 byte member, negative
+    bool     finished;
+    char     name[8];                                                           // truncated to 7 characters
+    char     shortName[8];                                                      // null -> ""
+};
+
+struct RowDecoder {
+    typedef Row                Record;
+    static constexpr uint32_t  record   = jsonPath("[]");
+    static constexpr JsonField fields[] = {
+        JSON_FIELD("[].place", Row, place),
+        JSON_FIELD("[].points", Row, points),
+        JSON_FIELD("[].goalDiff", Row, goalDiff),
+        JSON_FIELD("[].finished", Row, finished),
+        JSON_FIELD("[].team.name", Row, name),
+        JSON_FIELD("[].team.shortName", Row, shortName),
+    };
+};
+
+struct RowSink {
+    Row rows[4];
+    int count   = 0;
+    int skipped = 0;                                                            // values without field
+};
+
+static void decodeRows(JsonStream& json, JsonStreamEvent event, void* context) {
+    RowSink& sink = *(RowSink*)context;
+    if (json.pathHash() == RowDecoder::record) {
+        if (event == JSON_OBJECT_BEGIN)
+            memset(&sink.rows[sink.count], 0, sizeof(Row));
+        else if (event == JSON_OBJECT_END)
+            sink.count++;
+        return;
+    }
+    if (event == JSON_VALUE && !jsonDecode<RowDecoder>(json, sink.rows[sink.count]))
+        sink.skipped++;
+}
+
+void setUp() {}
+void tearDown() {}
+
+struct HashProbe {
+    const char* path;                                                           // at() syntax
+    bool        seen  = false;
+    bool        equal = true;                                                   // pathHash() == jsonPath(path) every time
+};
+
+static void compareHashes(JsonStream& json, JsonStreamEvent event, void* context) {
+    HashProbe* probes = (HashProbe*)context;
+    if (event != JSON_VALUE)
+        return;
+    for (HashProbe* p = probes; p->path; ++p) {
+        if (json.at(p->path)) {
+            p->seen = true;
+            p->equal &= json.pathHash() == jsonPath(p->path);
+        }
+    }
+}
+
+// the running path hash of the parser equals the compile-time hash of the same path
+void test_path_hash_matches() {
+    static_assert(jsonPath("") == JSON_PATH_ROOT, "root value");
+    static_assert(jsonPath("[].a") != jsonPath("[].b"), "different keys");
+    const char* body = "{\"groupOrderID\":5,\"goals\":[{\"goalID\":1},{\"goalID\":2}],\"team1\":{\"teamName\":\"SCF\"}}";
+    HashProbe   probes[5];
+    probes[0].path = "groupOrderID";
+    probes[1].path = "goals[].goalID";
+    probes[2].path = "team1.teamName";
+    probes[3].path = "";
+    probes[4].path = nullptr;
+    JsonStream json;
+    json.begin(compareHashes, probes);
+    TEST_ASSERT_TRUE(json.feed(body, strlen(body)));
+    TEST_ASSERT_TRUE(json.finish());
+    for (int i = 0; i < 3; ++i) {
+        TEST_ASSERT_TRUE(probes[i].seen);
+        TEST_ASSERT_TRUE(probes[i].equal);
+    }
+    TEST_ASSERT_FALSE(probes[3].seen);                                          // no scalar at the root
+}
+
+// every member type is written through its table entry, undeclared values are skipped
+void test_decode_members() {
+    const char* body =
+        "[{\"place\":1,\"points\":300,\"goalDiff\":-7,\"finished\":true,\"team\":{\"name\":\"Borussia Dortmund\",\"shortName\":null},\"extra\":1},"
+        "{\"place\":18,\"points\":0,\"goalDiff\":0,\"finished\":false,\"team\":{\"name\":\"SCF\",\"shortName\":\"SCF\"}}]";
+    RowSink    sink;
+    JsonStream json;
+    json.begin(decodeRows, &sink);
+    TEST_ASSERT_TRUE(json.feed(body, strlen(body)));
+    TEST_ASSERT_TRUE(json.finish());
+
+    TEST_ASSERT_EQUAL(2, sink.count);
+    TEST_ASSERT_EQUAL(1, sink.skipped);                                         // "extra"
+    TEST_ASSERT_EQUAL(1, sink.rows[0].place);
+    TEST_ASSERT_EQUAL(300, sink.rows[0].points);
+    TEST_ASSERT_EQUAL(-7, sink.rows[0].goalDiff);
+    TEST_ASSERT_TRUE(sink.rows[0].finished);
+    TEST_ASSERT_EQUAL_STRING("Borussi", sink.rows[0].name);
+    TEST_ASSERT_EQUAL_STRING("", sink.rows[0].shortName);
+    TEST_ASSERT_EQUAL(18, sink.rows[1].place);
+    TEST_ASSERT_FALSE(sink.rows[1].finished);
+    TEST_ASSERT_EQUAL_STRING("SCF", sink.rows[1].shortName);
+}
+
+// the table entry records offset and size of the member
+void test_field_layout() {
+    TEST_ASSERT_EQUAL(offsetof(Row, points), RowDecoder::fields[1].offset);
+    TEST_ASSERT_EQUAL(sizeof(uint16_t), RowDecoder::fields[1].size);
+    TEST_ASSERT_EQUAL(JSON_FIELD_INT, RowDecoder::fields[2].type);
+    TEST_ASSERT_EQUAL(JSON_FIELD_BOOL, RowDecoder::fields[3].type);
+    TEST_ASSERT_EQUAL(JSON_FIELD_TEXT, RowDecoder::fields[4].type);
+    TEST_ASSERT_EQUAL(8, RowDecoder::fields[4].size);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_path_hash_matches);
+    RUN_TEST(test_decode_members);
+    RUN_TEST(test_field_layout);
+    return UNITY_END();
+}
@@ -0,0 +1,150 @@
+// JsonStream (JsonStream.h): incremental parse of chunked openLigaDB bodies, paths, escapes, limits
+//
+//   pio test -e native -f test_json_stream
+#include <Arduino.h>
+#include <unity.h>
+#include <string>
+#include "JsonStream.h"
+
+static const char* matchday =
+    "[{\"matchID\":1101,\"team1\":{\"teamName\":\"FC Bayern M\\u00fcnchen\"},\"team2\":{\"teamName\":\"1. FC K\\u00f6ln\"},"
+    "\"goals\":[{\"goalID\":1,\"scoreTeam1\":1,\"scoreTeam2\":0,\"isPenalty\":true},"
+    "{\"goalID\":2,\"scoreTeam1\":1,\"scoreTeam2\":1,\"goalGetterName\":null}],\"matchIsFinished\":false},"
+    "{\"matchID\":1102,\"team1\":{\"teamName\":\"SC Freiburg\"},\"team2\":{\"teamName\":\"VfB Stuttgart\"},"
+    "\"goals\":[],\"matchIsFinished\":true}]";
+
+// everything a handler can see of the values, one line per value
+static void collect(JsonStream& json, JsonStreamEvent event, void* context) {
+    std::string& out = *(std::string*)context;
+    if (event != JSON_VALUE)
+        return;
+    out += std::to_string(json.index(0)) + ":" + json.key() + "=" + json.text() + (json.isString() ? "$" : "") + "\n";
+}
+
+static std::string parseInChunks(const char* body, size_t chunk, bool& ok) {
+    std::string out;
+    JsonStream  json;
+    json.begin(collect, &out);
+    const size_t len = strlen(body);
+    ok               = true;
+    for (size_t pos = 0; pos < len && ok; pos += chunk)
+        ok = json.feed(body + pos, std::min(chunk, len - pos));
+    ok = ok && json.finish();
+    return out;
+}
+
+void setUp() {}
+void tearDown() {}
+
+// chunk boundaries inside keys, strings, numbers and literals do not change the values
+void test_chunk_boundaries() {
+    bool              ok    = false;
+    const std::string whole = parseInChunks(matchday, 4096, ok);
+    TEST_ASSERT_TRUE(ok);
+    for (size_t chunk : {1, 2, 3, 7, 100}) {
+        const std::string split = parseInChunks(matchday, chunk, ok);
+        TEST_ASSERT_TRUE(ok);
+        TEST_ASSERT_EQUAL_STRING(whole.c_str(), split.c_str());
+    }
+    TEST_ASSERT_TRUE(whole.find("0:matchID=1101\n") != std::string::npos);
+    TEST_ASSERT_TRUE(whole.find("1:matchIsFinished=true\n") != std::string::npos);
+    TEST_ASSERT_TRUE(whole.find("0:goalGetterName=null\n") != std::string::npos);
+}
+
+// \uXXXX escapes arrive as UTF-8
+void test_unicode_escape() {
+    bool              ok  = false;
+    const std::string out = parseInChunks(matchday, 5, ok);
+    TEST_ASSERT_TRUE(ok);
+    TEST_ASSERT_TRUE(out.find("0:teamName=FC Bayern M\xc3\xbcnchen$\n") != std::string::npos);
+    TEST_ASSERT_TRUE(out.find("0:teamName=1. FC K\xc3\xb6ln$\n") != std::string::npos);
+}
+
+struct GoalProbe {
+    int  goals    = 0;                                                          // goals[].goalID seen
+    int  lastHome = -1;                                                         // goals[].scoreTeam1 of last goal
+    bool penalty  = false;                                                      // goals[].isPenalty
+    int  objects  = 0;                                                          // completed goal objects
+};
+
+static void probeGoals(JsonStream& json, JsonStreamEvent event, void* context) {
+    GoalProbe& p = *(GoalProbe*)context;
+    if (event == JSON_OBJECT_END && json.at("[].goals[]"))
+        p.objects++;
+    if (event != JSON_VALUE)
+        return;
+    if (json.at("[].goals[].goalID"))
+        p.goals++;
+    else if (json.at("[].goals[].scoreTeam1"))
+        p.lastHome = (int)json.asLong();
+    else if (json.at("[].goals[].isPenalty"))
+        p.penalty |= json.asBool();
+}
+
+// at() matches every array index, object ends carry the path of the object
+void test_paths() {
+    GoalProbe  probe;
+    JsonStream json;
+    json.begin(probeGoals, &probe);
+    TEST_ASSERT_TRUE(json.feed(matchday, strlen(matchday)));
+    TEST_ASSERT_TRUE(json.finish());
+    TEST_ASSERT_EQUAL(2, probe.goals);
+    TEST_ASSERT_EQUAL(2, probe.objects);
+    TEST_ASSERT_EQUAL(1, probe.lastHome);
+    TEST_ASSERT_TRUE(probe.penalty);
+    TEST_ASSERT_EQUAL(strlen(matchday), json.bytes());
+}
+
+// values longer than JSON_STREAM_VALUE_LEN are truncated, not overflowing
+void test_long_value_truncated() {
+    std::string body = "{\"comment\":\"" + std::string(300, 'x') + "\"}";
+    std::string value;                                                          // text, "~" appended if truncated
+    JsonStream  json;
+    json.begin(
+        [](JsonStream& j, JsonStreamEvent e, void* c) {
+            if (e == JSON_VALUE)
+                *(std::string*)c = std::string(j.text()) + (j.isTruncated() ? "~" : "");
+        },
+        &value);
+    TEST_ASSERT_TRUE(json.feed(body.data(), body.size()));
+    TEST_ASSERT_TRUE(json.finish());
+    TEST_ASSERT_EQUAL(JSON_STREAM_VALUE_LEN - 1 + 1, value.size());
+    TEST_ASSERT_EQUAL('~', value.back());
+}
+
+// syntax errors stick, an incomplete body is not finished
+void test_errors() {
+    bool ok = true;
+    parseInChunks("[{\"matchID\":1101,}]", 3, ok);
+    TEST_ASSERT_FALSE(ok);
+    parseInChunks("[{\"matchID\":1101}", 3, ok);                                // body cut off
+    TEST_ASSERT_FALSE(ok);
+    parseInChunks("[1] [2]", 3, ok);                                            // two root values
+    TEST_ASSERT_FALSE(ok);
+    parseInChunks("42", 1, ok);                                                 // number as root, ends with the body
+    TEST_ASSERT_TRUE(ok);
+}
+
+// nesting deeper than JSON_STREAM_MAX_DEPTH is rejected
+void test_depth_limit() {
+    std::string deep(JSON_STREAM_MAX_DEPTH, '[');
+    deep += std::string(JSON_STREAM_MAX_DEPTH, ']');
+    bool ok = false;
+    parseInChunks(deep.c_str(), 2, ok);
+    TEST_ASSERT_TRUE(ok);
+    std::string tooDeep(JSON_STREAM_MAX_DEPTH + 1, '[');
+    tooDeep += std::string(JSON_STREAM_MAX_DEPTH + 1, ']');
+    parseInChunks(tooDeep.c_str(), 2, ok);
+    TEST_ASSERT_FALSE(ok);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_chunk_boundaries);
+    RUN_TEST(test_unicode_escape);
+    RUN_TEST(test_paths);
+    RUN_TEST(test_long_value_truncated);
+    RUN_TEST(test_errors);
+    RUN_TEST(test_depth_limit);
+    return UNITY_END();
+}
@@ -0,0 +1,104 @@
+// I2C latency histograms (FlapStatistics.h): log2 buckets, interpolated percentiles, slots per address
+//
+//   pio test -e native -f test_latency_histogram
+#include <Arduino.h>
+#include <unity.h>
+#include <FlapGlobal.h>
+#include "FlapStatistics.h"
+
+static LatencyHistogram empty() {
+    LatencyHistogram h;
+    h.clear();
+    return h;
+}
+
+void setUp() {}
+void tearDown() {}
+
+// bucket 0 is below LATENCY_FIRST_BUCKET_US, every further bucket doubles, the last one is open
+void test_bucket_bounds() {
+    LatencyHistogram h = empty();
+    for (uint32_t us : {0u, 127u, 128u, 255u, 256u, 1023u, 1024u, 1000000u})
+        h.add(us);
+    TEST_ASSERT_EQUAL_UINT32(2, h.bucket[0]);
+    TEST_ASSERT_EQUAL_UINT32(2, h.bucket[1]);                                   // 128..255
+    TEST_ASSERT_EQUAL_UINT32(1, h.bucket[2]);                                   // 256..511
+    TEST_ASSERT_EQUAL_UINT32(1, h.bucket[3]);                                   // 512..1023
+    TEST_ASSERT_EQUAL_UINT32(1, h.bucket[4]);                                   // 1024..2047
+    TEST_ASSERT_EQUAL_UINT32(1, h.bucket[LATENCY_BUCKETS - 1]);                 // one second
+    TEST_ASSERT_EQUAL_UINT32(8, h.count);
+    TEST_ASSERT_EQUAL_UINT32(1000000, h.maxUs);
+}
+
+// percentiles are interpolated inside their bucket and never exceed the slowest value
+void test_percentile_interpolated() {
+    LatencyHistogram h = empty();
+    TEST_ASSERT_EQUAL_UINT32(0, h.percentile(50));
+    for (int i = 0; i < 90; ++i)
+        h.add(300);                                                             // bucket 256..511
+    for (int i = 0; i < 10; ++i)
+        h.add(3000);                                                            // bucket 2048..4095
+    TEST_ASSERT_EQUAL_UINT32(256 + 256 * 50 / 90, h.percentile(50));
+    TEST_ASSERT_EQUAL_UINT32(2048 + (3000 - 2048) * 5 / 10, h.percentile(95));
+    TEST_ASSERT_EQUAL_UINT32(3000, h.percentile(100));
+}
+
+// merge adds buckets and keeps the larger maximum
+void test_merge() {
+    LatencyHistogram a = empty(), b = empty();
+    a.add(100);
+    b.add(200);
+    b.add(5000);
+    a.merge(b);
+    TEST_ASSERT_EQUAL_UINT32(3, a.count);
+    TEST_ASSERT_EQUAL_UINT32(1, a.bucket[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, a.bucket[1]);
+    TEST_ASSERT_EQUAL_UINT32(5000, a.maxUs);
+}
+
+// each address gets its own slot in order of appearance, types are kept apart and merged per type
+void test_slots_per_address() {
+    FlapStatistics   stats;
+    LatencyHistogram byType[LAT_TYPES];
+    I2Caddress       address = 0;
+    stats.recordLatency(0x20, LAT_LONG, 400);
+    stats.recordLatency(0x21, LAT_PROBE, 150);
+    stats.recordLatency(0x20, LAT_PROBE, 160);
+    stats.recordLatency(0, LAT_SHORT, 100);                                     // no address, not recorded
+    stats.recordMutexWait(2000);
+
+    TEST_ASSERT_TRUE(stats.latencyBySlot(0, address, byType));
+    TEST_ASSERT_EQUAL_HEX8(0x20, address);
+    TEST_ASSERT_EQUAL_UINT32(1, byType[LAT_LONG].count);
+    TEST_ASSERT_EQUAL_UINT32(1, byType[LAT_PROBE].count);
+    TEST_ASSERT_TRUE(stats.latencyBySlot(1, address, byType));
+    TEST_ASSERT_EQUAL_HEX8(0x21, address);
+    TEST_ASSERT_FALSE(stats.latencyBySlot(2, address, byType));
+
+    stats.latencyByType(byType);
+    TEST_ASSERT_EQUAL_UINT32(2, byType[LAT_PROBE].count);
+    TEST_ASSERT_EQUAL_UINT32(0, byType[LAT_SHORT].count);
+    LatencyHistogram wait;
+    stats.mutexWait(wait);
+    TEST_ASSERT_EQUAL_UINT32(2000, wait.maxUs);
+}
+
+// addresses beyond LATENCY_ADDRESSES slots are dropped, not mixed into other slots
+void test_slots_full() {
+    FlapStatistics stats;
+    for (int a = 0; a <= LATENCY_ADDRESSES; ++a)
+        stats.recordLatency(I2Caddress(0x10 + a), LAT_SHORT, 100);
+    LatencyHistogram byType[LAT_TYPES];
+    stats.latencyByType(byType);
+    TEST_ASSERT_EQUAL_UINT32(LATENCY_ADDRESSES, byType[LAT_SHORT].count);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_bucket_bounds);
+    RUN_TEST(test_percentile_interpolated);
+    RUN_TEST(test_merge);
+    RUN_TEST(test_slots_per_address);
+    RUN_TEST(test_slots_full);
+    return UNITY_END();
+}
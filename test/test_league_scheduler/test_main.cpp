@@ -0,0 +1,156 @@
+// LeagueScheduler (LeagueScheduler.h): state swap per league, due order and request budget of the leagues not shown
+//
+//   pio test -e native -f test_league_scheduler
+#include <Arduino.h>
+#include <unity.h>
+#include <FlapGlobal.h>
+#include <thread>
+#include "NativeShim.h"
+#include "Liga.h"
+#include "LigaSession.h"
+#include "LeagueScheduler.h"
+
+#define EPOCH 1758979800                                                        // Sa 27.09.2025 15:30 CEST
+
+static esp_err_t ignoreBody(esp_http_client_event_t* evt) {
+    (void)evt;
+    return ESP_OK;
+}
+
+// requests of a poll cycle, counted by openLigaDB
+static void sendRequests(int count) {
+    for (int i = 0; i < count; ++i)
+        openLigaDB.get("https://api.openligadb.de/getbltable/bl2/2025", ignoreBody);
+}
+
+// view lock of the Report task, taken from another task
+static bool reportMayRead() {
+    bool owned = false;
+    std::thread report([&] {
+        LeagueViewLock lock;
+        owned = (bool)lock;
+    });
+    report.join();
+    return owned;
+}
+
+void setUp() {
+    if (traceSemaphore == nullptr) {
+        traceSemaphore = xSemaphoreCreateMutex();                               // what setup() provides
+        nativeClockStartVirtual(EPOCH);                                         // delay() moves millis() at once
+        nativeHttpSetResponder([](const std::string&, std::string& body) {
+            body = "[]";
+            return 200;
+        });
+    }
+    openLigaDB.pacer().configure(LIGA_PACE_INTERVAL_MS, LIGA_PACE_BURST);       // full budget
+    activeLeague = League::BL1;
+    ligaLeagues  = LeagueScheduler();
+    ligaLeagues.begin();
+}
+void tearDown() {}
+
+// every league keeps its own globals, a league not shown is loaded under the view lock
+void test_state_swap() {
+    TEST_ASSERT_TRUE(ligaLeague == League::BL1);
+    ligaMatchday    = 5;
+    currentPollMode = POLL_MODE_LIVE;
+
+    ligaLeagues.load(League::BL2);
+    TEST_ASSERT_TRUE(ligaLeague == League::BL2);
+    TEST_ASSERT_EQUAL(0, ligaMatchday);                                         // cold
+    TEST_ASSERT_EQUAL(LIGA2_MAX_TEAMS, ligaMaxTeams);
+    TEST_ASSERT_EQUAL(POLL_MODE_ONCE, currentPollMode);
+    TEST_ASSERT_EQUAL(POLL_MODE_LIVE, ligaLeagues.pollMode(League::BL1));       // from its stored state
+    TEST_ASSERT_FALSE(reportMayRead());
+    ligaMatchday = 7;
+
+    ligaLeagues.load(League::BL1);
+    TEST_ASSERT_TRUE(reportMayRead());
+    TEST_ASSERT_EQUAL(5, ligaMatchday);
+    TEST_ASSERT_EQUAL(LIGA1_MAX_TEAMS, ligaMaxTeams);
+    TEST_ASSERT_EQUAL(POLL_MODE_LIVE, currentPollMode);
+    TEST_ASSERT_EQUAL(POLL_MODE_ONCE, ligaLeagues.pollMode(League::BL2));
+
+    activeLeague = League::BL2;                                                 // toggle: BL2 is shown now
+    ligaLeagues.load(League::BL2);
+    TEST_ASSERT_TRUE(reportMayRead());
+    TEST_ASSERT_EQUAL(7, ligaMatchday);
+}
+
+// the league due first runs next, the shown league wins a tie
+void test_due_order() {
+    uint32_t wait = 1;
+    TEST_ASSERT_TRUE(ligaLeagues.next(wait) == League::BL1);                    // all due at start
+    TEST_ASSERT_EQUAL_UINT32(0, wait);
+    ligaLeagues.beginCycle(League::BL1);
+    ligaLeagues.endCycle(20000);
+
+    TEST_ASSERT_TRUE(ligaLeagues.next(wait) == League::BL2);
+    ligaLeagues.beginCycle(League::BL2);
+    ligaLeagues.endCycle(10000);
+    TEST_ASSERT_TRUE(ligaLeagues.next(wait) == League::BL3);
+    ligaLeagues.beginCycle(League::BL3);
+    ligaLeagues.endCycle(5000);
+
+    TEST_ASSERT_TRUE(ligaLeagues.next(wait) == League::BL3);                    // waits overlap
+    TEST_ASSERT_EQUAL_UINT32(5000, wait);
+    delay(10000);
+    TEST_ASSERT_TRUE(ligaLeagues.next(wait) == League::BL3);                    // longest overdue first
+    TEST_ASSERT_EQUAL_UINT32(0, wait);
+    ligaLeagues.beginCycle(League::BL3);
+    ligaLeagues.endCycle(10000);
+    TEST_ASSERT_TRUE(ligaLeagues.next(wait) == League::BL2);
+    ligaLeagues.beginCycle(League::BL2);
+    ligaLeagues.endCycle(10000);
+    delay(10000);                                                               // virtual clock: all three due at once
+    TEST_ASSERT_TRUE(ligaLeagues.next(wait) == League::BL1);
+    TEST_ASSERT_EQUAL_UINT32(2, ligaLeagues.cycles(League::BL2));
+
+    ligaLeagues.setTracked(0x01);                                               // only BL1
+    activeLeague = League::BL2;
+    ligaLeagues.beginCycle(League::BL2);
+    ligaLeagues.endCycle(60000);
+    TEST_ASSERT_TRUE(ligaLeagues.next(wait) == League::BL1);                    // BL3 not tracked
+    ligaLeagues.beginCycle(League::BL1);
+    ligaLeagues.endCycle(60000);
+    TEST_ASSERT_TRUE(ligaLeagues.next(wait) == League::BL2);                    // shown league is always polled
+}
+
+// the leagues not shown wait until the pacer holds the reserve of the shown league again
+void test_request_budget() {
+    uint32_t wait = 0;
+    ligaLeagues.beginCycle(League::BL1);
+    ligaLeagues.endCycle(30000);
+    ligaLeagues.beginCycle(League::BL2);
+    sendRequests(LIGA_PACE_BURST);                                              // budget used up, no wait yet
+    ligaLeagues.endCycle(0);
+    TEST_ASSERT_EQUAL_UINT32(LIGA_PACE_BURST, ligaLeagues.requests(League::BL2));
+
+    TEST_ASSERT_TRUE(ligaLeagues.next(wait) == League::BL2);                    // BL2 and BL3 postponed
+    TEST_ASSERT_EQUAL_UINT32(LIGA_SHOWN_RESERVE * LIGA_PACE_INTERVAL_MS, wait);
+    TEST_ASSERT_EQUAL_UINT32(2, ligaLeagues.postponed());
+    TEST_ASSERT_EQUAL(LIGA_SHOWN_RESERVE * LIGA_PACE_INTERVAL_MS, ligaLeagues.dueInMs(League::BL3));
+
+    ligaLeagues.beginCycle(League::BL1);
+    sendRequests(3);                                                            // shown league: paced, never postponed
+    ligaLeagues.endCycle(0);
+    TEST_ASSERT_TRUE(ligaLeagues.next(wait) == League::BL1);
+    TEST_ASSERT_EQUAL_UINT32(0, wait);
+    TEST_ASSERT_EQUAL_UINT32(4, ligaLeagues.postponed());                       // overdue again, budget still low
+
+    ligaLeagues.beginCycle(League::BL1);
+    ligaLeagues.endCycle(30000);
+    delay(LIGA_SHOWN_RESERVE * LIGA_PACE_INTERVAL_MS);                          // reserve is back
+    TEST_ASSERT_TRUE(ligaLeagues.next(wait) == League::BL2);
+    TEST_ASSERT_EQUAL_UINT32(0, wait);
+    TEST_ASSERT_EQUAL_UINT32(4, ligaLeagues.postponed());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_state_swap);
+    RUN_TEST(test_due_order);
+    RUN_TEST(test_request_budget);
+    return UNITY_END();
+}
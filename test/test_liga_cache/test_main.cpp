@@ -0,0 +1,138 @@
+// Conditional GET of LigaSession (getIfChanged): ETag/304, body hash fallback and one cache slot per handler
+//
+//   pio test -e native -f test_liga_cache
+#include <Arduino.h>
+#include <unity.h>
+#include <FlapGlobal.h>
+#include <string>
+#include "NativeShim.h"
+#include "LigaSession.h"
+
+static const char* tableUrl = "https://api.openligadb.de/getbltable/bl1/2025";
+
+static LigaSession* session = nullptr;
+static std::string  served;                                                     // body of the fake server
+
+struct Seen {
+    size_t bytes     = 0;                                                       // ON_DATA bytes
+    bool   finished  = false;                                                   // ON_FINISH seen
+    bool   unchanged = false;                                                   // session->unchanged() at ON_FINISH
+};
+static Seen seenA, seenB;
+static bool forgetOnFinish = false;                                             // handler could not use the body
+
+static esp_err_t record(esp_http_client_event_t* evt, Seen& seen) {
+    if (evt->event_id == HTTP_EVENT_ON_DATA)
+        seen.bytes += evt->data_len;
+    else if (evt->event_id == HTTP_EVENT_ON_FINISH) {
+        if (forgetOnFinish)
+            session->forget();
+        seen.finished  = true;
+        seen.unchanged = session->unchanged();
+    }
+    return ESP_OK;
+}
+static esp_err_t handlerA(esp_http_client_event_t* evt) {
+    return record(evt, seenA);
+}
+static esp_err_t handlerB(esp_http_client_event_t* evt) {
+    return record(evt, seenB);
+}
+
+static void serve(bool etag) {
+    nativeHttpSetResponder([](const std::string&, std::string& body) {
+        body = served;
+        return 200;
+    });
+    NativeHttpServerModel model;
+    model.etag = etag;
+    nativeHttpSetServerModel(model);
+}
+
+// request of handlerA, finished is false if the request failed
+static const Seen& getA(bool reuse = true) {
+    seenA = Seen();
+    if (session->getIfChanged(tableUrl, handlerA, nullptr, reuse) != ESP_OK)
+        seenA.finished = false;
+    return seenA;
+}
+
+void setUp() {
+    if (traceSemaphore == nullptr)
+        traceSemaphore = xSemaphoreCreateMutex();                               // what setup() provides
+    forgetOnFinish = false;
+    served         = "[{\"teamName\":\"SC Freiburg\",\"points\":9}]";
+    session        = new LigaSession("api.openligadb.de");
+    nativeHttpResetStats();
+}
+
+void tearDown() {
+    session->reset();
+    delete session;
+    session = nullptr;
+}
+
+// server with ETag: the second request is answered with 304 and carries no body
+void test_etag_not_modified() {
+    serve(true);
+    TEST_ASSERT_FALSE(getA().unchanged);                                        // first body is always processed
+    const Seen& second = getA();
+    TEST_ASSERT_TRUE(second.finished);
+    TEST_ASSERT_TRUE(second.unchanged);
+    TEST_ASSERT_EQUAL(0, second.bytes);
+    TEST_ASSERT_EQUAL_UINT32(1, session->notModified());
+    TEST_ASSERT_EQUAL_UINT32(1, nativeHttpStats().notModified);
+
+    served = "[{\"teamName\":\"SC Freiburg\",\"points\":10}]";                  // goal: new ETag, full body
+    const Seen& third = getA();
+    TEST_ASSERT_FALSE(third.unchanged);
+    TEST_ASSERT_EQUAL(served.size(), third.bytes);
+}
+
+// server without validators: the same body hashes equal, the handler may keep its data
+void test_body_hash_fallback() {
+    serve(false);
+    TEST_ASSERT_FALSE(getA().unchanged);
+    const Seen& second = getA();
+    TEST_ASSERT_TRUE(second.finished);
+    TEST_ASSERT_TRUE(second.unchanged);
+    TEST_ASSERT_EQUAL(served.size(), second.bytes);                             // body is still streamed
+    TEST_ASSERT_EQUAL_UINT32(0, session->notModified());
+
+    served += " ";
+    TEST_ASSERT_FALSE(getA().unchanged);
+}
+
+// two handlers on the same url own separate slots, each processes the body once
+void test_slot_per_handler() {
+    serve(true);
+    getA();
+    seenB = Seen();
+    TEST_ASSERT_EQUAL(ESP_OK, session->getIfChanged(tableUrl, handlerB));
+    TEST_ASSERT_FALSE(seenB.unchanged);
+    TEST_ASSERT_EQUAL(served.size(), seenB.bytes);
+    TEST_ASSERT_TRUE(getA().unchanged);
+}
+
+// reuse = false or forget() force the next full body
+void test_no_reuse_and_forget() {
+    serve(true);
+    getA();
+    TEST_ASSERT_FALSE(getA(false).unchanged);                                   // data of the handler is outdated
+    TEST_ASSERT_TRUE(getA().unchanged);
+
+    forgetOnFinish = true;
+    TEST_ASSERT_FALSE(getA().unchanged);
+    forgetOnFinish = false;
+    TEST_ASSERT_FALSE(getA().unchanged);                                        // no fingerprint left
+    TEST_ASSERT_TRUE(getA().unchanged);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_etag_not_modified);
+    RUN_TEST(test_body_hash_fallback);
+    RUN_TEST(test_slot_per_handler);
+    RUN_TEST(test_no_reuse_and_forget);
+    return UNITY_END();
+}
@@ -0,0 +1,143 @@
+// LigaSnapshotStore (Liga.h): concurrent readers against the writer, every copy must be one whole table
+//
+//   pio test -e native -f test_liga_snapshot
+#include <Arduino.h>
+#include <unity.h>
+#include <FlapGlobal.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "Liga.h"
+
+#define STRESS_MS 1000                                                          // writer publishes for this long
+#define READERS 4
+#define TEAMS 18
+
+// every field of the table carries the version it was published with
+static void fillTable(LigaSnapshot& snap, uint32_t version) {
+    snap.season       = 2025;
+    snap.matchday     = version % 34 + 1;
+    snap.fetchedAtUTC = version;
+    snap.teamCount    = TEAMS;
+    for (uint8_t i = 0; i < TEAMS; ++i) {
+        LigaRow& row = snap.rows[i];
+        row.pos      = i + 1;
+        row.pkt      = version & 0xff;
+        row.g        = (version >> 8) & 0xff;
+        row.w        = (version >> 16) & 0xff;
+        snprintf(row.team, sizeof(row.team), "Team %u v%lu", i, (unsigned long)version);
+        snprintf(row.dfb, sizeof(row.dfb), "T%02u", i);
+        if (i % 4 == 0)
+            std::this_thread::yield();                                          // let readers run while the slot is written
+    }
+}
+
+// true if the copy is the table published as version
+static bool isWhole(const LigaSnapshot& snap, uint32_t version) {
+    if (version == 0)
+        return snap.teamCount == 0;                                             // nothing published yet
+    if (snap.fetchedAtUTC != version || snap.teamCount != TEAMS || snap.matchday != version % 34 + 1)
+        return false;
+    char team[MAX_TEAMNAME_LENGTH];
+    for (uint8_t i = 0; i < TEAMS; ++i) {
+        const LigaRow& row = snap.rows[i];
+        snprintf(team, sizeof(team), "Team %u v%lu", i, (unsigned long)version);
+        if (row.pos != i + 1 || row.pkt != (version & 0xff) || row.g != ((version >> 8) & 0xff) || row.w != ((version >> 16) & 0xff) ||
+            strcmp(row.team, team) != 0)
+            return false;
+    }
+    return true;
+}
+
+void setUp() {
+    ligaMaxTeams = LIGA3_MAX_TEAMS;
+}
+void tearDown() {}
+
+// readers copy while the writer publishes: no torn table, versions never go backwards
+void test_concurrent_readers() {
+    LigaSnapshotStore     store;
+    std::atomic<bool>     done{false};
+    std::atomic<uint32_t> reads{0}, torn{0}, backwards{0}, during{0};
+    std::atomic<uint32_t> published{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < READERS; ++r) {
+        readers.emplace_back([&] {
+            LigaSnapshot copy;
+            uint32_t     last = 0;
+            while (!done.load()) {
+                const uint32_t version = store.read(copy);
+                if (!isWhole(copy, version))
+                    torn++;
+                if (version < last)
+                    backwards++;
+                last = version;
+                reads++;
+                if (version != 0 && !done.load())
+                    during++;                                                   // read overlapped the writer
+                std::this_thread::yield();                                      // one core: writer gets its share
+            }
+        });
+    }
+    std::thread writer([&] {
+        const uint32_t start = millis();
+        for (uint32_t v = 1; millis() - start < STRESS_MS; ++v) {
+            fillTable(store.build(), v);
+            store.publish();
+            published = v;
+        }
+        done = true;
+    });
+    writer.join();
+    for (std::thread& t : readers)
+        t.join();
+
+    TEST_ASSERT_EQUAL_UINT32(0, torn.load());
+    TEST_ASSERT_EQUAL_UINT32(0, backwards.load());
+    TEST_ASSERT_TRUE(during.load() > 0);
+    TEST_ASSERT_TRUE(published.load() > 1);
+    TEST_ASSERT_EQUAL_UINT32(published.load(), store.version());
+    LigaSnapshot last;
+    TEST_ASSERT_EQUAL_UINT32(published.load(), store.read(last));
+    TEST_ASSERT_TRUE(isWhole(last, published.load()));
+    printf("published %lu, reads %lu, during writes %lu, retries %lu\n", (unsigned long)published.load(), (unsigned long)reads.load(),
+           (unsigned long)during.load(), (unsigned long)store.retries());
+}
+
+// writer side: current/previous roles, keep() and clear()
+void test_roles_keep_clear() {
+    LigaSnapshotStore store;
+    LigaSnapshot      copy;
+    TEST_ASSERT_EQUAL_UINT32(0, store.read(copy));
+
+    fillTable(store.build(), 1);
+    store.publish();
+    fillTable(store.build(), 2);
+    store.publish();
+    TEST_ASSERT_EQUAL_UINT32(2, store.current().fetchedAtUTC);
+    TEST_ASSERT_EQUAL_UINT32(1, store.previous().fetchedAtUTC);
+
+    store.keep();                                                               // unchanged table
+    TEST_ASSERT_EQUAL_UINT32(2, store.previous().fetchedAtUTC);
+    TEST_ASSERT_EQUAL_UINT32(2, store.read(copy));
+    TEST_ASSERT_TRUE(isWhole(copy, 2));
+
+    fillTable(store.build(), 3);                                                // back slot is not the current one
+    TEST_ASSERT_EQUAL_UINT32(2, store.read(copy));
+    TEST_ASSERT_TRUE(isWhole(copy, 2));
+    store.publish();
+    TEST_ASSERT_EQUAL_UINT32(3, store.read(copy));
+
+    store.clear();                                                              // league changed
+    TEST_ASSERT_EQUAL_UINT32(4, store.read(copy));
+    TEST_ASSERT_EQUAL(0, copy.teamCount);
+    TEST_ASSERT_EQUAL(0, store.previous().teamCount);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_concurrent_readers);
+    RUN_TEST(test_roles_keep_clear);
+    return UNITY_END();
+}
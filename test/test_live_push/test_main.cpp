@@ -0,0 +1,142 @@
+// LivePush (LivePush.h): coalescing of goals, table changes and module moves into SSE events, slow subscribers
+//
+//   pio test -e native -f test_live_push
+#include <Arduino.h>
+#include <unity.h>
+#include <FlapGlobal.h>
+#include <string>
+#include "NativeShim.h"
+#include "Liga.h"
+#include "LivePush.h"
+
+#define SETTLE_MS (PUSH_COALESCE_MS * 4)                                        // one burst is sent after this
+
+static AsyncWebServer    web(80);
+static LivePush*         push   = nullptr;
+static AsyncEventSource* source = nullptr;
+
+static void pushTask(void* parameter) {
+    ((LivePush*)parameter)->run();
+}
+
+// events of a subscriber as "event data" lines, "hello" left out
+static std::string eventsOf(AsyncEventSourceClient* client) {
+    std::string out;
+    for (const String& message : client->messages) {
+        std::string text  = message.c_str();
+        size_t      event = text.find("event: ");
+        size_t      data  = text.find("data: ");
+        if (event == std::string::npos || data == std::string::npos)
+            continue;
+        std::string name = text.substr(event + 7, text.find('\n', event) - event - 7);
+        if (name != "hello")
+            out += name + " " + text.substr(data + 6, text.find('\n', data) - data - 6) + "\n";
+    }
+    return out;
+}
+
+static LiveMatchGoalInfo makeGoal(uint32_t goalID, uint8_t minute, const char* player) {
+    LiveMatchGoalInfo goal;
+    goal.clear();
+    goal.goalID        = goalID;
+    goal.matchID       = 1101;
+    goal.goalMinute    = minute;
+    goal.scoreTeam1    = 1;
+    goal.scoringTeam   = "SC Freiburg";
+    goal.scoringPlayer = player;
+    goal.isPenalty     = true;
+    return goal;
+}
+
+static LigaRow makeRow(const char* dfb) {
+    LigaRow row;
+    memset(&row, 0, sizeof(row));
+    snprintf(row.dfb, sizeof(row.dfb), "%s", dfb);
+    return row;
+}
+
+void setUp() {
+    if (push != nullptr)
+        return;
+    if (traceSemaphore == nullptr)
+        traceSemaphore = xSemaphoreCreateMutex();                               // what setup() provides
+    push = new LivePush();
+    push->attach(web);
+    source = (AsyncEventSource*)web.webHandlers().front();
+    xTaskCreate(pushTask, "LivePush", 4096, push, 1, nullptr);
+    delay(10);                                                                  // task waits for the first change
+}
+
+void tearDown() {}
+
+// without subscribers the burst is dropped, a new subscriber starts with hello
+void test_no_subscribers() {
+    const uint32_t messages = push->messages();
+    push->moduleMoved(0x21, 5);
+    delay(SETTLE_MS);
+    TEST_ASSERT_EQUAL_UINT32(messages, push->messages());
+
+    AsyncEventSourceClient* client = source->connect();
+    TEST_ASSERT_EQUAL_UINT32(1, push->subscribers());
+    TEST_ASSERT_EQUAL(1, client->messages.size());
+    TEST_ASSERT_TRUE(client->messages[0].indexOf("event: hello\n") >= 0);
+    TEST_ASSERT_TRUE(client->messages[0].indexOf("retry: 3000\n") >= 0);
+    client->close();
+    TEST_ASSERT_EQUAL_UINT32(0, push->subscribers());
+}
+
+// one burst: every goal, one table event (first old, last new team), all moves in one modules event
+void test_burst_coalesced() {
+    AsyncEventSourceClient* client = source->connect();
+    const LigaRow           bay    = makeRow("BAY");
+    const LigaRow           bvb    = makeRow("BVB");
+    const LigaRow           scf    = makeRow("SCF");
+
+    push->goal(makeGoal(7, 23, "Vincenzo \"Enzo\" Grifo"));
+    push->tableChange(PUSH_LEADER, &bay, &bvb);
+    push->tableChange(PUSH_LEADER, &bvb, &scf);
+    for (int round = 0; round < 6; ++round)
+        for (uint8_t m = 0; m < 5; ++m)
+            push->moduleMoved(0x21 + m, round * 5 + m);
+    delay(SETTLE_MS);
+
+    const std::string events = eventsOf(client);
+    TEST_ASSERT_EQUAL_STRING(
+        "goal {\"match\":1101,\"goal\":7,\"minute\":23,\"score\":\"1:0\",\"flags\":2,\"team\":\"SC Freiburg\",\"player\":\"Vincenzo \\\"Enzo\\\" Grifo\"}\n"
+        "table {\"leader\":[\"BAY\",\"SCF\"]}\n"
+        "modules [[33,25],[34,26],[35,27],[36,28],[37,29]]\n",
+        events.c_str());
+
+    client->messages.clear();
+    delay(SETTLE_MS);
+    TEST_ASSERT_EQUAL(0, client->messages.size());                              // nothing changed, nothing sent
+    client->close();
+}
+
+// more goals than PUSH_GOAL_QUEUE send resync, a subscriber that does not drain is closed
+void test_overflow_and_slow_client() {
+    AsyncEventSourceClient* fast = source->connect();
+    AsyncEventSourceClient* slow = source->connect();
+    slow->slow                   = true;
+    const uint32_t dropped       = push->dropped();
+
+    for (uint32_t i = 0; i < PUSH_GOAL_QUEUE + 4; ++i)
+        push->goal(makeGoal(100 + i, 80, "Ritsu Doan"));
+    delay(SETTLE_MS);
+
+    const std::string events = eventsOf(fast);
+    TEST_ASSERT_TRUE(events.find("\"goal\":115,") != std::string::npos);        // last goal of the queue
+    TEST_ASSERT_TRUE(events.find("\"goal\":116,") == std::string::npos);
+    TEST_ASSERT_TRUE(events.find("resync {\"reason\":\"goals\"}\n") != std::string::npos);
+    TEST_ASSERT_EQUAL_UINT32(dropped + 1, push->dropped());
+    TEST_ASSERT_EQUAL_UINT32(1, push->subscribers());                           // slow one is gone
+    fast->close();
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_no_subscribers);
+    RUN_TEST(test_burst_coalesced);
+    RUN_TEST(test_overflow_and_slow_client);
+    return UNITY_END();
+}
@@ -0,0 +1,165 @@
+// LiveTable (Liga.h): rank key order, re-rank of the touched rows and moves against recalcLiveTable()
+//
+//   pio test -e native -f test_live_table
+#include <Arduino.h>
+#include <unity.h>
+#include <FlapGlobal.h>
+#include <string>
+#include "Liga.h"
+#include "TeamIndex.h"
+
+#define TEAMS 6
+
+enum { FCB, BVB, RBL, T3, T4, T5 };                                             // row of DFB1[i] in the base table
+
+static LigaSnapshot base;
+
+static void setRow(LigaRow& row, int team, uint8_t pos, uint8_t pkt, uint8_t g, uint8_t og) {
+    row.pos     = pos;
+    row.sp      = 10;
+    row.pkt     = pkt;
+    row.g       = g;
+    row.og      = og;
+    row.diff    = g - og;
+    row.teamIdx = (int8_t)teamIndexOf(DFB1[team].key);
+    snprintf(row.team, sizeof(row.team), "%s", DFB1[team].key);
+    snprintf(row.dfb, sizeof(row.dfb), "%s", DFB1[team].code);
+}
+
+// rows out of order; ties on points, on difference and (T3/T4) on everything but the name
+static void makeBase() {
+    base.clear();
+    base.teamCount = TEAMS;
+    setRow(base.rows[0], T5, 1, 3, 2, 20);                                      // negative difference
+    setRow(base.rows[1], RBL, 2, 18, 12, 7);                                    // as BVB but fewer goals
+    setRow(base.rows[2], T4, 3, 15, 10, 10);
+    setRow(base.rows[3], FCB, 4, 20, 20, 5);
+    setRow(base.rows[4], BVB, 5, 18, 15, 10);
+    setRow(base.rows[5], T3, 6, 15, 10, 10);
+}
+
+// one live match, the goal entry carries the current score
+static void liveScore(uint32_t matchID, int team1, int team2, uint8_t score1, uint8_t score2) {
+    ligaLiveMatchCount     = 1;
+    liveMatches[0].matchID = matchID;
+    liveMatches[0].team1   = DFB1[team1].key;
+    liveMatches[0].team2   = DFB1[team2].key;
+
+    LiveMatchGoalInfo* goal = liveGoals.add(matchID);                           // like storeStreamGoal()
+    goal->goalID            = liveGoalCount;
+    goal->scoreTeam1        = score1;
+    goal->scoreTeam2        = score2;
+}
+
+// order, positions and counters equal the full recalculation
+static bool sameAsFull(const LiveTable& live) {
+    LigaSnapshot full;
+    if (!recalcLiveTable(base, full)) {
+        full = base;
+        sortSnapshot(full);
+    }
+    const LigaSnapshot& t = live.table();
+    for (uint8_t i = 0; i < TEAMS; ++i) {
+        const LigaRow& x = t.rows[i];
+        const LigaRow& y = full.rows[i];
+        if (strcmp(x.team, y.team) != 0 || x.pos != y.pos || x.sp != y.sp || x.pkt != y.pkt || x.diff != y.diff || x.g != y.g || x.og != y.og ||
+            x.w != y.w || x.d != y.d || x.l != y.l)
+            return false;
+    }
+    return true;
+}
+
+static const char* teamAt(const LiveTable& live, int row) {
+    return live.table().rows[row].team;
+}
+
+void setUp() {
+    ligaMaxTeams       = LIGA1_MAX_TEAMS;
+    ligaLiveMatchCount = 0;
+    liveGoals.beginCycle();
+    makeBase();
+}
+void tearDown() {}
+
+// a new base table is ranked by points, difference, goals, then name
+void test_rank_order() {
+    LiveTable live;
+    TEST_ASSERT_TRUE(live.update(base, 1));
+    const bool t3First = strcmp(DFB1[T3].key, DFB1[T4].key) < 0;
+    TEST_ASSERT_EQUAL_STRING(DFB1[FCB].key, teamAt(live, 0));
+    TEST_ASSERT_EQUAL_STRING(DFB1[BVB].key, teamAt(live, 1));                   // more goals than RBL
+    TEST_ASSERT_EQUAL_STRING(DFB1[RBL].key, teamAt(live, 2));
+    TEST_ASSERT_EQUAL_STRING(DFB1[t3First ? T3 : T4].key, teamAt(live, 3));
+    TEST_ASSERT_EQUAL_STRING(DFB1[t3First ? T4 : T3].key, teamAt(live, 4));
+    TEST_ASSERT_EQUAL_STRING(DFB1[T5].key, teamAt(live, 5));
+    for (uint8_t i = 0; i < TEAMS; ++i)
+        TEST_ASSERT_EQUAL(i + 1, live.table().rows[i].pos);
+    TEST_ASSERT_TRUE(sameAsFull(live));
+    TEST_ASSERT_EQUAL_UINT32(1, live.rebuilds());
+}
+
+// goals move only the rows that change place, the moves tell where they came from
+void test_rerank_moves() {
+    LiveTable live;
+    sortSnapshot(base);                                                         // openLigaDB delivers the table in order
+    live.update(base, 1);
+    TEST_ASSERT_EQUAL(0, live.moveCount());
+
+    liveScore(4711, RBL, FCB, 1, 0);                                            // RBL 21 points, first
+    TEST_ASSERT_TRUE(live.update(base, 1));
+    TEST_ASSERT_TRUE(sameAsFull(live));
+    TEST_ASSERT_EQUAL_STRING(DFB1[RBL].key, teamAt(live, 0));
+    TEST_ASSERT_EQUAL_STRING(DFB1[FCB].key, teamAt(live, 1));
+    TEST_ASSERT_EQUAL_STRING(DFB1[BVB].key, teamAt(live, 2));
+    TEST_ASSERT_EQUAL(3, live.moveCount());
+    TEST_ASSERT_EQUAL(0, live.move(0).row);
+    TEST_ASSERT_EQUAL(3, live.move(0).fromPos);
+    TEST_ASSERT_EQUAL(1, live.move(1).fromPos);
+
+    TEST_ASSERT_FALSE(live.update(base, 1));                                    // same score: nothing to do
+    TEST_ASSERT_EQUAL(0, live.moveCount());
+
+    liveScore(4711, RBL, FCB, 1, 1);                                            // equalizer: FCB 21, RBL 19
+    TEST_ASSERT_TRUE(live.update(base, 1));
+    TEST_ASSERT_TRUE(sameAsFull(live));
+    TEST_ASSERT_EQUAL_STRING(DFB1[FCB].key, teamAt(live, 0));
+    TEST_ASSERT_EQUAL_STRING(DFB1[RBL].key, teamAt(live, 1));
+    TEST_ASSERT_EQUAL(2, live.moveCount());
+    TEST_ASSERT_EQUAL(11, live.table().rows[1].sp);                             // result of the match counted once
+    TEST_ASSERT_EQUAL(13, live.table().rows[1].g);
+    TEST_ASSERT_EQUAL(1, live.table().rows[1].d);
+}
+
+// a match that leaves the live list takes its result out, a new base version is ranked again
+void test_match_ends_and_new_base() {
+    LiveTable live;
+    sortSnapshot(base);
+    live.update(base, 1);
+    liveScore(4712, T5, BVB, 3, 0);                                             // T5 6 points, still last
+    TEST_ASSERT_TRUE(live.update(base, 1));
+    TEST_ASSERT_EQUAL(2, live.moveCount());                                     // BVB difference 2, behind RBL
+    TEST_ASSERT_EQUAL_STRING(DFB1[RBL].key, teamAt(live, 1));
+    TEST_ASSERT_EQUAL(6, live.table().rows[5].pkt);
+
+    ligaLiveMatchCount = 0;                                                     // final whistle before the table poll
+    TEST_ASSERT_TRUE(live.update(base, 1));
+    TEST_ASSERT_TRUE(sameAsFull(live));
+    TEST_ASSERT_EQUAL(3, live.table().rows[5].pkt);
+    TEST_ASSERT_EQUAL_STRING(DFB1[BVB].key, teamAt(live, 1));
+
+    liveScore(4713, T4, FCB, 5, 0);                                             // T4 18 points like RBL, more goals
+    TEST_ASSERT_TRUE(live.update(base, 1));
+    TEST_ASSERT_TRUE(sameAsFull(live));
+    base.rows[0].pkt++;                                                         // table poll: new base version
+    TEST_ASSERT_TRUE(live.update(base, 2));
+    TEST_ASSERT_EQUAL_UINT32(2, live.rebuilds());
+    TEST_ASSERT_TRUE(sameAsFull(live));                                         // live result applied on top again
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_rank_order);
+    RUN_TEST(test_rerank_moves);
+    RUN_TEST(test_match_ends_and_new_base);
+    return UNITY_END();
+}
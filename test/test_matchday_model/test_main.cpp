@@ -0,0 +1,132 @@
+// MatchdayModel (MatchdayModel.h): one getmatchdata body of the matchday and the views derived from it
+//
+//   pio test -e native -f test_matchday_model
+#include <Arduino.h>
+#include <unity.h>
+#include <FlapGlobal.h>
+#include <string>
+#include "Liga.h"
+#include "MatchdayModel.h"
+
+#define T 1758979800                                                            // Sa 27.09.2025 15:30 CEST
+
+static MatchdayModel model;
+
+// kickoff as openLigaDB sends it (local time)
+static std::string kickoffOf(time_t t) {
+    char      buf[24];
+    struct tm tmKickoff;
+    localtime_r(&t, &tmKickoff);
+    strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%S", &tmKickoff);
+    return buf;
+}
+
+// Saturday of a matchday: two matches at 15:30, one at 18:30, one played on Friday
+static void loadSaturday() {
+    model.begin(5);
+    model.add(1100, kickoffOf(T - 22 * 3600).c_str(), true, "Bayer 04 Leverkusen", "FC Bayern München");
+    model.add(1101, kickoffOf(T).c_str(), false, "SC Freiburg", "VfB Stuttgart");
+    model.add(1102, kickoffOf(T).c_str(), false, "1. FC Köln", "");
+    model.add(1103, kickoffOf(T + 3 * 3600).c_str(), false, "Borussia Dortmund", "FC Augsburg");
+    model.end();
+}
+
+void setUp() {
+    model.clear();
+}
+
+void tearDown() {}
+
+// the body is kept with kickoffs as time_t, matchID 0 and a missing kickoff do not break it
+void test_body() {
+    const uint32_t cleared = model.version();
+    loadSaturday();
+    TEST_ASSERT_EQUAL(5, model.matchday());
+    TEST_ASSERT_EQUAL(4, model.count());
+    TEST_ASSERT_EQUAL(1, model.finishedCount());
+    TEST_ASSERT_EQUAL_UINT32(cleared + 1, model.version());
+    TEST_ASSERT_EQUAL(T, model.match(1).kickoff);
+    TEST_ASSERT_EQUAL_STRING("1. FC Köln", model.match(2).team1);
+
+    model.begin(6);
+    model.add(0, kickoffOf(T).c_str(), false, "no", "match");                   // skipped
+    model.add(1201, "", false, "Hamburger SV", "FC St. Pauli");                 // date not yet set
+    for (uint32_t id = 1202; id < 1202 + MAX_MATCHES_PER_MATCHDAY; ++id)
+        model.add(id, kickoffOf(T).c_str(), false, "A", "B");
+    model.end();
+    TEST_ASSERT_EQUAL(MAX_MATCHES_PER_MATCHDAY, model.count());                 // more matches than tracked
+    TEST_ASSERT_EQUAL(0, model.match(0).kickoff);
+    TEST_ASSERT_EQUAL(T, model.nextKickoff(T - 1));                             // no date: never next
+}
+
+// live: kicked off, not finished, at most MAX_MATCH_DURATION ago
+void test_live_matches() {
+    loadSaturday();
+    MatchInfo live[MAX_MATCHES_PER_MATCHDAY];
+    TEST_ASSERT_EQUAL(0, model.liveMatches(T - 1, live));
+    TEST_ASSERT_EQUAL(2, model.liveMatches(T, live));
+    TEST_ASSERT_EQUAL_UINT32(1101, live[0].matchID);
+    TEST_ASSERT_EQUAL_STRING("SC Freiburg", live[0].team1.c_str());
+    TEST_ASSERT_EQUAL_UINT32(1102, live[1].matchID);
+    TEST_ASSERT_EQUAL(2, model.liveMatches(T + MAX_MATCH_DURATION, live));
+    TEST_ASSERT_EQUAL(0, model.liveMatches(T + MAX_MATCH_DURATION + 1, live)); // no final whistle seen: dropped
+    TEST_ASSERT_EQUAL(1, model.liveMatches(T + 3 * 3600, live));
+    TEST_ASSERT_EQUAL_UINT32(1103, live[0].matchID);
+
+    const uint32_t version = model.version();
+    TEST_ASSERT_TRUE(model.matchFinished(1101));                                // final whistle
+    TEST_ASSERT_FALSE(model.matchFinished(1101));                               // seen before
+    TEST_ASSERT_FALSE(model.matchFinished(4711));                               // not in this matchday
+    TEST_ASSERT_EQUAL_UINT32(version + 1, model.version());
+    TEST_ASSERT_EQUAL(2, model.finishedCount());
+    TEST_ASSERT_EQUAL(1, model.liveMatches(T + 60, live));
+    TEST_ASSERT_EQUAL_UINT32(1102, live[0].matchID);
+}
+
+// next matches: nearest kickoff ahead, later kickoffs planned, empty team names replaced
+void test_next_matches() {
+    loadSaturday();
+    MatchInfo next[MAX_MATCHES_PER_MATCHDAY];
+    MatchInfo plan[MAX_MATCHES_PER_MATCHDAY];
+    uint8_t   planCount = 0;
+    TEST_ASSERT_EQUAL(2, model.nextMatches(T - 60, next, plan, planCount));
+    TEST_ASSERT_EQUAL(1, planCount);
+    TEST_ASSERT_EQUAL_STRING("Team B", next[1].team2.c_str());
+    TEST_ASSERT_EQUAL_UINT32(1103, plan[0].matchID);
+    TEST_ASSERT_EQUAL(T + 3 * 3600, plan[0].kickoff);
+
+    TEST_ASSERT_EQUAL(1, model.nextMatches(T, next, plan, planCount));          // 15:30 matches are past
+    TEST_ASSERT_EQUAL(0, planCount);
+    TEST_ASSERT_EQUAL_UINT32(1103, next[0].matchID);
+    TEST_ASSERT_EQUAL(0, model.nextMatches(T + 3 * 3600, next, plan, planCount));
+}
+
+// clock-driven changes of the views: kickoffs and ends of live windows
+void test_kickoff_queries() {
+    TEST_ASSERT_EQUAL(MATCHDAY_NEVER, model.nextKickoff(T));
+    TEST_ASSERT_EQUAL(MATCHDAY_NEVER, model.liveChangeAfter(T));
+    TEST_ASSERT_FALSE(model.pending(T));
+
+    loadSaturday();
+    TEST_ASSERT_EQUAL(T, model.nextKickoff(T - 3600));
+    TEST_ASSERT_EQUAL(T + 3 * 3600, model.nextKickoff(T));
+    TEST_ASSERT_EQUAL(T, model.liveChangeAfter(T - 1));
+    TEST_ASSERT_EQUAL(T + MAX_MATCH_DURATION, model.liveChangeAfter(T));        // end of the 15:30 live window
+    TEST_ASSERT_EQUAL(T + 3 * 3600, model.liveChangeAfter(T + MAX_MATCH_DURATION));
+    TEST_ASSERT_EQUAL(T + 3 * 3600 + MAX_MATCH_DURATION, model.liveChangeAfter(T + 3 * 3600));
+    TEST_ASSERT_TRUE(model.pending(T + 3 * 3600 + MAX_MATCH_DURATION - 1));
+    TEST_ASSERT_FALSE(model.pending(T + 3 * 3600 + MAX_MATCH_DURATION));
+
+    model.matchFinished(1103);
+    TEST_ASSERT_EQUAL(MATCHDAY_NEVER, model.nextKickoff(T));
+    TEST_ASSERT_FALSE(model.pending(T + MAX_MATCH_DURATION));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_body);
+    RUN_TEST(test_live_matches);
+    RUN_TEST(test_next_matches);
+    RUN_TEST(test_kickoff_queries);
+    return UNITY_END();
+}
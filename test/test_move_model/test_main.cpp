@@ -0,0 +1,105 @@
+// MoveModel (MoveModel.h): learned ETA factor from BUSY/READY answers, clamps and SPIFFS store
+//
+//   pio test -e native -f test_move_model
+#include <Arduino.h>
+#include <unity.h>
+#include <FlapGlobal.h>
+#include <SPIFFS.h>
+#include <unistd.h>
+#include "NativeShim.h"
+#include "MoveModel.h"
+
+#define ETA 1000                                                                // static ETA of the tests
+#define SERIAL_A 0x56460101
+#define SERIAL_B 0x56460102
+
+void setUp() {
+    if (traceSemaphore == nullptr)
+        traceSemaphore = xSemaphoreCreateMutex();                               // what setup() provides
+}
+void tearDown() {}
+
+// the model drives the first poll only after MOVE_MODEL_MIN_SAMPLES samples
+void test_predict_after_min_samples() {
+    MoveModel model;
+    for (int i = 0; i < MOVE_MODEL_MIN_SAMPLES; ++i) {
+        TEST_ASSERT_EQUAL_UINT32(0, model.predict(MOVE, ETA));
+        model.learn(MOVE, ETA, 650, 750);
+    }
+    TEST_ASSERT_EQUAL_UINT32(725, model.predict(MOVE, ETA));                    // 650 + 0.75 * (750 - 650)
+    TEST_ASSERT_EQUAL_UINT32(1450, model.predict(MOVE, 2 * ETA));               // factor, not fixed ms
+}
+
+// BUSY then READY: mean of the first samples, EWMA afterwards
+void test_busy_ready_fit() {
+    MoveModel model;
+    model.learn(MOVE, ETA, 650, 750);                                           // 0.725
+    model.learn(MOVE, ETA, 850, 950);                                           // 0.925, mean 0.825
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.825f, model.scale(MOVE));
+    for (int i = 0; i < 3; ++i)
+        model.learn(MOVE, ETA, 850, 950);
+    for (int i = 0; i < 20; ++i)
+        model.learn(MOVE, ETA, 450, 550);                                       // module became faster
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.525f, model.scale(MOVE));
+    TEST_ASSERT_EQUAL_UINT16(25, model.samples(MOVE));
+}
+
+// READY on the first probe only bounds the end of the move: take the bound and shrink a bit
+void test_ready_first_probe_shrinks() {
+    MoveModel model;
+    model.learn(MOVE, ETA, 0, 1200);                                            // bound above factor
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.0f - MOVE_MODEL_SHRINK, model.scale(MOVE));
+    model.learn(MOVE, ETA, 0, 800);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.8f * (1.0f - MOVE_MODEL_SHRINK), model.scale(MOVE));
+}
+
+// the factor stays within MIN/MAX scale, commands learn separately, others are not modelled
+void test_clamp_and_commands() {
+    MoveModel model;
+    model.learn(MOVE, ETA, 5000, 6000);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, MOVE_MODEL_MAX_SCALE, model.scale(MOVE));
+    model.learn(CALIBRATE, ETA, 0, 10);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, MOVE_MODEL_MIN_SCALE, model.scale(CALIBRATE));
+    TEST_ASSERT_EQUAL_UINT16(0, model.samples(SENSOR_CHECK));
+    model.learn(SET_OFFSET, ETA, 100, 200);
+    TEST_ASSERT_EQUAL_UINT16(0, model.samples(SET_OFFSET));
+    TEST_ASSERT_EQUAL_UINT32(0, model.predict(SET_OFFSET, ETA));
+}
+
+// the model of a module is saved per serial number and loaded again, another module starts fresh
+void test_store_per_serial() {
+    char dir[] = "/tmp/flapayrXXXXXX";
+    TEST_ASSERT_NOT_NULL(mkdtemp(dir));
+    nativeFsSetRoot(dir);
+    TEST_ASSERT_TRUE(SPIFFS.begin(true));
+
+    MoveModel model;
+    model.sync(SERIAL_A);                                                       // nothing stored yet
+    for (int i = 0; i < MOVE_MODEL_MIN_SAMPLES; ++i)
+        model.learn(MOVE, ETA, 650, 750);
+    model.sync(SERIAL_A);                                                       // first save is not delayed
+    TEST_ASSERT_TRUE(SPIFFS.exists("/ayr_56460101.bin"));
+
+    MoveModel reloaded;
+    reloaded.sync(SERIAL_A);
+    TEST_ASSERT_EQUAL_UINT16(MOVE_MODEL_MIN_SAMPLES, reloaded.samples(MOVE));
+    TEST_ASSERT_EQUAL_UINT32(725, reloaded.predict(MOVE, ETA));
+
+    reloaded.sync(SERIAL_B);                                                    // module swapped behind the twin
+    TEST_ASSERT_EQUAL_UINT16(0, reloaded.samples(MOVE));
+    TEST_ASSERT_EQUAL_UINT32(0, reloaded.predict(MOVE, ETA));
+
+    SPIFFS.remove("/ayr_56460101.bin");
+    nativeFsSetRoot(nullptr);
+    rmdir(dir);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_predict_after_min_samples);
+    RUN_TEST(test_busy_ready_fit);
+    RUN_TEST(test_ready_first_probe_shrinks);
+    RUN_TEST(test_clamp_and_commands);
+    RUN_TEST(test_store_per_serial);
+    return UNITY_END();
+}
@@ -0,0 +1,204 @@
+// Shim layer of the native build (NativeShim.h): RTOS queues and notifications, fake I2C bus,
+// fake esp_http_client and SPIFFS on a host directory
+//
+//   pio test -e native -f test_native_shim
+#include <Arduino.h>
+#include <unity.h>
+#include <SPIFFS.h>
+#include <unistd.h>
+#include <string>
+#include "NativeShim.h"
+#include "driver/i2c.h"
+#include "esp_http_client.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+
+void setUp() {}
+
+void tearDown() {
+    nativeHttpSetResponder(nullptr);
+}
+
+// ----------------------------
+// FreeRTOS
+
+// xQueueOverwrite() on a length-1 queue keeps only the latest item, like the twin command queue
+void test_queue_overwrite() {
+    QueueHandle_t q = xQueueCreate(1, sizeof(int));
+    int           v = 1;
+    TEST_ASSERT_EQUAL(pdPASS, xQueueOverwrite(q, &v));
+    v = 2;
+    TEST_ASSERT_EQUAL(pdPASS, xQueueOverwrite(q, &v));
+    TEST_ASSERT_EQUAL(1, uxQueueMessagesWaiting(q));
+    int out = 0;
+    TEST_ASSERT_EQUAL(pdTRUE, xQueueReceive(q, &out, 0));
+    TEST_ASSERT_EQUAL(2, out);
+    TEST_ASSERT_EQUAL(pdFALSE, xQueueReceive(q, &out, pdMS_TO_TICKS(10)));      // empty, times out
+    vQueueDelete(q);
+}
+
+static TaskHandle_t      waiter = nullptr;
+static volatile uint32_t taken  = 0;
+
+static void waitTask(void*) {
+    taken = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    vTaskDelete(nullptr);
+}
+
+// a notification wakes a task blocked in ulTaskNotifyTake()
+void test_task_notify() {
+    taken = 0;
+    xTaskCreate(waitTask, "waiter", 2048, nullptr, 1, &waiter);
+    vTaskDelay(pdMS_TO_TICKS(20));
+    TEST_ASSERT_EQUAL(0, taken);
+    xTaskNotifyGive(waiter);
+    for (int i = 0; i < 100 && taken == 0; ++i)
+        vTaskDelay(pdMS_TO_TICKS(5));
+    TEST_ASSERT_EQUAL(1, taken);
+}
+
+// ----------------------------
+// fake I2C bus
+
+// the attached device sees the written bytes without the address byte and fills the read
+void test_i2c_write_read() {
+    uint8_t seen[4] = {0};
+    size_t  seenLen = 0;
+    nativeI2cAttach(0x21, [&](NativeI2cTransfer& t) {
+        seenLen = t.writeLen;
+        memcpy(seen, t.write, t.writeLen < sizeof(seen) ? t.writeLen : sizeof(seen));
+        for (size_t i = 0; i < t.readLen; ++i)
+            t.read[i] = (uint8_t)(0xA0 + i);
+        return ESP_OK;
+    });
+
+    const uint32_t   before = nativeI2cTransactions();
+    uint8_t          cmd[2] = {0x11, 0x22};
+    uint8_t          answer[3];
+    i2c_cmd_handle_t link = i2c_cmd_link_create();
+    i2c_master_start(link);
+    i2c_master_write_byte(link, (0x21 << 1) | I2C_MASTER_WRITE, true);
+    i2c_master_write(link, cmd, sizeof(cmd), true);
+    i2c_master_start(link);
+    i2c_master_write_byte(link, (0x21 << 1) | I2C_MASTER_READ, true);
+    i2c_master_read(link, answer, sizeof(answer), I2C_MASTER_LAST_NACK);
+    i2c_master_stop(link);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_master_cmd_begin(I2C_NUM_0, link, pdMS_TO_TICKS(50)));
+    i2c_cmd_link_delete(link);
+
+    TEST_ASSERT_EQUAL(1, nativeI2cTransactions() - before);
+    TEST_ASSERT_EQUAL(2, seenLen);
+    TEST_ASSERT_EQUAL_HEX8(0x11, seen[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x22, seen[1]);
+    TEST_ASSERT_EQUAL_HEX8(0xA0, answer[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xA2, answer[2]);
+    nativeI2cDetach(0x21);
+}
+
+// an address without device gives no ACK
+void test_i2c_no_device() {
+    i2c_cmd_handle_t link = i2c_cmd_link_create();
+    i2c_master_start(link);
+    i2c_master_write_byte(link, (0x22 << 1) | I2C_MASTER_WRITE, true);
+    i2c_master_stop(link);
+    TEST_ASSERT_EQUAL(ESP_FAIL, i2c_master_cmd_begin(I2C_NUM_0, link, pdMS_TO_TICKS(50)));
+    i2c_cmd_link_delete(link);
+}
+
+// ----------------------------
+// fake esp_http_client
+
+struct HttpSink {
+    std::string body;                                                           // all ON_DATA bytes
+    int         chunks   = 0;                                                   // number of ON_DATA events
+    int         maxChunk = 0;                                                   // largest ON_DATA event
+    bool        finished = false;                                               // ON_FINISH seen
+};
+
+static esp_err_t sinkHandler(esp_http_client_event_t* evt) {
+    HttpSink* sink = (HttpSink*)evt->user_data;
+    if (evt->event_id == HTTP_EVENT_ON_DATA) {
+        sink->body.append((const char*)evt->data, evt->data_len);
+        sink->chunks++;
+        sink->maxChunk = evt->data_len > sink->maxChunk ? evt->data_len : sink->maxChunk;
+    } else if (evt->event_id == HTTP_EVENT_ON_FINISH) {
+        sink->finished = true;
+    }
+    return ESP_OK;
+}
+
+// the responder's body arrives in buffer_size chunks, followed by ON_FINISH
+void test_http_chunks() {
+    std::string requested;
+    nativeHttpSetResponder([&](const std::string& url, std::string& body) {
+        requested = url;
+        body.assign(1300, 'x');
+        return 200;
+    });
+    HttpSink                 sink;
+    esp_http_client_config_t config = {};
+    config.url                      = "https://api.openligadb.de/getbltable/bl1/2025";
+    config.event_handler            = sinkHandler;
+    config.user_data                = &sink;
+    config.buffer_size              = 512;
+    esp_http_client_handle_t client = esp_http_client_init(&config);
+    TEST_ASSERT_EQUAL(ESP_OK, esp_http_client_perform(client));
+    TEST_ASSERT_EQUAL(200, esp_http_client_get_status_code(client));
+    esp_http_client_cleanup(client);
+
+    TEST_ASSERT_EQUAL_STRING("https://api.openligadb.de/getbltable/bl1/2025", requested.c_str());
+    TEST_ASSERT_EQUAL(1300, sink.body.size());
+    TEST_ASSERT_EQUAL(3, sink.chunks);
+    TEST_ASSERT_EQUAL(512, sink.maxChunk);
+    TEST_ASSERT_TRUE(sink.finished);
+}
+
+// without responder there is no network
+void test_http_no_network() {
+    HttpSink                 sink;
+    esp_http_client_config_t config = {};
+    config.url                      = "https://api.openligadb.de/getbltable/bl1/2025";
+    config.event_handler            = sinkHandler;
+    config.user_data                = &sink;
+    esp_http_client_handle_t client = esp_http_client_init(&config);
+    TEST_ASSERT_EQUAL(ESP_ERR_HTTP_CONNECT, esp_http_client_perform(client));
+    esp_http_client_cleanup(client);
+    TEST_ASSERT_FALSE(sink.finished);
+}
+
+// ----------------------------
+// SPIFFS
+
+// a written file reads back through the host directory
+void test_spiffs_roundtrip() {
+    char dir[] = "/tmp/flapfsXXXXXX";
+    TEST_ASSERT_NOT_NULL(mkdtemp(dir));
+    nativeFsSetRoot(dir);
+    TEST_ASSERT_TRUE(SPIFFS.begin(true));
+
+    File out = SPIFFS.open("/TaskStatus.json", FILE_WRITE);
+    TEST_ASSERT_TRUE((bool)out);
+    out.print("{\"Uptime\":\"1\"}");
+    out.close();
+
+    TEST_ASSERT_TRUE(SPIFFS.exists("/TaskStatus.json"));
+    File in = SPIFFS.open("/TaskStatus.json", FILE_READ);
+    TEST_ASSERT_EQUAL_STRING("{\"Uptime\":\"1\"}", in.readString().c_str());
+    in.close();
+    TEST_ASSERT_TRUE(SPIFFS.remove("/TaskStatus.json"));
+    TEST_ASSERT_FALSE(SPIFFS.exists("/TaskStatus.json"));
+    nativeFsSetRoot(nullptr);
+    rmdir(dir);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_queue_overwrite);
+    RUN_TEST(test_task_notify);
+    RUN_TEST(test_i2c_write_read);
+    RUN_TEST(test_i2c_no_device);
+    RUN_TEST(test_http_chunks);
+    RUN_TEST(test_http_no_network);
+    RUN_TEST(test_spiffs_roundtrip);
+    return UNITY_END();
+}
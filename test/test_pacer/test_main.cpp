@@ -0,0 +1,132 @@
+// LigaPacer (LigaSession.h): token bucket of the openLigaDB requests on the virtual clock
+//
+//   pio test -e native -f test_pacer
+#include <Arduino.h>
+#include <unity.h>
+#include "NativeShim.h"
+#include "LigaSession.h"
+
+#define INTERVAL LIGA_PACE_INTERVAL_MS
+#define BURST LIGA_PACE_BURST
+
+static LigaPacer pacer(INTERVAL, BURST);
+
+static void sleepMs(uint32_t ms) {
+    vTaskDelay(pdMS_TO_TICKS(ms));                                              // virtual clock jumps
+}
+
+void setUp() {
+    if (!nativeClockIsVirtual())
+        nativeClockStartVirtual(1758979800);                                    // waits of acquire() take no host time
+    pacer = LigaPacer(INTERVAL, BURST);
+}
+
+void tearDown() {}
+
+// a full budget lets BURST requests go back-to-back, the next one waits one interval
+void test_burst_then_wait() {
+    for (int i = 0; i < BURST; ++i)
+        TEST_ASSERT_EQUAL_UINT32(0, pacer.acquire());
+    const uint32_t start = millis();
+    TEST_ASSERT_EQUAL_UINT32(INTERVAL, pacer.acquire());
+    TEST_ASSERT_EQUAL_UINT32(INTERVAL, millis() - start);
+    TEST_ASSERT_EQUAL_UINT32(1, pacer.throttled());
+    TEST_ASSERT_EQUAL_UINT32(INTERVAL, pacer.waitedMs());
+}
+
+// the budget grows back with time, at most to BURST requests
+void test_refill() {
+    for (int i = 0; i < BURST; ++i)
+        pacer.acquire();
+    sleepMs(INTERVAL * 2 + 500);
+    TEST_ASSERT_EQUAL_UINT32(0, pacer.acquire());
+    TEST_ASSERT_EQUAL_UINT32(0, pacer.acquire());
+    TEST_ASSERT_EQUAL_UINT32(INTERVAL - 500, pacer.acquire());
+    sleepMs(INTERVAL * BURST * 10);
+    for (int i = 0; i < BURST; ++i)
+        TEST_ASSERT_EQUAL_UINT32(0, pacer.acquire());
+    TEST_ASSERT_EQUAL_UINT32(INTERVAL, pacer.acquire());
+}
+
+// msUntil() plans a poll cycle without taking budget, asking for more than a burst waits for a full bucket
+void test_ms_until() {
+    TEST_ASSERT_EQUAL_UINT32(0, pacer.msUntil(BURST));
+    for (int i = 0; i < BURST; ++i)
+        pacer.acquire();
+    TEST_ASSERT_EQUAL_UINT32(INTERVAL, pacer.msUntil(1));
+    TEST_ASSERT_EQUAL_UINT32(3 * INTERVAL, pacer.msUntil(3));
+    TEST_ASSERT_EQUAL_UINT32(BURST * INTERVAL, pacer.msUntil(BURST + 4));
+    TEST_ASSERT_EQUAL_UINT32(INTERVAL, pacer.msUntil(1));                       // unchanged, nothing taken
+    sleepMs(INTERVAL + 500);
+    TEST_ASSERT_EQUAL_UINT32(0, pacer.msUntil(1));
+    TEST_ASSERT_EQUAL_UINT32(INTERVAL - 500, pacer.msUntil(2));
+}
+
+// refused(): double interval, no burst, time before the refusal is no credit
+void test_refused() {
+    for (int i = 0; i < BURST; ++i)
+        pacer.acquire();
+    sleepMs(INTERVAL - 500);                                                    // connect timeout of the refused request
+    pacer.refused();
+    TEST_ASSERT_EQUAL_UINT32(2 * INTERVAL, pacer.intervalMs());
+    TEST_ASSERT_EQUAL_UINT8(1, pacer.burst());
+    TEST_ASSERT_EQUAL_UINT32(1, pacer.refusals());
+    TEST_ASSERT_EQUAL_UINT32(2 * INTERVAL, pacer.msUntil(BURST));               // no bursts
+    TEST_ASSERT_EQUAL_UINT32(2 * INTERVAL, pacer.acquire());                    // full interval from the refusal on
+    sleepMs(10 * INTERVAL);
+    TEST_ASSERT_EQUAL_UINT32(0, pacer.acquire());
+    TEST_ASSERT_EQUAL_UINT32(2 * INTERVAL, pacer.acquire());                    // no bursts
+}
+
+// repeated refusals stop at LIGA_PACE_MAX_INTERVAL_MS
+void test_refused_max_interval() {
+    for (int i = 0; i < 20; ++i)
+        pacer.refused();
+    TEST_ASSERT_EQUAL_UINT32(LIGA_PACE_MAX_INTERVAL_MS, pacer.intervalMs());
+}
+
+// every LIGA_PACE_RECOVER answers halve the interval, the burst returns at the configured pace
+void test_answered_recovers() {
+    pacer.refused();
+    pacer.refused();
+    TEST_ASSERT_EQUAL_UINT32(4 * INTERVAL, pacer.intervalMs());
+    for (int i = 0; i < LIGA_PACE_RECOVER - 1; ++i)
+        pacer.answered();
+    TEST_ASSERT_EQUAL_UINT32(4 * INTERVAL, pacer.intervalMs());
+    pacer.answered();
+    TEST_ASSERT_EQUAL_UINT32(2 * INTERVAL, pacer.intervalMs());
+    TEST_ASSERT_EQUAL_UINT8(1, pacer.burst());
+    for (int i = 0; i < LIGA_PACE_RECOVER; ++i)
+        pacer.answered();
+    TEST_ASSERT_EQUAL_UINT32(INTERVAL, pacer.intervalMs());
+    TEST_ASSERT_EQUAL_UINT8(BURST, pacer.burst());
+    for (int i = 0; i < 3 * LIGA_PACE_RECOVER; ++i)
+        pacer.answered();                                                       // never faster than configured
+    TEST_ASSERT_EQUAL_UINT32(INTERVAL, pacer.intervalMs());
+}
+
+// configure() takes a new pace with a full budget
+void test_configure() {
+    pacer.refused();
+    pacer.configure(500, 3);
+    TEST_ASSERT_EQUAL_UINT32(500, pacer.intervalMs());
+    TEST_ASSERT_EQUAL_UINT8(3, pacer.burst());
+    for (int i = 0; i < 3; ++i)
+        TEST_ASSERT_EQUAL_UINT32(0, pacer.acquire());
+    TEST_ASSERT_EQUAL_UINT32(500, pacer.acquire());
+    pacer.configure(0, 0);                                                      // no zero pace
+    TEST_ASSERT_EQUAL_UINT32(1, pacer.intervalMs());
+    TEST_ASSERT_EQUAL_UINT8(1, pacer.burst());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_burst_then_wait);
+    RUN_TEST(test_refill);
+    RUN_TEST(test_ms_until);
+    RUN_TEST(test_refused);
+    RUN_TEST(test_refused_max_interval);
+    RUN_TEST(test_answered_recovers);
+    RUN_TEST(test_configure);
+    return UNITY_END();
+}
@@ -0,0 +1,238 @@
+// PollScheduler (PollScheduler.h): deadline heap, bootstrap cycle, kickoff schedule, live goals and back-off
+//
+//   pio test -e native -f test_poll_scheduler
+#include <Arduino.h>
+#include <unity.h>
+#include <FlapGlobal.h>
+#include <string>
+#include <vector>
+#include "Liga.h"
+#include "MatchdayModel.h"
+#include "PollScheduler.h"
+
+#define T 1758979800                                                            // Sa 27.09.2025 15:30 CEST
+
+static PollScheduler* polls = nullptr;
+
+struct Served {
+    uint32_t matchID;
+    time_t   kickoff;
+    bool     finished;
+};
+static std::vector<Served> served;                                              // getmatchdata body of the matchday
+static uint32_t            whistle = 0;                                         // final whistle seen by the next goal poll
+
+// what the Liga task does for a scope, without requests
+static void runScope(PollScope scope, time_t now) {
+    MatchInfo live[MAX_MATCHES_PER_MATCHDAY];
+    switch (scope) {
+        case CALC_CURRENT_SEASON:
+            ligaSeason = 2025;
+            break;
+        case FETCH_CURRENT_MATCHDAY:
+            ligaMatchday = 5;
+            break;
+        case FETCH_MATCHES:
+            ligaMatchdayModel.begin(ligaMatchday);
+            for (const Served& m : served) {
+                char      kickoff[24];
+                struct tm tmKickoff;
+                localtime_r(&m.kickoff, &tmKickoff);
+                strftime(kickoff, sizeof(kickoff), "%Y-%m-%dT%H:%M:%S", &tmKickoff);
+                ligaMatchdayModel.add(m.matchID, kickoff, m.finished, "Team A", "Team B");
+            }
+            ligaMatchdayModel.end();
+            break;
+        case CALC_LIVE_MATCHES:
+            ligaLiveMatchCount = ligaMatchdayModel.liveMatches(now, live);
+            break;
+        case CALC_NEXT_KICKOFF: {
+            const time_t kickoff = ligaMatchdayModel.nextKickoff(now);
+            nextKickoffChanged   = kickoff != POLL_NEVER && kickoff != currentNextKickoffTime;
+            if (nextKickoffChanged)
+                currentNextKickoffTime = kickoff;
+            break;
+        }
+        case FETCH_LIVE_GOALS:
+            if (whistle)
+                ligaMatchdayModel.matchFinished(whistle);
+            whistle = 0;
+            break;
+        default:
+            break;
+    }
+}
+
+// one poll cycle at now: pop and run every due scope
+static std::string runCycle(time_t now) {
+    std::string ran;
+    PollScope   scope;
+    polls->beginCycle();
+    while (polls->pop(now, scope)) {
+        runScope(scope, now);
+        ran += std::to_string(scope) + " ";
+        polls->done(scope, now);
+    }
+    return ran;
+}
+
+static std::string scopes(std::initializer_list<PollScope> list) {
+    std::string out;
+    for (PollScope s : list)
+        out += std::to_string(s) + " ";
+    return out;
+}
+
+// the heap top is the scope with the earliest deadline
+static bool topIsEarliest() {
+    time_t earliest = POLL_NEVER;
+    for (uint8_t s = 0; s < POLL_SCOPE_COUNT; ++s)
+        earliest = std::min(earliest, polls->deadline((PollScope)s));
+    return earliest == POLL_NEVER || polls->deadline(polls->nextScope()) == earliest;
+}
+
+void setUp() {
+    ligaSeason             = 0;
+    ligaMatchday           = 0;
+    ligaLiveMatchCount     = 0;
+    lastGoalID             = 0;
+    ligaConnectionRefused  = false;
+    currentMatchdayChanged = false;
+    currentNextKickoffTime = 0;
+    nextKickoffChanged     = false;
+    whistle                = 0;
+    served.clear();
+    ligaMatchdayModel.clear();
+    ligaNextMatchdayModel.clear();
+    polls = new PollScheduler();
+}
+
+void tearDown() {
+    delete polls;
+}
+
+// nothing known: season, matchday, matches, their views and table in cycle order, then the detectors once
+void test_bootstrap_cycle() {
+    const std::string ran      = runCycle(T);
+    const std::string expected = scopes({CALC_CURRENT_SEASON, FETCH_CURRENT_MATCHDAY, CHECK_FOR_CHANGES, FETCH_MATCHES, CALC_LIVE_MATCHES,
+                                         CALC_NEXT_MATCH_LIST, CALC_NEXT_KICKOFF, FETCH_TABLE, CALC_LEADER_CHANGE, CALC_RELEGATION_GHOST_CHANGE,
+                                         CALC_RED_LANTERN_CHANGE});
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), ran.c_str());
+    TEST_ASSERT_EQUAL_UINT32(POLL_RETRY_S * 1000, polls->waitMs(T));            // no table published yet
+    TEST_ASSERT_TRUE(polls->nextScope() == FETCH_TABLE);
+    TEST_ASSERT_EQUAL(T + POLL_IDLE_S, polls->deadline(CHECK_FOR_CHANGES));
+    TEST_ASSERT_EQUAL(T + POLL_IDLE_S, polls->deadline(FETCH_MATCHES));         // empty matchday: look again later
+    TEST_ASSERT_EQUAL(POLL_NEVER, polls->deadline(FETCH_LIVE_GOALS));
+    TEST_ASSERT_EQUAL(POLL_NEVER, polls->deadline(SHOW_NEXT_KICKOFF));
+    const std::string again = runCycle(T + 1);
+    TEST_ASSERT_EQUAL_STRING("", again.c_str());                                // nothing due
+}
+
+// deadlines follow the kickoffs of the matchday
+void test_kickoff_schedule() {
+    served = {{1101, T + 3 * 3600, false}, {1102, T + 1800, false}, {1100, T - 3600, true}};
+    runCycle(T);
+    TEST_ASSERT_EQUAL(T + 1800, currentNextKickoffTime);
+    TEST_ASSERT_EQUAL_UINT32(1, polls->runs(SHOW_NEXT_KICKOFF));
+    TEST_ASSERT_EQUAL(POLL_NEVER, polls->deadline(FETCH_MATCHES));              // changes come with CHECK_FOR_CHANGES
+    TEST_ASSERT_EQUAL(POLL_NEVER, polls->deadline(FETCH_CURRENT_MATCHDAY));
+    TEST_ASSERT_EQUAL(T + 1800, polls->deadline(CALC_LIVE_MATCHES));
+    TEST_ASSERT_EQUAL(T + 1800, polls->deadline(CALC_NEXT_MATCH_LIST));
+    TEST_ASSERT_EQUAL(T + 1800, polls->deadline(CALC_NEXT_KICKOFF));
+    TEST_ASSERT_EQUAL(T + 1800 - POLL_PRELIVE_CHECK_S, polls->deadline(CHECK_FOR_CHANGES));
+    TEST_ASSERT_EQUAL(POLL_MODE_PRELIVE, polls->mode(T));
+
+    currentMatchdayChanged = true;                                              // openLigaDB has news: body again now
+    const std::string ran  = runCycle(T + 1800 - POLL_PRELIVE_CHECK_S);
+    currentMatchdayChanged = false;
+    std::string expected   = scopes({FETCH_TABLE, CHECK_FOR_CHANGES, FETCH_MATCHES, CALC_LIVE_MATCHES, CALC_NEXT_MATCH_LIST, CALC_NEXT_KICKOFF});
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), ran.c_str());                    // table retry was due first
+    TEST_ASSERT_EQUAL_UINT32(0, polls->waitMs(T + 1800 - POLL_PRELIVE_CHECK_S)); // the table once more: next cycle
+    const std::string next = runCycle(T + 1800 - POLL_PRELIVE_CHECK_S);
+    expected               = scopes({FETCH_TABLE, CALC_LEADER_CHANGE, CALC_RELEGATION_GHOST_CHANGE, CALC_RED_LANTERN_CHANGE});
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), next.c_str());
+    TEST_ASSERT_EQUAL(T + 1800, polls->deadline(CALC_LIVE_MATCHES));            // same kickoffs, same deadlines
+    TEST_ASSERT_EQUAL(T + 1800 + MAX_MATCH_DURATION, ligaMatchdayModel.liveChangeAfter(T + 1800));
+    TEST_ASSERT_EQUAL(T + 3 * 3600, ligaMatchdayModel.nextKickoff(T + 1800));
+}
+
+// live: goals every POLL_GOALS_S, a new goal fetches the table now and once more later
+void test_live_goals() {
+    served = {{1101, T + 60, false}};
+    runCycle(T);
+
+    std::string ran      = runCycle(T + 60);                                    // goals never polled: due before the lists
+    std::string expected = scopes({CALC_LIVE_MATCHES, FETCH_LIVE_GOALS, CALC_NEXT_MATCH_LIST, CALC_NEXT_KICKOFF, FETCH_TABLE, CALC_LIVE_TABLE,
+                                   CALC_LEADER_CHANGE, CALC_RELEGATION_GHOST_CHANGE, CALC_RED_LANTERN_CHANGE});
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), ran.c_str());
+    TEST_ASSERT_EQUAL(1, ligaLiveMatchCount);
+    TEST_ASSERT_EQUAL(POLL_MODE_LIVE, polls->mode(T + 60));
+    TEST_ASSERT_EQUAL(T + 60 + POLL_GOALS_S, polls->deadline(FETCH_LIVE_GOALS));
+    TEST_ASSERT_EQUAL(T + 60 + MAX_MATCH_DURATION, polls->deadline(CALC_LIVE_MATCHES)); // no final whistle: drop it
+    TEST_ASSERT_EQUAL(POLL_NEVER, polls->deadline(CHECK_FOR_CHANGES));          // goal polls see every change
+
+    lastGoalID        = 7001;
+    const time_t goal = T + 60 + POLL_GOALS_S;
+    ran               = runCycle(goal);
+    expected = scopes({FETCH_LIVE_GOALS, FETCH_TABLE, CALC_LIVE_TABLE, CALC_LEADER_CHANGE, CALC_RELEGATION_GHOST_CHANGE, CALC_RED_LANTERN_CHANGE});
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), ran.c_str());
+    TEST_ASSERT_EQUAL(goal + POLL_TABLE_SETTLE_S, polls->deadline(FETCH_TABLE)); // late table update
+
+    whistle = 1101;                                                             // final whistle, no request for the matchday
+    ran     = runCycle(goal + POLL_GOALS_S);
+    TEST_ASSERT_TRUE(ran.find(scopes({FETCH_LIVE_GOALS, CALC_LIVE_MATCHES})) == 0);
+    TEST_ASSERT_TRUE(ran.find(scopes({FETCH_TABLE})) != std::string::npos);     // final result in the table
+    TEST_ASSERT_EQUAL(0, ligaLiveMatchCount);
+    TEST_ASSERT_EQUAL(POLL_NEVER, polls->deadline(FETCH_LIVE_GOALS));
+    TEST_ASSERT_EQUAL(T + POLL_IDLE_S, polls->deadline(FETCH_CURRENT_MATCHDAY)); // matchday over
+    TEST_ASSERT_EQUAL_UINT32(1, polls->runs(FETCH_MATCHES));
+}
+
+// refused connection: nothing runs before the back-off ends
+void test_backoff() {
+    runCycle(T);
+    ligaConnectionRefused = true;
+    polls->beginCycle();
+    polls->done(CHECK_FOR_CHANGES, T + 10);
+    TEST_ASSERT_EQUAL(POLL_MODE_NONE, polls->mode(T + 10));
+    for (uint8_t s = 0; s < POLL_SCOPE_COUNT; ++s)
+        TEST_ASSERT_TRUE(polls->deadline((PollScope)s) >= T + 10 + POLL_BACKOFF_S);
+    const std::string early = runCycle(T + 20);
+    TEST_ASSERT_EQUAL_STRING("", early.c_str());
+    const std::string ran      = runCycle(T + 10 + POLL_BACKOFF_S);
+    const std::string expected = scopes({CHECK_FOR_CHANGES, FETCH_TABLE, CALC_LEADER_CHANGE, CALC_RELEGATION_GHOST_CHANGE, CALC_RED_LANTERN_CHANGE});
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), ran.c_str());
+}
+
+// many events and runs in random order: the heap top stays the earliest deadline
+void test_heap_order() {
+    uint32_t random = 0x2545F491;
+    time_t   now    = T;
+    for (int step = 0; step < 2000; ++step) {
+        random ^= random << 13;
+        random ^= random >> 17;
+        random ^= random << 5;
+        now += random % 90;
+        ligaLiveMatchCount = (random >> 8) % 3 == 0;
+        lastGoalID += (random >> 12) % 4 == 0;
+        currentMatchdayChanged = (random >> 16) % 5 == 0;
+        if ((random >> 20) % 50 == 0)
+            served = {{1101, now + (random >> 24) * 60, false}, {1102, now + (random >> 26) * 60, (random & 1) != 0}};
+        whistle = (random >> 28) % 3 == 0 ? 1101 : 0;
+        const PollScope scope = (PollScope)((random >> 4) % POLL_SCOPE_COUNT);
+        polls->beginCycle();
+        runScope(scope, now);
+        polls->done(scope, now);
+        TEST_ASSERT_TRUE(topIsEarliest());
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_bootstrap_cycle);
+    RUN_TEST(test_kickoff_schedule);
+    RUN_TEST(test_live_goals);
+    RUN_TEST(test_backoff);
+    RUN_TEST(test_heap_order);
+    return UNITY_END();
+}
@@ -0,0 +1,115 @@
+// ReadyScheduler (ReadyScheduler.h): timer wheel rounds, BUSY re-probes, timeout and full wheel.
+// No readyPollTask runs, so the waiting caller drives the wheel like during setup()
+//
+//   pio test -e native -f test_ready_scheduler
+#include <Arduino.h>
+#include <unity.h>
+#include "VirtualFlap.h"
+#include "SlaveTwin.h"
+#include "ReadyScheduler.h"
+#include "i2cMaster.h"
+
+#define SPR 4096                                                                // steps per revolution
+#define MSPR 400                                                                // ms per revolution
+
+static VirtualFlapFleet*  fleet  = nullptr;
+static VirtualFlapModule* module = nullptr;
+static SlaveTwin*         twin   = nullptr;
+static ReadyScheduler*    wheel  = nullptr;
+
+static void move(uint16_t steps) {                                              // MOVE straight to the module
+    uint8_t           msg[3] = {MOVE, (uint8_t)(steps & 0xFF), (uint8_t)(steps >> 8)};
+    NativeI2cTransfer t;
+    t.write    = msg;
+    t.writeLen = sizeof(msg);
+    I2Caddress moved;
+    module->transfer(t, moved);
+}
+
+void setUp() {
+    if (traceSemaphore == nullptr) {
+        traceSemaphore = xSemaphoreCreateMutex();                               // what setup() provides
+        i2csetup();
+    }
+    VirtualFlapConfig c;
+    c.stepsPerRev = SPR;
+    c.msPerRev    = MSPR;
+    c.speedJitter = 0;                                                          // exact motion times
+    fleet         = new VirtualFlapFleet();
+    module        = fleet->addModule(0x20, c);
+    twin          = new SlaveTwin(0x20);
+    wheel         = new ReadyScheduler();
+}
+
+void tearDown() {
+    delete wheel;
+    delete twin;
+    delete fleet;
+}
+
+// a first poll beyond one wheel revolution waits extra rounds and is probed on time
+void test_long_eta_waits_rounds() {
+    const uint32_t first = READY_WHEEL_SLOTS * READY_WHEEL_TICK_MS + 220;       // 1.5 revolutions
+    ReadyTicket    ticket;
+    const uint32_t start = millis();
+    TEST_ASSERT_TRUE(wheel->book(twin, ticket, first, first + 1000));
+    TEST_ASSERT_TRUE(wheel->await(ticket));
+    const uint32_t elapsed = millis() - start;
+    TEST_ASSERT_GREATER_OR_EQUAL(first, elapsed);
+    TEST_ASSERT_LESS_THAN(first + 3 * READY_WHEEL_TICK_MS, elapsed);
+    TEST_ASSERT_EQUAL_UINT16(1, ticket.polls);
+    TEST_ASSERT_EQUAL_UINT32(1, wheel->probes());
+    TEST_ASSERT_LESS_THAN(2 * READY_WHEEL_TICK_MS, wheel->maxLateMs());
+}
+
+// BUSY answers are probed again every READY_POLL_MS inside the window until READY
+void test_busy_probed_again() {
+    move(SPR);                                                                  // busy for MSPR
+    ReadyTicket    ticket;
+    const uint32_t start = millis();
+    TEST_ASSERT_TRUE(wheel->book(twin, ticket, READY_POLL_MS, 2000));
+    TEST_ASSERT_TRUE(wheel->await(ticket));
+    const uint32_t elapsed = millis() - start;
+    TEST_ASSERT_GREATER_OR_EQUAL(MSPR, elapsed);
+    TEST_ASSERT_LESS_THAN(MSPR + READY_POLL_MS + 2 * READY_WHEEL_TICK_MS, elapsed);
+    TEST_ASSERT_GREATER_OR_EQUAL(MSPR / READY_POLL_MS, ticket.polls);
+    TEST_ASSERT_EQUAL_UINT32(1, wheel->readyCount());
+}
+
+// a slave still BUSY gets its last probe exactly at the deadline
+void test_timeout_probe_at_deadline() {
+    move(4 * SPR);                                                              // busy for 4 * MSPR
+    ReadyTicket    ticket;
+    const uint32_t timeout = 3 * READY_POLL_MS + 50;
+    const uint32_t start   = millis();
+    TEST_ASSERT_TRUE(wheel->book(twin, ticket, READY_POLL_MS, timeout));
+    TEST_ASSERT_FALSE(wheel->await(ticket));
+    const uint32_t elapsed = millis() - start;
+    TEST_ASSERT_GREATER_OR_EQUAL(timeout, elapsed);
+    TEST_ASSERT_LESS_THAN(timeout + 2 * READY_WHEEL_TICK_MS, elapsed);
+    TEST_ASSERT_EQUAL_UINT16(4, ticket.polls);                                  // 100, 200, 300 and the deadline
+    TEST_ASSERT_EQUAL_UINT32(1, wheel->timeouts());
+}
+
+// a full wheel refuses the booking, the twin then polls on its own
+void test_full_wheel_refuses() {
+    static ReadyTicket tickets[READY_WHEEL_ENTRIES];
+    for (int i = 0; i < READY_WHEEL_ENTRIES; ++i)
+        TEST_ASSERT_TRUE(wheel->book(twin, tickets[i], 20 + i, 500));
+    ReadyTicket spare;
+    TEST_ASSERT_FALSE(wheel->book(twin, spare, 20, 500));
+    for (int i = 0; i < READY_WHEEL_ENTRIES; ++i)
+        TEST_ASSERT_TRUE(wheel->await(tickets[i]));
+    TEST_ASSERT_EQUAL_UINT32(READY_WHEEL_ENTRIES, wheel->readyCount());
+    TEST_ASSERT_TRUE(wheel->book(twin, spare, 20, 500));                        // entries are free again
+    TEST_ASSERT_TRUE(wheel->await(spare));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_long_eta_waits_rounds);
+    RUN_TEST(test_busy_probed_again);
+    RUN_TEST(test_timeout_probe_at_deadline);
+    RUN_TEST(test_full_wheel_refuses);
+    return UNITY_END();
+}
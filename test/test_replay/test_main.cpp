@@ -0,0 +1,91 @@
+// Replay support of the native build: recording format of LigaRecorder.h (nativeReadRecording) and
+// the virtual clock that jumps over poll delays
+//
+//   pio test -e native -f test_replay
+#include <Arduino.h>
+#include <unity.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "NativeShim.h"
+#include "NativeReplay.h"
+#include "freertos/task.h"
+
+#define EPOCH 1758979800                                                        // Sa 27.09.2025 15:30 CEST
+
+static char path[] = "/tmp/flaprecXXXXXX";
+
+static void writeRecording(const std::string& content) {
+    const int fd = mkstemp(path);
+    TEST_ASSERT_TRUE(fd >= 0);
+    TEST_ASSERT_EQUAL(content.size(), (size_t)write(fd, content.data(), content.size()));
+    close(fd);
+}
+
+void setUp() {}
+
+void tearDown() {
+    unlink(path);
+    strcpy(path, "/tmp/flaprecXXXXXX");
+}
+
+// chunks of one block are joined, blocks are returned in file order
+void test_read_blocks() {
+    writeRecording(
+        "@1758979800 200 https://api.openligadb.de/getcurrentgroup/bl1\n+5\n{\"gro+13\nupOrderID\":5}.\n"
+        "@1758979860 200 https://api.openligadb.de/getmatchdata/1101\n+2\n[]"
+        ".\n");
+    std::vector<NativeRecordedResponse> responses;
+    TEST_ASSERT_EQUAL(2, nativeReadRecording(path, responses));
+    TEST_ASSERT_EQUAL_STRING("https://api.openligadb.de/getcurrentgroup/bl1", responses[0].url.c_str());
+    TEST_ASSERT_EQUAL(EPOCH, (long)responses[0].at);
+    TEST_ASSERT_EQUAL(200, responses[0].status);
+    TEST_ASSERT_EQUAL_STRING("{\"groupOrderID\":5}", responses[0].body.c_str());
+    TEST_ASSERT_EQUAL(EPOCH + 60, (long)responses[1].at);
+    TEST_ASSERT_EQUAL_STRING("[]", responses[1].body.c_str());
+}
+
+// a block without end line (reset, transport error) and a 304 are skipped, the next block is read
+void test_skip_aborted_and_304() {
+    writeRecording(
+        "@1758979800 200 https://api.openligadb.de/getbltable/bl1/2025\n+3\n[{\"\n"                     // aborted
+        "@1758979830 304 https://api.openligadb.de/getbltable/bl1/2025\n.\n"
+        "@1758979860 200 https://api.openligadb.de/getbltable/bl1/2025\n+2\n[].\n"
+        "@1758979890 200 https://api.openligadb.de/getbltable/bl1/2025\n+2\n[]");                       // cut file
+    std::vector<NativeRecordedResponse> responses;
+    TEST_ASSERT_EQUAL(1, nativeReadRecording(path, responses));
+    TEST_ASSERT_EQUAL(EPOCH + 60, (long)responses[0].at);
+    TEST_ASSERT_EQUAL_STRING("[]", responses[0].body.c_str());
+}
+
+// the virtual clock starts at the epoch, delays move it without host time
+void test_virtual_clock() {
+    TEST_ASSERT_FALSE(nativeClockIsVirtual());
+    nativeClockStartVirtual(EPOCH);
+    TEST_ASSERT_TRUE(nativeClockIsVirtual());
+    TEST_ASSERT_EQUAL(EPOCH, (long)time(nullptr));
+
+    uint32_t       observed = 0;
+    const uint32_t ms       = millis();
+    nativeClockSetObserver([&] { observed++; });
+    const auto host = std::chrono::steady_clock::now();
+    vTaskDelay(pdMS_TO_TICKS(30 * 60 * 1000));                                  // poll delay far from kickoff
+    delay(500);
+    const double hostMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - host).count();
+    nativeClockSetObserver(nullptr);
+
+    TEST_ASSERT_EQUAL(EPOCH + 30 * 60, (long)time(nullptr));
+    TEST_ASSERT_EQUAL(30 * 60 * 1000 + 500, millis() - ms);
+    TEST_ASSERT_EQUAL(2, observed);                                             // before every jump
+    TEST_ASSERT_TRUE(hostMs < 100);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_read_blocks);
+    RUN_TEST(test_skip_aborted_and_304);
+    RUN_TEST(test_virtual_clock);
+    return UNITY_END();
+}
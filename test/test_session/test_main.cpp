@@ -0,0 +1,105 @@
+// LigaSession (LigaSession.h): one TLS handshake per poll cycle against the fake server of NativeShim.h
+//
+//   pio test -e native -f test_session
+#include <Arduino.h>
+#include <unity.h>
+#include <FlapGlobal.h>
+#include "NativeShim.h"
+#include "LigaSession.h"
+
+#define HANDSHAKE_MS 40                                                         // TCP + TLS to api.openligadb.de
+#define REQUEST_MS 20
+#define IDLE_TIMEOUT_MS 5000                                                    // server closes idle keep-alive connections
+
+static const char* cycle[] = {                                                  // requests of one live poll cycle
+    "https://api.openligadb.de/getlastchangedate/bl1/2025/5",
+    "https://api.openligadb.de/getmatchdata/bl1/2025/5",
+    "https://api.openligadb.de/getmatchdata/1101",
+    "https://api.openligadb.de/getmatchdata/1102",
+    "https://api.openligadb.de/getbltable/bl1/2025",
+};
+#define CYCLE_POLLS (sizeof(cycle) / sizeof(cycle[0]))
+
+static LigaSession* session  = nullptr;
+static int          finished = 0;                                               // bodies the handler received
+
+static esp_err_t handler(esp_http_client_event_t* evt) {
+    if (evt->event_id == HTTP_EVENT_ON_FINISH)
+        finished++;
+    return ESP_OK;
+}
+
+static void pollCycle() {
+    for (size_t i = 0; i < CYCLE_POLLS; ++i)
+        TEST_ASSERT_EQUAL(ESP_OK, session->get(cycle[i], handler));
+}
+
+void setUp() {
+    if (!nativeClockIsVirtual())
+        nativeClockStartVirtual(1758979800);                                    // latency and idle time take no host time
+    if (traceSemaphore == nullptr)
+        traceSemaphore = xSemaphoreCreateMutex();                               // what setup() provides
+    nativeHttpSetResponder([](const std::string&, std::string& body) {
+        body = "[]";
+        return 200;
+    });
+    NativeHttpServerModel model;
+    model.handshakeMs   = HANDSHAKE_MS;
+    model.requestMs     = REQUEST_MS;
+    model.idleTimeoutMs = IDLE_TIMEOUT_MS;
+    nativeHttpSetServerModel(model);
+    nativeHttpResetStats();
+    session  = new LigaSession("api.openligadb.de");
+    finished = 0;
+}
+
+void tearDown() {
+    session->reset();
+    delete session;
+    session = nullptr;
+}
+
+// all polls of a cycle share one connection
+void test_poll_cycle_one_handshake() {
+    pollCycle();
+    const NativeHttpStats stats = nativeHttpStats();
+    TEST_ASSERT_EQUAL_UINT32(CYCLE_POLLS, stats.requests);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.handshakes);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.dropped);
+    TEST_ASSERT_EQUAL_UINT32(1, session->handshakes());
+    TEST_ASSERT_EQUAL(CYCLE_POLLS, finished);
+}
+
+// cycles closer than the idle timeout keep the connection
+void test_cycles_within_idle_timeout() {
+    for (int c = 0; c < 3; ++c) {
+        pollCycle();
+        vTaskDelay(pdMS_TO_TICKS(IDLE_TIMEOUT_MS / 2));
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, nativeHttpStats().handshakes);
+}
+
+// server closed the idle connection: the request is repeated once on a new one, no error
+void test_idle_close_reconnects() {
+    pollCycle();
+    vTaskDelay(pdMS_TO_TICKS(IDLE_TIMEOUT_MS + 1000));
+    TEST_ASSERT_EQUAL(ESP_OK, session->get(cycle[0], handler));
+    const NativeHttpStats stats = nativeHttpStats();
+    TEST_ASSERT_EQUAL_UINT32(2, stats.handshakes);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.dropped);
+    TEST_ASSERT_EQUAL_UINT32(CYCLE_POLLS + 1, stats.requests);
+    TEST_ASSERT_EQUAL_UINT32(2, session->handshakes());
+    TEST_ASSERT_EQUAL_UINT32(0, session->errors());
+    TEST_ASSERT_EQUAL(CYCLE_POLLS + 1, finished);                               // dropped request reached no handler
+
+    pollCycle();                                                                // new connection is kept again
+    TEST_ASSERT_EQUAL_UINT32(2, nativeHttpStats().handshakes);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_poll_cycle_one_handshake);
+    RUN_TEST(test_cycles_within_idle_timeout);
+    RUN_TEST(test_idle_close_reconnects);
+    return UNITY_END();
+}
@@ -0,0 +1,109 @@
+// Lock-free I2C statistics (FlapStatistics.h): per-core counter shards and latency slots under
+// concurrent writers, no access may get lost
+//
+//   pio test -e native -f test_stat_shards
+#include <Arduino.h>
+#include <unity.h>
+#include <FlapGlobal.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "FlapStatistics.h"
+
+#define WRITERS 8
+#define ACCESSES 20000                                                          // per writer
+
+void setUp() {}
+void tearDown() {}
+
+// writers count while makeHistory() takes and resets the shards: the cycles add up to every access
+void test_no_access_lost() {
+    FlapStatistics           stats;
+    std::atomic<int>         running{WRITERS};
+    std::vector<std::thread> writers;
+    for (int w = 0; w < WRITERS; ++w)
+        writers.emplace_back([&] {
+            for (int i = 0; i < ACCESSES; ++i)
+                stats.increment(1, 3, 2, (i % 100) == 0);                       // like i2cShortCommand
+            running--;
+        });
+
+    uint64_t access = 0, sent = 0, read = 0, timeouts = 0;
+    bool     last   = false;
+    while (!last) {
+        last = running.load() == 0;                                             // one more cycle after the writers ended
+        const uint8_t cycle = stats._historyIndex;
+        stats.makeHistory();
+        access += stats._accessHistory[cycle];
+        sent += stats._dataHistory[cycle];
+        read += stats._readHistory[cycle];
+        timeouts += stats._timeoutHistory[cycle];
+    }
+    for (std::thread& t : writers)
+        t.join();
+    TEST_ASSERT_EQUAL_UINT64((uint64_t)WRITERS * ACCESSES, access);
+    TEST_ASSERT_EQUAL_UINT64((uint64_t)WRITERS * ACCESSES * 3, sent);
+    TEST_ASSERT_EQUAL_UINT64((uint64_t)WRITERS * ACCESSES * 2, read);
+    TEST_ASSERT_EQUAL_UINT64((uint64_t)WRITERS * (ACCESSES / 100), timeouts);
+}
+
+// updateCurrentCycle() shows the running cycle without resetting it, makeHistory() starts the next one
+void test_current_cycle() {
+    FlapStatistics stats;
+    stats.makeHistory();                                                        // cycle with own index
+    const uint8_t cycle = stats._historyIndex;
+    stats.increment(5, 10, 0, 0);
+    stats.updateCurrentCycle();
+    TEST_ASSERT_EQUAL_UINT32(5, stats._accessHistory[cycle]);
+    stats.increment(1, 0, 0, 0);
+    stats.makeHistory();
+    TEST_ASSERT_EQUAL_UINT32(6, stats._accessHistory[cycle]);
+    TEST_ASSERT_EQUAL_UINT32(10, stats._dataHistory[cycle]);
+    TEST_ASSERT_EQUAL_UINT32(0, stats._accessHistory[stats._historyIndex]);
+}
+
+// addresses that appear at the same time on several tasks claim exactly one slot each
+void test_latency_slots_claimed_once() {
+    FlapStatistics           stats;
+    std::vector<std::thread> writers;
+    for (int w = 0; w < WRITERS; ++w)
+        writers.emplace_back([&stats, w] {
+            for (int i = 0; i < 1000; ++i)
+                stats.recordLatency(I2Caddress(0x20 + (i + w) % 4), LAT_PROBE, 150 + i);
+        });
+    for (std::thread& t : writers)
+        t.join();
+
+    LatencyHistogram byType[LAT_TYPES];
+    I2Caddress       seen[4] = {0, 0, 0, 0};
+    for (int slot = 0; slot < 4; ++slot) {
+        I2Caddress address = 0;
+        TEST_ASSERT_TRUE(stats.latencyBySlot(slot, address, byType));
+        TEST_ASSERT_EQUAL_UINT32(WRITERS * 1000 / 4, byType[LAT_PROBE].count);
+        seen[address - 0x20] = address;
+    }
+    I2Caddress unused = 0;
+    TEST_ASSERT_FALSE(stats.latencyBySlot(4, unused, byType));                  // no duplicate slot
+    for (int a = 0; a < 4; ++a)
+        TEST_ASSERT_EQUAL_HEX8(0x20 + a, seen[a]);
+    stats.latencyByType(byType);
+    TEST_ASSERT_EQUAL_UINT32(WRITERS * 1000, byType[LAT_PROBE].count);
+    TEST_ASSERT_EQUAL_UINT32(150 + 999, byType[LAT_PROBE].maxUs);
+}
+
+// every shard fills its own cache line, so the two cores never write to the same line
+void test_shard_per_cache_line() {
+    TEST_ASSERT_EQUAL(64, alignof(StatShard));
+    TEST_ASSERT_EQUAL(64, sizeof(StatShard));
+    StatShard shards[2];
+    TEST_ASSERT_EQUAL(64, (uintptr_t)&shards[1] - (uintptr_t)&shards[0]);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_no_access_lost);
+    RUN_TEST(test_current_cycle);
+    RUN_TEST(test_latency_slots_claimed_once);
+    RUN_TEST(test_shard_per_cache_line);
+    return UNITY_END();
+}
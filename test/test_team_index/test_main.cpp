@@ -0,0 +1,66 @@
+// TeamIndex (TeamIndex.h): compile-time perfect hash of the DFB team names against the linear scan
+//
+//   pio test -e native -f test_team_index
+#include <Arduino.h>
+#include <unity.h>
+#include <FlapGlobal.h>
+#include "Liga.h"
+#include "TeamIndex.h"
+
+#define DFB1_TEAMS (int)(sizeof(DFB1) / sizeof(DFB1[0]))
+#define DFB2_TEAMS (int)(sizeof(DFB2) / sizeof(DFB2[0]))
+
+// dense index by scanning DFB1, DFB2 and DFB3 in this order, what the hash replaces
+static int scanIndexOf(const char* teamName) {
+    const DfbMap* leagues[] = {DFB1, DFB2, DFB3};
+    const int     counts[]  = {DFB1_TEAMS, DFB2_TEAMS, TEAM_COUNT - DFB1_TEAMS - DFB2_TEAMS};
+    int           index     = 0;
+    for (int l = 0; l < 3; ++l)
+        for (int t = 0; t < counts[l]; ++t, ++index)
+            if (strcmp(leagues[l][t].key, teamName) == 0)
+                return index;
+    return TEAM_NONE;
+}
+
+void setUp() {}
+void tearDown() {}
+
+// every team name of the three leagues finds its own entry
+void test_all_names() {
+    for (int i = 0; i < TEAM_COUNT; ++i) {
+        const DfbMap& team = teamEntry(i);
+        TEST_ASSERT_EQUAL(i, teamIndexOf(team.key));
+        TEST_ASSERT_EQUAL(scanIndexOf(team.key), i);
+    }
+    TEST_ASSERT_EQUAL_STRING("BVB", teamEntry(teamIndexOf("Borussia Dortmund")).code);
+    TEST_ASSERT_EQUAL_STRING("BSC", teamEntry(DFB1_TEAMS).code);                // first team of DFB2
+    TEST_ASSERT_EQUAL_STRING(DFB3[0].code, teamEntry(DFB1_TEAMS + DFB2_TEAMS).code);
+}
+
+// unknown names, near misses and empty input are rejected by the strcmp behind the slot
+void test_unknown_names() {
+    TEST_ASSERT_EQUAL(TEAM_NONE, teamIndexOf(nullptr));
+    TEST_ASSERT_EQUAL(TEAM_NONE, teamIndexOf(""));
+    TEST_ASSERT_EQUAL(TEAM_NONE, teamIndexOf("FC Bayern Munchen"));             // transliterated
+    TEST_ASSERT_EQUAL(TEAM_NONE, teamIndexOf("Borussia Dortmund "));
+    TEST_ASSERT_EQUAL(TEAM_NONE, teamIndexOf("borussia dortmund"));
+    TEST_ASSERT_EQUAL(TEAM_NONE, teamIndexOf("Real Madrid"));
+}
+
+// the strict lookups of Liga keep their results
+void test_strict_lookups() {
+    TEST_ASSERT_EQUAL_STRING("FCB", dfbCodeForTeamStrict("FC Bayern München").c_str());
+    TEST_ASSERT_EQUAL(1, flapForTeamStrict("FC Bayern München"));
+    TEST_ASSERT_EQUAL(19, flapForTeamStrict("Hertha BSC"));
+    TEST_ASSERT_EQUAL(-1, flapForTeamStrict(DFB3[0].key));                      // 3. Liga has no flap
+    TEST_ASSERT_EQUAL_STRING("", dfbCodeForTeamStrict("Real Madrid").c_str());
+    TEST_ASSERT_EQUAL(-1, flapForTeamStrict("Real Madrid"));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_all_names);
+    RUN_TEST(test_unknown_names);
+    RUN_TEST(test_strict_lookups);
+    return UNITY_END();
+}
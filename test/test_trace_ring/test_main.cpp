@@ -0,0 +1,144 @@
+// Asynchronous trace (TracePrint.h): deferred formatting prints the same text as the synchronous
+// path, a full ring drops instead of blocking, concurrent producers lose no count
+//
+//   pio test -e native -f test_trace_ring
+#include <Arduino.h>
+#include <unity.h>
+#include <FlapGlobal.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "TracePrint.h"
+
+// everything the calls write to Serial (stdout)
+static std::string serialOf(const std::function<void()>& calls) {
+    fflush(stdout);
+    FILE*     capture = tmpfile();
+    const int saved   = dup(STDOUT_FILENO);
+    dup2(fileno(capture), STDOUT_FILENO);
+    calls();
+    fflush(stdout);
+    dup2(saved, STDOUT_FILENO);
+    close(saved);
+
+    std::string text;
+    char        buf[512];
+    rewind(capture);
+    for (size_t n; (n = fread(buf, 1, sizeof(buf), capture)) > 0;)
+        text.append(buf, n);
+    fclose(capture);
+    return text;
+}
+
+static void sampleLines() {
+    int         counter = 42;
+    float       temp    = 23.5f;
+    long        big     = 123456789L;
+    const char* msg     = "Hello, World!";
+    char        prefix[24];
+    snprintf(prefix, sizeof(prefix), "[TWIN 0x%02X] ", 0x21);                   // like twinPrint: prefix on the stack
+    tracePrint("DBG: ", counter, ", flag=", true);                              // Serial.print of each argument
+    tracePrintln("", " c=%c, big=%ld, tmp=%.2f", 'X', big, temp);               // second string is a printf format
+    tracePrintln("CHR: ", 'X', " big=", big, " tmp=", temp);
+    tracePrintf("FMT: ", "counter=%d, temp=%.1f, hex=0x%X, s='%s'\r\n", counter, temp, counter, msg);
+    tracePrintf("W: ", "[%*d|%-6s|%05.2f|%lu]\r\n", 5, -counter, "ab", temp, (unsigned long)big);
+    tracePrintln(prefix, String("String ") + counter, ' ', -7);
+}
+
+static const char* sampleText = "DBG: 42, flag=1 c=X, big=123456789, tmp=23.50\r\n"
+                                "CHR: X big=123456789 tmp=23.50\r\n"
+                                "FMT: counter=42, temp=23.5, hex=0x2A, s='Hello, World!'\r\n"
+                                "W: [  -42|ab    |23.50|123456789]\r\n"
+                                "[TWIN 0x21] String 42 -7\r\n";
+
+void setUp() {
+    if (traceSemaphore == nullptr)
+        traceSemaphore = xSemaphoreCreateMutex();                               // what setup() provides
+}
+void tearDown() {}
+
+// until TraceLog runs every line is written at once
+void test_sync_before_start() {
+    const std::string text = serialOf(sampleLines);
+    TEST_ASSERT_EQUAL_STRING(sampleText, text.c_str());
+}
+
+// after traceStart() lines wait in the ring, traceDrain() prints the same text
+void test_ring_same_text() {
+    traceStart();
+    const uint32_t written = traceWritten();
+    TEST_ASSERT_EQUAL(0, serialOf(sampleLines).size());                         // nothing printed yet
+    const std::string text = serialOf([] { TEST_ASSERT_EQUAL_UINT32(6, traceDrain()); });
+    TEST_ASSERT_EQUAL_STRING(sampleText, text.c_str());
+    TEST_ASSERT_EQUAL_UINT32(written + 6, traceWritten());
+}
+
+// a full ring drops lines and counts them, TraceLog reports the drops once
+void test_full_ring_drops() {
+    const uint32_t dropped = traceDropped();
+    for (int i = 0; i < TRACE_RING_SLOTS + 3; ++i)
+        tracePrintln("FULL: ", i);
+    TEST_ASSERT_EQUAL_UINT32(dropped + 3, traceDropped());
+    const std::string text = serialOf([] { TEST_ASSERT_EQUAL_UINT32(TRACE_RING_SLOTS, traceDrain()); });
+    TEST_ASSERT_TRUE(text.find("FULL: 0\r\n") == 0);
+    TEST_ASSERT_TRUE(text.find("ring full, lines dropped: 3\r\n") != std::string::npos);
+    TEST_ASSERT_EQUAL(0, serialOf([] { traceDrain(); }).size());                // drops are reported once
+}
+
+// a full answer dump and a steps line fill their TRACE_TEXT_BYTES text and come back uncut
+void test_long_answer_not_cut() {
+    char   answer[TRACE_TEXT_BYTES];                                            // like formatAnswer of SlaveTwin
+    size_t used = 0;
+    for (int i = 0; i < 8; i++)
+        used += snprintf(answer + used, sizeof(answer) - used, " [%d] = 0x%X", i, 0xA0 + i);
+    TEST_ASSERT_EQUAL(88, used);
+    char steps[TRACE_TEXT_BYTES];                                               // like printStepsByFlapLines
+    used = 0;
+    for (int i = 0; i < 10; ++i)
+        used += snprintf(steps + used, sizeof(steps) - used, i ? ", %d" : "%d", 4090 + i);
+    char prefix[20];
+    snprintf(prefix, sizeof(prefix), "[I2C TWIN 0x%02X  ] ", 0x55);             // like twinPrint
+
+    tracePrintln(prefix, "Got answer for shortCommand from slave:%s", answer);
+    tracePrintln("[FLAP - REGISTER] ", "device 0x%02X Steps by Flap: %s", 0x55, steps);
+    const std::string text     = serialOf([] { TEST_ASSERT_EQUAL_UINT32(2, traceDrain()); });
+    const std::string expected = std::string(prefix) + "Got answer for shortCommand from slave:" + answer + "\r\n" +
+                                 "[FLAP - REGISTER] device 0x55 Steps by Flap: " + steps + "\r\n";
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), text.c_str());
+    TEST_ASSERT_TRUE(text.find("0xA7\r\n") != std::string::npos);               // last answer byte, no "..."
+}
+
+// several producers against one TraceLog: every line is written or counted as dropped
+void test_concurrent_producers() {
+    const uint32_t           written = traceWritten(), dropped = traceDropped();
+    std::atomic<int>         running{8};
+    std::vector<std::thread> producers;
+    for (int p = 0; p < 8; ++p)
+        producers.emplace_back([&running, p] {
+            for (int i = 0; i < 2000; ++i)
+                tracePrintf("P: ", "%d %d\n", p, i);
+            running--;
+        });
+    serialOf([&running] {
+        while (running.load() > 0)
+            traceDrain();
+        traceDrain();
+    });
+    for (std::thread& t : producers)
+        t.join();
+    TEST_ASSERT_EQUAL_UINT32(8 * 2000, (traceWritten() - written) + (traceDropped() - dropped));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_sync_before_start);
+    RUN_TEST(test_ring_same_text);
+    RUN_TEST(test_full_ring_drops);
+    RUN_TEST(test_long_answer_not_cut);
+    RUN_TEST(test_concurrent_producers);
+    return UNITY_END();
+}
@@ -0,0 +1,88 @@
+// SlaveTwin command queue (SlaveTwin.h): moves keep TWIN_QUEUE_RESERVED slots free, others are never dropped
+//
+//   pio test -e native -f test_twin_queue
+#include <Arduino.h>
+#include <unity.h>
+#include "SlaveTwin.h"
+#include "FlapTasks.h"
+#include "Parser.h"
+
+static SlaveTwin* twin = nullptr;
+
+static bool send(TwinCommands command, int parameter = 0) {
+    return twin->sendQueue(TwinCommand{command, parameter, nullptr});
+}
+
+void setUp() {
+    if (traceSemaphore == nullptr)
+        traceSemaphore = xSemaphoreCreateMutex();                               // what setup() provides
+    if (Parser == nullptr)
+        Parser = new ParserClass();                                             // names of dropped commands (ERRORVERBOSE)
+    twin = new SlaveTwin(0x10);                                                 // no twin task: commands stay queued
+    twin->createQueue();
+}
+
+void tearDown() {
+    delete twin;
+    twin = nullptr;
+}
+
+// manual moves on a busy twin: queue fills up to the reserve, the rest is dropped
+void test_manual_moves_dropped_at_reserve() {
+    int accepted = 0;
+    for (int i = 0; i < 10; ++i)
+        accepted += send(TWIN_NEXT_FLAP);
+    TEST_ASSERT_EQUAL(TWIN_QUEUE_DEPTH - TWIN_QUEUE_RESERVED, accepted);
+    TEST_ASSERT_EQUAL_UINT8(TWIN_QUEUE_DEPTH - TWIN_QUEUE_RESERVED, twin->queueDepth());
+    TEST_ASSERT_EQUAL_UINT32(10 - accepted, twin->queueDropped());
+}
+
+// calibration and availability find the reserved slots behind a full set of moves
+void test_calibration_and_availability_never_dropped() {
+    for (int i = 0; i < 10; ++i)
+        send(TWIN_PREV_STEP);
+    const uint32_t dropped = twin->queueDropped();
+    TEST_ASSERT_TRUE(send(TWIN_CALIBRATION));
+    TEST_ASSERT_TRUE(send(TWIN_AVAILABILITY));
+    TEST_ASSERT_EQUAL_UINT8(TWIN_QUEUE_DEPTH, twin->queueDepth());
+    TEST_ASSERT_EQUAL_UINT32(dropped, twin->queueDropped());
+}
+
+// consecutive show-flap collapse to the last target
+void test_show_flap_coalesced() {
+    TEST_ASSERT_TRUE(send(TWIN_SHOW_FLAP, 3));
+    TEST_ASSERT_TRUE(send(TWIN_SHOW_FLAP, 7));
+    TEST_ASSERT_TRUE(send(TWIN_SHOW_FLAP, 12));
+    TEST_ASSERT_EQUAL_UINT8(1, twin->queueDepth());
+    TEST_ASSERT_EQUAL_UINT32(2, twin->queueCoalesced());
+    TEST_ASSERT_EQUAL_UINT32(0, twin->queueDropped());
+}
+
+// show-flap on a queue without free move slot replaces the oldest show-flap, no wait, no drop
+void test_show_flap_replaces_oldest_when_full() {
+    TEST_ASSERT_TRUE(send(TWIN_SHOW_FLAP, 3));
+    for (int i = 1; i < TWIN_QUEUE_DEPTH - TWIN_QUEUE_RESERVED; ++i)
+        TEST_ASSERT_TRUE(send(TWIN_NEXT_FLAP));
+    TEST_ASSERT_FALSE(send(TWIN_NEXT_FLAP));                                    // only reserved slots left
+    const uint32_t start = millis();
+    TEST_ASSERT_TRUE(send(TWIN_SHOW_FLAP, 9));
+    TEST_ASSERT_LESS_OR_EQUAL(TWIN_QUEUE_SEND_TIMEOUT_MS / 2, millis() - start);
+    TEST_ASSERT_EQUAL_UINT8(TWIN_QUEUE_DEPTH - TWIN_QUEUE_RESERVED, twin->queueDepth());
+    TEST_ASSERT_EQUAL_UINT32(1, twin->queueDropped());
+}
+
+// no queue created: sendQueue() refuses instead of blocking
+void test_send_without_queue() {
+    SlaveTwin lonely(0x11);
+    TEST_ASSERT_FALSE(lonely.sendQueue(TwinCommand{TWIN_CALIBRATION, 0, nullptr}));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_manual_moves_dropped_at_reserve);
+    RUN_TEST(test_calibration_and_availability_never_dropped);
+    RUN_TEST(test_show_flap_coalesced);
+    RUN_TEST(test_show_flap_replaces_oldest_when_full);
+    RUN_TEST(test_send_without_queue);
+    return UNITY_END();
+}
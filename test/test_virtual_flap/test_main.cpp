@@ -0,0 +1,132 @@
+// VirtualFlapModule / VirtualFlapFleet (VirtualFlap.h): stepper timing, busy handling and
+// registration of simulated flap modules
+//
+//   pio test -e native -f test_virtual_flap
+#include <Arduino.h>
+#include <unity.h>
+#include "VirtualFlap.h"
+#include "driver/i2c.h"
+
+#define SPR 4096                                                                // steps per revolution
+#define MSPR 200                                                                // ms per revolution, keeps the test short
+
+static VirtualFlapConfig config() {
+    VirtualFlapConfig c;
+    c.serialnumber = 0x56460101;
+    c.stepsPerRev  = SPR;
+    c.msPerRev     = MSPR;
+    c.speedJitter  = 0;                                                         // exact motion times
+    return c;
+}
+
+static esp_err_t sendLong(VirtualFlapModule& m, uint8_t command, uint16_t param) {
+    uint8_t           msg[3] = {command, (uint8_t)(param & 0xFF), (uint8_t)(param >> 8)};
+    NativeI2cTransfer t;
+    t.write    = msg;
+    t.writeLen = sizeof(msg);
+    I2Caddress moved;
+    return m.transfer(t, moved);
+}
+
+static uint8_t askShort(VirtualFlapModule& m, uint8_t command, uint8_t* answer = nullptr, size_t len = 1) {
+    uint8_t           one = 0xFF;
+    NativeI2cTransfer t;
+    t.write    = &command;
+    t.writeLen = 1;
+    t.read     = answer ? answer : &one;
+    t.readLen  = answer ? len : 1;
+    I2Caddress moved;
+    m.transfer(t, moved);
+    return t.read[0];
+}
+
+void setUp() {}
+void tearDown() {}
+
+// a MOVE keeps the module busy for steps * msPerRev / stepsPerRev and ends at the new position
+void test_move_timing() {
+    VirtualFlapModule m(0x20, config());
+    sendLong(m, CALIBRATE, 0);                                                  // known drum position
+    TEST_ASSERT_TRUE(m.isBusy());
+    delay(MSPR * 2 + 20);
+    TEST_ASSERT_FALSE(m.isBusy());
+    TEST_ASSERT_EQUAL(0, m.position());
+
+    sendLong(m, MOVE, SPR / 2);                                                 // half revolution = MSPR / 2 ms
+    TEST_ASSERT_EQUAL(0, askShort(m, CMD_ARE_YOU_READY));
+    delay(MSPR / 2 - 40);
+    TEST_ASSERT_EQUAL(0, askShort(m, CMD_ARE_YOU_READY));
+    delay(60);
+    TEST_ASSERT_EQUAL(1, askShort(m, CMD_ARE_YOU_READY));
+    TEST_ASSERT_EQUAL(SPR / 2, m.position());
+}
+
+// the slave does not queue: a LongMessage while busy is ignored and counted
+void test_busy_ignores_long() {
+    VirtualFlapModule m(0x20, config());
+    sendLong(m, MOVE, SPR / 4);
+    sendLong(m, MOVE, SPR / 4);
+    TEST_ASSERT_EQUAL(1, m.ignored());
+    delay(MSPR / 4 + 20);
+    TEST_ASSERT_FALSE(m.isBusy());
+}
+
+// a module without working hall sensor reports it after CALIBRATE, GET_STATE carries the task code
+void test_sensor_fault() {
+    VirtualFlapConfig c = config();
+    c.sensorFault       = true;
+    VirtualFlapModule m(0x20, c);
+    sendLong(m, CALIBRATE, 0);
+    delay(MSPR * 2 + 20);
+    uint8_t state[6];
+    askShort(m, CMD_GET_STATE, state, sizeof(state));
+    TEST_ASSERT_EQUAL(1, state[0]);                                             // ready
+    TEST_ASSERT_EQUAL(CALIBRATE, state[1]);                                     // last task
+    TEST_ASSERT_EQUAL(0, state[3]);                                             // sensor not working
+}
+
+// RESET: no ACK while rebooting, boot flag set afterwards
+void test_reset_reboots() {
+    VirtualFlapModule m(0x20, config());
+    askShort(m, CMD_RESET_BOOT);
+    TEST_ASSERT_EQUAL(0, askShort(m, CMD_GET_BOOT_FLAG));
+    sendLong(m, RESET, 0);
+    TEST_ASSERT_EQUAL(ESP_FAIL, sendLong(m, MOVE, 10));
+    delay(VIRTUAL_REBOOT_MS + 20);
+    TEST_ASSERT_EQUAL(1, askShort(m, CMD_GET_BOOT_FLAG));
+}
+
+// a plugged-in module waits at I2C_BASE_ADDRESS until CMD_NEW_ADDRESS moves it on the bus
+void test_fleet_new_address() {
+    VirtualFlapFleet fleet(0);
+    fleet.plugIn(1, config());
+    TEST_ASSERT_EQUAL(0, fleet.size());
+
+    uint8_t          msg[2] = {CMD_NEW_ADDRESS, 0x12};
+    uint8_t          serial[4];
+    i2c_cmd_handle_t link = i2c_cmd_link_create();
+    i2c_master_start(link);
+    i2c_master_write_byte(link, (I2C_BASE_ADDRESS << 1) | I2C_MASTER_WRITE, true);
+    i2c_master_write(link, msg, sizeof(msg), true);
+    i2c_master_start(link);
+    i2c_master_write_byte(link, (I2C_BASE_ADDRESS << 1) | I2C_MASTER_READ, true);
+    i2c_master_read(link, serial, sizeof(serial), I2C_MASTER_LAST_NACK);
+    i2c_master_stop(link);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_master_cmd_begin(I2C_NUM_0, link, pdMS_TO_TICKS(50)));
+    i2c_cmd_link_delete(link);
+
+    TEST_ASSERT_EQUAL(1, fleet.size());
+    TEST_ASSERT_EQUAL_UINT32(0x56460101, serial[0] | serial[1] << 8 | serial[2] << 16 | (uint32_t)serial[3] << 24);
+    TEST_ASSERT_EQUAL(1, fleet.commandCount(CMD_NEW_ADDRESS));
+    nativeI2cDetach(0x12);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_move_timing);
+    RUN_TEST(test_busy_ignores_long);
+    RUN_TEST(test_sensor_fault);
+    RUN_TEST(test_reset_reboots);
+    RUN_TEST(test_fleet_new_address);
+    return UNITY_END();
+}
@@ -0,0 +1,138 @@
+// Web endpoints of flapServerTask (StatusModel.h, ESPAsyncWebServer.h shim): codes, bodies and ETags per uri
+//
+//   pio test -e native -f test_web_dispatch
+#include <Arduino.h>
+#include <unity.h>
+#include <FlapGlobal.h>
+#include <SPIFFS.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <string>
+#include "NativeShim.h"
+#include "FlapFile.h"
+#include "FlapTasks.h"
+#include "RtosTasks.h"
+#include "StatusModel.h"
+#include "freertos/task.h"
+
+static char        root[] = "/tmp/flapwebXXXXXX";
+static const char* status = "{\"report\":\"Task Status\",\"Free heap\":\"123456\"}";
+
+static void writeFile(const char* name, const char* content) {
+    FILE* f = fopen((std::string(root) + name).c_str(), "w");
+    fputs(content, f);
+    fclose(f);
+}
+
+static uint32_t webRequests() {
+    LatencyHistogram web;
+    g_webLatency.copyTo(web);
+    return web.count;
+}
+
+void setUp() {
+    if (traceSemaphore != nullptr)
+        return;
+    traceSemaphore = xSemaphoreCreateMutex();                                   // what setup() provides
+    nativeFsSetRoot(mkdtemp(root));
+    Store = new FlapFile();
+    xTaskCreate(flapServerTask, "flapServerTask", 4096, nullptr, 1, nullptr);
+    int code = 0;
+    for (int i = 0; i < 200 && code != 200; ++i) {                              // endpoints are registered by the task
+        server.dispatch("/", &code);
+        delay(10);
+    }
+}
+
+void tearDown() {
+    unlink((std::string(root) + "/TaskStatus.json").c_str());
+    unlink((std::string(root) + "/PollStatus.json").c_str());
+}
+
+static JsonDocument pollStatus(int polls) {
+    JsonDocument doc;
+    doc["league"] = "bl1";
+    doc["polls"]  = polls;
+    return doc;
+}
+
+// before the first publish: the SPIFFS copy of the last run is served, without one 500
+void test_restore_and_missing() {
+    writeFile("/TaskStatus.json", status);
+    const uint32_t before = webRequests();
+    int            code   = 0;
+
+    String body = server.dispatch("/", &code);
+    TEST_ASSERT_EQUAL(200, code);
+    TEST_ASSERT_TRUE(body.indexOf("<h1>") >= 0);
+
+    body = server.dispatch("/1", &code);
+    TEST_ASSERT_EQUAL(200, code);
+    TEST_ASSERT_TRUE(body.indexOf("\"Free heap\":\"123456\"") >= 0);
+    TEST_ASSERT_EQUAL_UINT32(0, TaskStatusDoc.version());                       // restored, not published
+
+    body = server.dispatch("/2", &code);                                        // no poll status yet
+    TEST_ASSERT_EQUAL(500, code);
+    TEST_ASSERT_EQUAL_STRING("{\"error\":\"Datei nicht gefunden\"}", body.c_str());
+
+    server.dispatch("/unknown", &code);
+    TEST_ASSERT_EQUAL(404, code);
+    TEST_ASSERT_EQUAL_UINT32(before + 3, webRequests());                        // 404 is not timed
+}
+
+// a published status carries an ETag, a matching If-None-Match gets 304 until the next publish
+void test_publish_etag() {
+    JsonDocument first = pollStatus(1);
+    PollStatusDoc.publish(first);
+    WebHeaders headers;
+    int        code = 0;
+    String     body = server.dispatch("/2", &code, WebHeaders(), &headers);
+    TEST_ASSERT_EQUAL(200, code);
+    TEST_ASSERT_EQUAL_STRING("{\"league\":\"bl1\",\"polls\":1}", body.c_str());
+    TEST_ASSERT_EQUAL_STRING("*", headers["Access-Control-Allow-Origin"].c_str());
+    const String etag = headers["ETag"];
+    TEST_ASSERT_EQUAL(10, etag.length());                                       // quoted 8 hex digits
+
+    WebHeaders ifNoneMatch;
+    ifNoneMatch["If-None-Match"] = etag;
+    const uint32_t notModified   = PollStatusDoc.notModified();
+    body                         = server.dispatch("/2", &code, ifNoneMatch);
+    TEST_ASSERT_EQUAL(304, code);
+    TEST_ASSERT_EQUAL(0, body.length());
+    TEST_ASSERT_EQUAL_UINT32(notModified + 1, PollStatusDoc.notModified());
+
+    JsonDocument second = pollStatus(2);
+    PollStatusDoc.publish(second);
+    body = server.dispatch("/2", &code, ifNoneMatch, &headers);
+    TEST_ASSERT_EQUAL(200, code);
+    TEST_ASSERT_EQUAL_STRING("{\"league\":\"bl1\",\"polls\":2}", body.c_str());
+    TEST_ASSERT_FALSE(headers["ETag"] == etag);
+    TEST_ASSERT_EQUAL_UINT32(2, PollStatusDoc.version());
+}
+
+// /status renders the flat task status as text lines without _meta, with its own ETag
+void test_status_page() {
+    JsonDocument doc;
+    doc["_meta"]["file"] = "/TaskStatus.json";
+    doc["report"]        = "Task Status";
+    doc["Free heap"]     = "654321";
+    TaskStatusDoc.publish(doc);
+
+    WebHeaders headers;
+    int        code = 0;
+    String     body = server.dispatch("/status", &code, WebHeaders(), &headers);
+    TEST_ASSERT_EQUAL(200, code);
+    TEST_ASSERT_TRUE(body.indexOf("Task Status\n=======================\n") >= 0);
+    TEST_ASSERT_TRUE(body.indexOf("Free heap                654321\n") >= 0);
+    TEST_ASSERT_TRUE(body.indexOf("_meta") < 0);
+    TEST_ASSERT_TRUE(body.endsWith("</body></html>"));
+    TEST_ASSERT_EQUAL('h', headers["ETag"][9]);                                 // differs from the JSON ETag
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_restore_and_missing);
+    RUN_TEST(test_publish_etag);
+    RUN_TEST(test_status_page);
+    return UNITY_END();
+}